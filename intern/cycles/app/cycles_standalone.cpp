@@ -499,7 +499,16 @@ static void options_parse(int argc, const char **argv)
 
   bool device_available = false;
   if (!devices.empty()) {
-    options.session_params.device = devices.front();
+    if (device_type == DEVICE_NETWORK && devices.size() > 1) {
+      /* Shard the render across all discovered servers. Tiles are pulled on
+       * demand, so faster nodes automatically take a bigger share of the
+       * frame and a slow node only holds back its last tile. */
+      options.session_params.device = Device::get_multi_device(
+          devices, options.session_params.threads, options.session_params.background);
+    }
+    else {
+      options.session_params.device = devices.front();
+    }
     device_available = true;
   }
 
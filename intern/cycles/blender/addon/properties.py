@@ -695,6 +695,11 @@ class CyclesRenderSettings(bpy.types.PropertyGroup):
         default=0,
         min=0, max=16,
     )
+    debug_use_compact_bvh: BoolProperty(
+        name="Use Compact BVH",
+        description="Use compact BVH nodes with quantized bounds, to reduce memory usage in cost of slower render time",
+        default=False,
+    )
     tile_order: EnumProperty(
         name="Tile Order",
         description="Tile order for rendering",
@@ -828,6 +833,7 @@ class CyclesRenderSettings(bpy.types.PropertyGroup):
         scene = context.scene.as_pointer()
         return _cycles.debug_flags_update(scene)
 
+    debug_use_cpu_avx512: BoolProperty(name="AVX512", default=True)
     debug_use_cpu_avx2: BoolProperty(name="AVX2", default=True)
     debug_use_cpu_avx: BoolProperty(name="AVX", default=True)
     debug_use_cpu_sse41: BoolProperty(name="SSE41", default=True)
@@ -226,9 +226,10 @@ Object *BlenderSync::sync_object(BL::Depsgraph &b_depsgraph,
     return NULL;
   }
 
-  /* Use task pool only for non-instances, since sync_dupli_particle accesses
-   * geometry. This restriction should be removed for better performance. */
-  TaskPool *object_geom_task_pool = (is_instance) ? NULL : geom_task_pool;
+  /* Instances can use the task pool as well: particle and object sync below only
+   * depend on state that is set synchronously by #sync_geometry, not on the
+   * deferred geometry data itself. */
+  TaskPool *object_geom_task_pool = geom_task_pool;
 
   /* key to lookup object */
   ObjectKey key(b_parent, persistent_id, b_ob_instance, use_particle_hair);
@@ -320,9 +321,13 @@ Object *BlenderSync::sync_object(BL::Depsgraph &b_depsgraph,
 
   /* object sync
    * transform comparison should not be needed, but duplis don't work perfect
-   * in the depsgraph and may not signal changes, so this is a workaround */
+   * in the depsgraph and may not signal changes, so this is a workaround.
+   *
+   * The geometry sync may still be running in the task pool, so test whether the
+   * geometry was scheduled for sync in this loop instead of reading its modified
+   * flags, which the deferred sync writes concurrently. */
   if (object->is_modified() || object_updated ||
-      (object->get_geometry() && object->get_geometry()->is_modified())) {
+      (geometry && geometry_synced.find(geometry) != geometry_synced.end())) {
     object->name = b_ob.name().c_str();
     object->set_pass_id(b_ob.pass_index());
     object->set_color(get_float3(b_ob.color()));
@@ -38,7 +38,9 @@ bool BlenderSync::sync_dupli_particle(BL::Object &b_ob,
 
   object->set_hide_on_missing_motion(true);
 
-  /* test if we need particle data */
+  /* Test if we need particle data. This only reads the shader attribute requests,
+   * which are stored synchronously by #sync_geometry before the geometry data sync
+   * is deferred to the task pool. */
   if (!object->get_geometry()->need_attribute(scene, ATTR_STD_PARTICLE))
     return false;
 
@@ -55,8 +57,9 @@ bool BlenderSync::sync_dupli_particle(BL::Object &b_ob,
   bool first_use = !particle_system_map.is_used(key);
   bool need_update = particle_system_map.add_or_update(&psys, b_ob, b_instance.object(), key);
 
-  /* no update needed? */
-  if (!need_update && !object->get_geometry()->is_modified() &&
+  /* No update needed? Test #geometry_synced membership rather than the geometry
+   * modified flags, which the deferred geometry sync may be writing concurrently. */
+  if (!need_update && geometry_synced.find(object->get_geometry()) == geometry_synced.end() &&
       !scene->object_manager->need_update())
     return true;
 
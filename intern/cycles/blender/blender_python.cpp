@@ -81,6 +81,7 @@ bool debug_flags_sync_from_scene(BL::Scene b_scene)
   /* Synchronize shared flags. */
   flags.viewport_static_bvh = get_enum(cscene, "debug_bvh_type");
   /* Synchronize CPU flags. */
+  flags.cpu.avx512 = get_boolean(cscene, "debug_use_cpu_avx512");
   flags.cpu.avx2 = get_boolean(cscene, "debug_use_cpu_avx2");
   flags.cpu.avx = get_boolean(cscene, "debug_use_cpu_avx");
   flags.cpu.sse41 = get_boolean(cscene, "debug_use_cpu_sse41");
@@ -19,6 +19,7 @@
 #include "render/curves.h"
 #include "render/film.h"
 #include "render/graph.h"
+#include "render/image.h"
 #include "render/integrator.h"
 #include "render/light.h"
 #include "render/mesh.h"
@@ -242,14 +243,23 @@ void BlenderSync::sync_data(BL::RenderSettings &b_render,
                             int height,
                             void **python_thread_state)
 {
+  BL::ViewLayer b_view_layer = b_depsgraph.view_layer_eval();
+
+  /* A re-render of a persistent scene may come without any depsgraph updates,
+   * while the scene still has to be brought in sync. Objects are filtered per
+   * view layer, and auto-refresh image sequences resolve their file path for
+   * a specific frame during shader sync (see #sync_shaders). */
+  if (view_layer.name != b_view_layer.name() ||
+      scene->image_manager->need_animation_frame_update(b_scene.frame_current())) {
+    has_updates_ = true;
+  }
+
   if (!has_updates_) {
     return;
   }
 
   scoped_timer timer;
 
-  BL::ViewLayer b_view_layer = b_depsgraph.view_layer_eval();
-
   sync_view_layer(b_view_layer);
   sync_integrator();
   sync_film(b_v3d);
@@ -778,6 +788,7 @@ SceneParams BlenderSync::get_scene_params(BL::Scene &b_scene, bool background)
 
   params.use_bvh_spatial_split = RNA_boolean_get(&cscene, "debug_use_spatial_splits");
   params.use_bvh_unaligned_nodes = RNA_boolean_get(&cscene, "debug_use_hair_bvh");
+  params.use_bvh_compact_nodes = RNA_boolean_get(&cscene, "debug_use_compact_bvh");
   params.num_bvh_time_steps = RNA_int_get(&cscene, "debug_bvh_time_steps");
 
   PointerRNA csscene = RNA_pointer_get(&b_scene.ptr, "cycles_curves");
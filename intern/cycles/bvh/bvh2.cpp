@@ -101,7 +101,15 @@ void BVH2::build(Progress &progress, Stats *)
 void BVH2::refit(Progress &progress)
 {
   progress.set_substatus("Packing BVH primitives");
-  pack_primitives();
+  if (params.top_level) {
+    /* For the top level BVH the primitive indices are offset into the global
+     * arrays, so the packed layout cannot be recreated from scratch. Update the
+     * primitive data in place instead. */
+    refit_packed_primitives();
+  }
+  else {
+    pack_primitives();
+  }
 
   if (progress.get_cancel())
     return;
@@ -143,6 +151,9 @@ void BVH2::pack_inner(const BVHStackEntry &e, const BVHStackEntry &e0, const BVH
   if (e0.node->is_unaligned || e1.node->is_unaligned) {
     pack_unaligned_inner(e, e0, e1);
   }
+  else if (params.use_compact_nodes) {
+    pack_compact_inner(e, e0, e1);
+  }
   else {
     pack_aligned_inner(e, e0, e1);
   }
@@ -193,6 +204,88 @@ void BVH2::pack_aligned_node(int idx,
   memcpy(&pack.nodes[idx], data, sizeof(int4) * BVH_NODE_SIZE);
 }
 
+void BVH2::pack_compact_inner(const BVHStackEntry &e,
+                              const BVHStackEntry &e0,
+                              const BVHStackEntry &e1)
+{
+  pack_compact_node(e.idx,
+                    e0.node->bounds,
+                    e1.node->bounds,
+                    e0.encodeIdx(),
+                    e1.encodeIdx(),
+                    e0.node->visibility,
+                    e1.node->visibility);
+}
+
+/* Smallest power of two grid step that still covers the extent with 8 bit
+ * offsets, so that quantization is conservative. Returns the biased exponent
+ * byte, with the corresponding scale factor in scale. */
+static uint bvh_compact_node_scale(float extent, float *scale)
+{
+  int exponent;
+  frexpf(extent / 255.0f, &exponent);
+  exponent = clamp(exponent + 127, 1, 254);
+  *scale = __uint_as_float((uint)exponent << 23);
+  return (uint)exponent;
+}
+
+static uint bvh_compact_node_quantize(float value, float origin, float scale, bool round_up)
+{
+  const float q = (value - origin) / scale;
+  return (uint)clamp(round_up ? ceilf(q) : floorf(q), 0.0f, 255.0f);
+}
+
+void BVH2::pack_compact_node(int idx,
+                             const BoundBox &b0,
+                             const BoundBox &b1,
+                             int c0,
+                             int c1,
+                             uint visibility0,
+                             uint visibility1)
+{
+  assert(idx + BVH_COMPACT_NODE_SIZE <= pack.nodes.size());
+  assert(c0 < 0 || c0 < pack.nodes.size());
+  assert(c1 < 0 || c1 < pack.nodes.size());
+
+  /* Child bounds are stored as 8 bit offsets on a grid relative to the common
+   * origin of both children, so the kernel can decode them with a multiply
+   * and an add, see bvh_compact_node_intersect(). */
+  const float3 origin = min(b0.min, b1.min);
+  const float3 extent = max(b0.max, b1.max) - origin;
+
+  float3 scale;
+  const uint exponent_x = bvh_compact_node_scale(extent.x, &scale.x);
+  const uint exponent_y = bvh_compact_node_scale(extent.y, &scale.y);
+  const uint exponent_z = bvh_compact_node_scale(extent.z, &scale.z);
+
+  uint bounds[12];
+  const BoundBox *children[2] = {&b0, &b1};
+  for (int i = 0; i < 2; i++) {
+    const BoundBox &b = *(children[i]);
+    bounds[i * 6 + 0] = bvh_compact_node_quantize(b.min.x, origin.x, scale.x, false);
+    bounds[i * 6 + 1] = bvh_compact_node_quantize(b.min.y, origin.y, scale.y, false);
+    bounds[i * 6 + 2] = bvh_compact_node_quantize(b.min.z, origin.z, scale.z, false);
+    bounds[i * 6 + 3] = bvh_compact_node_quantize(b.max.x, origin.x, scale.x, true);
+    bounds[i * 6 + 4] = bvh_compact_node_quantize(b.max.y, origin.y, scale.y, true);
+    bounds[i * 6 + 5] = bvh_compact_node_quantize(b.max.z, origin.z, scale.z, true);
+  }
+
+  int4 data[BVH_COMPACT_NODE_SIZE] = {
+      make_int4(
+          visibility0 & ~PATH_RAY_NODE_UNALIGNED, visibility1 & ~PATH_RAY_NODE_UNALIGNED, c0, c1),
+      make_int4(__float_as_int(origin.x),
+                __float_as_int(origin.y),
+                __float_as_int(origin.z),
+                (int)(exponent_x | (exponent_y << 8) | (exponent_z << 16))),
+      make_int4((int)(bounds[0] | (bounds[1] << 8) | (bounds[2] << 16) | (bounds[3] << 24)),
+                (int)(bounds[4] | (bounds[5] << 8) | (bounds[6] << 16) | (bounds[7] << 24)),
+                (int)(bounds[8] | (bounds[9] << 8) | (bounds[10] << 16) | (bounds[11] << 24)),
+                0),
+  };
+
+  memcpy(&pack.nodes[idx], data, sizeof(int4) * BVH_COMPACT_NODE_SIZE);
+}
+
 void BVH2::pack_unaligned_inner(const BVHStackEntry &e,
                                 const BVHStackEntry &e0,
                                 const BVHStackEntry &e1)
@@ -246,14 +339,16 @@ void BVH2::pack_nodes(const BVHNode *root)
   const size_t num_leaf_nodes = root->getSubtreeSize(BVH_STAT_LEAF_COUNT);
   assert(num_leaf_nodes <= num_nodes);
   const size_t num_inner_nodes = num_nodes - num_leaf_nodes;
+  const size_t aligned_node_size = params.use_compact_nodes ? BVH_COMPACT_NODE_SIZE :
+                                                              BVH_NODE_SIZE;
   size_t node_size;
   if (params.use_unaligned_nodes) {
     const size_t num_unaligned_nodes = root->getSubtreeSize(BVH_STAT_UNALIGNED_INNER_COUNT);
     node_size = (num_unaligned_nodes * BVH_UNALIGNED_NODE_SIZE) +
-                (num_inner_nodes - num_unaligned_nodes) * BVH_NODE_SIZE;
+                (num_inner_nodes - num_unaligned_nodes) * aligned_node_size;
   }
   else {
-    node_size = num_inner_nodes * BVH_NODE_SIZE;
+    node_size = num_inner_nodes * aligned_node_size;
   }
   /* Resize arrays */
   pack.nodes.clear();
@@ -276,7 +371,7 @@ void BVH2::pack_nodes(const BVHNode *root)
   }
   else {
     stack.push_back(BVHStackEntry(root, nextNodeIdx));
-    nextNodeIdx += root->has_unaligned() ? BVH_UNALIGNED_NODE_SIZE : BVH_NODE_SIZE;
+    nextNodeIdx += root->has_unaligned() ? BVH_UNALIGNED_NODE_SIZE : aligned_node_size;
   }
 
   while (stack.size()) {
@@ -298,7 +393,7 @@ void BVH2::pack_nodes(const BVHNode *root)
         else {
           idx[i] = nextNodeIdx;
           nextNodeIdx += e.node->get_child(i)->has_unaligned() ? BVH_UNALIGNED_NODE_SIZE :
-                                                                 BVH_NODE_SIZE;
+                                                                 aligned_node_size;
         }
       }
 
@@ -315,8 +410,8 @@ void BVH2::pack_nodes(const BVHNode *root)
 
 void BVH2::refit_nodes()
 {
-  assert(!params.top_level);
-
+  /* NOTE: For the top level BVH this only refits nodes reachable from the root,
+   * so the caller must ensure there are no merged instance BVH nodes. */
   BoundBox bbox = BoundBox::empty;
   uint visibility = 0;
   refit_node(0, (pack.root_index == -1) ? true : false, bbox, visibility);
@@ -342,7 +437,7 @@ void BVH2::refit_node(int idx, bool leaf, BoundBox &bbox, uint &visibility)
     memcpy(&pack.leaf_nodes[idx], leaf_data, sizeof(float4) * BVH_NODE_LEAF_SIZE);
   }
   else {
-    assert(idx + BVH_NODE_SIZE <= pack.nodes.size());
+    assert(idx + BVH_COMPACT_NODE_SIZE <= pack.nodes.size());
 
     const int4 *data = &pack.nodes[idx];
     const bool is_unaligned = (data[0].x & PATH_RAY_NODE_UNALIGNED) != 0;
@@ -360,6 +455,9 @@ void BVH2::refit_node(int idx, bool leaf, BoundBox &bbox, uint &visibility)
       pack_unaligned_node(
           idx, aligned_space, aligned_space, bbox0, bbox1, c0, c1, visibility0, visibility1);
     }
+    else if (params.use_compact_nodes) {
+      pack_compact_node(idx, bbox0, bbox1, c0, c1, visibility0, visibility1);
+    }
     else {
       pack_aligned_node(idx, bbox0, bbox1, c0, c1, visibility0, visibility1);
     }
@@ -437,6 +535,34 @@ void BVH2::refit_primitives(int start, int end, BoundBox &bbox, uint &visibility
   }
 }
 
+void BVH2::refit_packed_primitives()
+{
+  const size_t num_prims = pack.prim_index.size();
+  for (size_t i = 0; i < num_prims; i++) {
+    const int pidx = pack.prim_index[i];
+    if (pidx == -1) {
+      /* Object instance. */
+      continue;
+    }
+
+    const int tob = pack.prim_object[i];
+    Object *ob = objects[tob];
+    pack.prim_visibility[i] = ob->visibility_for_tracing();
+
+    if ((pack.prim_type[i] & PRIMITIVE_ALL_TRIANGLE) != 0) {
+      const Mesh *mesh = static_cast<const Mesh *>(ob->get_geometry());
+      const int prim_offset = (params.top_level) ? mesh->prim_offset : 0;
+      const Mesh::Triangle t = mesh->get_triangle(pidx - prim_offset);
+      const float3 *vpos = &mesh->verts[0];
+      float4 *tri_verts = (float4 *)&pack.prim_tri_verts[pack.prim_tri_index[i]];
+
+      tri_verts[0] = float3_to_float4(vpos[t.v[0]]);
+      tri_verts[1] = float3_to_float4(vpos[t.v[1]]);
+      tri_verts[2] = float3_to_float4(vpos[t.v[2]]);
+    }
+  }
+}
+
 /* Triangles */
 
 void BVH2::pack_triangle(int idx, float4 tri_verts[3])
@@ -669,7 +795,7 @@ void BVH2::pack_instances(size_t nodes_size, size_t leaf_nodes_size)
           nsize_bbox = 0;
         }
         else {
-          nsize = BVH_NODE_SIZE;
+          nsize = params.use_compact_nodes ? BVH_COMPACT_NODE_SIZE : BVH_NODE_SIZE;
           nsize_bbox = 0;
         }
 
@@ -29,6 +29,7 @@ CCL_NAMESPACE_BEGIN
 #define BVH_NODE_SIZE 4
 #define BVH_NODE_LEAF_SIZE 1
 #define BVH_UNALIGNED_NODE_SIZE 7
+#define BVH_COMPACT_NODE_SIZE 3
 
 /* Pack Utility */
 struct BVHStackEntry {
@@ -77,6 +78,17 @@ class BVH2 : public BVH {
                          uint visibility0,
                          uint visibility1);
 
+  void pack_compact_inner(const BVHStackEntry &e,
+                          const BVHStackEntry &e0,
+                          const BVHStackEntry &e1);
+  void pack_compact_node(int idx,
+                         const BoundBox &b0,
+                         const BoundBox &b1,
+                         int c0,
+                         int c1,
+                         uint visibility0,
+                         uint visibility1);
+
   void pack_unaligned_inner(const BVHStackEntry &e,
                             const BVHStackEntry &e0,
                             const BVHStackEntry &e1);
@@ -97,6 +109,9 @@ class BVH2 : public BVH {
   /* Refit range of primitives. */
   void refit_primitives(int start, int end, BoundBox &bbox, uint &visibility);
 
+  /* Update packed primitive data in place, keeping the packed layout. */
+  void refit_packed_primitives();
+
   /* triangles and strands */
   void pack_primitives();
   void pack_triangle(int idx, float4 storage[3]);
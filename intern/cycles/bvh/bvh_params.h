@@ -74,6 +74,14 @@ class BVHParams {
    */
   bool use_unaligned_nodes;
 
+  /* Store inner nodes in the compact layout, with child bounds quantized to
+   * 8 bit offsets relative to the node. Saves node memory and traversal
+   * bandwidth in the cost of a bit of extra decoding math.
+   *
+   * Mutually exclusive with unaligned nodes.
+   */
+  bool use_compact_nodes;
+
   /* Split time range to this number of steps and create leaf node for each
    * of this time steps.
    *
@@ -115,6 +123,7 @@ class BVHParams {
     top_level = false;
     bvh_layout = BVH_LAYOUT_BVH2;
     use_unaligned_nodes = false;
+    use_compact_nodes = false;
 
     num_motion_curve_steps = 0;
     num_motion_triangle_steps = 0;
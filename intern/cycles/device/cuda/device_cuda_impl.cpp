@@ -736,9 +736,10 @@ void CUDADevice::move_textures_to_host(size_t size, bool for_texture)
 
   while (size > 0) {
     /* Find suitable memory allocation to move. */
-    device_memory *max_mem = NULL;
-    size_t max_size = 0;
-    bool max_is_image = false;
+    device_memory *best_mem = NULL;
+    size_t best_size = 0;
+    bool best_is_image = false;
+    bool best_covers_size = false;
 
     thread_scoped_lock lock(cuda_mem_map_mutex);
     foreach (CUDAMemMap::value_type &pair, cuda_mem_map) {
@@ -765,11 +766,30 @@ void CUDADevice::move_textures_to_host(size_t size, bool for_texture)
         continue;
       }
 
-      /* Try to move largest allocation, prefer moving images. */
-      if (is_image > max_is_image || (is_image == max_is_image && mem.device_size > max_size)) {
-        max_is_image = is_image;
-        max_size = mem.device_size;
-        max_mem = &mem;
+      /* Prefer moving images, and move as little memory as possible: the smallest
+       * allocation that still covers the remaining deficit, or the largest one when
+       * none does. This keeps the biggest possible set of textures resident on the
+       * device, so fewer lookups go through the slow mapped host memory path. */
+      const bool covers_size = (mem.device_size >= size);
+      bool better;
+      if (is_image != best_is_image) {
+        better = is_image;
+      }
+      else if (covers_size != best_covers_size) {
+        better = covers_size;
+      }
+      else if (covers_size) {
+        better = (mem.device_size < best_size);
+      }
+      else {
+        better = (mem.device_size > best_size);
+      }
+
+      if (best_mem == NULL || better) {
+        best_is_image = is_image;
+        best_covers_size = covers_size;
+        best_size = mem.device_size;
+        best_mem = &mem;
       }
     }
     lock.unlock();
@@ -777,8 +797,8 @@ void CUDADevice::move_textures_to_host(size_t size, bool for_texture)
     /* Move to host memory. This part is mutex protected since
      * multiple CUDA devices could be moving the memory. The
      * first one will do it, and the rest will adopt the pointer. */
-    if (max_mem) {
-      VLOG(1) << "Move memory from device to host: " << max_mem->name;
+    if (best_mem) {
+      VLOG(1) << "Move memory from device to host: " << best_mem->name;
 
       static thread_mutex move_mutex;
       thread_scoped_lock lock(move_mutex);
@@ -792,8 +812,8 @@ void CUDADevice::move_textures_to_host(size_t size, bool for_texture)
        * devices as well, which is potentially dangerous when still in use (since
        * a thread rendering on another devices would only be caught in this mutex
        * if it so happens to do an allocation at the same time as well. */
-      max_mem->device_copy_to();
-      size = (max_size >= size) ? 0 : size - max_size;
+      best_mem->device_copy_to();
+      size = (best_size >= size) ? 0 : size - best_size;
 
       any_device_moving_textures_to_host = false;
     }
@@ -1024,6 +1044,25 @@ void CUDADevice::mem_copy_to(device_memory &mem)
   }
 }
 
+void CUDADevice::mem_copy_to(device_memory &mem, size_t offset, size_t size)
+{
+  if (!mem.device_pointer || mem.type == MEM_PIXELS || mem.type == MEM_TEXTURE) {
+    /* Needs a full allocation or texture rebuild. */
+    mem_copy_to(mem);
+  }
+  else if (mem.host_pointer) {
+    /* See #generic_copy_to for the mapped host memory case, where the data needs
+     * no explicit copy. */
+    thread_scoped_lock lock(cuda_mem_map_mutex);
+    if (!cuda_mem_map[&mem].use_mapped_host || mem.host_pointer != mem.shared_pointer) {
+      const CUDAContextScope scope(this);
+      cuda_assert(cuMemcpyHtoD((CUdeviceptr)mem.device_pointer + offset,
+                               (char *)mem.host_pointer + offset,
+                               size));
+    }
+  }
+}
+
 void CUDADevice::mem_copy_from(device_memory &mem, int y, int w, int h, int elem)
 {
   if (mem.type == MEM_PIXELS && !background) {
@@ -1918,9 +1957,9 @@ void CUDADevice::render(DeviceTask &task, RenderTile &rtile, device_vector<WorkT
   wtile->stride = rtile.stride;
   wtile->buffer = (float *)(CUdeviceptr)rtile.buffer;
 
-  /* Prepare work size. More step samples render faster, but for now we
-   * remain conservative for GPUs connected to a display to avoid driver
-   * timeouts and display freezing. */
+  /* Prepare work size. More step samples render faster, but we start
+   * conservative to avoid driver timeouts and display freezing, and let the
+   * batch time feedback below grow the size on fast GPUs. */
   int min_blocks, num_threads_per_block;
   cuda_assert(
       cuOccupancyMaxPotentialBlockSize(&min_blocks, &num_threads_per_block, cuRender, NULL, 0, 0));
@@ -1930,11 +1969,18 @@ void CUDADevice::render(DeviceTask &task, RenderTile &rtile, device_vector<WorkT
 
   uint step_samples = divide_up(min_blocks * num_threads_per_block, wtile->w * wtile->h);
 
+  /* Aim for a fixed wall time per launch: long enough to keep the GPU fed,
+   * short enough to remain responsive to cancel and progress updates, and to
+   * avoid driver timeouts on display devices. */
+  const double target_step_time = (info.display_device) ? 0.1 : 1.0;
+
   /* Render all samples. */
   int start_sample = rtile.start_sample;
   int end_sample = rtile.start_sample + rtile.num_samples;
 
   for (int sample = start_sample; sample < end_sample;) {
+    const double step_time_start = time_dt();
+
     /* Setup and copy work tile to device. */
     wtile->start_sample = sample;
     wtile->num_samples = step_samples;
@@ -1962,6 +2008,21 @@ void CUDADevice::render(DeviceTask &task, RenderTile &rtile, device_vector<WorkT
 
     cuda_assert(cuCtxSynchronize());
 
+    /* Adjust the sample batch size towards the target step time. Doubling and
+     * halving with hysteresis keeps a single noisy measurement from swinging
+     * the batch size wildly. Skip partial batches at the end of the tile and
+     * batches shortened for adaptive sampling, their timing is not
+     * representative of a full step. */
+    if (wtile->num_samples == step_samples) {
+      const double step_time = time_dt() - step_time_start;
+      if (step_time > target_step_time * 2.0) {
+        step_samples = max((int)(step_samples / 2), 1);
+      }
+      else if (step_time < target_step_time * 0.5) {
+        step_samples *= 2;
+      }
+    }
+
     /* Update progress. */
     sample += wtile->num_samples;
     rtile.sample = sample;
@@ -1971,10 +2032,19 @@ void CUDADevice::render(DeviceTask &task, RenderTile &rtile, device_vector<WorkT
       if (task.need_finish_queue == false)
         break;
     }
+
+    /* Give up the remaining samples of the tile when another device ran out of work and
+     * wants to continue it. The adaptive sampling state is part of the render buffer and
+     * moves to the new device along with the tile. */
+    if (rtile.stealing_state == RenderTile::CAN_BE_STOLEN && task.get_tile_stolen()) {
+      rtile.stealing_state = RenderTile::WAS_STOLEN;
+      break;
+    }
   }
 
-  /* Finalize adaptive sampling. */
-  if (task.adaptive_sampling.use) {
+  /* Finalize adaptive sampling, unless the tile was stolen: the device that finishes the
+   * remaining samples runs this. */
+  if (task.adaptive_sampling.use && (rtile.stealing_state != RenderTile::WAS_STOLEN)) {
     CUdeviceptr d_work_tiles = (CUdeviceptr)work_tiles.device_pointer;
     adaptive_sampling_post(rtile, wtile, d_work_tiles);
     cuda_assert(cuCtxSynchronize());
@@ -409,9 +409,15 @@ Device *Device::create(DeviceInfo &info, Stats &stats, Profiler &profiler, bool
       break;
 #endif
 #ifdef WITH_NETWORK
-    case DEVICE_NETWORK:
-      device = device_network_create(info, stats, profiler, "127.0.0.1");
+    case DEVICE_NETWORK: {
+      /* The server address is encoded in the device ID, see device_network_info(). */
+      string address = "127.0.0.1";
+      if (string_startswith(info.id, "NETWORK_")) {
+        address = info.id.substr(strlen("NETWORK_"));
+      }
+      device = device_network_create(info, stats, profiler, address.c_str());
       break;
+    }
 #endif
 #ifdef WITH_OPENCL
     case DEVICE_OPENCL:
@@ -623,6 +629,7 @@ DeviceInfo Device::get_multi_device(const vector<DeviceInfo> &subdevices,
   info.has_volume_decoupled = true;
   info.has_branched_path = true;
   info.has_adaptive_stop_per_sample = true;
+  info.has_tile_stealing = true;
   info.has_osl = true;
   info.has_profiling = true;
   info.has_peer_memory = false;
@@ -670,6 +677,7 @@ DeviceInfo Device::get_multi_device(const vector<DeviceInfo> &subdevices,
     info.has_volume_decoupled &= device.has_volume_decoupled;
     info.has_branched_path &= device.has_branched_path;
     info.has_adaptive_stop_per_sample &= device.has_adaptive_stop_per_sample;
+    info.has_tile_stealing &= device.has_tile_stealing;
     info.has_osl &= device.has_osl;
     info.has_profiling &= device.has_profiling;
     info.has_peer_memory |= device.has_peer_memory;
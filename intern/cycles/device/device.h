@@ -81,6 +81,7 @@ class DeviceInfo {
   bool has_volume_decoupled;         /* Decoupled volume shading. */
   bool has_branched_path;            /* Supports branched path tracing. */
   bool has_adaptive_stop_per_sample; /* Per-sample adaptive sampling stopping. */
+  bool has_tile_stealing;            /* Can release an in-flight tile to another device. */
   bool has_osl;                      /* Support Open Shading Language. */
   bool use_split_kernel;             /* Use split or mega kernel. */
   bool has_profiling;                /* Supports runtime collection of profiling info. */
@@ -103,6 +104,7 @@ class DeviceInfo {
     has_volume_decoupled = false;
     has_branched_path = true;
     has_adaptive_stop_per_sample = false;
+    has_tile_stealing = false;
     has_osl = false;
     use_split_kernel = false;
     has_profiling = false;
@@ -489,6 +491,13 @@ class Device {
 
   virtual void mem_alloc(device_memory &mem) = 0;
   virtual void mem_copy_to(device_memory &mem) = 0;
+  /* Copy a sub-range of the buffer to the device, with offset and size in bytes. Only
+   * valid when the buffer is already allocated at its current size on the device.
+   * Devices without a way to update a range copy the whole buffer. */
+  virtual void mem_copy_to(device_memory &mem, size_t /*offset*/, size_t /*size*/)
+  {
+    mem_copy_to(mem);
+  }
   virtual void mem_copy_from(device_memory &mem, int y, int w, int h, int elem) = 0;
   virtual void mem_zero(device_memory &mem) = 0;
   virtual void mem_free(device_memory &mem) = 0;
@@ -131,6 +131,8 @@ void device_cuda_info(vector<DeviceInfo> &devices)
     info.has_nanovdb = true;
     info.has_volume_decoupled = false;
     info.has_adaptive_stop_per_sample = false;
+    /* The render loop releases tiles between sample batches, see CUDADevice::render. */
+    info.has_tile_stealing = true;
     info.denoisers = DENOISER_NLM;
 
     /* Check if the device has P2P access to any other device in the system. */
@@ -254,6 +254,7 @@ class device_memory {
   void device_alloc();
   void device_free();
   void device_copy_to();
+  void device_copy_to(size_t offset, size_t size);
   void device_copy_from(int y, int w, int h, int elem);
   void device_zero();
 
@@ -490,6 +491,16 @@ template<typename T> class device_vector : public device_memory {
     }
   }
 
+  /* Copy a range of elements to the device. Only use this when the buffer did not
+   * need a reallocation, so the device side still matches the host layout. */
+  void copy_to_device(size_t offset, size_t size)
+  {
+    assert(offset + size <= data_size);
+    if (size != 0) {
+      device_copy_to(offset * sizeof(T), size * sizeof(T));
+    }
+  }
+
   void copy_to_device_if_modified()
   {
     if (!modified) {
@@ -436,6 +436,43 @@ class MultiDevice : public Device {
     stats.mem_alloc(mem.device_size - existing_size);
   }
 
+  void mem_copy_to(device_memory &mem, size_t offset, size_t size) override
+  {
+    device_ptr key = mem.device_pointer;
+    size_t existing_size = mem.device_size;
+
+    /* Partial copies are only valid for buffers that did not need a reallocation,
+     * so unlike the full copy there is no allocation to handle here. */
+    if (!key) {
+      mem_copy_to(mem);
+      return;
+    }
+
+    if (strcmp(mem.name, "RenderBuffers") == 0 && use_denoising) {
+      foreach (SubDevice &sub, devices) {
+        mem.device = sub.device;
+        mem.device_pointer = sub.ptr_map[key];
+        mem.device_size = existing_size;
+
+        sub.device->mem_copy_to(mem, offset, size);
+      }
+    }
+    else {
+      foreach (const vector<SubDevice *> &island, peer_islands) {
+        SubDevice *owner_sub = find_suitable_mem_device(key, island);
+        mem.device = owner_sub->device;
+        mem.device_pointer = owner_sub->ptr_map[key];
+        mem.device_size = existing_size;
+
+        owner_sub->device->mem_copy_to(mem, offset, size);
+      }
+    }
+
+    mem.device = this;
+    mem.device_pointer = key;
+    mem.device_size = existing_size;
+  }
+
   void mem_copy_from(device_memory &mem, int y, int w, int h, int elem) override
   {
     device_ptr key = mem.device_pointer;
@@ -710,13 +747,17 @@ class MultiDevice : public Device {
       return;
     }
 
-    /* Copy denoised result back to the host. */
+    /* Copy denoised result back to the host. Only the rows covered by the
+     * target tile are copied, so that tiles denoised concurrently on other
+     * devices do not overwrite each other in a shared buffer. */
+    const int row = (target_tile.offset + target_tile.y * target_tile.stride + target_tile.x) /
+                    target_tile.stride;
     mem.swap_device(sub_device, target_tile.device_size, target_tile.buffer);
-    mem.copy_from_device();
+    mem.copy_from_device(row, mem.data_width, target_tile.h);
     mem.restore_device();
 
     /* Copy denoised result to the original device. */
-    mem.copy_to_device();
+    mem.copy_to_device(row * mem.data_width, target_tile.h * mem.data_width);
 
     for (int i = 0; i < RenderTileNeighbors::SIZE; i++) {
       RenderTile &tile = neighbors.tiles[i];
@@ -791,12 +832,11 @@ class MultiDevice : public Device {
         if (task.shader_output)
           subtask.shader_output = find_matching_mem(task.shader_output, sub);
 
+        /* Subtasks sharing a RenderBuffers can run concurrently: the neighbor
+         * tile mapping callbacks are serialized by the session, and each
+         * subtask only writes back the rows of its own target tile (see
+         * 'unmap_neighbor_tiles'). */
         sub.device->task_add(subtask);
-
-        if (task.buffers && task.buffers->buffer.device == this) {
-          /* Synchronize access to RenderBuffers, since 'map_neighbor_tiles' is not thread-safe. */
-          sub.device->task_wait();
-        }
       }
     }
   }
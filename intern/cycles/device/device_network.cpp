@@ -20,6 +20,8 @@
 
 #include "util/util_foreach.h"
 #include "util/util_logging.h"
+#include "util/util_string.h"
+#include "util/util_time.h"
 
 #if defined(WITH_NETWORK)
 
@@ -184,7 +186,6 @@ class NetworkDevice : public Device {
 
     RPCSend snd(socket, &error_func, "load_kernels");
     snd.add(requested_features.experimental);
-    snd.add(requested_features.max_closure);
     snd.add(requested_features.max_nodes_group);
     snd.add(requested_features.nodes_features);
     snd.write();
@@ -232,7 +233,7 @@ class NetworkDevice : public Device {
         lock.unlock();
 
         /* todo: watch out for recursive calls! */
-        if (the_task.acquire_tile(this, tile)) { /* write return as bool */
+        if (the_task.acquire_tile(this, tile, the_task.tile_types)) { /* write return as bool */
           the_tiles.push_back(tile);
 
           lock.lock();
@@ -302,20 +303,33 @@ Device *device_network_create(DeviceInfo &info,
 
 void device_network_info(vector<DeviceInfo> &devices)
 {
-  DeviceInfo info;
+  /* Discover render servers on the local network. Replies to the broadcast
+   * come in asynchronously, so give the servers a moment to answer. This only
+   * runs once, the result is cached by the device enumeration. */
+  ServerDiscovery discovery(true);
+  time_sleep(1.0);
 
-  info.type = DEVICE_NETWORK;
-  info.description = "Network Device";
-  info.id = "NETWORK";
-  info.num = 0;
+  vector<string> servers = discovery.get_server_list();
 
-  /* todo: get this info from device */
-  info.has_volume_decoupled = false;
-  info.has_adaptive_stop_per_sample = false;
-  info.has_osl = false;
-  info.denoisers = DENOISER_NONE;
+  int num = 0;
+  foreach (const string &address, servers) {
+    DeviceInfo info;
 
-  devices.push_back(info);
+    info.type = DEVICE_NETWORK;
+    info.description = string_printf("Network Device (%s)", address.c_str());
+    /* The server address doubles as the ID, so that a specific server can be
+     * recognized across sessions and the address recovered on creation. */
+    info.id = string_printf("NETWORK_%s", address.c_str());
+    info.num = num++;
+
+    /* todo: get this info from device */
+    info.has_volume_decoupled = false;
+    info.has_adaptive_stop_per_sample = false;
+    info.has_osl = false;
+    info.denoisers = DENOISER_NONE;
+
+    devices.push_back(info);
+  }
 }
 
 class DeviceServer {
@@ -507,7 +521,7 @@ class DeviceServer {
 
       DataVector &data_v = data_vector_find(client_pointer);
 
-      mem.host_pointer = (device_ptr) & (data_v[0]);
+      mem.host_pointer = (void *)&data_v[0];
 
       device->mem_copy_from(mem, y, w, h, elem);
 
@@ -538,7 +552,7 @@ class DeviceServer {
       else {
         /* Allocate host side data buffer. */
         DataVector &data_v = data_vector_insert(client_pointer, data_size);
-        mem.host_pointer = (void *) ? (device_ptr) & (data_v[0]) : 0;
+        mem.host_pointer = data_size ? (void *)&data_v[0] : 0;
       }
 
       /* Zero memory. */
@@ -578,7 +592,6 @@ class DeviceServer {
     else if (rcv.name == "load_kernels") {
       DeviceRequestedFeatures requested_features;
       rcv.read(requested_features.experimental);
-      rcv.read(requested_features.max_closure);
       rcv.read(requested_features.max_nodes_group);
       rcv.read(requested_features.nodes_features);
 
@@ -610,10 +623,10 @@ class DeviceServer {
       if (task.shader_output)
         task.shader_output = device_ptr_from_client_pointer(task.shader_output);
 
-      task.acquire_tile = function_bind(&DeviceServer::task_acquire_tile, this, _1, _2);
+      task.acquire_tile = function_bind(&DeviceServer::task_acquire_tile, this, _1, _2, _3);
       task.release_tile = function_bind(&DeviceServer::task_release_tile, this, _1);
-      task.update_progress_sample = function_bind(&DeviceServer::task_update_progress_sample,
-                                                  this);
+      task.update_progress_sample = function_bind(
+          &DeviceServer::task_update_progress_sample, this, _1, _2);
       task.update_tile_sample = function_bind(&DeviceServer::task_update_tile_sample, this, _1);
       task.get_cancel = function_bind(&DeviceServer::task_get_cancel, this);
 
@@ -660,7 +673,7 @@ class DeviceServer {
     }
   }
 
-  bool task_acquire_tile(Device *, RenderTile &tile)
+  bool task_acquire_tile(Device *, RenderTile &tile, uint /*tile_types*/)
   {
     thread_scoped_lock acquire_lock(acquire_mutex);
 
@@ -701,7 +714,7 @@ class DeviceServer {
     return result;
   }
 
-  void task_update_progress_sample()
+  void task_update_progress_sample(long /*total*/, int /*sample*/)
   {
     ; /* skip */
   }
@@ -33,6 +33,8 @@
 #  include <iostream>
 #  include <sstream>
 
+#  include "device/device_task.h"
+
 #  include "render/buffers.h"
 
 #  include "util/util_foreach.h"
@@ -130,7 +132,6 @@ class RPCSend {
     archive &mem.data_type &mem.data_elements &mem.data_size;
     archive &mem.data_width &mem.data_height &mem.data_depth &mem.device_pointer;
     archive &mem.type &string(mem.name);
-    archive &mem.interpolation &mem.extension;
     archive &mem.device_pointer;
   }
 
@@ -148,6 +149,7 @@ class RPCSend {
     archive &task.shader_input &task.shader_output &task.shader_eval_type;
     archive &task.shader_x &task.shader_w;
     archive &task.need_finish_queue;
+    archive &task.tile_types;
   }
 
   void add(const RenderTile &tile)
@@ -272,7 +274,6 @@ class RPCReceive {
     *archive &mem.data_type &mem.data_elements &mem.data_size;
     *archive &mem.data_width &mem.data_height &mem.data_depth &mem.device_pointer;
     *archive &mem.type &name;
-    *archive &mem.interpolation &mem.extension;
     *archive &mem.device_pointer;
 
     mem.name = name.c_str();
@@ -312,6 +313,7 @@ class RPCReceive {
     *archive &task.shader_input &task.shader_output &task.shader_eval_type;
     *archive &task.shader_x &task.shader_w;
     *archive &task.need_finish_queue;
+    *archive &task.tile_types;
 
     task.type = (DeviceTask::Type)type;
   }
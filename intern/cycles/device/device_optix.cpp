@@ -757,6 +757,9 @@ class OptiXDevice : public CUDADevice {
     const int end_sample = rtile.start_sample + rtile.num_samples;
     // Keep this number reasonable to avoid running into TDRs
     int step_samples = (info.display_device ? 8 : 32);
+    // Aim for a fixed wall time per launch: long enough to keep the GPU fed, short enough to
+    // remain responsive and to avoid TDRs on display devices
+    const double target_step_time = (info.display_device ? 0.1 : 1.0);
 
     // Offset into launch params buffer so that streams use separate data
     device_ptr launch_params_ptr = launch_params.device_pointer +
@@ -765,6 +768,8 @@ class OptiXDevice : public CUDADevice {
     const CUDAContextScope scope(cuContext);
 
     for (int sample = rtile.start_sample; sample < end_sample;) {
+      const double step_time_start = time_dt();
+
       // Copy work tile information to device
       wtile.start_sample = sample;
       wtile.num_samples = step_samples;
@@ -812,6 +817,19 @@ class OptiXDevice : public CUDADevice {
       // Wait for launch to finish
       check_result_cuda(cuStreamSynchronize(cuda_stream[thread_index]));
 
+      // Adjust the sample batch size towards the target step time, doubling and halving with
+      // hysteresis so a single noisy measurement does not swing the batch size wildly. Partial
+      // batches (end of tile or shortened for adaptive sampling) are not representative, skip them
+      if (wtile.num_samples == static_cast<uint>(step_samples)) {
+        const double step_time = time_dt() - step_time_start;
+        if (step_time > target_step_time * 2.0) {
+          step_samples = max(step_samples / 2, 1);
+        }
+        else if (step_time < target_step_time * 0.5) {
+          step_samples *= 2;
+        }
+      }
+
       // Update current sample, so it is displayed correctly
       sample += wtile.num_samples;
       rtile.sample = sample;
@@ -820,10 +838,18 @@ class OptiXDevice : public CUDADevice {
 
       if (task.get_cancel() && !task.need_finish_queue)
         return;  // Cancel rendering
+
+      // Give up the remaining samples of the tile when another device ran out of work and
+      // wants to continue it (the adaptive sampling state moves along in the render buffer)
+      if (rtile.stealing_state == RenderTile::CAN_BE_STOLEN && task.get_tile_stolen()) {
+        rtile.stealing_state = RenderTile::WAS_STOLEN;
+        break;
+      }
     }
 
-    // Finalize adaptive sampling
-    if (task.adaptive_sampling.use) {
+    // Finalize adaptive sampling, unless the tile was stolen: the device finishing the
+    // remaining samples runs this
+    if (task.adaptive_sampling.use && (rtile.stealing_state != RenderTile::WAS_STOLEN)) {
       device_ptr d_wtile_ptr = launch_params_ptr + offsetof(KernelParams, tile);
       adaptive_sampling_post(rtile, &wtile, d_wtile_ptr, cuda_stream[thread_index]);
       check_result_cuda(cuStreamSynchronize(cuda_stream[thread_index]));
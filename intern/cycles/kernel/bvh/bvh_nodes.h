@@ -28,6 +28,64 @@ ccl_device_forceinline Transform bvh_unaligned_node_fetch_space(KernelGlobals *k
   return space;
 }
 
+/* Intersect against a compact node, which stores the child bounds as 8 bit
+ * offsets on a grid relative to the common origin of both children, with a
+ * power of two step per axis, see BVH2::pack_compact_node(). */
+ccl_device_forceinline int bvh_compact_node_intersect(KernelGlobals *kg,
+                                                      const float3 P,
+                                                      const float3 idir,
+                                                      const float t,
+                                                      const int node_addr,
+                                                      const uint visibility,
+                                                      float dist[2])
+{
+  /* fetch node data */
+#ifdef __VISIBILITY_FLAG__
+  float4 cnodes = kernel_tex_fetch(__bvh_nodes, node_addr + 0);
+#endif
+  float4 node0 = kernel_tex_fetch(__bvh_nodes, node_addr + 1);
+  float4 node1 = kernel_tex_fetch(__bvh_nodes, node_addr + 2);
+
+  /* decode the grid origin and the per axis steps */
+  const uint exponents = __float_as_uint(node0.w);
+  const float scale_x = __uint_as_float((exponents & 0xff) << 23);
+  const float scale_y = __uint_as_float(((exponents >> 8) & 0xff) << 23);
+  const float scale_z = __uint_as_float(((exponents >> 16) & 0xff) << 23);
+
+  const uint q0 = __float_as_uint(node1.x);
+  const uint q1 = __float_as_uint(node1.y);
+  const uint q2 = __float_as_uint(node1.z);
+
+  /* intersect ray against child nodes */
+  float c0lox = (node0.x + (float)(q0 & 0xff) * scale_x - P.x) * idir.x;
+  float c0hix = (node0.x + (float)((q0 >> 24) & 0xff) * scale_x - P.x) * idir.x;
+  float c0loy = (node0.y + (float)((q0 >> 8) & 0xff) * scale_y - P.y) * idir.y;
+  float c0hiy = (node0.y + (float)(q1 & 0xff) * scale_y - P.y) * idir.y;
+  float c0loz = (node0.z + (float)((q0 >> 16) & 0xff) * scale_z - P.z) * idir.z;
+  float c0hiz = (node0.z + (float)((q1 >> 8) & 0xff) * scale_z - P.z) * idir.z;
+  float c0min = max4(0.0f, min(c0lox, c0hix), min(c0loy, c0hiy), min(c0loz, c0hiz));
+  float c0max = min4(t, max(c0lox, c0hix), max(c0loy, c0hiy), max(c0loz, c0hiz));
+
+  float c1lox = (node0.x + (float)((q1 >> 16) & 0xff) * scale_x - P.x) * idir.x;
+  float c1hix = (node0.x + (float)((q2 >> 8) & 0xff) * scale_x - P.x) * idir.x;
+  float c1loy = (node0.y + (float)((q1 >> 24) & 0xff) * scale_y - P.y) * idir.y;
+  float c1hiy = (node0.y + (float)((q2 >> 16) & 0xff) * scale_y - P.y) * idir.y;
+  float c1loz = (node0.z + (float)(q2 & 0xff) * scale_z - P.z) * idir.z;
+  float c1hiz = (node0.z + (float)((q2 >> 24) & 0xff) * scale_z - P.z) * idir.z;
+  float c1min = max4(0.0f, min(c1lox, c1hix), min(c1loy, c1hiy), min(c1loz, c1hiz));
+  float c1max = min4(t, max(c1lox, c1hix), max(c1loy, c1hiy), max(c1loz, c1hiz));
+
+  dist[0] = c0min;
+  dist[1] = c1min;
+
+#ifdef __VISIBILITY_FLAG__
+  return (((c0max >= c0min) && (__float_as_uint(cnodes.x) & visibility)) ? 1 : 0) |
+         (((c1max >= c1min) && (__float_as_uint(cnodes.y) & visibility)) ? 2 : 0);
+#else
+  return ((c0max >= c0min) ? 1 : 0) | ((c1max >= c1min) ? 2 : 0);
+#endif
+}
+
 ccl_device_forceinline int bvh_aligned_node_intersect(KernelGlobals *kg,
                                                       const float3 P,
                                                       const float3 idir,
@@ -36,6 +94,9 @@ ccl_device_forceinline int bvh_aligned_node_intersect(KernelGlobals *kg,
                                                       const uint visibility,
                                                       float dist[2])
 {
+  if (kernel_data.bvh.use_compact_nodes) {
+    return bvh_compact_node_intersect(kg, P, idir, t, node_addr, visibility, dist);
+  }
 
   /* fetch node data */
 #ifdef __VISIBILITY_FLAG__
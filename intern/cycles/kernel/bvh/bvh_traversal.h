@@ -37,8 +37,6 @@ ccl_device_noinline bool BVH_FUNCTION_FULL_NAME(BVH)(KernelGlobals *kg,
                                                      const uint visibility)
 {
   /* todo:
-   * - test if pushing distance on the stack helps (for non shadow rays)
-   * - separate version for shadow rays
    * - likely and unlikely for if() statements
    * - test restrict attribute for pointers
    */
@@ -46,6 +44,13 @@ ccl_device_noinline bool BVH_FUNCTION_FULL_NAME(BVH)(KernelGlobals *kg,
   /* traversal stack in CUDA thread-local memory */
   int traversal_stack[BVH_STACK_SIZE];
   traversal_stack[0] = ENTRYPOINT_SENTINEL;
+#ifdef __KERNEL_CPU__
+  /* Distances at which the pushed subtrees are entered, to cull them on pop
+   * when a closer hit was found in the meantime. Only done on the CPU, on the
+   * GPU the extra thread-local memory costs more than the culling saves. */
+  float traversal_dist[BVH_STACK_SIZE];
+  traversal_dist[0] = 0.0f;
+#endif
 
   /* traversal variables in registers */
   int stack_ptr = 0;
@@ -104,6 +109,9 @@ ccl_device_noinline bool BVH_FUNCTION_FULL_NAME(BVH)(KernelGlobals *kg,
           ++stack_ptr;
           kernel_assert(stack_ptr < BVH_STACK_SIZE);
           traversal_stack[stack_ptr] = node_addr_child1;
+#ifdef __KERNEL_CPU__
+          traversal_dist[stack_ptr] = is_closest_child1 ? dist[0] : dist[1];
+#endif
         }
         else {
           /* One child was intersected. */
@@ -112,8 +120,20 @@ ccl_device_noinline bool BVH_FUNCTION_FULL_NAME(BVH)(KernelGlobals *kg,
           }
           else if (traverse_mask == 0) {
             /* Neither child was intersected. */
+#ifdef __KERNEL_CPU__
+            /* Pop, skipping subtrees that start beyond the closest hit. */
+            for (;;) {
+              node_addr = traversal_stack[stack_ptr];
+              const float node_dist = traversal_dist[stack_ptr];
+              --stack_ptr;
+              if (node_addr == ENTRYPOINT_SENTINEL || node_dist <= isect->t) {
+                break;
+              }
+            }
+#else
             node_addr = traversal_stack[stack_ptr];
             --stack_ptr;
+#endif
           }
         }
       }
@@ -128,8 +148,20 @@ ccl_device_noinline bool BVH_FUNCTION_FULL_NAME(BVH)(KernelGlobals *kg,
           const uint type = __float_as_int(leaf.w);
 
           /* pop */
+#ifdef __KERNEL_CPU__
+          /* Skip subtrees that start beyond the closest hit. */
+          for (;;) {
+            node_addr = traversal_stack[stack_ptr];
+            const float node_dist = traversal_dist[stack_ptr];
+            --stack_ptr;
+            if (node_addr == ENTRYPOINT_SENTINEL || node_dist <= isect->t) {
+              break;
+            }
+          }
+#else
           node_addr = traversal_stack[stack_ptr];
           --stack_ptr;
+#endif
 
           /* primitive intersection */
           switch (type & PRIMITIVE_ALL) {
@@ -193,6 +225,9 @@ ccl_device_noinline bool BVH_FUNCTION_FULL_NAME(BVH)(KernelGlobals *kg,
           ++stack_ptr;
           kernel_assert(stack_ptr < BVH_STACK_SIZE);
           traversal_stack[stack_ptr] = ENTRYPOINT_SENTINEL;
+#ifdef __KERNEL_CPU__
+          traversal_dist[stack_ptr] = 0.0f;
+#endif
 
           node_addr = kernel_tex_fetch(__object_node, object);
         }
@@ -58,6 +58,9 @@ void kernel_global_memory_copy(KernelGlobals *kg, const char *name, void *mem, s
 #define KERNEL_ARCH cpu_avx2
 #include "kernel/kernels/cpu/kernel_cpu.h"
 
+#define KERNEL_ARCH cpu_avx512
+#include "kernel/kernels/cpu/kernel_cpu.h"
+
 CCL_NAMESPACE_END
 
 #endif /* __KERNEL_H__ */
@@ -171,7 +171,7 @@ ccl_device_inline bool lamp_light_sample(
     }
   }
 
-  ls->pdf *= kernel_data.integrator.pdf_lights;
+  ls->pdf *= klight->pdf_selection;
 
   return (ls->pdf > 0.0f);
 }
@@ -328,7 +328,7 @@ ccl_device bool lamp_light_eval(
     return false;
   }
 
-  ls->pdf *= kernel_data.integrator.pdf_lights;
+  ls->pdf *= klight->pdf_selection;
 
   return true;
 }
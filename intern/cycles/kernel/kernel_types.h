@@ -1377,6 +1377,8 @@ typedef struct KernelBVH {
   int bvh_layout;
   int use_bvh_steps;
   int curve_subdivisions;
+  int use_compact_nodes;
+  int pad3, pad4, pad5;
 
   /* Custom BVH */
 #ifdef __KERNEL_OPTIX__
@@ -1489,7 +1491,7 @@ typedef struct KernelLight {
   float max_bounces;
   float random;
   float strength[3];
-  float pad1;
+  float pdf_selection;
   Transform tfm;
   Transform itfm;
   union {
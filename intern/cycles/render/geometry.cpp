@@ -238,6 +238,9 @@ void Geometry::compute_bvh(
       bparams.bvh_layout = bvh_layout;
       bparams.use_unaligned_nodes = dscene->data.bvh.have_curves &&
                                     params->use_bvh_unaligned_nodes;
+      bparams.use_compact_nodes = (bvh_layout == BVH_LAYOUT_BVH2) &&
+                                  params->use_bvh_compact_nodes &&
+                                  !bparams.use_unaligned_nodes;
       bparams.num_motion_triangle_steps = params->num_bvh_time_steps;
       bparams.num_motion_curve_steps = params->num_bvh_time_steps;
       bparams.bvh_type = params->bvh_type;
@@ -1110,17 +1113,26 @@ void GeometryManager::device_update_mesh(
                                dscene->tri_patch.need_realloc() ||
                                dscene->tri_patch_uv.need_realloc();
 
+    /* Ranges of the global arrays that get repacked, in elements, so only those
+     * ranges need to be re-uploaded when the buffers did not get reallocated. */
+    size_t dirty_prim_begin = tri_size, dirty_prim_end = 0;
+    size_t dirty_vert_begin = vert_size, dirty_vert_end = 0;
+
     foreach (Geometry *geom, scene->geometry) {
       if (geom->geometry_type == Geometry::MESH || geom->geometry_type == Geometry::VOLUME) {
         Mesh *mesh = static_cast<Mesh *>(geom);
 
+        bool repacked = false;
+
         if (mesh->shader_is_modified() || mesh->smooth_is_modified() ||
             mesh->triangles_is_modified() || copy_all_data) {
           mesh->pack_shaders(scene, &tri_shader[mesh->prim_offset]);
+          repacked = true;
         }
 
         if (mesh->verts_is_modified() || copy_all_data) {
           mesh->pack_normals(&vnormal[mesh->vert_offset]);
+          repacked = true;
         }
 
         if (mesh->triangles_is_modified() || mesh->vert_patch_uv_is_modified() || copy_all_data) {
@@ -1130,6 +1142,14 @@ void GeometryManager::device_update_mesh(
                            &tri_patch_uv[mesh->vert_offset],
                            mesh->vert_offset,
                            mesh->prim_offset);
+          repacked = true;
+        }
+
+        if (repacked) {
+          dirty_prim_begin = std::min(dirty_prim_begin, (size_t)mesh->prim_offset);
+          dirty_prim_end = std::max(dirty_prim_end, (size_t)mesh->prim_offset + mesh->num_triangles());
+          dirty_vert_begin = std::min(dirty_vert_begin, (size_t)mesh->vert_offset);
+          dirty_vert_end = std::max(dirty_vert_end, (size_t)mesh->vert_offset + mesh->verts.size());
         }
 
         if (progress.get_cancel())
@@ -1140,11 +1160,32 @@ void GeometryManager::device_update_mesh(
     /* vertex coordinates */
     progress.set_status("Updating Mesh", "Copying Mesh to device");
 
-    dscene->tri_shader.copy_to_device_if_modified();
-    dscene->tri_vnormal.copy_to_device_if_modified();
-    dscene->tri_vindex.copy_to_device_if_modified();
-    dscene->tri_patch.copy_to_device_if_modified();
-    dscene->tri_patch_uv.copy_to_device_if_modified();
+    if (copy_all_data) {
+      dscene->tri_shader.copy_to_device_if_modified();
+      dscene->tri_vnormal.copy_to_device_if_modified();
+      dscene->tri_vindex.copy_to_device_if_modified();
+      dscene->tri_patch.copy_to_device_if_modified();
+      dscene->tri_patch_uv.copy_to_device_if_modified();
+    }
+    else if (dirty_prim_begin < dirty_prim_end) {
+      /* Only re-upload the repacked ranges, so editing a single mesh does not
+       * re-transfer the whole scene. */
+      if (dscene->tri_shader.is_modified()) {
+        dscene->tri_shader.copy_to_device(dirty_prim_begin, dirty_prim_end - dirty_prim_begin);
+      }
+      if (dscene->tri_vnormal.is_modified()) {
+        dscene->tri_vnormal.copy_to_device(dirty_vert_begin, dirty_vert_end - dirty_vert_begin);
+      }
+      if (dscene->tri_vindex.is_modified()) {
+        dscene->tri_vindex.copy_to_device(dirty_prim_begin, dirty_prim_end - dirty_prim_begin);
+      }
+      if (dscene->tri_patch.is_modified()) {
+        dscene->tri_patch.copy_to_device(dirty_prim_begin, dirty_prim_end - dirty_prim_begin);
+      }
+      if (dscene->tri_patch_uv.is_modified()) {
+        dscene->tri_patch_uv.copy_to_device(dirty_vert_begin, dirty_vert_end - dirty_vert_begin);
+      }
+    }
   }
 
   if (curve_size != 0) {
@@ -1155,6 +1196,9 @@ void GeometryManager::device_update_mesh(
 
     const bool copy_all_data = dscene->curve_keys.need_realloc() || dscene->curves.need_realloc();
 
+    size_t dirty_key_begin = curve_key_size, dirty_key_end = 0;
+    size_t dirty_curve_begin = curve_size, dirty_curve_end = 0;
+
     foreach (Geometry *geom, scene->geometry) {
       if (geom->is_hair()) {
         Hair *hair = static_cast<Hair *>(geom);
@@ -1172,13 +1216,30 @@ void GeometryManager::device_update_mesh(
                           &curve_keys[hair->curvekey_offset],
                           &curves[hair->prim_offset],
                           hair->curvekey_offset);
+
+        dirty_key_begin = std::min(dirty_key_begin, (size_t)hair->curvekey_offset);
+        dirty_key_end = std::max(dirty_key_end,
+                            (size_t)hair->curvekey_offset + hair->get_curve_keys().size());
+        dirty_curve_begin = std::min(dirty_curve_begin, (size_t)hair->prim_offset);
+        dirty_curve_end = std::max(dirty_curve_end, (size_t)hair->prim_offset + hair->num_curves());
+
         if (progress.get_cancel())
           return;
       }
     }
 
-    dscene->curve_keys.copy_to_device_if_modified();
-    dscene->curves.copy_to_device_if_modified();
+    if (copy_all_data) {
+      dscene->curve_keys.copy_to_device_if_modified();
+      dscene->curves.copy_to_device_if_modified();
+    }
+    else if (dirty_curve_begin < dirty_curve_end) {
+      if (dscene->curve_keys.is_modified()) {
+        dscene->curve_keys.copy_to_device(dirty_key_begin, dirty_key_end - dirty_key_begin);
+      }
+      if (dscene->curves.is_modified()) {
+        dscene->curves.copy_to_device(dirty_curve_begin, dirty_curve_end - dirty_curve_begin);
+      }
+    }
   }
 
   if (patch_size != 0 && dscene->patches.need_realloc()) {
@@ -1240,6 +1301,8 @@ void GeometryManager::device_update_bvh(Device *device,
   bparams.use_spatial_split = scene->params.use_bvh_spatial_split;
   bparams.use_unaligned_nodes = dscene->data.bvh.have_curves &&
                                 scene->params.use_bvh_unaligned_nodes;
+  bparams.use_compact_nodes = (bparams.bvh_layout == BVH_LAYOUT_BVH2) &&
+                              scene->params.use_bvh_compact_nodes && !bparams.use_unaligned_nodes;
   bparams.num_motion_triangle_steps = scene->params.num_bvh_time_steps;
   bparams.num_motion_curve_steps = scene->params.num_bvh_time_steps;
   bparams.bvh_type = scene->params.bvh_type;
@@ -1247,8 +1310,23 @@ void GeometryManager::device_update_bvh(Device *device,
 
   VLOG(1) << "Using " << bvh_layout_name(bparams.bvh_layout) << " layout.";
 
-  const bool can_refit = scene->bvh != nullptr &&
-                         (bparams.bvh_layout == BVHLayout::BVH_LAYOUT_OPTIX);
+  const bool has_bvh2_layout = (bparams.bvh_layout == BVH_LAYOUT_BVH2);
+
+  /* The top level BVH2 can only be refit when its packed layout is unchanged, which is only
+   * guaranteed when no geometry has its own BVH whose nodes get merged into the top level one. */
+  bool can_refit_bvh2 = has_bvh2_layout && scene->bvh != nullptr;
+  if (can_refit_bvh2) {
+    foreach (Geometry *geom, scene->geometry) {
+      if (geom->need_build_bvh(bparams.bvh_layout)) {
+        can_refit_bvh2 = false;
+        break;
+      }
+    }
+  }
+
+  const bool can_refit = can_refit_bvh2 ||
+                         (scene->bvh != nullptr &&
+                          (bparams.bvh_layout == BVHLayout::BVH_LAYOUT_OPTIX));
 
   PackFlags pack_flags = PackFlags::PACK_NONE;
 
@@ -1265,14 +1343,28 @@ void GeometryManager::device_update_bvh(Device *device,
     bvh = scene->bvh = BVH::create(bparams, scene->geometry, scene->objects, device);
   }
 
+  if (can_refit_bvh2) {
+    /* The previous update moved the packed arrays into the device vectors, so hand the
+     * memory back to let the refit update the arrays in place. */
+    BVH2 *const bvh2 = static_cast<BVH2 *>(bvh);
+    dscene->bvh_nodes.give_data(bvh2->pack.nodes);
+    dscene->bvh_leaf_nodes.give_data(bvh2->pack.leaf_nodes);
+    dscene->object_node.give_data(bvh2->pack.object_node);
+    dscene->prim_tri_index.give_data(bvh2->pack.prim_tri_index);
+    dscene->prim_tri_verts.give_data(bvh2->pack.prim_tri_verts);
+    dscene->prim_type.give_data(bvh2->pack.prim_type);
+    dscene->prim_visibility.give_data(bvh2->pack.prim_visibility);
+    dscene->prim_index.give_data(bvh2->pack.prim_index);
+    dscene->prim_object.give_data(bvh2->pack.prim_object);
+    dscene->prim_time.give_data(bvh2->pack.prim_time);
+  }
+
   device->build_bvh(bvh, progress, can_refit);
 
   if (progress.get_cancel()) {
     return;
   }
 
-  const bool has_bvh2_layout = (bparams.bvh_layout == BVH_LAYOUT_BVH2);
-
   PackedBVH pack;
   if (has_bvh2_layout) {
     pack = std::move(static_cast<BVH2 *>(bvh)->pack);
@@ -1399,6 +1491,7 @@ void GeometryManager::device_update_bvh(Device *device,
   }
 
   dscene->data.bvh.root = pack.root_index;
+  dscene->data.bvh.use_compact_nodes = bparams.use_compact_nodes;
   dscene->data.bvh.use_bvh_steps = (scene->params.num_bvh_time_steps != 0);
   dscene->data.bvh.curve_subdivisions = scene->params.curve_subdivisions();
   /* The scene handle is set in 'CPUDevice::const_copy_to' and 'OptiXDevice::const_copy_to' */
@@ -1771,6 +1864,24 @@ void GeometryManager::device_update_volume_images(Device *device, Scene *scene,
   pool.wait_work();
 }
 
+void GeometryManager::tessellate_mesh(Mesh *mesh, Progress *progress, int n, int total)
+{
+  if (progress->get_cancel()) {
+    return;
+  }
+
+  string msg = "Tessellating ";
+  if (mesh->name == "")
+    msg += string_printf("%u/%u", (uint)(n + 1), (uint)total);
+  else
+    msg += string_printf("%s %u/%u", mesh->name.c_str(), (uint)(n + 1), (uint)total);
+
+  progress->set_status("Updating Mesh", msg);
+
+  DiagSplit dsplit(*mesh->subd_params);
+  mesh->tessellate(&dsplit);
+}
+
 void GeometryManager::device_update(Device *device,
                                     DeviceScene *dscene,
                                     Scene *scene,
@@ -1839,6 +1950,10 @@ void GeometryManager::device_update(Device *device,
         dicing_camera->get_full_width(), dicing_camera->get_full_height(), 1);
     dicing_camera->update(scene);
 
+    /* Meshes are diced independently, so tessellate them in parallel like
+     * the object BVH builds below. */
+    TaskPool pool;
+
     size_t i = 0;
     foreach (Geometry *geom, scene->geometry) {
       if (!(geom->is_modified() && geom->is_mesh())) {
@@ -1847,27 +1962,19 @@ void GeometryManager::device_update(Device *device,
 
       Mesh *mesh = static_cast<Mesh *>(geom);
       if (mesh->need_tesselation()) {
-        string msg = "Tessellating ";
-        if (mesh->name == "")
-          msg += string_printf("%u/%u", (uint)(i + 1), (uint)total_tess_needed);
-        else
-          msg += string_printf(
-              "%s %u/%u", mesh->name.c_str(), (uint)(i + 1), (uint)total_tess_needed);
-
-        progress.set_status("Updating Mesh", msg);
-
         mesh->subd_params->camera = dicing_camera;
-        DiagSplit dsplit(*mesh->subd_params);
-        mesh->tessellate(&dsplit);
-
+        pool.push(function_bind(&GeometryManager::tessellate_mesh,
+                                this,
+                                mesh,
+                                &progress,
+                                (int)i,
+                                (int)total_tess_needed));
         i++;
-
-        if (progress.get_cancel()) {
-          return;
-        }
       }
     }
 
+    pool.wait_work();
+
     if (progress.get_cancel()) {
       return;
     }
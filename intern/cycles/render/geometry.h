@@ -243,6 +243,8 @@ class GeometryManager {
  protected:
   bool displace(Device *device, DeviceScene *dscene, Scene *scene, Mesh *mesh, Progress &progress);
 
+  void tessellate_mesh(Mesh *mesh, Progress *progress, int n, int total);
+
   void create_volume_mesh(Volume *volume, Progress &progress);
 
   /* Attributes */
@@ -318,6 +318,20 @@ void ImageManager::set_osl_texture_system(void *texture_system)
   osl_texture_system = texture_system;
 }
 
+bool ImageManager::need_animation_frame_update(int frame)
+{
+  if (frame != animation_frame) {
+    thread_scoped_lock device_lock(images_mutex);
+
+    for (size_t slot = 0; slot < images.size(); slot++) {
+      if (images[slot] && images[slot]->params.animated)
+        return true;
+    }
+  }
+
+  return false;
+}
+
 bool ImageManager::set_animation_frame_update(int frame)
 {
   if (frame != animation_frame) {
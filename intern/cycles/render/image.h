@@ -192,6 +192,7 @@ class ImageManager {
   void device_free_builtin(Device *device);
 
   void set_osl_texture_system(void *texture_system);
+  bool need_animation_frame_update(int frame);
   bool set_animation_frame_update(int frame);
 
   void collect_statistics(RenderStats *stats);
@@ -284,6 +284,14 @@ bool LightManager::object_usable_as_light(Object *object)
   return false;
 }
 
+static float light_power_weight(const Light *light)
+{
+  /* Heuristic importance of a lamp for the light distribution CDF. The shader
+   * can still scale emission arbitrarily, so the strength is only an estimate
+   * of the actual power. */
+  return (fabsf(light->strength.x) + fabsf(light->strength.y) + fabsf(light->strength.z)) / 3.0f;
+}
+
 void LightManager::device_update_distribution(Device *,
                                               DeviceScene *dscene,
                                               Scene *scene,
@@ -412,19 +420,59 @@ void LightManager::device_update_distribution(Device *,
   float trianglearea = totarea;
 
   /* point lights */
-  float lightarea = (totarea > 0.0f) ? totarea / num_lights : 1.0f;
   bool use_lamp_mis = false;
 
+  /* The lamps together keep the same total share of the distribution as
+   * before (equal to the triangle area, or a unit span per lamp when there
+   * are no emissive triangles), but within that share each lamp is weighted
+   * by its estimated emission power, so that in many-light scenes the strong
+   * lamps are sampled more often than the dim ones. Background lights keep
+   * their uniform 1/num_lights share, background_light_pdf() relies on it
+   * through kernel_data.integrator.pdf_lights. */
+  float light_weight_sum = 0.0f;
+
+  foreach (Light *light, scene->lights) {
+    if (!light->is_enabled) {
+      continue;
+    }
+
+    if (light->light_type == LIGHT_BACKGROUND) {
+      num_background_lights++;
+    }
+    else {
+      light_weight_sum += light_power_weight(light);
+    }
+  }
+
+  const float totlightarea = (trianglearea > 0.0f) ? trianglearea : (float)num_lights;
+  const float backgroundarea = (num_lights > 0) ? totlightarea / num_lights : 0.0f;
+  const float lamparea = totlightarea - backgroundarea * num_background_lights;
+
+  vector<float> light_areas;
+  light_areas.reserve(num_lights);
+
   int light_index = 0;
   foreach (Light *light, scene->lights) {
     if (!light->is_enabled)
       continue;
 
+    float lightarea;
+    if (light->light_type == LIGHT_BACKGROUND) {
+      lightarea = backgroundarea;
+    }
+    else if (light_weight_sum > 0.0f) {
+      lightarea = lamparea * light_power_weight(light) / light_weight_sum;
+    }
+    else {
+      lightarea = lamparea / (num_lights - num_background_lights);
+    }
+
     distribution[offset].totarea = totarea;
     distribution[offset].prim = ~light_index;
     distribution[offset].lamp.pad = 1.0f;
     distribution[offset].lamp.size = light->size;
     totarea += lightarea;
+    light_areas.push_back(lightarea);
 
     if (light->light_type == LIGHT_DISTANT) {
       use_lamp_mis |= (light->angle > 0.0f && light->use_mis);
@@ -436,7 +484,6 @@ void LightManager::device_update_distribution(Device *,
       use_lamp_mis |= light->use_mis;
     }
     else if (light->light_type == LIGHT_BACKGROUND) {
-      num_background_lights++;
       background_mis |= light->use_mis;
     }
 
@@ -483,6 +530,9 @@ void LightManager::device_update_distribution(Device *,
     }
 
     if (num_lights) {
+      /* Selection pdf of the background light, which keeps a uniform share of
+       * the distribution. The other lamps store their power-weighted pdf in
+       * KernelLight.pdf_selection. */
       kintegrator->pdf_lights = 1.0f / num_lights;
       if (trianglearea > 0.0f)
         kintegrator->pdf_lights *= 0.5f;
@@ -503,6 +553,18 @@ void LightManager::device_update_distribution(Device *,
     /* CDF */
     dscene->light_distribution.copy_to_device();
 
+    /* Store each lamp's selection probability, the kernel needs it to compute
+     * the pdf of non-uniformly picked lamps. The normalized distribution is
+     * not known yet in device_update_points, so the lights are copied to the
+     * device a second time here. */
+    if (num_lights > 0) {
+      KernelLight *klights = dscene->lights.data();
+      for (int i = 0; i < light_index; i++) {
+        klights[i].pdf_selection = (totarea > 0.0f) ? light_areas[i] / totarea : 0.0f;
+      }
+      dscene->lights.copy_to_device();
+    }
+
     /* Portals */
     if (num_portals > 0) {
       kbackground->portal_offset = light_index;
@@ -343,8 +343,8 @@ bool Session::draw_cpu(BufferParams &buffer_params, DeviceDrawParams &draw_param
 
 bool Session::steal_tile(RenderTile &rtile, Device *tile_device, thread_scoped_lock &tile_lock)
 {
-  /* Devices that can get their tiles stolen don't steal tiles themselves.
-   * Additionally, if there are no stealable tiles in flight, give up here. */
+  /* The CPU device does not steal tiles itself, it is the slowest device in a multi-device
+   * setup. Additionally, if there are no stealable tiles in flight, give up here. */
   if (tile_device->info.type == DEVICE_CPU || stealable_tiles == 0) {
     return false;
   }
@@ -445,7 +445,11 @@ bool Session::acquire_tile(RenderTile &rtile, Device *tile_device, uint tile_typ
     rtile.task = RenderTile::DENOISE;
   }
   else {
-    if (tile_device->info.type == DEVICE_CPU) {
+    /* Tiles can be stolen from any device whose render loop cooperatively releases them
+     * between sample batches, so a fast device can take over queued work from a slower one
+     * instead of idling at the end of the render. The adaptive sampling state lives in the
+     * render buffer passes and moves along with the tile. */
+    if (tile_device->info.has_tile_stealing) {
       stealable_tiles++;
       rtile.stealing_state = RenderTile::CAN_BE_STOLEN;
     }
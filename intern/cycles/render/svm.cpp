@@ -45,6 +45,8 @@ SVMShaderManager::~SVMShaderManager()
 
 void SVMShaderManager::reset(Scene * /*scene*/)
 {
+  thread_scoped_lock lock(compile_cache_mutex);
+  compile_cache.clear();
 }
 
 void SVMShaderManager::device_update_shader(Scene *scene,
@@ -57,16 +59,41 @@ void SVMShaderManager::device_update_shader(Scene *scene,
   }
   assert(shader->graph);
 
+  const bool background = (shader == scene->background->get_shader(scene));
+  const string graph_hash = shader->graph->content_hash();
+
+  /* Reuse the previously compiled nodes if the graph did not change. The
+   * shader itself still carries the metadata (flags, attribute requests)
+   * from that earlier compile, which is why modified shaders always take
+   * the full compilation path below. */
+  if (!shader->is_modified()) {
+    thread_scoped_lock lock(compile_cache_mutex);
+    map<Shader *, CachedShader>::iterator it = compile_cache.find(shader);
+    if (it != compile_cache.end() && it->second.graph_hash == graph_hash &&
+        it->second.background == background) {
+      *svm_nodes = it->second.svm_nodes;
+      return;
+    }
+  }
+
   svm_nodes->push_back_slow(make_int4(NODE_SHADER_JUMP, 0, 0, 0));
 
   SVMCompiler::Summary summary;
   SVMCompiler compiler(scene);
-  compiler.background = (shader == scene->background->get_shader(scene));
+  compiler.background = background;
   compiler.compile(shader, *svm_nodes, 0, &summary);
 
   VLOG(2) << "Compilation summary:\n"
           << "Shader name: " << shader->name << "\n"
           << summary.full_report();
+
+  thread_scoped_lock lock(compile_cache_mutex);
+  CachedShader &cached = compile_cache[shader];
+  /* Compilation finalizes the graph, so hash it again to match the state it
+   * will be in when the next update looks the entry up. */
+  cached.graph_hash = shader->graph->content_hash();
+  cached.background = background;
+  cached.svm_nodes = *svm_nodes;
 }
 
 void SVMShaderManager::device_update_specific(Device *device,
@@ -92,6 +119,21 @@ void SVMShaderManager::device_update_specific(Device *device,
   /* test if we need to update */
   device_free(device, dscene, scene);
 
+  /* Drop cache entries of shaders that were removed from the scene. */
+  {
+    thread_scoped_lock lock(compile_cache_mutex);
+    const set<Shader *> scene_shaders(scene->shaders.begin(), scene->shaders.end());
+    for (map<Shader *, CachedShader>::iterator it = compile_cache.begin();
+         it != compile_cache.end();) {
+      if (scene_shaders.find(it->first) == scene_shaders.end()) {
+        compile_cache.erase(it++);
+      }
+      else {
+        ++it;
+      }
+    }
+  }
+
   /* Build all shaders. */
   TaskPool task_pool;
   vector<array<int4>> shader_svm_nodes(num_shaders);
@@ -22,6 +22,7 @@
 #include "render/shader.h"
 
 #include "util/util_array.h"
+#include "util/util_map.h"
 #include "util/util_set.h"
 #include "util/util_string.h"
 #include "util/util_thread.h"
@@ -57,6 +58,18 @@ class SVMShaderManager : public ShaderManager {
                             Shader *shader,
                             Progress *progress,
                             array<int4> *svm_nodes);
+
+  /* Cache of compiled shaders keyed by the content hash of their graph, so
+   * that unmodified shaders are not recompiled on every scene update. Entries
+   * are per shader since compilation also updates metadata on the Shader
+   * (flags, attribute requests) which reused nodes alone would not provide. */
+  struct CachedShader {
+    string graph_hash;
+    bool background;
+    array<int4> svm_nodes;
+  };
+  map<Shader *, CachedShader> compile_cache;
+  thread_mutex compile_cache_mutex;
 };
 
 /* Graph Compiler */
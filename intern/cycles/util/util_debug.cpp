@@ -26,7 +26,8 @@
 CCL_NAMESPACE_BEGIN
 
 DebugFlags::CPU::CPU()
-    : avx2(true),
+    : avx512(true),
+      avx2(true),
       avx(true),
       sse41(true),
       sse3(true),
@@ -48,6 +49,7 @@ void DebugFlags::CPU::reset()
     } \
   } while (0)
 
+  CHECK_CPU_FLAGS(avx512, "CYCLES_CPU_NO_AVX512");
   CHECK_CPU_FLAGS(avx2, "CYCLES_CPU_NO_AVX2");
   CHECK_CPU_FLAGS(avx, "CYCLES_CPU_NO_AVX");
   CHECK_CPU_FLAGS(sse41, "CYCLES_CPU_NO_SSE41");
@@ -137,6 +139,7 @@ void DebugFlags::reset()
 std::ostream &operator<<(std::ostream &os, DebugFlagsConstRef debug_flags)
 {
   os << "CPU flags:\n"
+     << "  AVX512     : " << string_from_bool(debug_flags.cpu.avx512) << "\n"
      << "  AVX2       : " << string_from_bool(debug_flags.cpu.avx2) << "\n"
      << "  AVX        : " << string_from_bool(debug_flags.cpu.avx) << "\n"
      << "  SSE4.1     : " << string_from_bool(debug_flags.cpu.sse41) << "\n"
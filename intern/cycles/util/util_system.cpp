@@ -243,6 +243,11 @@ struct CPUCapabilities {
   bool fma4;
   bool bmi1;
   bool bmi2;
+  bool avx512f;
+  bool avx512dq;
+  bool avx512cd;
+  bool avx512bw;
+  bool avx512vl;
 };
 
 static CPUCapabilities &system_cpu_capabilities()
@@ -274,9 +279,9 @@ static CPUCapabilities &system_cpu_capabilities()
       bool os_uses_xsave_xrestore = (result[2] & ((int)1 << 27)) != 0;
       bool cpu_avx_support = (result[2] & ((int)1 << 28)) != 0;
 
+      uint32_t xcr_feature_mask = 0;
       if (os_uses_xsave_xrestore && cpu_avx_support) {
         // Check if the OS will save the YMM registers
-        uint32_t xcr_feature_mask;
 #  if defined(__GNUC__)
         int edx; /* not used */
         /* actual opcode for xgetbv */
@@ -284,8 +289,6 @@ static CPUCapabilities &system_cpu_capabilities()
 #  elif defined(_MSC_VER) && defined(_XCR_XFEATURE_ENABLED_MASK)
         /* Minimum VS2010 SP1 compiler is required. */
         xcr_feature_mask = (uint32_t)_xgetbv(_XCR_XFEATURE_ENABLED_MASK);
-#  else
-        xcr_feature_mask = 0;
 #  endif
         caps.avx = (xcr_feature_mask & 0x6) == 0x6;
       }
@@ -296,6 +299,14 @@ static CPUCapabilities &system_cpu_capabilities()
       caps.bmi1 = (result[1] & ((int)1 << 3)) != 0;
       caps.bmi2 = (result[1] & ((int)1 << 8)) != 0;
       caps.avx2 = (result[1] & ((int)1 << 5)) != 0;
+
+      /* AVX-512 additionally needs the OS to save the ZMM and opmask registers. */
+      const bool os_saves_zmm = (xcr_feature_mask & 0xe6) == 0xe6;
+      caps.avx512f = os_saves_zmm && (result[1] & ((int)1 << 16)) != 0;
+      caps.avx512dq = os_saves_zmm && (result[1] & ((int)1 << 17)) != 0;
+      caps.avx512cd = os_saves_zmm && (result[1] & ((int)1 << 28)) != 0;
+      caps.avx512bw = os_saves_zmm && (result[1] & ((int)1 << 30)) != 0;
+      caps.avx512vl = os_saves_zmm && (result[1] & ((int)1 << 31)) != 0;
     }
 
     caps_init = true;
@@ -334,6 +345,13 @@ bool system_cpu_support_avx2()
   return caps.sse && caps.sse2 && caps.sse3 && caps.ssse3 && caps.sse41 && caps.avx && caps.f16c &&
          caps.avx2 && caps.fma3 && caps.bmi1 && caps.bmi2;
 }
+
+bool system_cpu_support_avx512()
+{
+  CPUCapabilities &caps = system_cpu_capabilities();
+  return system_cpu_support_avx2() && caps.avx512f && caps.avx512dq && caps.avx512cd &&
+         caps.avx512bw && caps.avx512vl;
+}
 #else
 
 bool system_cpu_support_sse2()
@@ -360,6 +378,11 @@ bool system_cpu_support_avx2()
   return false;
 }
 
+bool system_cpu_support_avx512()
+{
+  return false;
+}
+
 #endif
 
 bool system_call_self(const vector<string> &args)
@@ -44,8 +44,38 @@ typedef struct MemHeadAligned {
   size_t len;
 } MemHeadAligned;
 
-static unsigned int totblock = 0;
-static size_t mem_in_use = 0, peak_mem = 0;
+/* Allocation statistics are sharded over a fixed number of padded slots, each thread uses one
+ * slot assigned round-robin on its first allocation. A single pair of global counters bounces
+ * their cache line between all cores on allocation-heavy threaded code, which shows up in
+ * profiles of code that is otherwise embarrassingly parallel.
+ *
+ * A thread may free memory that was allocated through another slot, so individual slot counters
+ * can wrap around zero; only their (modular) sum is meaningful. */
+#define MEM_STATS_SLOTS 64
+
+/* How much a slot may grow between re-checks of the peak memory usage. The peak needs the total
+ * over all slots, computing that on every allocation would serialize threads again, so it is
+ * only approximate (off by at most #MEM_STATS_SLOTS times this threshold). */
+#define MEM_STATS_PEAK_CHECK_THRESHOLD (1 << 20)
+
+typedef struct MemStatsSlot {
+  size_t mem_in_use;
+  size_t mem_since_peak_check;
+  unsigned int totblock;
+  /* Keep slots from sharing cache lines, that being the whole point of the sharding. */
+  char _pad[128 - 2 * sizeof(size_t) - sizeof(unsigned int)];
+} MemStatsSlot;
+
+static MemStatsSlot mem_stats_slots[MEM_STATS_SLOTS];
+static unsigned int mem_stats_slot_next = 0;
+
+#if defined(_MSC_VER)
+static __declspec(thread) int mem_stats_slot_index = -1;
+#else
+static _Thread_local int mem_stats_slot_index = -1;
+#endif
+
+static size_t peak_mem = 0;
 static bool malloc_debug_memset = false;
 
 static void (*error_callback)(const char *) = NULL;
@@ -71,6 +101,54 @@ MEM_INLINE void update_maximum(size_t *maximum_value, size_t value)
 #endif
 }
 
+MEM_INLINE MemStatsSlot *mem_stats_slot_get(void)
+{
+  int slot = mem_stats_slot_index;
+  if (UNLIKELY(slot < 0)) {
+    slot = (int)(atomic_add_and_fetch_u(&mem_stats_slot_next, 1) % MEM_STATS_SLOTS);
+    mem_stats_slot_index = slot;
+  }
+  return &mem_stats_slots[slot];
+}
+
+MEM_INLINE size_t mem_stats_mem_in_use(void)
+{
+  size_t total = 0;
+  for (int i = 0; i < MEM_STATS_SLOTS; i++) {
+    total += mem_stats_slots[i].mem_in_use;
+  }
+  return total;
+}
+
+MEM_INLINE unsigned int mem_stats_totblock(void)
+{
+  unsigned int total = 0;
+  for (int i = 0; i < MEM_STATS_SLOTS; i++) {
+    total += mem_stats_slots[i].totblock;
+  }
+  return total;
+}
+
+MEM_INLINE void mem_stats_block_add(size_t len)
+{
+  MemStatsSlot *slot = mem_stats_slot_get();
+  atomic_add_and_fetch_u(&slot->totblock, 1);
+  atomic_add_and_fetch_z(&slot->mem_in_use, len);
+
+  const size_t since = atomic_add_and_fetch_z(&slot->mem_since_peak_check, len);
+  if (UNLIKELY(since >= MEM_STATS_PEAK_CHECK_THRESHOLD)) {
+    atomic_cas_z(&slot->mem_since_peak_check, since, 0);
+    update_maximum(&peak_mem, mem_stats_mem_in_use());
+  }
+}
+
+MEM_INLINE void mem_stats_block_sub(size_t len)
+{
+  MemStatsSlot *slot = mem_stats_slot_get();
+  atomic_sub_and_fetch_u(&slot->totblock, 1);
+  atomic_sub_and_fetch_z(&slot->mem_in_use, len);
+}
+
 #ifdef __GNUC__
 __attribute__((format(printf, 1, 2)))
 #endif
@@ -116,8 +194,7 @@ void MEM_lockfree_freeN(void *vmemh)
     return;
   }
 
-  atomic_sub_and_fetch_u(&totblock, 1);
-  atomic_sub_and_fetch_z(&mem_in_use, len);
+  mem_stats_block_sub(len);
 
   if (UNLIKELY(malloc_debug_memset && len)) {
     memset(memh + 1, 255, len);
@@ -237,16 +314,14 @@ void *MEM_lockfree_callocN(size_t len, const char *str)
 
   if (LIKELY(memh)) {
     memh->len = len;
-    atomic_add_and_fetch_u(&totblock, 1);
-    atomic_add_and_fetch_z(&mem_in_use, len);
-    update_maximum(&peak_mem, mem_in_use);
+    mem_stats_block_add(len);
 
     return PTR_FROM_MEMHEAD(memh);
   }
   print_error("Calloc returns null: len=" SIZET_FORMAT " in %s, total %u\n",
               SIZET_ARG(len),
               str,
-              (unsigned int)mem_in_use);
+              (unsigned int)mem_stats_mem_in_use());
   return NULL;
 }
 
@@ -260,7 +335,7 @@ void *MEM_lockfree_calloc_arrayN(size_t len, size_t size, const char *str)
         SIZET_ARG(len),
         SIZET_ARG(size),
         str,
-        (unsigned int)mem_in_use);
+        (unsigned int)mem_stats_mem_in_use());
     abort();
     return NULL;
   }
@@ -282,16 +357,14 @@ void *MEM_lockfree_mallocN(size_t len, const char *str)
     }
 
     memh->len = len;
-    atomic_add_and_fetch_u(&totblock, 1);
-    atomic_add_and_fetch_z(&mem_in_use, len);
-    update_maximum(&peak_mem, mem_in_use);
+    mem_stats_block_add(len);
 
     return PTR_FROM_MEMHEAD(memh);
   }
   print_error("Malloc returns null: len=" SIZET_FORMAT " in %s, total %u\n",
               SIZET_ARG(len),
               str,
-              (unsigned int)mem_in_use);
+              (unsigned int)mem_stats_mem_in_use());
   return NULL;
 }
 
@@ -305,7 +378,7 @@ void *MEM_lockfree_malloc_arrayN(size_t len, size_t size, const char *str)
         SIZET_ARG(len),
         SIZET_ARG(size),
         str,
-        (unsigned int)mem_in_use);
+        (unsigned int)mem_stats_mem_in_use());
     abort();
     return NULL;
   }
@@ -353,16 +426,14 @@ void *MEM_lockfree_mallocN_aligned(size_t len, size_t alignment, const char *str
 
     memh->len = len | (size_t)MEMHEAD_ALIGN_FLAG;
     memh->alignment = (short)alignment;
-    atomic_add_and_fetch_u(&totblock, 1);
-    atomic_add_and_fetch_z(&mem_in_use, len);
-    update_maximum(&peak_mem, mem_in_use);
+    mem_stats_block_add(len);
 
     return PTR_FROM_MEMHEAD(memh);
   }
   print_error("Malloc returns null: len=" SIZET_FORMAT " in %s, total %u\n",
               SIZET_ARG(len),
               str,
-              (unsigned int)mem_in_use);
+              (unsigned int)mem_stats_mem_in_use());
   return NULL;
 }
 
@@ -382,7 +453,7 @@ void MEM_lockfree_callbackmemlist(void (*func)(void *))
 
 void MEM_lockfree_printmemlist_stats(void)
 {
-  printf("\ntotal memory len: %.3f MB\n", (double)mem_in_use / (double)(1024 * 1024));
+  printf("\ntotal memory len: %.3f MB\n", (double)mem_stats_mem_in_use() / (double)(1024 * 1024));
   printf("peak memory len: %.3f MB\n", (double)peak_mem / (double)(1024 * 1024));
   printf(
       "\nFor more detailed per-block statistics run Blender with memory debugging command line "
@@ -411,22 +482,25 @@ void MEM_lockfree_set_memory_debug(void)
 
 size_t MEM_lockfree_get_memory_in_use(void)
 {
-  return mem_in_use;
+  return mem_stats_mem_in_use();
 }
 
 unsigned int MEM_lockfree_get_memory_blocks_in_use(void)
 {
-  return totblock;
+  return mem_stats_totblock();
 }
 
 /* dummy */
 void MEM_lockfree_reset_peak_memory(void)
 {
-  peak_mem = mem_in_use;
+  peak_mem = mem_stats_mem_in_use();
 }
 
 size_t MEM_lockfree_get_peak_memory(void)
 {
+  /* The peak is only re-checked when a slot grows past its threshold, make sure the current
+   * usage is taken into account as well. */
+  update_maximum(&peak_mem, mem_stats_mem_in_use());
   return peak_mem;
 }
 
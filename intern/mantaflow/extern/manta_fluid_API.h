@@ -71,6 +71,7 @@ bool manta_has_guiding(struct MANTA *fluid,
                        struct FluidModifierData *fmd,
                        int framenr,
                        bool domain);
+void manta_cache_read_ahead(struct MANTA *fluid, struct FluidModifierData *fmd, int framenr);
 
 void manta_update_variables(struct MANTA *fluid, struct FluidModifierData *fmd);
 int manta_get_frame(struct MANTA *fluid);
@@ -2255,6 +2255,42 @@ bool MANTA::hasGuiding(FluidModifierData *fmd, int framenr, bool sourceDomain)
   return exists;
 }
 
+static void fileReadAhead(const string &file)
+{
+  if (BLI_exists(file.c_str())) {
+    BLI_file_read_ahead(file.c_str());
+  }
+}
+
+void MANTA::cacheReadAhead(FluidModifierData *fmd, int framenr)
+{
+  if (with_debug)
+    cout << "MANTA::cacheReadAhead()" << endl;
+
+  /* Decompression has to happen on the main thread inside the Mantaflow interpreter, but the
+   * file I/O does not: ask the OS to pull the files of an upcoming frame into its cache while
+   * the current frame is still playing. Uses the same naming as the has* checks above. */
+  string extension = getCacheFileEnding(fmd->domain->cache_data_format);
+
+  fileReadAhead(getFile(
+      fmd, FLUID_DOMAIN_DIR_CONFIG, FLUID_NAME_CONFIG, FLUID_DOMAIN_EXTENSION_UNI, framenr));
+  fileReadAhead(getFile(fmd, FLUID_DOMAIN_DIR_DATA, FLUID_NAME_DATA, extension, framenr));
+  if (mUsingNoise) {
+    fileReadAhead(getFile(fmd, FLUID_DOMAIN_DIR_NOISE, FLUID_NAME_NOISE, extension, framenr));
+  }
+  if (mUsingMesh) {
+    string mesh_extension = getCacheFileEnding(fmd->domain->cache_mesh_format);
+    fileReadAhead(getFile(fmd, FLUID_DOMAIN_DIR_MESH, FLUID_NAME_MESH, mesh_extension, framenr));
+  }
+  if (mUsingDrops || mUsingBubbles || mUsingFloats || mUsingTracers) {
+    fileReadAhead(
+        getFile(fmd, FLUID_DOMAIN_DIR_PARTICLES, FLUID_NAME_PARTICLES, extension, framenr));
+  }
+  if (mUsingGuiding) {
+    fileReadAhead(getFile(fmd, FLUID_DOMAIN_DIR_GUIDE, FLUID_NAME_GUIDING, extension, framenr));
+  }
+}
+
 string MANTA::getDirectory(FluidModifierData *fmd, string subdirectory)
 {
   char directory[FILE_MAX];
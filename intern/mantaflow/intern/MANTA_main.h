@@ -116,6 +116,9 @@ struct MANTA {
   bool hasParticles(FluidModifierData *fmd, int framenr);
   bool hasGuiding(FluidModifierData *fmd, int framenr, bool sourceDomain);
 
+  /* Hint the OS to load the cache files of a frame into memory in the background. */
+  void cacheReadAhead(FluidModifierData *fmd, int framenr);
+
   inline size_t getTotalCells()
   {
     return mTotalCells;
@@ -149,6 +149,11 @@ bool manta_has_guiding(MANTA *fluid, FluidModifierData *fmd, int framenr, bool d
   return fluid->hasGuiding(fmd, framenr, domain);
 }
 
+void manta_cache_read_ahead(MANTA *fluid, FluidModifierData *fmd, int framenr)
+{
+  fluid->cacheReadAhead(fmd, framenr);
+}
+
 void manta_update_variables(MANTA *fluid, FluidModifierData *fmd)
 {
   fluid->updateVariables(fmd);
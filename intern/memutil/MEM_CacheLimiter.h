@@ -66,6 +66,8 @@ void MEM_CacheLimiter_set_maximum(size_t m);
 size_t MEM_CacheLimiter_get_maximum();
 void MEM_CacheLimiter_set_disabled(bool disabled);
 bool MEM_CacheLimiter_is_disabled(void);
+void MEM_CacheLimiter_set_external_usage_func(size_t (*func)(void));
+size_t MEM_CacheLimiter_get_external_usage(void);
 };
 #endif
 
@@ -201,6 +203,13 @@ template<class T> class MEM_CacheLimiter {
 
     mem_in_use = get_memory_in_use();
 
+    /* Memory held by caches which are not managed by this limiter (the sequencer cache for
+     * example) counts against the same budget. When measuring globally this is already
+     * included in MEM_get_memory_in_use(). */
+    if (data_size_func) {
+      mem_in_use += MEM_CacheLimiter_get_external_usage();
+    }
+
     if (mem_in_use <= max) {
       return;
     }
@@ -45,11 +45,17 @@ typedef int (*MEM_CacheLimiter_ItemPriority_Func)(void *, int);
 /* function to check whether item could be destroyed */
 typedef bool (*MEM_CacheLimiter_ItemDestroyable_Func)(void *);
 
+/* function used to measure memory used by caches which are not managed by any
+ * limiter but still count against the shared cache budget */
+typedef size_t (*MEM_CacheLimiter_ExternalUsage_Func)(void);
+
 #ifndef __MEM_CACHELIMITER_H__
 void MEM_CacheLimiter_set_maximum(size_t m);
 size_t MEM_CacheLimiter_get_maximum(void);
 void MEM_CacheLimiter_set_disabled(bool disabled);
 bool MEM_CacheLimiter_is_disabled(void);
+void MEM_CacheLimiter_set_external_usage_func(MEM_CacheLimiter_ExternalUsage_Func func);
+size_t MEM_CacheLimiter_get_external_usage(void);
 #endif /* __MEM_CACHELIMITER_H__ */
 
 /**
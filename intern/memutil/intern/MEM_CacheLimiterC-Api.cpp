@@ -51,6 +51,18 @@ bool MEM_CacheLimiter_is_disabled(void)
   return is_disabled;
 }
 
+static MEM_CacheLimiter_ExternalUsage_Func external_usage_func = NULL;
+
+void MEM_CacheLimiter_set_external_usage_func(MEM_CacheLimiter_ExternalUsage_Func func)
+{
+  external_usage_func = func;
+}
+
+size_t MEM_CacheLimiter_get_external_usage(void)
+{
+  return external_usage_func ? external_usage_func() : 0;
+}
+
 class MEM_CacheLimiterHandleCClass;
 class MEM_CacheLimiterCClass;
 
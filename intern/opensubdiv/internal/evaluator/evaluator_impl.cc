@@ -763,9 +763,13 @@ OpenSubdiv_EvaluatorImpl::~OpenSubdiv_EvaluatorImpl()
 }
 
 OpenSubdiv_EvaluatorImpl *openSubdiv_createEvaluatorInternal(
-    OpenSubdiv_TopologyRefiner *topology_refiner)
+    OpenSubdiv_TopologyRefiner *topology_refiner, eOpenSubdivEvaluator evaluator_type)
 {
   using blender::opensubdiv::vector;
+  // Only the CPU evaluator is implemented here so far: evaluator_type is
+  // accepted so GPU compute evaluation can be added behind this API without
+  // changing all creation call sites again.
+  (void)evaluator_type;
   TopologyRefiner *refiner = topology_refiner->impl->topology_refiner;
   if (refiner == NULL) {
     // Happens on bad topology.
@@ -19,6 +19,8 @@
 #ifndef OPENSUBDIV_EVALUATOR_CAPI_H_
 #define OPENSUBDIV_EVALUATOR_CAPI_H_
 
+#include "opensubdiv_capi_type.h"  // For eOpenSubdivEvaluator.
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -126,8 +128,11 @@ typedef struct OpenSubdiv_Evaluator {
   struct OpenSubdiv_EvaluatorImpl *impl;
 } OpenSubdiv_Evaluator;
 
+// NOTE: Only OPENSUBDIV_EVALUATOR_CPU is implemented at this point, requesting
+// any other evaluator type falls back to the CPU one. The argument exists so
+// the GPU compute backend can be slotted in without another API change.
 OpenSubdiv_Evaluator *openSubdiv_createEvaluatorFromTopologyRefiner(
-    struct OpenSubdiv_TopologyRefiner *topology_refiner);
+    struct OpenSubdiv_TopologyRefiner *topology_refiner, eOpenSubdivEvaluator evaluator_type);
 
 void openSubdiv_deleteEvaluator(OpenSubdiv_Evaluator *evaluator);
 
@@ -63,9 +63,10 @@ typedef struct rbConstraint rbConstraint;
 
 /* Setup ---------------------------- */
 
-/* Create a new dynamics world instance */
-/* TODO: add args to set the type of constraint solvers, etc. */
-rbDynamicsWorld *RB_dworld_new(const float gravity[3]);
+/* Create a new dynamics world instance.
+ * num_solver_threads > 1 enables Bullet's island-parallel dispatcher and constraint solving;
+ * pass 1 for the sequential world. */
+rbDynamicsWorld *RB_dworld_new(const float gravity[3], int num_solver_threads);
 
 /* Delete the given dynamics world, and free any extra data it may require */
 void RB_dworld_delete(rbDynamicsWorld *world);
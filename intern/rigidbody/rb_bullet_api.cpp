@@ -63,9 +63,13 @@
 #include "LinearMath/btTransform.h"
 #include "LinearMath/btVector3.h"
 
+#include "BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h"
 #include "BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.h"
 #include "BulletCollision/Gimpact/btGImpactCollisionAlgorithm.h"
 #include "BulletCollision/Gimpact/btGImpactShape.h"
+#include "BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h"
+#include "BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h"
+#include "LinearMath/btThreads.h"
 
 struct rbDynamicsWorld {
   btDiscreteDynamicsWorld *dynamicsWorld;
@@ -73,6 +77,8 @@ struct rbDynamicsWorld {
   btDispatcher *dispatcher;
   btBroadphaseInterface *pairCache;
   btConstraintSolver *constraintSolver;
+  /* Large-island solver of the multithreaded world, NULL for the sequential world. */
+  btConstraintSolver *constraintSolverMt;
   btOverlapFilterCallback *filterCallback;
 };
 struct rbRigidBody {
@@ -136,14 +142,25 @@ static inline void copy_quat_btquat(float quat[4], const btQuaternion &btquat)
 
 /* Setup ---------------------------- */
 
-rbDynamicsWorld *RB_dworld_new(const float gravity[3])
+rbDynamicsWorld *RB_dworld_new(const float gravity[3], int num_solver_threads)
 {
   rbDynamicsWorld *world = new rbDynamicsWorld;
+  const bool multithreaded = (num_solver_threads > 1);
+
+  if (multithreaded && btGetTaskScheduler() == NULL) {
+    /* The scheduler is process-wide; all multithreaded worlds share it. */
+    btSetTaskScheduler(btCreateDefaultTaskScheduler());
+  }
 
   /* collision detection/handling */
   world->collisionConfiguration = new btDefaultCollisionConfiguration();
 
-  world->dispatcher = new btCollisionDispatcher(world->collisionConfiguration);
+  if (multithreaded) {
+    world->dispatcher = new btCollisionDispatcherMt(world->collisionConfiguration);
+  }
+  else {
+    world->dispatcher = new btCollisionDispatcher(world->collisionConfiguration);
+  }
   btGImpactCollisionAlgorithm::registerAlgorithm((btCollisionDispatcher *)world->dispatcher);
 
   world->pairCache = new btDbvtBroadphase();
@@ -152,11 +169,28 @@ rbDynamicsWorld *RB_dworld_new(const float gravity[3])
   world->pairCache->getOverlappingPairCache()->setOverlapFilterCallback(world->filterCallback);
 
   /* constraint solving */
-  world->constraintSolver = new btSequentialImpulseConstraintSolver();
+  if (multithreaded) {
+    /* Small islands are distributed over a pool of sequential solvers, large islands go to a
+     * single solver that is itself parallel over the island's constraints. */
+    world->constraintSolver = new btConstraintSolverPoolMt(num_solver_threads);
+    world->constraintSolverMt = new btSequentialImpulseConstraintSolverMt();
+
+    world->dynamicsWorld = new btDiscreteDynamicsWorldMt(
+        world->dispatcher,
+        world->pairCache,
+        (btConstraintSolverPoolMt *)world->constraintSolver,
+        world->constraintSolverMt,
+        world->collisionConfiguration);
+  }
+  else {
+    world->constraintSolver = new btSequentialImpulseConstraintSolver();
+    world->constraintSolverMt = NULL;
 
-  /* world */
-  world->dynamicsWorld = new btDiscreteDynamicsWorld(
-      world->dispatcher, world->pairCache, world->constraintSolver, world->collisionConfiguration);
+    world->dynamicsWorld = new btDiscreteDynamicsWorld(world->dispatcher,
+                                                       world->pairCache,
+                                                       world->constraintSolver,
+                                                       world->collisionConfiguration);
+  }
 
   RB_dworld_set_gravity(world, gravity);
 
@@ -167,6 +201,7 @@ void RB_dworld_delete(rbDynamicsWorld *world)
 {
   /* bullet doesn't like if we free these in a different order */
   delete world->dynamicsWorld;
+  delete world->constraintSolverMt;
   delete world->constraintSolver;
   delete world->pairCache;
   delete world->dispatcher;
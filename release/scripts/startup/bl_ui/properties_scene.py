@@ -413,6 +413,37 @@ class SCENE_PT_rigid_body_field_weights(RigidBodySubPanel, Panel):
         effector_weights_ui(self, rbw.effector_weights, 'RIGID_BODY')
 
 
+class SCENE_PT_eval_statistics(SceneButtonsPanel, Panel):
+    bl_label = "Evaluation Statistics"
+    bl_options = {'DEFAULT_CLOSED'}
+
+    @classmethod
+    def poll(cls, context):
+        return bpy.app.debug_depsgraph_time
+
+    def draw(self, context):
+        layout = self.layout
+
+        depsgraph = context.evaluated_depsgraph_get()
+
+        times = []
+        for ob in context.view_layer.objects:
+            eval_time = depsgraph.debug_id_eval_time(id=ob)
+            if eval_time > 0.0:
+                times.append((eval_time, ob.name))
+        times.sort(reverse=True)
+
+        if not times:
+            layout.label(text="No timing recorded in the last evaluation")
+            return
+
+        col = layout.column(align=True)
+        for eval_time, name in times[:25]:
+            split = col.split(factor=0.7)
+            split.label(text=name, translate=False)
+            split.label(text="%.2f ms" % (eval_time * 1000.0), translate=False)
+
+
 class SCENE_PT_custom_props(SceneButtonsPanel, PropertyPanel, Panel):
     _context_path = "scene"
     _property_type = bpy.types.Scene
@@ -431,6 +462,7 @@ classes = (
     SCENE_PT_rigid_body_world_settings,
     SCENE_PT_rigid_body_cache,
     SCENE_PT_rigid_body_field_weights,
+    SCENE_PT_eval_statistics,
     SCENE_PT_custom_props,
 )
 
@@ -176,15 +176,15 @@ void blf_batch_draw_begin(FontBLF *font)
 
 static GPUTexture *blf_batch_cache_texture_load(void)
 {
-  GlyphCacheBLF *gc = g_batch.glyph_cache;
-  BLI_assert(gc);
-  BLI_assert(gc->bitmap_len > 0);
+  FontBLF *font = g_batch.font;
+  BLI_assert(font);
+  BLI_assert(font->bitmap_len > 0);
 
-  if (gc->bitmap_len > gc->bitmap_len_landed) {
-    const int tex_width = GPU_texture_width(gc->texture);
+  if (font->bitmap_len > font->bitmap_len_landed) {
+    const int tex_width = GPU_texture_width(font->texture);
 
-    int bitmap_len_landed = gc->bitmap_len_landed;
-    int remain = gc->bitmap_len - bitmap_len_landed;
+    int bitmap_len_landed = font->bitmap_len_landed;
+    int remain = font->bitmap_len - bitmap_len_landed;
     int offset_x = bitmap_len_landed % tex_width;
     int offset_y = bitmap_len_landed / tex_width;
 
@@ -192,9 +192,9 @@ static GPUTexture *blf_batch_cache_texture_load(void)
     while (remain) {
       int remain_row = tex_width - offset_x;
       int width = remain > remain_row ? remain_row : remain;
-      GPU_texture_update_sub(gc->texture,
+      GPU_texture_update_sub(font->texture,
                              GPU_DATA_UBYTE,
-                             &gc->bitmap_result[bitmap_len_landed],
+                             &font->bitmap_result[bitmap_len_landed],
                              offset_x,
                              offset_y,
                              0,
@@ -208,10 +208,10 @@ static GPUTexture *blf_batch_cache_texture_load(void)
       offset_y += 1;
     }
 
-    gc->bitmap_len_landed = bitmap_len_landed;
+    font->bitmap_len_landed = bitmap_len_landed;
   }
 
-  return gc->texture;
+  return font->texture;
 }
 
 void blf_batch_draw(void)
@@ -1285,6 +1285,13 @@ void blf_font_free(FontBLF *font)
 
   blf_kerning_cache_clear(font);
 
+  if (font->texture) {
+    GPU_texture_free(font->texture);
+  }
+  if (font->bitmap_result) {
+    MEM_freeN(font->bitmap_result);
+  }
+
   FT_Done_Face(font->face);
   if (font->filename) {
     MEM_freeN(font->filename);
@@ -199,6 +199,10 @@ void blf_glyph_cache_clear(FontBLF *font)
     blf_glyph_cache_free(gc);
   }
 
+  /* No glyph referencing the shared pixel buffer is left: recycle it. */
+  font->bitmap_len = 0;
+  font->bitmap_len_landed = 0;
+
   BLI_spin_unlock(font->glyph_cache_mutex);
 }
 
@@ -210,12 +214,6 @@ void blf_glyph_cache_free(GlyphCacheBLF *gc)
       blf_glyph_free(g);
     }
   }
-  if (gc->texture) {
-    GPU_texture_free(gc->texture);
-  }
-  if (gc->bitmap_result) {
-    MEM_freeN(gc->bitmap_result);
-  }
   MEM_freeN(gc);
 }
 
@@ -490,29 +488,29 @@ void blf_glyph_render(FontBLF *font, GlyphCacheBLF *gc, GlyphBLF *g, float x, fl
       font->tex_size_max = GPU_max_texture_size();
     }
 
-    g->offset = gc->bitmap_len;
+    g->offset = font->bitmap_len;
 
     int buff_size = g->dims[0] * g->dims[1];
-    int bitmap_len = gc->bitmap_len + buff_size;
+    int bitmap_len = font->bitmap_len + buff_size;
 
-    if (bitmap_len > gc->bitmap_len_alloc) {
+    if (bitmap_len > font->bitmap_len_alloc) {
       int w = font->tex_size_max;
       int h = bitmap_len / w + 1;
 
-      gc->bitmap_len_alloc = w * h;
-      gc->bitmap_result = MEM_reallocN(gc->bitmap_result, (size_t)gc->bitmap_len_alloc);
+      font->bitmap_len_alloc = w * h;
+      font->bitmap_result = MEM_reallocN(font->bitmap_result, (size_t)font->bitmap_len_alloc);
 
       /* Keep in sync with the texture. */
-      if (gc->texture) {
-        GPU_texture_free(gc->texture);
+      if (font->texture) {
+        GPU_texture_free(font->texture);
       }
-      gc->texture = GPU_texture_create_2d(__func__, w, h, 1, GPU_R8, NULL);
+      font->texture = GPU_texture_create_2d(__func__, w, h, 1, GPU_R8, NULL);
 
-      gc->bitmap_len_landed = 0;
+      font->bitmap_len_landed = 0;
     }
 
-    memcpy(&gc->bitmap_result[gc->bitmap_len], g->bitmap, (size_t)buff_size);
-    gc->bitmap_len = bitmap_len;
+    memcpy(&font->bitmap_result[font->bitmap_len], g->bitmap, (size_t)buff_size);
+    font->bitmap_len = bitmap_len;
 
     gc->glyphs_len_free--;
     g->glyph_cache = gc;
@@ -528,10 +526,8 @@ void blf_glyph_render(FontBLF *font, GlyphCacheBLF *gc, GlyphBLF *g, float x, fl
     }
   }
 
-  if (g_batch.glyph_cache != g->glyph_cache) {
-    blf_batch_draw();
-    g_batch.glyph_cache = g->glyph_cache;
-  }
+  /* Glyphs of all sizes and styles of this font share one texture, so only a
+   * font change (handled in blf_batch_draw_begin) needs to break the batch. */
 
   if (font->flags & BLF_SHADOW) {
     rctf rect_ofs;
@@ -38,7 +38,6 @@ typedef struct BatchBLF {
   float ofs[2];    /* copy of font->pos */
   float mat[4][4]; /* previous call modelmatrix. */
   bool enabled, active, simple_shader;
-  struct GlyphCacheBLF *glyph_cache;
 } BatchBLF;
 
 extern BatchBLF g_batch;
@@ -73,13 +72,6 @@ typedef struct GlyphCacheBLF {
   /* fast ascii lookup */
   struct GlyphBLF *glyph_ascii_table[256];
 
-  /* texture array, to draw the glyphs. */
-  GPUTexture *texture;
-  char *bitmap_result;
-  int bitmap_len;
-  int bitmap_len_landed;
-  int bitmap_len_alloc;
-
   /* and the bigger glyph in the font. */
   int glyph_width_max;
   int glyph_height_max;
@@ -217,6 +209,15 @@ typedef struct FontBLF {
   /* max texture size. */
   int tex_size_max;
 
+  /* Glyph pixel buffer, shared by all glyph caches (sizes, styles) of this
+   * font so changing the size does not break draw-call batching. Glyphs are
+   * packed linearly, see GlyphBLF.offset. */
+  GPUTexture *texture;
+  char *bitmap_result;
+  int bitmap_len;
+  int bitmap_len_landed;
+  int bitmap_len_alloc;
+
   /* font options. */
   int flags;
 
@@ -199,6 +199,13 @@ void BKE_constraints_proxylocal_extract(struct ListBase *dst, struct ListBase *s
 bool BKE_constraints_proxylocked_owner(struct Object *ob, struct bPoseChannel *pchan);
 
 /* Constraint Evaluation function prototypes */
+void BKE_constraints_evalob_init(struct Depsgraph *depsgraph,
+                                 struct Scene *scene,
+                                 struct Object *ob,
+                                 void *subdata,
+                                 short datatype,
+                                 struct bConstraintOb *cob);
+void BKE_constraints_evalob_flush(struct bConstraintOb *cob);
 struct bConstraintOb *BKE_constraints_make_evalob(struct Depsgraph *depsgraph,
                                                   struct Scene *scene,
                                                   struct Object *ob,
@@ -33,6 +33,7 @@
 extern "C" {
 #endif
 
+struct BLI_mempool_cache;
 struct BMesh;
 struct BlendDataReader;
 struct BlendWriter;
@@ -406,6 +407,10 @@ void CustomData_set_layer_flag(struct CustomData *data, int type, int flag);
 void CustomData_clear_layer_flag(struct CustomData *data, int type, int flag);
 
 void CustomData_bmesh_set_default(struct CustomData *data, void **block);
+void CustomData_bmesh_ensure_block(struct CustomData *data, void **block);
+void CustomData_bmesh_ensure_block_cached(struct CustomData *data,
+                                          void **block,
+                                          struct BLI_mempool_cache *cache);
 void CustomData_bmesh_free_block(struct CustomData *data, void **block);
 void CustomData_bmesh_free_block_data(struct CustomData *data, void *block);
 void CustomData_bmesh_free_block_data_exclude_by_type(struct CustomData *data,
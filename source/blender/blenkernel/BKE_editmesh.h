@@ -78,6 +78,13 @@ typedef struct BMEditMesh {
   /** Temp variables for x-mirror editing (-1 when the layer does not exist). */
   int mirror_cdlayer;
 
+  /**
+   * Lazily built spatial hash of the vertices for bounded-radius proximity lookups
+   * (x-mirror, symmetry snapping). Kept up to date over vertex moves via
+   * #BKE_editmesh_spatial_cache_update_verts, must be freed on any topology change.
+   */
+  struct BMEditMeshSpatialCache *spatial_cache;
+
   /**
    * ID data is older than edit-mode data.
    * Set #Main.is_memfile_undo_flush_needed when enabling.
@@ -118,6 +125,18 @@ const float (*BKE_editmesh_vert_coords_when_deformed(struct Depsgraph *depsgraph
                                                      int *r_vert_len,
                                                      bool *r_is_alloc))[3];
 
+struct BMEditMeshSpatialCache *BKE_editmesh_spatial_cache_ensure(BMEditMesh *em,
+                                                                 float cell_size_min);
+void BKE_editmesh_spatial_cache_update_verts(BMEditMesh *em,
+                                             const struct BMPartialUpdate *bmpinfo);
+void BKE_editmesh_spatial_cache_free(BMEditMesh *em);
+struct BMVert *BKE_editmesh_spatial_cache_find_nearest(BMEditMesh *em,
+                                                       const float co[3],
+                                                       float maxdist,
+                                                       bool (*filter_fn)(struct BMVert *v,
+                                                                         void *user_data),
+                                                       void *user_data);
+
 void BKE_editmesh_lnorspace_update(BMEditMesh *em, struct Mesh *me);
 void BKE_editmesh_ensure_autosmooth(BMEditMesh *em, struct Mesh *me);
 struct BoundBox *BKE_editmesh_cage_boundbox_get(BMEditMesh *em);
@@ -245,6 +245,14 @@ int BKE_fcurve_pathcache_find_array(struct FCurvePathCache *fcache,
                                     struct FCurve **fcurve_result,
                                     int fcurve_result_len);
 
+/* Baked uniform-sample tables for playback, built lazily per curve. */
+void BKE_fcurve_bake_cache_set_enabled(const bool enabled);
+void BKE_fcurve_bake_cache_invalidate(struct FCurve *fcu);
+bool BKE_fcurve_bake_cache_evaluate(struct FCurve *fcu, float evaltime, float *r_value);
+
+/* Changes whenever any F-Curve is keyframe-edited or freed, for value caches. */
+uint64_t BKE_fcurve_edit_generation(void);
+
 /* get the time extents for F-Curve */
 bool BKE_fcurve_calc_range(
     struct FCurve *fcu, float *min, float *max, const bool do_sel_only, const bool do_min_length);
@@ -83,6 +83,11 @@ typedef enum {
   eGpencilModifierTypeFlag_NoUserAdd = (1 << 5),
   /** Can't be applied. */
   eGpencilModifierTypeFlag_NoApply = (1 << 6),
+  /**
+   * The #GpencilModifierTypeInfo.deformStroke callback only reads shared data and writes to the
+   * stroke it is given, so the strokes of a frame can be deformed from multiple threads at once.
+   */
+  eGpencilModifierTypeFlag_SupportsThreading = (1 << 7),
 } GpencilModifierTypeFlag;
 
 typedef void (*GreasePencilIDWalkFunc)(void *userData,
@@ -67,6 +67,8 @@ void *BKE_libblock_alloc(struct Main *bmain, short type, const char *name, const
     ATTR_WARN_UNUSED_RESULT;
 void BKE_libblock_init_empty(struct ID *id) ATTR_NONNULL(1);
 
+size_t BKE_libblock_memory_usage_estimate(struct ID *id) ATTR_NONNULL(1);
+
 /* *** ID's session_uuid management. *** */
 
 /* When an ID's uuid is of that value, it is unset/invalid (e.g. for runtime IDs, etc.). */
@@ -161,6 +163,10 @@ void BLI_libblock_ensure_unique_name(struct Main *bmain, const char *name) ATTR_
 struct ID *BKE_libblock_find_name(struct Main *bmain,
                                   const short type,
                                   const char *name) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL();
+struct ID *BKE_libblock_find_session_uuid(struct Main *bmain,
+                                          const short type,
+                                          const uint32_t session_uuid) ATTR_WARN_UNUSED_RESULT
+    ATTR_NONNULL();
 
 /**
  * Duplicate (a.k.a. deep copy) common processing options.
@@ -250,7 +256,8 @@ struct ID *BKE_id_copy_ex(struct Main *bmain,
                           const int flag);
 struct ID *BKE_id_copy_for_duplicate(struct Main *bmain,
                                      struct ID *id,
-                                     const uint duplicate_flags);
+                                     const uint duplicate_flags,
+                                     const int copy_flags);
 
 void BKE_lib_id_swap(struct Main *bmain, struct ID *id_a, struct ID *id_b);
 void BKE_lib_id_swap_full(struct Main *bmain, struct ID *id_a, struct ID *id_b);
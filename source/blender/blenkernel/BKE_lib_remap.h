@@ -100,6 +100,22 @@ void BKE_libblock_remap_locked(struct Main *bmain,
 void BKE_libblock_remap(struct Main *bmain, void *old_idv, void *new_idv, const short remap_flags)
     ATTR_NONNULL(1, 2);
 
+/** A single remapping for the batched remap functions. */
+typedef struct IDRemapPair {
+  struct ID *old_id;
+  /** May be NULL, in which case usages of `old_id` are unlinked. */
+  struct ID *new_id;
+} IDRemapPair;
+
+void BKE_libblock_remap_multiple_locked(struct Main *bmain,
+                                        const IDRemapPair *remaps,
+                                        const int remaps_num,
+                                        const short remap_flags) ATTR_NONNULL(1, 2);
+void BKE_libblock_remap_multiple(struct Main *bmain,
+                                 const IDRemapPair *remaps,
+                                 const int remaps_num,
+                                 const short remap_flags) ATTR_NONNULL(1, 2);
+
 void BKE_libblock_unlink(struct Main *bmain,
                          void *idv,
                          const bool do_flag_never_null,
@@ -195,6 +195,13 @@ typedef struct Main {
   /* IDMap of IDs. Currently used when reading (expanding) libraries. */
   struct IDNameLib_Map *id_map;
 
+  /**
+   * Lazily created cache for fast `name -> ID` and `session_uuid -> ID` lookups,
+   * see #BKE_main_idmap_ensure. Kept up to date by the ID management code in `lib_id.c`,
+   * code modifying ID names or listbases directly must invalidate it instead.
+   */
+  struct IDNameLib_Map *id_lookup_map;
+
   struct MainLock *lock;
 } Main;
 
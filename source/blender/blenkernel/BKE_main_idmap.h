@@ -70,6 +70,13 @@ struct ID *BKE_main_idmap_lookup_uuid(struct IDNameLib_Map *id_map,
                                       const uint session_uuid) ATTR_WARN_UNUSED_RESULT
     ATTR_NONNULL(1);
 
+/* Persistent per-Main lookup cache, see #Main.id_lookup_map. */
+
+struct IDNameLib_Map *BKE_main_idmap_ensure(struct Main *bmain) ATTR_NONNULL();
+void BKE_main_idmap_cache_insert_id(struct Main *bmain, struct ID *id) ATTR_NONNULL();
+void BKE_main_idmap_cache_remove_id(struct Main *bmain, struct ID *id) ATTR_NONNULL();
+void BKE_main_idmap_cache_invalidate(struct Main *bmain) ATTR_NONNULL();
+
 #ifdef __cplusplus
 }
 #endif
@@ -68,6 +68,8 @@ void BKE_object_free_softbody(struct Object *ob);
 void BKE_object_free_curve_cache(struct Object *ob);
 
 void BKE_object_free_derived_caches(struct Object *ob);
+/* Defined in `DerivedMesh.cc`. */
+void BKE_object_modifier_prefix_cache_free(struct Object *object);
 void BKE_object_free_caches(struct Object *object);
 
 void BKE_object_modifier_hook_reset(struct Object *ob, struct HookModifierData *hmd);
@@ -229,6 +231,7 @@ void BKE_boundbox_minmax(const struct BoundBox *bb,
                          float r_max[3]);
 
 struct BoundBox *BKE_object_boundbox_get(struct Object *ob);
+float BKE_object_camera_coverage_estimate(const struct Object *camera, const struct Object *ob);
 void BKE_object_dimensions_get(struct Object *ob, float r_vec[3]);
 void BKE_object_dimensions_set_ex(struct Object *ob,
                                   const float value[3],
@@ -190,6 +190,13 @@ typedef struct PTCacheBaker {
   int render;
   int anim_init;
   int quick_step;
+  /* Optional frame sub-range to bake (inclusive), both 0 to bake the full cache range.
+   * Meant for distributing a bake over several background instances which share one disk
+   * cache: the per-frame cache files written by each range simply merge in the common
+   * blendcache directory. A sub-range bake does not flag the cache as baked, since frames
+   * outside the range may still be missing. */
+  int range_startframe;
+  int range_endframe;
   struct PTCacheID pid;
 
   void (*update_progress)(void *data, float progress, int *cancel);
@@ -185,6 +185,13 @@ typedef struct Subdiv {
   /* Statistics for debugging. */
   SubdivStats stats;
 
+  /* Hash of the topology inputs (geometry arrays, creases, UV coordinates) of
+   * the coarse mesh this surface was last updated from. Allows deform-only
+   * mesh re-evaluations to keep the topology refiner and its stencil tables
+   * alive without re-running the converter comparison. Zero when the topology
+   * did not come from a mesh. */
+  uint64_t coarse_mesh_topology_hash;
+
   /* Cached values, are not supposed to be accessed directly. */
   struct {
     /* Indexed by base face index, element indicates total number of ptex
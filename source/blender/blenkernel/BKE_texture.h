@@ -94,6 +94,18 @@ void BKE_texture_get_value(const struct Scene *scene,
                            struct TexResult *texres,
                            bool use_color_management);
 
+/**
+ * Evaluate \a texture at \a num coordinates in one call,
+ * also initializes `texres[i].nor` to NULL for every sample.
+ */
+void BKE_texture_get_value_span(const struct Scene *scene,
+                                struct Tex *texture,
+                                const float (*tex_co)[3],
+                                struct TexResult *texres,
+                                const int num,
+                                struct ImagePool *pool,
+                                bool use_color_management);
+
 void BKE_texture_fetch_images_for_pool(struct Tex *texture, struct ImagePool *pool);
 
 #ifdef __cplusplus
@@ -39,8 +39,10 @@
 #include "BLI_bitmap.h"
 #include "BLI_blenlib.h"
 #include "BLI_float2.hh"
+#include "BLI_hash_mm2a.h"
 #include "BLI_linklist.h"
 #include "BLI_math.h"
+#include "BLI_profile.h"
 #include "BLI_task.h"
 #include "BLI_task.hh"
 #include "BLI_utildefines.h"
@@ -71,6 +73,8 @@
 
 #include "BLI_sys_types.h" /* for intptr_t support */
 
+#include "atomic_ops.h"
+
 #include "BKE_shrinkwrap.h"
 #include "DEG_depsgraph.h"
 #include "DEG_depsgraph_query.h"
@@ -969,6 +973,262 @@ static Mesh *modifier_modify_mesh_and_geometry_set(ModifierData *md,
   return mesh_output;
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Modifier Stack Prefix Cache
+ *
+ * Cache an intermediate result of the modifier stack so that tweaking the parameters of the
+ * last expensive constructive modifier does not re-evaluate the entire stack. A single snapshot
+ * is kept: the input mesh of the last constructive modifier in the cacheable prefix, together
+ * with a 64-bit hash of everything that snapshot depends on (modifier parameters, input
+ * geometry, requested data masks and the evaluated geometry of object dependencies). When the
+ * hash still matches on the next evaluation, the stack resumes from the snapshot.
+ *
+ * The cache lives on the original object (the evaluated copy is re-created on every depsgraph
+ * update) and is conservatively disabled for any prefix whose inputs cannot be hashed reliably:
+ * time dependent modifiers, geometry nodes, non-object ID dependencies and steps that require
+ * orco coordinates.
+ * \{ */
+
+struct ModifierPrefixCache {
+  /** Hash of everything the snapshot depends on, see #prefix_cache_calc_resume_point. */
+  uint64_t prefix_hash;
+  /** Number of modifier list links to skip when resuming from the snapshot. */
+  int resume_index;
+  /** Stack state just before the resume point's modifier. */
+  Mesh *mesh;
+};
+
+/** Protects the cache against concurrent evaluations from multiple depsgraphs. */
+static ThreadMutex prefix_cache_mutex = BLI_MUTEX_INITIALIZER;
+
+/** Monotonic stamp for evaluated meshes, used to detect changed object dependencies. */
+static uint64_t g_mesh_eval_generation = 0;
+
+void BKE_object_modifier_prefix_cache_free(Object *object)
+{
+  ModifierPrefixCache *cache = object->runtime.modifier_prefix_cache;
+  if (cache == nullptr) {
+    return;
+  }
+  if (cache->mesh != nullptr) {
+    BKE_id_free(nullptr, cache->mesh);
+  }
+  MEM_freeN(cache);
+  object->runtime.modifier_prefix_cache = nullptr;
+}
+
+struct PrefixCacheDepsData {
+  /** When null, only the eligibility of the dependencies is checked. */
+  BLI_HashMurmur2A *hash_lo;
+  BLI_HashMurmur2A *hash_hi;
+  bool eligible;
+};
+
+static void prefix_cache_hash_data(PrefixCacheDepsData *data, const void *buf, size_t len)
+{
+  BLI_hash_mm2a_add(data->hash_lo, static_cast<const uchar *>(buf), len);
+  BLI_hash_mm2a_add(data->hash_hi, static_cast<const uchar *>(buf), len);
+}
+
+/**
+ * Hash the full contents of one #CustomData domain: layer types, names and the layer data
+ * itself. All layers are inputs of the stack (UVs, vertex colors, skin radii, ...), so all of
+ * them must participate in the hash; layers referenced from another data-block
+ * (#CD_FLAG_NOFREE) flow into modifiers like owned ones and are hashed the same way.
+ *
+ * \return false when a layer cannot be hashed reliably because its elements own heap data
+ * (byte hashing would cover the pointers, not the contents), making the prefix ineligible.
+ */
+static bool prefix_cache_hash_customdata(PrefixCacheDepsData *data,
+                                         const CustomData *cdata,
+                                         const int totelem)
+{
+  prefix_cache_hash_data(data, &cdata->totlayer, sizeof(cdata->totlayer));
+  prefix_cache_hash_data(data, &totelem, sizeof(totelem));
+  for (int i = 0; i < cdata->totlayer; i++) {
+    const CustomDataLayer *layer = &cdata->layers[i];
+    prefix_cache_hash_data(data, &layer->type, sizeof(layer->type));
+    prefix_cache_hash_data(data, layer->name, sizeof(layer->name));
+    if (layer->data == nullptr) {
+      continue;
+    }
+    if (layer->type == CD_MDEFORMVERT) {
+      /* Vertex group elements hold pointers, hash the weights themselves. */
+      const MDeformVert *dvert = static_cast<const MDeformVert *>(layer->data);
+      for (int j = 0; j < totelem; j++) {
+        const MDeformVert *dv = &dvert[j];
+        prefix_cache_hash_data(data, &dv->totweight, sizeof(dv->totweight));
+        if (dv->dw != nullptr) {
+          prefix_cache_hash_data(data, dv->dw, sizeof(MDeformWeight) * size_t(dv->totweight));
+        }
+      }
+    }
+    else if (CustomData_layertype_is_dynamic(layer->type)) {
+      /* Elements own heap data (multires displacements, grid paint masks, ...). */
+      return false;
+    }
+    else {
+      prefix_cache_hash_data(data, layer->data, CustomData_sizeof(layer->type) * size_t(totelem));
+    }
+  }
+  return true;
+}
+
+static void prefix_cache_id_link_cb(void *userData,
+                                    Object *UNUSED(ob),
+                                    ID **idpoin,
+                                    int UNUSED(cb_flag))
+{
+  PrefixCacheDepsData *data = static_cast<PrefixCacheDepsData *>(userData);
+  ID *id = *idpoin;
+  if (id == nullptr) {
+    return;
+  }
+  /* Only object dependencies with stamped evaluated meshes can be hashed reliably. */
+  if (GS(id->name) != ID_OB) {
+    data->eligible = false;
+    return;
+  }
+  const Object *ob_dep = reinterpret_cast<const Object *>(id);
+  const Mesh *me_dep = BKE_object_get_evaluated_mesh(ob_dep);
+  if (me_dep == nullptr || me_dep->runtime.eval_generation == 0) {
+    data->eligible = false;
+    return;
+  }
+  if (data->hash_lo != nullptr) {
+    prefix_cache_hash_data(data, id->name, strlen(id->name));
+    prefix_cache_hash_data(data, &me_dep->runtime.eval_generation, sizeof(uint64_t));
+    prefix_cache_hash_data(data, ob_dep->obmat, sizeof(ob_dep->obmat));
+  }
+}
+
+/**
+ * Decide where evaluation could resume from a cached snapshot and hash everything the
+ * snapshot depends on.
+ *
+ * \return the number of modifier links (starting from \a md_begin) before the resume point,
+ * or -1 when the stack has no usable prefix. The resume point is the last constructive
+ * modifier whose whole input prefix is hashable, so that tweaking it only re-evaluates
+ * the (usually cheap) tail of the stack.
+ */
+static int prefix_cache_calc_resume_point(Scene *scene,
+                                          Object *ob,
+                                          const Mesh *mesh_input,
+                                          const float (*deformed_verts)[3],
+                                          const int num_deformed_verts,
+                                          ModifierData *md_begin,
+                                          CDMaskLink *md_datamask_begin,
+                                          const CustomData_MeshMasks *final_datamask,
+                                          const int required_mode,
+                                          const bool need_mapping,
+                                          uint64_t *r_hash)
+{
+  /* Pass 1: walk the stack mirroring the evaluation loop's skip logic to find the resume
+   * point. A candidate must directly follow another applied constructive modifier, so the
+   * snapshot state is a plain mesh without pending deformed coordinates. */
+  int resume_index = -1;
+  {
+    PrefixCacheDepsData check_data = {nullptr, nullptr, true};
+    ModifierData *md = md_begin;
+    CDMaskLink *md_datamask = md_datamask_begin;
+    bool prev_applied_constructive = false;
+    int walk_index = 0;
+    for (; md; md = md->next, md_datamask = md_datamask->next, walk_index++) {
+      const ModifierTypeInfo *mti = BKE_modifier_get_info((ModifierType)md->type);
+      if (!BKE_modifier_is_enabled(scene, md, required_mode)) {
+        continue;
+      }
+      if (need_mapping && !BKE_modifier_supports_mapping(md)) {
+        prev_applied_constructive = false;
+        continue;
+      }
+      if ((mti->flags & eModifierTypeFlag_RequiresOriginalData) ||
+          (md->type == eModifierType_Nodes) || BKE_modifier_depends_ontime(md)) {
+        break;
+      }
+      /* Orco evaluation runs every modifier a second time, which the cache cannot resume. */
+      const CustomData_MeshMasks *nextmask = md_datamask->next ? &md_datamask->next->mask :
+                                                                 final_datamask;
+      if ((md_datamask->mask.vmask | nextmask->vmask) & (CD_MASK_ORCO | CD_MASK_CLOTH_ORCO)) {
+        break;
+      }
+      if (mti->foreachIDLink != nullptr) {
+        check_data.eligible = true;
+        mti->foreachIDLink(md, ob, prefix_cache_id_link_cb, &check_data);
+        if (!check_data.eligible) {
+          break;
+        }
+      }
+      if (mti->type == eModifierTypeType_OnlyDeform) {
+        prev_applied_constructive = false;
+        continue;
+      }
+      if (prev_applied_constructive) {
+        resume_index = walk_index;
+      }
+      prev_applied_constructive = true;
+    }
+  }
+  if (resume_index <= 0) {
+    return -1;
+  }
+
+  /* Pass 2: hash everything evaluation of the prefix before the resume point depends on. */
+  BLI_HashMurmur2A hash_lo, hash_hi;
+  BLI_hash_mm2a_init(&hash_lo, 0);
+  BLI_hash_mm2a_init(&hash_hi, 0x652e5b65);
+  PrefixCacheDepsData data = {&hash_lo, &hash_hi, true};
+
+  const int counts[4] = {
+      mesh_input->totvert, mesh_input->totedge, mesh_input->totpoly, mesh_input->totloop};
+  prefix_cache_hash_data(&data, counts, sizeof(counts));
+  /* All layers of every domain: UVs, vertex colors, skin radii and the like drive or pass
+   * through the prefix just as much as the core geometry arrays do. */
+  if (!prefix_cache_hash_customdata(&data, &mesh_input->vdata, mesh_input->totvert) ||
+      !prefix_cache_hash_customdata(&data, &mesh_input->edata, mesh_input->totedge) ||
+      !prefix_cache_hash_customdata(&data, &mesh_input->pdata, mesh_input->totpoly) ||
+      !prefix_cache_hash_customdata(&data, &mesh_input->ldata, mesh_input->totloop) ||
+      !prefix_cache_hash_customdata(&data, &mesh_input->fdata, mesh_input->totface)) {
+    return -1;
+  }
+  /* Output of the leading deform-only section (shape keys, armatures, ...). */
+  if (deformed_verts != nullptr) {
+    prefix_cache_hash_data(&data, &num_deformed_verts, sizeof(num_deformed_verts));
+    prefix_cache_hash_data(&data, deformed_verts, sizeof(float[3]) * (size_t)num_deformed_verts);
+  }
+  prefix_cache_hash_data(&data, final_datamask, sizeof(*final_datamask));
+  prefix_cache_hash_data(&data, &required_mode, sizeof(required_mode));
+  prefix_cache_hash_data(&data, &need_mapping, sizeof(need_mapping));
+
+  {
+    ModifierData *md = md_begin;
+    CDMaskLink *md_datamask = md_datamask_begin;
+    for (int walk_index = 0; walk_index < resume_index;
+         md = md->next, md_datamask = md_datamask->next, walk_index++) {
+      const ModifierTypeInfo *mti = BKE_modifier_get_info((ModifierType)md->type);
+      const char enabled = BKE_modifier_is_enabled(scene, md, required_mode);
+      prefix_cache_hash_data(&data, &md->type, sizeof(md->type));
+      prefix_cache_hash_data(&data, &md->mode, sizeof(md->mode));
+      prefix_cache_hash_data(&data, &enabled, sizeof(enabled));
+      /* Parameters, skipping the shared #ModifierData header with its list pointers. */
+      if ((size_t)mti->structSize > sizeof(ModifierData)) {
+        prefix_cache_hash_data(&data,
+                               reinterpret_cast<const char *>(md) + sizeof(ModifierData),
+                               (size_t)mti->structSize - sizeof(ModifierData));
+      }
+      prefix_cache_hash_data(&data, &md_datamask->mask, sizeof(md_datamask->mask));
+      if (enabled && mti->foreachIDLink != nullptr) {
+        mti->foreachIDLink(md, ob, prefix_cache_id_link_cb, &data);
+      }
+    }
+  }
+
+  *r_hash = (uint64_t(BLI_hash_mm2a_end(&hash_hi)) << 32) | BLI_hash_mm2a_end(&hash_lo);
+  return resume_index;
+}
+
+/** \} */
+
 static void mesh_calc_modifiers(struct Depsgraph *depsgraph,
                                 Scene *scene,
                                 Object *ob,
@@ -1110,9 +1370,84 @@ static void mesh_calc_modifiers(struct Depsgraph *depsgraph,
 
   /* Apply all remaining constructive and deforming modifiers. */
   bool have_non_onlydeform_modifiers_appled = false;
-  for (; md; md = md->next, md_datamask = md_datamask->next) {
+
+  /* Try to resume evaluation from the cached result of a previous run, so tweaking the last
+   * expensive constructive modifier does not pay for the whole stack again. */
+  const bool use_prefix_cache = (index == -1) && use_deform && use_cache && !use_render &&
+                                !sculpt_mode && (ob->mode == OB_MODE_OBJECT) &&
+                                DEG_is_active(depsgraph);
+  Object *ob_orig = use_prefix_cache ? DEG_get_original_object(ob) : nullptr;
+  uint64_t prefix_hash = 0;
+  int prefix_resume_index = -1;
+  int walk_index = 0;
+  /* Set once the cache has either been resumed from, stored, or found unusable. */
+  bool prefix_cache_handled = true;
+  if (use_prefix_cache) {
+    prefix_resume_index = prefix_cache_calc_resume_point(scene,
+                                                         ob,
+                                                         mesh_input,
+                                                         deformed_verts,
+                                                         num_deformed_verts,
+                                                         md,
+                                                         md_datamask,
+                                                         &final_datamask,
+                                                         required_mode,
+                                                         need_mapping,
+                                                         &prefix_hash);
+    if (prefix_resume_index != -1) {
+      prefix_cache_handled = false;
+      Mesh *mesh_resume = nullptr;
+      BLI_mutex_lock(&prefix_cache_mutex);
+      const ModifierPrefixCache *cache = ob_orig->runtime.modifier_prefix_cache;
+      if (cache != nullptr && cache->mesh != nullptr && cache->prefix_hash == prefix_hash &&
+          cache->resume_index == prefix_resume_index) {
+        mesh_resume = BKE_mesh_copy_for_eval(cache->mesh, false);
+        ASSERT_IS_VALID_MESH(mesh_resume);
+      }
+      BLI_mutex_unlock(&prefix_cache_mutex);
+      if (mesh_resume != nullptr) {
+        if (mesh_final != nullptr) {
+          BKE_id_free(nullptr, mesh_final);
+        }
+        mesh_final = mesh_resume;
+        /* The snapshot already has the leading deform result applied. */
+        MEM_SAFE_FREE(deformed_verts);
+        have_non_onlydeform_modifiers_appled = true;
+        isPrevDeform = false;
+        while (walk_index < prefix_resume_index) {
+          md = md->next;
+          md_datamask = md_datamask->next;
+          walk_index++;
+        }
+        prefix_cache_handled = true;
+      }
+    }
+  }
+
+  for (; md; md = md->next, md_datamask = md_datamask->next, walk_index++) {
     const ModifierTypeInfo *mti = BKE_modifier_get_info((ModifierType)md->type);
 
+    if (!prefix_cache_handled && walk_index == prefix_resume_index) {
+      /* Snapshot the input of the last cacheable constructive modifier for the next run. */
+      prefix_cache_handled = true;
+      if (mesh_final != nullptr && deformed_verts == nullptr) {
+        BLI_mutex_lock(&prefix_cache_mutex);
+        ModifierPrefixCache *cache = ob_orig->runtime.modifier_prefix_cache;
+        if (cache == nullptr) {
+          cache = static_cast<ModifierPrefixCache *>(
+              MEM_callocN(sizeof(ModifierPrefixCache), __func__));
+          ob_orig->runtime.modifier_prefix_cache = cache;
+        }
+        if (cache->mesh != nullptr) {
+          BKE_id_free(nullptr, cache->mesh);
+        }
+        cache->mesh = BKE_mesh_copy_for_eval(mesh_final, false);
+        cache->prefix_hash = prefix_hash;
+        cache->resume_index = prefix_resume_index;
+        BLI_mutex_unlock(&prefix_cache_mutex);
+      }
+    }
+
     if (!BKE_modifier_is_enabled(scene, md, required_mode)) {
       continue;
     }
@@ -1162,6 +1497,8 @@ static void mesh_calc_modifiers(struct Depsgraph *depsgraph,
       continue;
     }
 
+    BLI_PROFILE_SCOPE(md->name);
+
     /* Add orco mesh as layer if needed by this modifier. */
     if (mesh_final && mesh_orco && mti->requiredDataMask) {
       CustomData_MeshMasks mask = {0};
@@ -1936,6 +2273,10 @@ static void mesh_build_data(struct Depsgraph *depsgraph,
   const bool is_mesh_eval_owned = (mesh_eval != mesh->runtime.mesh_eval);
   BKE_object_eval_assign_data(ob, &mesh_eval->id, is_mesh_eval_owned);
 
+  /* Stamp a unique generation so dependent objects can detect that this geometry changed,
+   * see #ModifierPrefixCache. */
+  mesh_eval->runtime.eval_generation = atomic_add_and_fetch_uint64(&g_mesh_eval_generation, 1);
+
   /* Add the final mesh as read-only non-owning component to the geometry set. */
   MeshComponent &mesh_component = geometry_set_eval->get_component_for_write<MeshComponent>();
   mesh_component.replace(mesh_eval, GeometryOwnershipType::ReadOnly);
@@ -36,6 +36,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_string_utils.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -596,6 +597,160 @@ static void animsys_write_orig_anim_rna(PointerRNA *ptr,
   }
 }
 
+/* Cache of the last resolved F-Curve path within one evaluation pass. Channels are stored
+ * grouped, so consecutive F-Curves usually animate different array indices of the same
+ * property and the string parse can be skipped. The cache must not outlive the evaluation:
+ * resolved pointers die whenever the depsgraph rewrites the evaluated ID. */
+typedef struct AnimRNAResolveCache {
+  const char *rna_path;
+  PointerRNA res_ptr;
+  PropertyRNA *res_prop;
+  int array_len;
+  bool valid;
+} AnimRNAResolveCache;
+
+static bool animsys_rna_path_resolve_cached(PointerRNA *ptr,
+                                            const char *rna_path,
+                                            const int array_index,
+                                            AnimRNAResolveCache *cache,
+                                            PathResolvedRNA *r_result)
+{
+  if (rna_path == NULL) {
+    return false;
+  }
+
+  if (cache->rna_path == NULL || !STREQ(cache->rna_path, rna_path)) {
+    cache->rna_path = rna_path;
+    cache->valid = RNA_path_resolve_property(ptr, rna_path, &cache->res_ptr, &cache->res_prop);
+
+    if (!cache->valid) {
+      /* See BKE_animsys_rna_path_resolve: missing paths are legit (Action Constraint). */
+      if (G.debug & G_DEBUG) {
+        CLOG_WARN(&LOG,
+                  "Animato: Invalid path. ID = '%s',  '%s[%d]'",
+                  (ptr->owner_id) ? (ptr->owner_id->name + 2) : "<No ID>",
+                  rna_path,
+                  array_index);
+      }
+    }
+    else if (ptr->owner_id != NULL && !RNA_property_animateable(&cache->res_ptr, cache->res_prop)) {
+      cache->valid = false;
+    }
+
+    if (cache->valid) {
+      cache->array_len = RNA_property_array_length(&cache->res_ptr, cache->res_prop);
+    }
+  }
+
+  if (!cache->valid) {
+    return false;
+  }
+
+  /* The array index check stays per F-Curve, indices into the same property differ. */
+  if (cache->array_len && array_index >= cache->array_len) {
+    if (G.debug & G_DEBUG) {
+      CLOG_WARN(&LOG,
+                "Animato: Invalid array index. ID = '%s',  '%s[%d]', array length is %d",
+                (ptr->owner_id) ? (ptr->owner_id->name + 2) : "<No ID>",
+                rna_path,
+                array_index,
+                cache->array_len - 1);
+    }
+    return false;
+  }
+
+  r_result->ptr = cache->res_ptr;
+  r_result->prop = cache->res_prop;
+  r_result->prop_index = cache->array_len ? array_index : -1;
+  return true;
+}
+
+/* Minimum number of evaluatable channels before evaluation is batched over
+ * the task scheduler, below this the scheduling overhead isn't worth it. */
+#define ANIMSYS_FCURVES_BATCH_MIN 64
+
+/* Per F-Curve result of the parallel evaluation pass, see
+ * animsys_evaluate_fcurves_parallel(). */
+typedef struct FCurveEvalResult {
+  PathResolvedRNA anim_rna;
+  float value;
+  bool resolved;
+} FCurveEvalResult;
+
+typedef struct FCurveEvalTaskData {
+  PointerRNA *ptr;
+  FCurve **fcurves;
+  const AnimationEvalContext *anim_eval_context;
+  FCurveEvalResult *results;
+} FCurveEvalTaskData;
+
+static void animsys_evaluate_fcurve_task_cb(void *__restrict userdata,
+                                            const int index,
+                                            const TaskParallelTLS *__restrict tls)
+{
+  FCurveEvalTaskData *task_data = userdata;
+  AnimRNAResolveCache *cache = tls->userdata_chunk;
+  FCurve *fcu = task_data->fcurves[index];
+  FCurveEvalResult *result = &task_data->results[index];
+
+  result->resolved = animsys_rna_path_resolve_cached(
+      task_data->ptr, fcu->rna_path, fcu->array_index, cache, &result->anim_rna);
+  if (!result->resolved) {
+    return;
+  }
+
+  /* Drivers may run Python, leave them to the serial pass. Action F-Curves
+   * virtually never have one. */
+  if (fcu->driver == NULL) {
+    result->value = calculate_fcurve(&result->anim_rna, fcu, task_data->anim_eval_context);
+  }
+}
+
+/**
+ * Evaluate a batch of F-Curves over the task scheduler. RNA path resolution
+ * and curve evaluation dominate the cost and are independent per channel,
+ * only the RNA writes have to stay serial (setters may have side effects).
+ */
+static void animsys_evaluate_fcurves_parallel(PointerRNA *ptr,
+                                              FCurve **fcurves,
+                                              const int fcurves_len,
+                                              const AnimationEvalContext *anim_eval_context,
+                                              bool flush_to_original)
+{
+  FCurveEvalTaskData task_data;
+  task_data.ptr = ptr;
+  task_data.fcurves = fcurves;
+  task_data.anim_eval_context = anim_eval_context;
+  task_data.results = MEM_malloc_arrayN(fcurves_len, sizeof(FCurveEvalResult), __func__);
+
+  /* Chunks iterate contiguous channel ranges, so the per-chunk cache catches the common
+   * case of consecutive F-Curves animating the same property. */
+  AnimRNAResolveCache cache = {NULL};
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.userdata_chunk = &cache;
+  settings.userdata_chunk_size = sizeof(cache);
+  BLI_task_parallel_range(0, fcurves_len, &task_data, animsys_evaluate_fcurve_task_cb, &settings);
+
+  for (int i = 0; i < fcurves_len; i++) {
+    FCurveEvalResult *result = &task_data.results[i];
+    if (!result->resolved) {
+      continue;
+    }
+    FCurve *fcu = fcurves[i];
+    const float curval = (fcu->driver != NULL) ?
+                             calculate_fcurve(&result->anim_rna, fcu, anim_eval_context) :
+                             result->value;
+    BKE_animsys_write_to_rna_path(&result->anim_rna, curval);
+    if (flush_to_original) {
+      animsys_write_orig_anim_rna(ptr, fcu->rna_path, fcu->array_index, curval);
+    }
+  }
+
+  MEM_freeN(task_data.results);
+}
+
 /**
  * Evaluate all the F-Curves in the given list
  * This performs a set of standard checks. If extra checks are required,
@@ -606,7 +761,32 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
                                      const AnimationEvalContext *anim_eval_context,
                                      bool flush_to_original)
 {
+  int fcurves_len = 0;
+  LISTBASE_FOREACH (FCurve *, fcu, list) {
+    if (is_fcurve_evaluatable(fcu)) {
+      fcurves_len++;
+    }
+  }
+
+  /* Large channel lists (dense rigs, crowd shots) are batched over the task
+   * scheduler instead of walking the list serially. */
+  if (fcurves_len >= ANIMSYS_FCURVES_BATCH_MIN) {
+    FCurve **fcurves = MEM_malloc_arrayN(fcurves_len, sizeof(FCurve *), __func__);
+    int i = 0;
+    LISTBASE_FOREACH (FCurve *, fcu, list) {
+      if (is_fcurve_evaluatable(fcu)) {
+        fcurves[i++] = fcu;
+      }
+    }
+    animsys_evaluate_fcurves_parallel(
+        ptr, fcurves, fcurves_len, anim_eval_context, flush_to_original);
+    MEM_freeN(fcurves);
+    return;
+  }
+
   /* Calculate then execute each curve. */
+  AnimRNAResolveCache cache = {NULL};
+
   LISTBASE_FOREACH (FCurve *, fcu, list) {
 
     if (!is_fcurve_evaluatable(fcu)) {
@@ -614,7 +794,7 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
     }
 
     PathResolvedRNA anim_rna;
-    if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+    if (animsys_rna_path_resolve_cached(ptr, fcu->rna_path, fcu->array_index, &cache, &anim_rna)) {
       const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
       BKE_animsys_write_to_rna_path(&anim_rna, curval);
       if (flush_to_original) {
@@ -2243,6 +2423,119 @@ static void nlasnapshot_from_action(PointerRNA *ptr,
   }
 }
 
+void BKE_nlastrip_eval_cache_free(NlaStrip *strip)
+{
+  NlaStripEvalCache *cache = strip->eval_cache;
+  if (cache != NULL) {
+    MEM_SAFE_FREE(cache->values);
+    MEM_freeN(cache);
+    strip->eval_cache = NULL;
+  }
+}
+
+/**
+ * Version of #nlasnapshot_from_action that reuses the strip's cached raw
+ * values when its inputs (action contents, strip time) did not change since
+ * the previous evaluation. With layered workflows most strips are static
+ * (hold extensions, settled mocap layers), only their blending varies.
+ */
+static void nlasnapshot_from_action_cached(PointerRNA *ptr,
+                                           NlaEvalData *channels,
+                                           ListBase *modifiers,
+                                           NlaStrip *strip,
+                                           NlaEvalSnapshot *r_snapshot)
+{
+  bAction *action = strip->act;
+
+  /* F-Modifiers (on the stack or on individual curves) can depend on more
+   * than (action, strip_time), don't cache in their presence. */
+  bool cacheable = BLI_listbase_is_empty(modifiers);
+  int fcurve_len = 0;
+  if (cacheable) {
+    LISTBASE_FOREACH (FCurve *, fcu, &action->curves) {
+      if (!is_fcurve_evaluatable(fcu)) {
+        continue;
+      }
+      if (!BLI_listbase_is_empty(&fcu->modifiers)) {
+        cacheable = false;
+        break;
+      }
+      fcurve_len++;
+    }
+  }
+  if (!cacheable) {
+    nlasnapshot_from_action(ptr, channels, modifiers, action, strip->strip_time, r_snapshot);
+    return;
+  }
+
+  action_idcode_patch_check(ptr->owner_id, action);
+
+  /* Keyframe edits and curve frees (including COW re-copies of the action)
+   * change the generation, which versions the cached values. */
+  const uint64_t fcurve_generation = BKE_fcurve_edit_generation();
+
+  NlaStripEvalCache *cache = strip->eval_cache;
+  const bool cache_hit = (cache != NULL) && (cache->act == action) &&
+                         (cache->strip_time == strip->strip_time) &&
+                         (cache->fcurve_generation == fcurve_generation) &&
+                         (cache->value_len == fcurve_len);
+  if (!cache_hit) {
+    if (cache == NULL) {
+      cache = MEM_callocN(sizeof(NlaStripEvalCache), __func__);
+      strip->eval_cache = cache;
+    }
+    if (cache->value_len != fcurve_len) {
+      MEM_SAFE_FREE(cache->values);
+      cache->values = MEM_malloc_arrayN(fcurve_len, sizeof(float), __func__);
+    }
+    cache->act = action;
+    cache->strip_time = strip->strip_time;
+    cache->fcurve_generation = fcurve_generation;
+    cache->value_len = fcurve_len;
+  }
+
+  /* Channel resolution is still done every evaluation, the channel data only
+   * lives for the duration of one NLA evaluation. */
+  int value_index = 0;
+  LISTBASE_FOREACH (FCurve *, fcu, &action->curves) {
+    if (!is_fcurve_evaluatable(fcu)) {
+      continue;
+    }
+
+    float value;
+    if (cache_hit) {
+      value = cache->values[value_index];
+    }
+    else {
+      value = evaluate_fcurve(fcu, strip->strip_time);
+      cache->values[value_index] = value;
+    }
+    value_index++;
+
+    NlaEvalChannel *nec = nlaevalchan_verify(ptr, channels, fcu->rna_path);
+
+    /* Invalid path or property cannot be animated. */
+    if (nec == NULL) {
+      continue;
+    }
+
+    if (!nlaevalchan_validate_index_ex(nec, fcu->array_index)) {
+      continue;
+    }
+
+    NlaEvalChannelSnapshot *necs = nlaeval_snapshot_ensure_channel(r_snapshot, nec);
+
+    necs->values[fcu->array_index] = value;
+
+    if (nec->mix_mode == NEC_MIX_QUATERNION) {
+      BLI_bitmap_set_all(necs->blend_domain.ptr, true, 4);
+    }
+    else {
+      BLI_BITMAP_ENABLE(necs->blend_domain.ptr, fcu->array_index);
+    }
+  }
+}
+
 /* evaluate action-clip strip */
 static void nlastrip_evaluate_actionclip(PointerRNA *ptr,
                                          NlaEvalData *channels,
@@ -2271,8 +2564,7 @@ static void nlastrip_evaluate_actionclip(PointerRNA *ptr,
   NlaEvalSnapshot strip_snapshot;
   nlaeval_snapshot_init(&strip_snapshot, channels, NULL);
 
-  nlasnapshot_from_action(
-      ptr, channels, &tmp_modifiers, strip->act, strip->strip_time, &strip_snapshot);
+  nlasnapshot_from_action_cached(ptr, channels, &tmp_modifiers, strip, &strip_snapshot);
   nlasnapshot_blend(
       channels, snapshot, &strip_snapshot, strip->blendmode, strip->influence, snapshot);
 
@@ -2589,6 +2881,10 @@ static void animsys_create_tweak_strip(const AnimData *adt,
   memcpy(r_tweak_strip, adt->actstrip, sizeof(NlaStrip));
   r_tweak_strip->next = r_tweak_strip->prev = NULL;
 
+  /* Don't share the cached evaluation result with the real strip, the copy
+   * owns (and frees) whatever it caches itself. */
+  r_tweak_strip->eval_cache = NULL;
+
   /* If tweaked strip is syncing action length, then evaluate using action length. */
   if (r_tweak_strip->flag & NLASTRIP_FLAG_SYNC_LENGTH) {
     BKE_nlastrip_recalculate_bounds_sync_action(r_tweak_strip);
@@ -2760,7 +3056,7 @@ static bool animsys_evaluate_nla_for_flush(NlaEvalData *echannels,
   ListBase estrips = {NULL, NULL};
   NlaEvalStrip *nes;
 
-  NlaStrip tweak_strip;
+  NlaStrip tweak_strip = {0};
 
   NlaTrack *tweaked_track = nlatrack_find_tweaked(adt);
 
@@ -2812,6 +3108,8 @@ static bool animsys_evaluate_nla_for_flush(NlaEvalData *echannels,
   }
 
   /* Free temporary evaluation data that's not used elsewhere. */
+  BKE_nlastrip_eval_cache_free(&tweak_strip);
+  BKE_nlastrip_eval_cache_free(&action_strip);
   BLI_freelistN(&estrips);
   return true;
 }
@@ -3209,6 +3507,7 @@ void BKE_animsys_free_nla_keyframing_context_cache(struct ListBase *cache)
 {
   LISTBASE_FOREACH (NlaKeyframingContext *, ctx, cache) {
     MEM_SAFE_FREE(ctx->eval_strip);
+    BKE_nlastrip_eval_cache_free(&ctx->strip);
     nlaeval_free(&ctx->lower_eval_data);
   }
 
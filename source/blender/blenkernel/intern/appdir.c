@@ -217,6 +217,59 @@ bool BKE_appdir_folder_documents(char *dir)
   return true;
 }
 
+/**
+ * Get the Blender-specific directory for per-user cache files, i.e.
+ * `$XDG_CACHE_HOME/blender` (or `$HOME/.cache/blender`) on Linux, `~/Library/Caches/Blender` on
+ * macOS and `%LOCALAPPDATA%/Blender Foundation/Blender/Cache` on Windows.
+ *
+ * \note The returned path itself is not guaranteed to exist, only its cache root is checked.
+ * Callers are expected to create it (and any sub-directory) on demand, see
+ * #BLI_dir_create_recursive.
+ *
+ * \returns True if the cache root directory of the OS could be found.
+ */
+bool BKE_appdir_folder_caches(char *r_path, const size_t path_len)
+{
+  r_path[0] = '\0';
+
+#ifdef WIN32
+  const char *caches_root_path = BLI_getenv("LOCALAPPDATA");
+  if (caches_root_path == NULL || !BLI_is_dir(caches_root_path)) {
+    return false;
+  }
+  BLI_path_join(
+      r_path, path_len, caches_root_path, "Blender Foundation", "Blender", "Cache", NULL);
+#elif defined(__APPLE__)
+  const char *home_path = BKE_appdir_folder_home();
+  if (home_path == NULL) {
+    return false;
+  }
+  char caches_root_path[FILE_MAXDIR];
+  BLI_path_join(caches_root_path, sizeof(caches_root_path), home_path, "Library", "Caches", NULL);
+  if (!BLI_is_dir(caches_root_path)) {
+    return false;
+  }
+  BLI_path_join(r_path, path_len, caches_root_path, "Blender", NULL);
+#else /* Unix */
+  char caches_root_buf[FILE_MAXDIR];
+  const char *caches_root_path = BLI_getenv("XDG_CACHE_HOME");
+  if (caches_root_path == NULL || caches_root_path[0] == '\0') {
+    const char *home_path = BKE_appdir_folder_home();
+    if (home_path == NULL) {
+      return false;
+    }
+    BLI_path_join(caches_root_buf, sizeof(caches_root_buf), home_path, ".cache", NULL);
+    caches_root_path = caches_root_buf;
+  }
+  if (!BLI_is_dir(caches_root_path)) {
+    return false;
+  }
+  BLI_path_join(r_path, path_len, caches_root_path, "blender", NULL);
+#endif
+
+  return true;
+}
+
 /**
  * Gets a good default directory for fonts.
  */
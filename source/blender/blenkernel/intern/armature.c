@@ -35,6 +35,7 @@
 #include "BLI_listbase.h"
 #include "BLI_math.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 #include "BLT_translation.h"
 
@@ -2650,6 +2651,8 @@ void BKE_pose_rebuild(Main *bmain, Object *ob, bArmature *arm, const bool do_id_
   BKE_pose_channels_clear_with_null_bone(pose, do_id_user);
 
   BKE_pose_channels_hash_ensure(pose);
+  /* Refresh the flat evaluation array as well, so it never points at freed channels. */
+  BKE_pose_pchan_index_rebuild(pose);
 
   for (pchan = pose->chanbase.first; pchan; pchan = pchan->next) {
     /* Find the custom B-Bone handles. */
@@ -2787,26 +2790,26 @@ void BKE_pose_where_is_bone(struct Depsgraph *depsgraph,
   if (do_extra) {
     /* Do constraints */
     if (pchan->constraints.first) {
-      bConstraintOb *cob;
+      bConstraintOb cob;
       float vec[3];
 
       /* make a copy of location of PoseChannel for later */
       copy_v3_v3(vec, pchan->pose_mat[3]);
 
       /* prepare PoseChannel for Constraint solving
-       * - makes a copy of matrix, and creates temporary struct to use
+       * - makes a copy of matrix, on the stack as this runs for every bone
        */
-      cob = BKE_constraints_make_evalob(depsgraph, scene, ob, pchan, CONSTRAINT_OBTYPE_BONE);
+      BKE_constraints_evalob_init(depsgraph, scene, ob, pchan, CONSTRAINT_OBTYPE_BONE, &cob);
 
       /* Solve PoseChannel's Constraints */
 
       /* ctime doesn't alter objects. */
-      BKE_constraints_solve(depsgraph, &pchan->constraints, cob, ctime);
+      BKE_constraints_solve(depsgraph, &pchan->constraints, &cob, ctime);
 
       /* cleanup after Constraint Solving
-       * - applies matrix back to pchan, and frees temporary struct used
+       * - applies matrix back to pchan
        */
-      BKE_constraints_clear_evalob(cob);
+      BKE_constraints_evalob_flush(&cob);
 
       /* prevent constraints breaking a chain */
       if (pchan->bone->flag & BONE_CONNECTED) {
@@ -2823,6 +2826,66 @@ void BKE_pose_where_is_bone(struct Depsgraph *depsgraph,
 
 /* This only reads anim data from channels, and writes to channels */
 /* This is the only function adding poses */
+/**
+ * Solve a run of pose channels with the per-channel dispatch used by #BKE_pose_where_is
+ * (the channels must be ordered parents before children).
+ */
+static void pose_channels_solve(struct Depsgraph *depsgraph,
+                                Scene *scene,
+                                Object *ob,
+                                bPoseChannel **pchans,
+                                const int pchans_len,
+                                const float ctime)
+{
+  for (int i = 0; i < pchans_len; i++) {
+    bPoseChannel *pchan = pchans[i];
+    /* 4a. if we find an IK root, we handle it separated */
+    if (pchan->flag & POSE_IKTREE) {
+      BIK_execute_tree(depsgraph, scene, ob, pchan, ctime);
+    }
+    /* 4b. if we find a Spline IK root, we handle it separated too */
+    else if (pchan->flag & POSE_IKSPLINE) {
+      BKE_splineik_execute_tree(depsgraph, scene, ob, pchan, ctime);
+    }
+    /* 5. otherwise just call the normal solver */
+    else if (!(pchan->flag & POSE_DONE)) {
+      BKE_pose_where_is_bone(depsgraph, scene, ob, pchan, ctime, 1);
+    }
+  }
+}
+
+typedef struct PoseChainGroupTask {
+  struct Depsgraph *depsgraph;
+  Scene *scene;
+  Object *ob;
+  float ctime;
+  bPoseChannel **pchans;
+  int pchans_len;
+} PoseChainGroupTask;
+
+static void pose_chain_group_solve_fn(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  PoseChainGroupTask *task = taskdata;
+  pose_channels_solve(
+      task->depsgraph, task->scene, task->ob, task->pchans, task->pchans_len, task->ctime);
+}
+
+/* Union-find over channel indices, used to merge bone hierarchies that reference
+ * each other through constraints. */
+static int pose_chain_group_find(int *group, int i)
+{
+  while (group[i] != i) {
+    group[i] = group[group[i]];
+    i = group[i];
+  }
+  return i;
+}
+
+static void pose_chain_group_union(int *group, const int a, const int b)
+{
+  group[pose_chain_group_find(group, a)] = pose_chain_group_find(group, b);
+}
+
 void BKE_pose_where_is(struct Depsgraph *depsgraph, Scene *scene, Object *ob)
 {
   bArmature *arm;
@@ -2873,20 +2936,140 @@ void BKE_pose_where_is(struct Depsgraph *depsgraph, Scene *scene, Object *ob)
      */
     BKE_pose_splineik_init_tree(scene, ob, ctime);
 
-    /* 3. the main loop, channels are already hierarchical sorted from root to children */
-    for (pchan = ob->pose->chanbase.first; pchan; pchan = pchan->next) {
-      /* 4a. if we find an IK root, we handle it separated */
-      if (pchan->flag & POSE_IKTREE) {
-        BIK_execute_tree(depsgraph, scene, ob, pchan, ctime);
+    /* 3. The main loop, channels are already hierarchical sorted from root to children.
+     * Independent bone hierarchies that don't reference each other through constraints
+     * can be solved in parallel. Assign every channel to the group of its hierarchy
+     * root, then merge groups that are linked by constraint targets or B-Bone handles,
+     * so each group is closed under the channels it reads and writes. */
+    {
+      const int tot_channels = BLI_listbase_count(&ob->pose->chanbase);
+      bPoseChannel **pchan_array = MEM_malloc_arrayN(
+          (size_t)tot_channels, sizeof(*pchan_array), __func__);
+      int *group = MEM_malloc_arrayN((size_t)tot_channels, sizeof(int), __func__);
+      GHash *pchan_index_map = BLI_ghash_ptr_new_ex(__func__, (uint)tot_channels);
+
+      /* Small rigs don't make up for the task overhead. */
+      bool use_threading = (tot_channels > 64);
+      int i = 0;
+      for (pchan = ob->pose->chanbase.first; pchan; pchan = pchan->next, i++) {
+        pchan_array[i] = pchan;
+        BLI_ghash_insert(pchan_index_map, pchan, POINTER_FROM_INT(i));
+        group[i] = i;
+        if (pchan->parent) {
+          /* Parents always precede their children in the list. */
+          pose_chain_group_union(
+              group, i, POINTER_AS_INT(BLI_ghash_lookup(pchan_index_map, pchan->parent)));
+        }
+        if (pchan->flag & POSE_IKSPLINE) {
+          /* Curve path data is evaluated lazily and shared between the trees,
+           * don't risk racing on it. */
+          use_threading = false;
+        }
+      }
+
+      if (use_threading) {
+        for (i = 0; i < tot_channels; i++) {
+          LISTBASE_FOREACH (bConstraint *, con, &pchan_array[i]->constraints) {
+            const bConstraintTypeInfo *cti = BKE_constraint_typeinfo_get(con);
+            if (cti == NULL || cti->get_constraint_targets == NULL) {
+              continue;
+            }
+            ListBase targets = {NULL, NULL};
+            if (cti->get_constraint_targets(con, &targets)) {
+              LISTBASE_FOREACH (bConstraintTarget *, ct, &targets) {
+                if (ct->tar == ob && ct->subtarget[0] != '\0') {
+                  bPoseChannel *pchan_target = BKE_pose_channel_find_name(ob->pose,
+                                                                          ct->subtarget);
+                  if (pchan_target) {
+                    pose_chain_group_union(
+                        group,
+                        i,
+                        POINTER_AS_INT(BLI_ghash_lookup(pchan_index_map, pchan_target)));
+                  }
+                }
+              }
+            }
+            if (cti->flush_constraint_targets) {
+              cti->flush_constraint_targets(con, &targets, true);
+            }
+          }
+          if (pchan_array[i]->bbone_prev) {
+            pose_chain_group_union(
+                group,
+                i,
+                POINTER_AS_INT(BLI_ghash_lookup(pchan_index_map, pchan_array[i]->bbone_prev)));
+          }
+          if (pchan_array[i]->bbone_next) {
+            pose_chain_group_union(
+                group,
+                i,
+                POINTER_AS_INT(BLI_ghash_lookup(pchan_index_map, pchan_array[i]->bbone_next)));
+          }
+        }
+      }
+
+      int tot_groups = 0;
+      if (use_threading) {
+        for (i = 0; i < tot_channels; i++) {
+          if (pose_chain_group_find(group, i) == i) {
+            tot_groups++;
+          }
+        }
       }
-      /* 4b. if we find a Spline IK root, we handle it separated too */
-      else if (pchan->flag & POSE_IKSPLINE) {
-        BKE_splineik_execute_tree(depsgraph, scene, ob, pchan, ctime);
+
+      if (use_threading && tot_groups > 1) {
+        /* Bucket the channels by group, keeping the root-first order within each. */
+        int *group_start = MEM_callocN(sizeof(int) * (size_t)tot_channels, __func__);
+        int *group_cursor = MEM_callocN(sizeof(int) * (size_t)tot_channels, __func__);
+        bPoseChannel **sorted = MEM_malloc_arrayN(
+            (size_t)tot_channels, sizeof(*sorted), __func__);
+        PoseChainGroupTask *tasks = MEM_malloc_arrayN(
+            (size_t)tot_groups, sizeof(*tasks), __func__);
+
+        for (i = 0; i < tot_channels; i++) {
+          group_start[pose_chain_group_find(group, i)]++;
+        }
+        int offset = 0, task_index = 0;
+        for (i = 0; i < tot_channels; i++) {
+          if (group[i] == i) {
+            tasks[task_index] = (PoseChainGroupTask){
+                .depsgraph = depsgraph,
+                .scene = scene,
+                .ob = ob,
+                .ctime = ctime,
+                .pchans = sorted + offset,
+                .pchans_len = group_start[i],
+            };
+            task_index++;
+            const int len = group_start[i];
+            group_start[i] = offset;
+            group_cursor[i] = offset;
+            offset += len;
+          }
+        }
+        for (i = 0; i < tot_channels; i++) {
+          sorted[group_cursor[pose_chain_group_find(group, i)]++] = pchan_array[i];
+        }
+
+        TaskPool *task_pool = BLI_task_pool_create(NULL, TASK_PRIORITY_HIGH);
+        for (i = 0; i < tot_groups; i++) {
+          BLI_task_pool_push(task_pool, pose_chain_group_solve_fn, &tasks[i], false, NULL);
+        }
+        BLI_task_pool_work_and_wait(task_pool);
+        BLI_task_pool_free(task_pool);
+
+        MEM_freeN(tasks);
+        MEM_freeN(sorted);
+        MEM_freeN(group_cursor);
+        MEM_freeN(group_start);
       }
-      /* 5. otherwise just call the normal solver */
-      else if (!(pchan->flag & POSE_DONE)) {
-        BKE_pose_where_is_bone(depsgraph, scene, ob, pchan, ctime, 1);
+      else {
+        pose_channels_solve(depsgraph, scene, ob, pchan_array, tot_channels, ctime);
       }
+
+      BLI_ghash_free(pchan_index_map, NULL, NULL);
+      MEM_freeN(group);
+      MEM_freeN(pchan_array);
     }
     /* 6. release the IK tree */
     BIK_release_tree(scene, ob, ctime);
@@ -34,6 +34,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_math.h"
+#include "BLI_simd.h"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
 
@@ -81,11 +82,26 @@ static void pchan_deform_accumulate(const DualQuat *deform_dq,
     add_weighted_dq_dq(dq_accum, deform_dq, weight);
   }
   else {
+#ifdef BLI_HAVE_SSE2
+    /* Compute `co_accum += weight * (deform_mat * co_in - co_in)` on whole registers,
+     * the matrix columns are contiguous so they can be loaded directly. */
+    __m128 co = _mm_setr_ps(co_in[0], co_in[1], co_in[2], 1.0f);
+    __m128 tmp_vec = _mm_mul_ps(_mm_loadu_ps(deform_mat[0]), _mm_set1_ps(co_in[0]));
+    tmp_vec = _mm_add_ps(tmp_vec, _mm_mul_ps(_mm_loadu_ps(deform_mat[1]), _mm_set1_ps(co_in[1])));
+    tmp_vec = _mm_add_ps(tmp_vec, _mm_mul_ps(_mm_loadu_ps(deform_mat[2]), _mm_set1_ps(co_in[2])));
+    tmp_vec = _mm_add_ps(tmp_vec, _mm_loadu_ps(deform_mat[3]));
+    tmp_vec = _mm_sub_ps(tmp_vec, co);
+
+    __m128 accum = _mm_setr_ps(co_accum[0], co_accum[1], co_accum[2], 0.0f);
+    accum = _mm_add_ps(accum, _mm_mul_ps(tmp_vec, _mm_set1_ps(weight)));
+    copy_v3_v3(co_accum, (float *)&accum);
+#else
     float tmp[3];
     mul_v3_m4v3(tmp, deform_mat, co_in);
 
     sub_v3_v3(tmp, co_in);
     madd_v3_v3fl(co_accum, tmp, weight);
+#endif
 
     if (mat_accum) {
       float tmpmat[3][3];
@@ -55,6 +55,7 @@
 #include "BKE_lib_id.h"
 #include "BKE_lib_override.h"
 #include "BKE_main.h"
+#include "BKE_main_idmap.h"
 #include "BKE_preferences.h"
 #include "BKE_report.h"
 #include "BKE_scene.h"
@@ -157,7 +158,11 @@ static void setup_app_data(bContext *C,
   /* may happen with library files - UNDO file should never have NULL curscene (but may have a
    * NULL curscreen)... */
   else if (ELEM(NULL, bfd->curscreen, bfd->curscene)) {
-    BKE_report(reports->reports, RPT_WARNING, "Library file, loading empty scene");
+    /* The active screen is also NULL when UI data-blocks were skipped on reading
+     * (#BLO_READ_SKIP_UI), only warn when there really is no scene to show. */
+    if (bfd->curscene == NULL) {
+      BKE_report(reports->reports, RPT_WARNING, "Library file, loading empty scene");
+    }
     mode = LOAD_UI_OFF;
   }
   else if (G.fileflags & G_FILE_NO_UI) {
@@ -204,6 +209,10 @@ static void setup_app_data(bContext *C,
     SWAP(ListBase, bmain->workspaces, bfd->main->workspaces);
     SWAP(ListBase, bmain->screens, bfd->main->screens);
 
+    /* UI data-blocks were exchanged between the two Mains wholesale. */
+    BKE_main_idmap_cache_invalidate(bmain);
+    BKE_main_idmap_cache_invalidate(bfd->main);
+
     /* In case of actual new file reading without loading UI, we need to regenerate the session
      * uuid of the UI-related datablocks we are keeping from previous session, otherwise their uuid
      * will collide with some generated for newly read data. */
@@ -45,6 +45,8 @@
 
 #include "RNA_enum_types.h"
 
+#include "atomic_ops.h"
+
 static float len_squared_v3v3_with_normal_bias(const float co_search[3],
                                                const float co_test[3],
                                                const void *user_data)
@@ -778,9 +780,11 @@ static bool rule_fight(BoidRule *rule, BoidBrainData *bbd, BoidValues *val, Part
       /* must face enemy to fight */
       if (dot_v3v3(pa->prev_state.ave, enemy_dir) > 0.5f) {
         bpa = enemy_pa->boid;
-        bpa->data.health -= bbd->part->boids->strength * bbd->timestep *
-                            ((1.0f - bbd->part->boids->accuracy) * damage +
-                             bbd->part->boids->accuracy);
+        /* Several boids may attack the same enemy from different tasks at once. */
+        atomic_add_and_fetch_fl(&bpa->data.health,
+                                -(bbd->part->boids->strength * bbd->timestep *
+                                  ((1.0f - bbd->part->boids->accuracy) * damage +
+                                   bbd->part->boids->accuracy)));
       }
     }
     else {
@@ -1562,6 +1562,43 @@ static bool cloth_bvh_self_overlap_cb(void *userdata, int index_a, int index_b,
   return false;
 }
 
+typedef struct ObjectColliderOverlapData {
+  ClothModifierData *clmd;
+  BVHTree *cloth_bvh;
+  CollisionModifierData **collmds;
+  float step;
+  float dt;
+  bool is_hair;
+
+  uint *coll_counts_obj;
+  BVHTreeOverlap **overlap_obj;
+} ObjectColliderOverlapData;
+
+/* Broad-phase for one collider: advance its BVH to the current sub-step (refit only, the tree
+ * is persistent and rebuilt by the collision modifier only on topology changes) and gather the
+ * overlapping pairs. Colliders are independent of each other, so the collection loop can batch
+ * them over the task scheduler. */
+static void cloth_bvh_objcollision_overlap_task(void *__restrict userdata,
+                                                const int i,
+                                                const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ObjectColliderOverlapData *data = (ObjectColliderOverlapData *)userdata;
+  CollisionModifierData *collmd = data->collmds[i];
+
+  if (collmd == NULL || collmd->bvhtree == NULL) {
+    return;
+  }
+
+  /* Move object to position (step) in time. */
+  collision_move_object(collmd, data->step + data->dt, data->step, false);
+
+  data->overlap_obj[i] = BLI_bvhtree_overlap(data->cloth_bvh,
+                                             collmd->bvhtree,
+                                             &data->coll_counts_obj[i],
+                                             data->is_hair ? NULL : cloth_bvh_obj_overlap_cb,
+                                             data->clmd);
+}
+
 int cloth_bvh_collision(
     Depsgraph *depsgraph, Object *ob, ClothModifierData *clmd, float step, float dt)
 {
@@ -1575,6 +1612,7 @@ int cloth_bvh_collision(
   unsigned int numcollobj = 0;
   uint *coll_counts_obj = NULL;
   BVHTreeOverlap **overlap_obj = NULL;
+  CollisionModifierData **collmds = NULL;
   uint coll_count_self = 0;
   BVHTreeOverlap *overlap_self = NULL;
 
@@ -1600,25 +1638,28 @@ int cloth_bvh_collision(
     if (collobjs) {
       coll_counts_obj = MEM_callocN(sizeof(uint) * numcollobj, "CollCounts");
       overlap_obj = MEM_callocN(sizeof(*overlap_obj) * numcollobj, "BVHOverlap");
+      collmds = MEM_callocN(sizeof(*collmds) * numcollobj, "ClothCollMods");
 
       for (i = 0; i < numcollobj; i++) {
-        Object *collob = collobjs[i];
-        CollisionModifierData *collmd = (CollisionModifierData *)BKE_modifiers_findby_type(
-            collob, eModifierType_Collision);
-
-        if (!collmd->bvhtree) {
-          continue;
-        }
-
-        /* Move object to position (step) in time. */
-        collision_move_object(collmd, step + dt, step, false);
-
-        overlap_obj[i] = BLI_bvhtree_overlap(cloth_bvh,
-                                             collmd->bvhtree,
-                                             &coll_counts_obj[i],
-                                             is_hair ? NULL : cloth_bvh_obj_overlap_cb,
-                                             clmd);
+        collmds[i] = (CollisionModifierData *)BKE_modifiers_findby_type(collobjs[i],
+                                                                        eModifierType_Collision);
       }
+
+      ObjectColliderOverlapData data = {
+          .clmd = clmd,
+          .cloth_bvh = cloth_bvh,
+          .collmds = collmds,
+          .step = step,
+          .dt = dt,
+          .is_hair = is_hair,
+          .coll_counts_obj = coll_counts_obj,
+          .overlap_obj = overlap_obj,
+      };
+
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      settings.use_threading = (numcollobj > 1);
+      BLI_task_parallel_range(0, numcollobj, &data, cloth_bvh_objcollision_overlap_task, &settings);
     }
   }
 
@@ -1641,8 +1682,7 @@ int cloth_bvh_collision(
 
       for (i = 0; i < numcollobj; i++) {
         Object *collob = collobjs[i];
-        CollisionModifierData *collmd = (CollisionModifierData *)BKE_modifiers_findby_type(
-            collob, eModifierType_Collision);
+        CollisionModifierData *collmd = collmds[i];
 
         if (!collmd->bvhtree) {
           continue;
@@ -1723,6 +1763,8 @@ int cloth_bvh_collision(
 
   MEM_SAFE_FREE(coll_counts_obj);
 
+  MEM_SAFE_FREE(collmds);
+
   MEM_SAFE_FREE(overlap_self);
 
   BKE_collision_objects_free(collobjs);
@@ -132,15 +132,16 @@ void BKE_constraint_unique_name(bConstraint *con, ListBase *list)
 /* ----------------- Evaluation Loop Preparation --------------- */
 
 /* package an object/bone for use in constraint evaluation */
-/* This function MEM_calloc's a bConstraintOb struct,
- * that will need to be freed after evaluation */
-bConstraintOb *BKE_constraints_make_evalob(
-    Depsgraph *depsgraph, Scene *scene, Object *ob, void *subdata, short datatype)
+/* Initialize a caller-provided (usually stack allocated) struct. The per-bone
+ * pose evaluation uses this to avoid a heap allocation for every bone. */
+void BKE_constraints_evalob_init(Depsgraph *depsgraph,
+                                 Scene *scene,
+                                 Object *ob,
+                                 void *subdata,
+                                 short datatype,
+                                 bConstraintOb *cob)
 {
-  bConstraintOb *cob;
-
-  /* create regardless of whether we have any data! */
-  cob = MEM_callocN(sizeof(bConstraintOb), "bConstraintOb");
+  memset(cob, 0, sizeof(*cob));
 
   /* for system time, part of deglobalization, code nicer later with local time (ton) */
   cob->scene = scene;
@@ -207,20 +208,25 @@ bConstraintOb *BKE_constraints_make_evalob(
       unit_m4(cob->startmat);
       break;
   }
+}
 
+/* This function MEM_calloc's a bConstraintOb struct,
+ * that will need to be freed after evaluation */
+bConstraintOb *BKE_constraints_make_evalob(
+    Depsgraph *depsgraph, Scene *scene, Object *ob, void *subdata, short datatype)
+{
+  /* create regardless of whether we have any data! */
+  bConstraintOb *cob = MEM_mallocN(sizeof(bConstraintOb), "bConstraintOb");
+  BKE_constraints_evalob_init(depsgraph, scene, ob, subdata, datatype, cob);
   return cob;
 }
 
-/* cleanup after constraint evaluation */
-void BKE_constraints_clear_evalob(bConstraintOb *cob)
+/* Copy the result of constraint evaluation back to the owner,
+ * counterpart of #BKE_constraints_evalob_init. */
+void BKE_constraints_evalob_flush(bConstraintOb *cob)
 {
   float delta[4][4], imat[4][4];
 
-  /* prevent crashes */
-  if (cob == NULL) {
-    return;
-  }
-
   /* calculate delta of constraints evaluation */
   invert_m4_m4(imat, cob->startmat);
   /* XXX This would seem to be in wrong order. However, it does not work in 'right' order -
@@ -254,6 +260,17 @@ void BKE_constraints_clear_evalob(bConstraintOb *cob)
       break;
     }
   }
+}
+
+/* cleanup after constraint evaluation */
+void BKE_constraints_clear_evalob(bConstraintOb *cob)
+{
+  /* prevent crashes */
+  if (cob == NULL) {
+    return;
+  }
+
+  BKE_constraints_evalob_flush(cob);
 
   /* free tempolary struct */
   MEM_freeN(cob);
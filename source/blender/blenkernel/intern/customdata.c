@@ -36,12 +36,14 @@
 
 #include "BLI_bitmap.h"
 #include "BLI_endian_switch.h"
+#include "BLI_ghash.h"
 #include "BLI_math.h"
 #include "BLI_math_color_blend.h"
 #include "BLI_mempool.h"
 #include "BLI_path_util.h"
 #include "BLI_string.h"
 #include "BLI_string_utils.h"
+#include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -2058,6 +2060,93 @@ void customData_mask_layers__print(const CustomData_MeshMasks *mask)
   }
 }
 
+/************************* Layer Data Sharing *************************/
+
+/* Reference counting for layer data shared through #CD_REFERENCE.
+ *
+ * Historically a referencing layer (#CD_FLAG_NOFREE) required its owner to outlive it, which
+ * ruled out sharing layers between original and evaluated data-blocks: the original may be
+ * freed or re-allocated while the evaluated copy is still alive. Keeping a reference count per
+ * shared allocation lifts that restriction: the allocation is freed together with the last
+ * layer using it, regardless of the order in which the layers are freed.
+ *
+ * Only allocations which actually get referenced have an entry in the map, so layers which are
+ * never shared do not pay for a lookup on the fast path. */
+
+static GHash *cd_shared_data_map = NULL;
+static ThreadMutex cd_shared_data_mutex = BLI_MUTEX_INITIALIZER;
+
+/* Number of referencing (#CD_FLAG_NOFREE) layers, with the lowest bit set while the owning
+ * layer has already been freed and ownership rests with the remaining references. */
+#define CD_SHARED_PACK(refs, orphan) POINTER_FROM_UINT(((refs) << 1) | (uint)(orphan))
+#define CD_SHARED_REFS(val) (POINTER_AS_UINT(val) >> 1)
+#define CD_SHARED_ORPHAN(val) (POINTER_AS_UINT(val) & 1)
+
+/* Register one more referencing layer for the given layer data. */
+static void customdata_sharing_data_ref(const void *data)
+{
+  BLI_mutex_lock(&cd_shared_data_mutex);
+  if (cd_shared_data_map == NULL) {
+    cd_shared_data_map = BLI_ghash_ptr_new(__func__);
+  }
+  void **val_p;
+  if (BLI_ghash_ensure_p(cd_shared_data_map, (void *)data, &val_p)) {
+    *val_p = CD_SHARED_PACK(CD_SHARED_REFS(*val_p) + 1, CD_SHARED_ORPHAN(*val_p));
+  }
+  else {
+    *val_p = CD_SHARED_PACK(1, false);
+  }
+  BLI_mutex_unlock(&cd_shared_data_mutex);
+}
+
+/* Drop one referencing layer. Returns true when the caller was the last user and is now
+ * responsible for freeing the data. */
+static bool customdata_sharing_data_unref(const void *data)
+{
+  if (cd_shared_data_map == NULL) {
+    /* Reference created without registration (e.g. ownership stolen by flagging the layer
+     * with #CD_FLAG_NOFREE directly), keep the historic "never free" behavior. */
+    return false;
+  }
+  bool do_free = false;
+  BLI_mutex_lock(&cd_shared_data_mutex);
+  void **val_p = BLI_ghash_lookup_p(cd_shared_data_map, (void *)data);
+  if (val_p != NULL) {
+    const uint refs = CD_SHARED_REFS(*val_p) - 1;
+    if (refs == 0) {
+      do_free = CD_SHARED_ORPHAN(*val_p);
+      BLI_ghash_remove(cd_shared_data_map, (void *)data, NULL, NULL);
+    }
+    else {
+      *val_p = CD_SHARED_PACK(refs, CD_SHARED_ORPHAN(*val_p));
+    }
+  }
+  BLI_mutex_unlock(&cd_shared_data_mutex);
+  return do_free;
+}
+
+/* The owning layer is being freed. Returns true when references still exist, in which case
+ * ownership is transferred to them and the caller must not free the data. */
+static bool customdata_sharing_data_disown(const void *data)
+{
+  if (cd_shared_data_map == NULL) {
+    return false;
+  }
+  bool is_shared = false;
+  BLI_mutex_lock(&cd_shared_data_mutex);
+  void **val_p = BLI_ghash_lookup_p(cd_shared_data_map, (void *)data);
+  if (val_p != NULL) {
+    *val_p = CD_SHARED_PACK(CD_SHARED_REFS(*val_p), true);
+    is_shared = true;
+  }
+  BLI_mutex_unlock(&cd_shared_data_mutex);
+  return is_shared;
+}
+
+#undef CD_SHARED_PACK
+#undef CD_SHARED_REFS
+#undef CD_SHARED_ORPHAN
+
 /********************* CustomData functions *********************/
 static void customData_update_offsets(CustomData *data);
 
@@ -2209,17 +2298,28 @@ static void customData_free_layer__internal(CustomDataLayer *layer, int totelem)
 {
   const LayerTypeInfo *typeInfo;
 
-  if (!(layer->flag & CD_FLAG_NOFREE) && layer->data) {
-    typeInfo = layerType_getInfo(layer->type);
+  if (layer->data == NULL) {
+    return;
+  }
 
-    if (typeInfo->free) {
-      typeInfo->free(layer->data, totelem, typeInfo->size);
+  if (layer->flag & CD_FLAG_NOFREE) {
+    /* The last reference to an already disowned allocation is responsible for freeing it. */
+    if (!customdata_sharing_data_unref(layer->data)) {
+      return;
     }
+  }
+  else if (customdata_sharing_data_disown(layer->data)) {
+    /* References remain, ownership is transferred to them. */
+    return;
+  }
 
-    if (layer->data) {
-      MEM_freeN(layer->data);
-    }
+  typeInfo = layerType_getInfo(layer->type);
+
+  if (typeInfo->free) {
+    typeInfo->free(layer->data, totelem, typeInfo->size);
   }
+
+  MEM_freeN(layer->data);
 }
 
 static void CustomData_external_free(CustomData *data)
@@ -2584,6 +2684,10 @@ static CustomDataLayer *customData_add_layer__internal(CustomData *data,
   data->layers[index].flag = flag;
   data->layers[index].data = newlayerdata;
 
+  if ((flag & CD_FLAG_NOFREE) && newlayerdata != NULL) {
+    customdata_sharing_data_ref(newlayerdata);
+  }
+
   /* Set default name if none exists. Note we only call DATA_()  once
    * we know there is a default name, to avoid overhead of locale lookups
    * in the depsgraph. */
@@ -2768,18 +2872,26 @@ static void *customData_duplicate_referenced_layer_index(CustomData *data,
      * So in case a custom copy function is defined, use it!
      */
     const LayerTypeInfo *typeInfo = layerType_getInfo(layer->type);
+    void *src_data = layer->data;
 
     if (typeInfo->copy) {
       void *dst_data = MEM_malloc_arrayN(
           (size_t)totelem, typeInfo->size, "CD duplicate ref layer");
-      typeInfo->copy(layer->data, dst_data, totelem);
+      typeInfo->copy(src_data, dst_data, totelem);
       layer->data = dst_data;
     }
     else {
-      layer->data = MEM_dupallocN(layer->data);
+      layer->data = MEM_dupallocN(src_data);
     }
 
     layer->flag &= ~CD_FLAG_NOFREE;
+
+    if (customdata_sharing_data_unref(src_data)) {
+      if (typeInfo->free) {
+        typeInfo->free(src_data, totelem, typeInfo->size);
+      }
+      MEM_freeN(src_data);
+    }
   }
 
   return layer->data;
@@ -3018,6 +3130,28 @@ void CustomData_free_elem(CustomData *data, int index, int count)
 
 #define SOURCE_BUF_SIZE 100
 
+/**
+ * Number of contiguous floats making up an element of the given layer type, for types whose
+ * interpolation is a plain weighted sum of the source values (ignoring sub-weights). Types with
+ * any extra semantics (flags, normalization, sub-weight handling, ...) return 0 and keep using
+ * their per-type callback.
+ */
+static int customdata_interp_plain_float_len(const int type)
+{
+  switch (type) {
+    case CD_PROP_FLOAT:
+      return 1;
+    case CD_PROP_FLOAT2:
+      return 2;
+    case CD_PROP_FLOAT3:
+      return 3;
+    case CD_PROP_COLOR:
+      return 4;
+    default:
+      return 0;
+  }
+}
+
 /**
  * Interpolate given custom data source items into a single destination one.
  *
@@ -3084,17 +3218,33 @@ void CustomData_interp(const CustomData *source,
     /* if we found a matching layer, copy the data */
     if (dest->layers[dest_i].type == source->layers[src_i].type) {
       void *src_data = source->layers[src_i].data;
+      void *dst_data = POINTER_OFFSET(dest->layers[dest_i].data,
+                                      (size_t)dest_index * typeInfo->size);
+
+      const int float_len = customdata_interp_plain_float_len(source->layers[src_i].type);
+      if (float_len != 0) {
+        /* Plain float layers all blend the same way, so gather and accumulate them directly
+         * instead of building the source pointer array and dispatching through the per-type
+         * callback. The flat loop below vectorizes well. */
+        float result[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        for (int j = 0; j < count; j++) {
+          const float *src = POINTER_OFFSET(src_data, (size_t)src_indices[j] * typeInfo->size);
+          const float interp_weight = weights[j];
+          for (int k = 0; k < float_len; k++) {
+            result[k] += src[k] * interp_weight;
+          }
+        }
+        memcpy(dst_data, result, sizeof(float) * (size_t)float_len);
+
+        dest_i++;
+        continue;
+      }
 
       for (int j = 0; j < count; j++) {
         sources[j] = POINTER_OFFSET(src_data, (size_t)src_indices[j] * typeInfo->size);
       }
 
-      typeInfo->interp(
-          sources,
-          weights,
-          sub_weights,
-          count,
-          POINTER_OFFSET(dest->layers[dest_i].data, (size_t)dest_index * typeInfo->size));
+      typeInfo->interp(sources, weights, sub_weights, count, dst_data);
 
       /* if there are multiple source & dest layers of the same type,
        * we don't want to copy all source layers to the same dest, so
@@ -3663,6 +3813,36 @@ static void CustomData_bmesh_alloc_block(CustomData *data, void **block)
   }
 }
 
+/**
+ * Allocate the block if it was not allocated yet, without initializing it.
+ *
+ * Allows callers to allocate blocks for many elements up front (the mempool is
+ * not thread-safe), so the data copy in #CustomData_to_bmesh_block can then be
+ * done from multiple threads.
+ */
+void CustomData_bmesh_ensure_block(CustomData *data, void **block)
+{
+  if (*block == NULL) {
+    CustomData_bmesh_alloc_block(data, block);
+  }
+}
+
+/**
+ * A version of #CustomData_bmesh_ensure_block that allocates through a thread-local
+ * #BLI_mempool_cache initialized on `data->pool`, so blocks for many elements can be
+ * allocated concurrently from task-pool workers. The caller is responsible for flushing
+ * the cache before the pool is used directly again.
+ */
+void CustomData_bmesh_ensure_block_cached(CustomData *data,
+                                          void **block,
+                                          struct BLI_mempool_cache *cache)
+{
+  if (*block == NULL && data->totsize > 0) {
+    BLI_assert(cache->pool == data->pool);
+    *block = BLI_mempool_cache_alloc(cache);
+  }
+}
+
 /**
  * A selective version of #CustomData_bmesh_free_block_data.
  */
@@ -33,6 +33,7 @@
 #include "DNA_scene_types.h"
 #include "DNA_vfont_types.h"
 
+#include "BLI_array.hh"
 #include "BLI_bitmap.h"
 #include "BLI_index_range.hh"
 #include "BLI_linklist.h"
@@ -41,7 +42,9 @@
 #include "BLI_memarena.h"
 #include "BLI_scanfill.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_anim_path.h"
 #include "BKE_curve.h"
@@ -282,133 +285,150 @@ static void curve_to_displist(const Curve *cu,
 {
   const bool editmode = (!for_render && (cu->editnurb || cu->editfont));
 
-  LISTBASE_FOREACH (Nurb *, nu, nubase) {
+  /* Splines only read their own data, so they can be evaluated in parallel into per-spline
+   * display lists, which are moved into the output in the original order below. */
+  blender::Vector<const Nurb *> nurbs;
+  LISTBASE_FOREACH (const Nurb *, nu, nubase) {
     if (nu->hide != 0 && editmode) {
       continue;
     }
     if (!BKE_nurb_check_valid_u(nu)) {
       continue;
     }
+    nurbs.append(nu);
+  }
 
-    const int resolution = (for_render && cu->resolu_ren != 0) ? cu->resolu_ren : nu->resolu;
-    const bool is_cyclic = nu->flagu & CU_NURB_CYCLIC;
-    const BezTriple *bezt_first = &nu->bezt[0];
-    const BezTriple *bezt_last = &nu->bezt[nu->pntsu - 1];
-
-    if (nu->type == CU_BEZIER) {
-      int samples_len = 0;
-      for (int i = 1; i < nu->pntsu; i++) {
-        const BezTriple *prevbezt = &nu->bezt[i - 1];
-        const BezTriple *bezt = &nu->bezt[i];
-        if (prevbezt->h2 == HD_VECT && bezt->h1 == HD_VECT) {
-          samples_len++;
-        }
-        else {
-          samples_len += resolution;
+  blender::Array<ListBase> nurb_dispbases(nurbs.size(), {nullptr, nullptr});
+
+  blender::threading::parallel_for(nurbs.index_range(), 8, [&](IndexRange range) {
+    for (const int nu_index : range) {
+      const Nurb *nu = nurbs[nu_index];
+      ListBase *out_dispbase = &nurb_dispbases[nu_index];
+
+      const int resolution = (for_render && cu->resolu_ren != 0) ? cu->resolu_ren : nu->resolu;
+      const bool is_cyclic = nu->flagu & CU_NURB_CYCLIC;
+      const BezTriple *bezt_first = &nu->bezt[0];
+      const BezTriple *bezt_last = &nu->bezt[nu->pntsu - 1];
+
+      if (nu->type == CU_BEZIER) {
+        int samples_len = 0;
+        for (int i = 1; i < nu->pntsu; i++) {
+          const BezTriple *prevbezt = &nu->bezt[i - 1];
+          const BezTriple *bezt = &nu->bezt[i];
+          if (prevbezt->h2 == HD_VECT && bezt->h1 == HD_VECT) {
+            samples_len++;
+          }
+          else {
+            samples_len += resolution;
+          }
         }
-      }
-      if (is_cyclic) {
-        /* If the curve is cyclic, sample the last edge between the last and first points. */
-        if (bezt_first->h1 == HD_VECT && bezt_last->h2 == HD_VECT) {
-          samples_len++;
+        if (is_cyclic) {
+          /* If the curve is cyclic, sample the last edge between the last and first points. */
+          if (bezt_first->h1 == HD_VECT && bezt_last->h2 == HD_VECT) {
+            samples_len++;
+          }
+          else {
+            samples_len += resolution;
+          }
         }
         else {
-          samples_len += resolution;
+          /* Otherwise, we only need one additional sample to complete the last edge. */
+          samples_len++;
         }
-      }
-      else {
-        /* Otherwise, we only need one additional sample to complete the last edge. */
-        samples_len++;
-      }
 
-      /* Check that there are more than two points so the curve doesn't loop back on itself. This
-       * needs to be separate from `is_cyclic` because cyclic sampling can work with two points
-       * and resolution > 1. */
-      const bool use_cyclic_sample = is_cyclic && (samples_len != 2);
+        /* Check that there are more than two points so the curve doesn't loop back on itself. This
+         * needs to be separate from `is_cyclic` because cyclic sampling can work with two points
+         * and resolution > 1. */
+        const bool use_cyclic_sample = is_cyclic && (samples_len != 2);
 
-      DispList *dl = (DispList *)MEM_callocN(sizeof(DispList), __func__);
-      /* Add one to the length because of 'BKE_curve_forward_diff_bezier'. */
-      dl->verts = (float *)MEM_mallocN(sizeof(float[3]) * (samples_len + 1), __func__);
-      BLI_addtail(r_dispbase, dl);
-      dl->parts = 1;
-      dl->nr = samples_len;
-      dl->col = nu->mat_nr;
-      dl->charidx = nu->charidx;
+        DispList *dl = (DispList *)MEM_callocN(sizeof(DispList), __func__);
+        /* Add one to the length because of 'BKE_curve_forward_diff_bezier'. */
+        dl->verts = (float *)MEM_mallocN(sizeof(float[3]) * (samples_len + 1), __func__);
+        BLI_addtail(out_dispbase, dl);
+        dl->parts = 1;
+        dl->nr = samples_len;
+        dl->col = nu->mat_nr;
+        dl->charidx = nu->charidx;
 
-      dl->type = use_cyclic_sample ? DL_POLY : DL_SEGM;
+        dl->type = use_cyclic_sample ? DL_POLY : DL_SEGM;
 
-      float *data = dl->verts;
-      for (int i = 1; i < nu->pntsu; i++) {
-        const BezTriple *prevbezt = &nu->bezt[i - 1];
-        const BezTriple *bezt = &nu->bezt[i];
+        float *data = dl->verts;
+        for (int i = 1; i < nu->pntsu; i++) {
+          const BezTriple *prevbezt = &nu->bezt[i - 1];
+          const BezTriple *bezt = &nu->bezt[i];
 
-        if (prevbezt->h2 == HD_VECT && bezt->h1 == HD_VECT) {
-          copy_v3_v3(data, prevbezt->vec[1]);
-          data += 3;
-        }
-        else {
-          for (int j = 0; j < 3; j++) {
-            BKE_curve_forward_diff_bezier(prevbezt->vec[1][j],
-                                          prevbezt->vec[2][j],
-                                          bezt->vec[0][j],
-                                          bezt->vec[1][j],
-                                          data + j,
-                                          resolution,
-                                          sizeof(float[3]));
+          if (prevbezt->h2 == HD_VECT && bezt->h1 == HD_VECT) {
+            copy_v3_v3(data, prevbezt->vec[1]);
+            data += 3;
+          }
+          else {
+            for (int j = 0; j < 3; j++) {
+              BKE_curve_forward_diff_bezier(prevbezt->vec[1][j],
+                                            prevbezt->vec[2][j],
+                                            bezt->vec[0][j],
+                                            bezt->vec[1][j],
+                                            data + j,
+                                            resolution,
+                                            sizeof(float[3]));
+            }
+            data += 3 * resolution;
           }
-          data += 3 * resolution;
         }
-      }
-      if (is_cyclic) {
-        if (bezt_first->h1 == HD_VECT && bezt_last->h2 == HD_VECT) {
-          copy_v3_v3(data, bezt_last->vec[1]);
+        if (is_cyclic) {
+          if (bezt_first->h1 == HD_VECT && bezt_last->h2 == HD_VECT) {
+            copy_v3_v3(data, bezt_last->vec[1]);
+          }
+          else {
+            for (int j = 0; j < 3; j++) {
+              BKE_curve_forward_diff_bezier(bezt_last->vec[1][j],
+                                            bezt_last->vec[2][j],
+                                            bezt_first->vec[0][j],
+                                            bezt_first->vec[1][j],
+                                            data + j,
+                                            resolution,
+                                            sizeof(float[3]));
+            }
+          }
         }
         else {
-          for (int j = 0; j < 3; j++) {
-            BKE_curve_forward_diff_bezier(bezt_last->vec[1][j],
-                                          bezt_last->vec[2][j],
-                                          bezt_first->vec[0][j],
-                                          bezt_first->vec[1][j],
-                                          data + j,
-                                          resolution,
-                                          sizeof(float[3]));
-          }
+          copy_v3_v3(data, bezt_last->vec[1]);
         }
       }
-      else {
-        copy_v3_v3(data, bezt_last->vec[1]);
-      }
-    }
-    else if (nu->type == CU_NURBS) {
-      const int len = (resolution * SEGMENTSU(nu));
-      DispList *dl = (DispList *)MEM_callocN(sizeof(DispList), __func__);
-      dl->verts = (float *)MEM_mallocN(len * sizeof(float[3]), __func__);
-      BLI_addtail(r_dispbase, dl);
-      dl->parts = 1;
-      dl->nr = len;
-      dl->col = nu->mat_nr;
-      dl->charidx = nu->charidx;
-      dl->type = is_cyclic ? DL_POLY : DL_SEGM;
+      else if (nu->type == CU_NURBS) {
+        const int len = (resolution * SEGMENTSU(nu));
+        DispList *dl = (DispList *)MEM_callocN(sizeof(DispList), __func__);
+        dl->verts = (float *)MEM_mallocN(len * sizeof(float[3]), __func__);
+        BLI_addtail(out_dispbase, dl);
+        dl->parts = 1;
+        dl->nr = len;
+        dl->col = nu->mat_nr;
+        dl->charidx = nu->charidx;
+        dl->type = is_cyclic ? DL_POLY : DL_SEGM;
 
-      BKE_nurb_makeCurve(nu, dl->verts, nullptr, nullptr, nullptr, resolution, sizeof(float[3]));
-    }
-    else if (nu->type == CU_POLY) {
-      const int len = nu->pntsu;
-      DispList *dl = (DispList *)MEM_callocN(sizeof(DispList), __func__);
-      dl->verts = (float *)MEM_mallocN(len * sizeof(float[3]), __func__);
-      BLI_addtail(r_dispbase, dl);
-      dl->parts = 1;
-      dl->nr = len;
-      dl->col = nu->mat_nr;
-      dl->charidx = nu->charidx;
-      dl->type = (is_cyclic && (dl->nr != 2)) ? DL_POLY : DL_SEGM;
+        BKE_nurb_makeCurve(nu, dl->verts, nullptr, nullptr, nullptr, resolution, sizeof(float[3]));
+      }
+      else if (nu->type == CU_POLY) {
+        const int len = nu->pntsu;
+        DispList *dl = (DispList *)MEM_callocN(sizeof(DispList), __func__);
+        dl->verts = (float *)MEM_mallocN(len * sizeof(float[3]), __func__);
+        BLI_addtail(out_dispbase, dl);
+        dl->parts = 1;
+        dl->nr = len;
+        dl->col = nu->mat_nr;
+        dl->charidx = nu->charidx;
+        dl->type = (is_cyclic && (dl->nr != 2)) ? DL_POLY : DL_SEGM;
 
-      float(*coords)[3] = (float(*)[3])dl->verts;
-      for (int i = 0; i < len; i++) {
-        const BPoint *bp = &nu->bp[i];
-        copy_v3_v3(coords[i], bp->vec);
+        float(*coords)[3] = (float(*)[3])dl->verts;
+        for (int i = 0; i < len; i++) {
+          const BPoint *bp = &nu->bp[i];
+          copy_v3_v3(coords[i], bp->vec);
+        }
       }
     }
+  });
+
+  for (ListBase &lb : nurb_dispbases) {
+    BLI_movelisttolist(r_dispbase, &lb);
   }
 }
 
@@ -1433,171 +1453,198 @@ static void evaluate_curve_type_object(Depsgraph *depsgraph,
   else {
     const float widfac = cu->width - 1.0f;
 
-    const BevList *bl = (BevList *)ob->runtime.curve_cache->bev.first;
-    const Nurb *nu = (Nurb *)deformed_nurbs->first;
-    for (; bl && nu; bl = bl->next, nu = nu->next) {
-      float *data;
-
-      if (bl->nr == 0) { /* blank bevel lists can happen */
-        continue;
+    /* Pair each bevel list with its spline. The sweep for each pair only reads shared data,
+     * so the pairs are swept in parallel into per-pair display lists, which are moved into the
+     * output in the original order below. */
+    blender::Vector<std::pair<const BevList *, const Nurb *>> bevel_pairs;
+    {
+      const BevList *bl = (const BevList *)ob->runtime.curve_cache->bev.first;
+      const Nurb *nu = (const Nurb *)deformed_nurbs->first;
+      for (; bl && nu; bl = bl->next, nu = nu->next) {
+        bevel_pairs.append({bl, nu});
       }
+    }
 
-      /* exception handling; curve without bevel or extrude, with width correction */
-      if (BLI_listbase_is_empty(&dlbev)) {
-        DispList *dl = (DispList *)MEM_callocN(sizeof(DispList), "makeDispListbev");
-        dl->verts = (float *)MEM_mallocN(sizeof(float[3]) * bl->nr, "dlverts");
-        BLI_addtail(r_dispbase, dl);
+    if (cu->taperobj != nullptr) {
+      /* Evaluating the taper builds the taper object's display list when it is missing, which
+       * must not happen from multiple threads at once. */
+      displist_calc_taper(depsgraph, scene, cu->taperobj, 0.0f);
+    }
 
-        if (bl->poly != -1) {
-          dl->type = DL_POLY;
-        }
-        else {
-          dl->type = DL_SEGM;
-          dl->flag = (DL_FRONT_CURVE | DL_BACK_CURVE);
-        }
+    blender::Array<ListBase> pair_dispbases(bevel_pairs.size(), {nullptr, nullptr});
 
-        dl->parts = 1;
-        dl->nr = bl->nr;
-        dl->col = nu->mat_nr;
-        dl->charidx = nu->charidx;
-        dl->rt = nu->flag;
-
-        int a = dl->nr;
-        BevPoint *bevp = bl->bevpoints;
-        data = dl->verts;
-        while (a--) {
-          data[0] = bevp->vec[0] + widfac * bevp->sina;
-          data[1] = bevp->vec[1] + widfac * bevp->cosa;
-          data[2] = bevp->vec[2];
-          bevp++;
-          data += 3;
-        }
-      }
-      else {
-        ListBase bottom_capbase = {nullptr, nullptr};
-        ListBase top_capbase = {nullptr, nullptr};
-        float bottom_no[3] = {0.0f};
-        float top_no[3] = {0.0f};
-        float first_blend = 0.0f, last_blend = 0.0f;
-        int start, steps = 0;
-
-        if (nu->flagu & CU_NURB_CYCLIC) {
-          calc_bevfac_mapping_default(bl, &start, &first_blend, &steps, &last_blend);
-        }
-        else {
-          if (fabsf(cu->bevfac2 - cu->bevfac1) < FLT_EPSILON) {
-            continue;
-          }
+    blender::threading::parallel_for(bevel_pairs.index_range(), 1, [&](IndexRange range) {
+      for (const int pair_index : range) {
+        const BevList *bl = bevel_pairs[pair_index].first;
+        const Nurb *nu = bevel_pairs[pair_index].second;
+        ListBase *out_dispbase = &pair_dispbases[pair_index];
+        float *data;
 
-          calc_bevfac_mapping(cu, bl, nu, &start, &first_blend, &steps, &last_blend);
+        if (bl->nr == 0) { /* blank bevel lists can happen */
+          continue;
         }
 
-        LISTBASE_FOREACH (DispList *, dlb, &dlbev) {
-          /* for each part of the bevel use a separate displblock */
-          DispList *dl = (DispList *)MEM_callocN(sizeof(DispList), __func__);
-          dl->verts = data = (float *)MEM_mallocN(sizeof(float[3]) * dlb->nr * steps, __func__);
-          BLI_addtail(r_dispbase, dl);
+        /* exception handling; curve without bevel or extrude, with width correction */
+        if (BLI_listbase_is_empty(&dlbev)) {
+          DispList *dl = (DispList *)MEM_callocN(sizeof(DispList), "makeDispListbev");
+          dl->verts = (float *)MEM_mallocN(sizeof(float[3]) * bl->nr, "dlverts");
+          BLI_addtail(out_dispbase, dl);
 
-          dl->type = DL_SURF;
-
-          dl->flag = dlb->flag & (DL_FRONT_CURVE | DL_BACK_CURVE);
-          if (dlb->type == DL_POLY) {
-            dl->flag |= DL_CYCL_U;
+          if (bl->poly != -1) {
+            dl->type = DL_POLY;
           }
-          if ((bl->poly >= 0) && (steps > 2)) {
-            dl->flag |= DL_CYCL_V;
+          else {
+            dl->type = DL_SEGM;
+            dl->flag = (DL_FRONT_CURVE | DL_BACK_CURVE);
           }
 
-          dl->parts = steps;
-          dl->nr = dlb->nr;
+          dl->parts = 1;
+          dl->nr = bl->nr;
           dl->col = nu->mat_nr;
           dl->charidx = nu->charidx;
           dl->rt = nu->flag;
 
-          /* for each point of poly make a bevel piece */
-          BevPoint *bevp_first = bl->bevpoints;
-          BevPoint *bevp_last = &bl->bevpoints[bl->nr - 1];
-          BevPoint *bevp = &bl->bevpoints[start];
-          for (int i = start, a = 0; a < steps; i++, bevp++, a++) {
-            float radius_factor = 1.0;
-            float *cur_data = data;
+          int a = dl->nr;
+          BevPoint *bevp = bl->bevpoints;
+          data = dl->verts;
+          while (a--) {
+            data[0] = bevp->vec[0] + widfac * bevp->sina;
+            data[1] = bevp->vec[1] + widfac * bevp->cosa;
+            data[2] = bevp->vec[2];
+            bevp++;
+            data += 3;
+          }
+        }
+        else {
+          ListBase bottom_capbase = {nullptr, nullptr};
+          ListBase top_capbase = {nullptr, nullptr};
+          float bottom_no[3] = {0.0f};
+          float top_no[3] = {0.0f};
+          float first_blend = 0.0f, last_blend = 0.0f;
+          int start, steps = 0;
+
+          if (nu->flagu & CU_NURB_CYCLIC) {
+            calc_bevfac_mapping_default(bl, &start, &first_blend, &steps, &last_blend);
+          }
+          else {
+            if (fabsf(cu->bevfac2 - cu->bevfac1) < FLT_EPSILON) {
+              continue;
+            }
+
+            calc_bevfac_mapping(cu, bl, nu, &start, &first_blend, &steps, &last_blend);
+          }
+
+          LISTBASE_FOREACH (DispList *, dlb, &dlbev) {
+            /* for each part of the bevel use a separate displblock */
+            DispList *dl = (DispList *)MEM_callocN(sizeof(DispList), __func__);
+            dl->verts = data = (float *)MEM_mallocN(sizeof(float[3]) * dlb->nr * steps, __func__);
+            BLI_addtail(out_dispbase, dl);
 
-            if (cu->taperobj == nullptr) {
-              radius_factor = bevp->radius;
+            dl->type = DL_SURF;
+
+            dl->flag = dlb->flag & (DL_FRONT_CURVE | DL_BACK_CURVE);
+            if (dlb->type == DL_POLY) {
+              dl->flag |= DL_CYCL_U;
+            }
+            if ((bl->poly >= 0) && (steps > 2)) {
+              dl->flag |= DL_CYCL_V;
             }
-            else {
-              float taper_factor;
-              if (cu->flag & CU_MAP_TAPER) {
-                float len = (steps - 3) + first_blend + last_blend;
 
-                if (a == 0) {
-                  taper_factor = 0.0f;
-                }
-                else if (a == steps - 1) {
-                  taper_factor = 1.0f;
+            dl->parts = steps;
+            dl->nr = dlb->nr;
+            dl->col = nu->mat_nr;
+            dl->charidx = nu->charidx;
+            dl->rt = nu->flag;
+
+            /* for each point of poly make a bevel piece */
+            BevPoint *bevp_first = bl->bevpoints;
+            BevPoint *bevp_last = &bl->bevpoints[bl->nr - 1];
+            BevPoint *bevp = &bl->bevpoints[start];
+            for (int i = start, a = 0; a < steps; i++, bevp++, a++) {
+              float radius_factor = 1.0;
+              float *cur_data = data;
+
+              if (cu->taperobj == nullptr) {
+                radius_factor = bevp->radius;
+              }
+              else {
+                float taper_factor;
+                if (cu->flag & CU_MAP_TAPER) {
+                  float len = (steps - 3) + first_blend + last_blend;
+
+                  if (a == 0) {
+                    taper_factor = 0.0f;
+                  }
+                  else if (a == steps - 1) {
+                    taper_factor = 1.0f;
+                  }
+                  else {
+                    taper_factor = ((float)a - (1.0f - first_blend)) / len;
+                  }
                 }
                 else {
-                  taper_factor = ((float)a - (1.0f - first_blend)) / len;
+                  float len = bl->nr - 1;
+                  taper_factor = (float)i / len;
+
+                  if (a == 0) {
+                    taper_factor += (1.0f - first_blend) / len;
+                  }
+                  else if (a == steps - 1) {
+                    taper_factor -= (1.0f - last_blend) / len;
+                  }
                 }
-              }
-              else {
-                float len = bl->nr - 1;
-                taper_factor = (float)i / len;
 
-                if (a == 0) {
-                  taper_factor += (1.0f - first_blend) / len;
+                radius_factor = displist_calc_taper(depsgraph, scene, cu->taperobj, taper_factor);
+
+                if (cu->taper_radius_mode == CU_TAPER_RADIUS_MULTIPLY) {
+                  radius_factor *= bevp->radius;
                 }
-                else if (a == steps - 1) {
-                  taper_factor -= (1.0f - last_blend) / len;
+                else if (cu->taper_radius_mode == CU_TAPER_RADIUS_ADD) {
+                  radius_factor += bevp->radius;
                 }
               }
 
-              radius_factor = displist_calc_taper(depsgraph, scene, cu->taperobj, taper_factor);
-
-              if (cu->taper_radius_mode == CU_TAPER_RADIUS_MULTIPLY) {
-                radius_factor *= bevp->radius;
+              /* rotate bevel piece and write in data */
+              if ((a == 0) && (bevp != bevp_last)) {
+                rotateBevelPiece(
+                    cu, bevp, bevp + 1, dlb, 1.0f - first_blend, widfac, radius_factor, &data);
               }
-              else if (cu->taper_radius_mode == CU_TAPER_RADIUS_ADD) {
-                radius_factor += bevp->radius;
+              else if ((a == steps - 1) && (bevp != bevp_first)) {
+                rotateBevelPiece(
+                    cu, bevp, bevp - 1, dlb, 1.0f - last_blend, widfac, radius_factor, &data);
               }
-            }
-
-            /* rotate bevel piece and write in data */
-            if ((a == 0) && (bevp != bevp_last)) {
-              rotateBevelPiece(
-                  cu, bevp, bevp + 1, dlb, 1.0f - first_blend, widfac, radius_factor, &data);
-            }
-            else if ((a == steps - 1) && (bevp != bevp_first)) {
-              rotateBevelPiece(
-                  cu, bevp, bevp - 1, dlb, 1.0f - last_blend, widfac, radius_factor, &data);
-            }
-            else {
-              rotateBevelPiece(cu, bevp, nullptr, dlb, 0.0f, widfac, radius_factor, &data);
-            }
-
-            if ((cu->flag & CU_FILL_CAPS) && !(nu->flagu & CU_NURB_CYCLIC)) {
-              if (a == 1) {
-                fillBevelCap(nu, dlb, cur_data - 3 * dlb->nr, &bottom_capbase);
-                copy_v3_v3(bottom_no, bevp->dir);
+              else {
+                rotateBevelPiece(cu, bevp, nullptr, dlb, 0.0f, widfac, radius_factor, &data);
               }
-              if (a == steps - 1) {
-                fillBevelCap(nu, dlb, cur_data, &top_capbase);
-                negate_v3_v3(top_no, bevp->dir);
+
+              if ((cu->flag & CU_FILL_CAPS) && !(nu->flagu & CU_NURB_CYCLIC)) {
+                if (a == 1) {
+                  fillBevelCap(nu, dlb, cur_data - 3 * dlb->nr, &bottom_capbase);
+                  copy_v3_v3(bottom_no, bevp->dir);
+                }
+                if (a == steps - 1) {
+                  fillBevelCap(nu, dlb, cur_data, &top_capbase);
+                  negate_v3_v3(top_no, bevp->dir);
+                }
               }
             }
-          }
 
-          /* gl array drawing: using indices */
-          displist_surf_indices(dl);
-        }
+            /* gl array drawing: using indices */
+            displist_surf_indices(dl);
+          }
 
-        if (bottom_capbase.first) {
-          BKE_displist_fill(&bottom_capbase, r_dispbase, bottom_no, false);
-          BKE_displist_fill(&top_capbase, r_dispbase, top_no, false);
-          BKE_displist_free(&bottom_capbase);
-          BKE_displist_free(&top_capbase);
+          if (bottom_capbase.first) {
+            BKE_displist_fill(&bottom_capbase, out_dispbase, bottom_no, false);
+            BKE_displist_fill(&top_capbase, out_dispbase, top_no, false);
+            BKE_displist_free(&bottom_capbase);
+            BKE_displist_free(&top_capbase);
+          }
         }
       }
+    });
+
+    for (ListBase &lb : pair_dispbases) {
+      BLI_movelisttolist(r_dispbase, &lb);
     }
   }
 
@@ -2828,6 +2828,60 @@ static bool dynamicPaint_symmetrizeAdjData(PaintAdjData *ed, int active_points)
   return false;
 }
 
+typedef struct DynamicPaintCreateUVSurfaceAdjData {
+  const DynamicPaintCreateUVSurfaceData *data;
+  const MeshElemMap *vert_to_looptri_map;
+  const int *final_index;
+  PaintAdjData *ed;
+} DynamicPaintCreateUVSurfaceAdjData;
+
+static void dynamic_paint_create_uv_surface_adj_cb(void *__restrict userdata,
+                                                   const int ty,
+                                                   const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const DynamicPaintCreateUVSurfaceAdjData *adj_data = userdata;
+  const DynamicPaintCreateUVSurfaceData *data = adj_data->data;
+  const int *final_index = adj_data->final_index;
+  PaintAdjData *ed = adj_data->ed;
+
+  const int w = data->surface->image_resolution;
+  const int h = w;
+
+  for (int tx = 0; tx < w; tx++) {
+    const int index = tx + w * ty;
+
+    if (data->tempPoints[index].tri_index == -1) {
+      continue;
+    }
+
+    /* Every pixel gets its own 8 target slots: the lists are compacted when the adjacency
+     * data is made symmetric, so rows can run in parallel without sharing a cursor. */
+    const int fidx = final_index[index];
+    ed->n_index[fidx] = fidx * 8;
+    ed->n_num[fidx] = 0;
+
+    if (data->tempPoints[index].neighbor_pixel != -1) {
+      ed->flags[fidx] |= ADJ_BORDER_PIXEL;
+    }
+
+    for (int i = 0; i < 8; i++) {
+      /* Try to find a neighboring pixel in defined direction. If not found, -1 is returned */
+      const int n_target = dynamic_paint_find_neighbor_pixel(
+          data, adj_data->vert_to_looptri_map, w, h, tx, ty, i);
+
+      if (n_target >= 0 && n_target != index) {
+        if (!dynamicPaint_pointHasNeighbor(ed, fidx, final_index[n_target])) {
+          ed->n_target[fidx * 8 + ed->n_num[fidx]] = final_index[n_target];
+          ed->n_num[fidx]++;
+        }
+      }
+      else if (ELEM(n_target, ON_MESH_EDGE, OUT_OF_TEXTURE)) {
+        ed->flags[fidx] |= ADJ_ON_MESH_EDGE;
+      }
+    }
+  }
+}
+
 int dynamicPaint_createUVSurface(Scene *scene,
                                  DynamicPaintSurface *surface,
                                  float *progress,
@@ -2995,7 +3049,6 @@ int dynamicPaint_createUVSurface(Scene *scene,
 
       if (sData->adj_data) {
         PaintAdjData *ed = sData->adj_data;
-        int n_pos = 0;
 
         MeshElemMap *vert_to_looptri_map;
         int *vert_to_looptri_map_mem;
@@ -3009,40 +3062,25 @@ int dynamicPaint_createUVSurface(Scene *scene,
                                          mloop,
                                          mesh->totloop);
 
-        int total_border = 0;
-
-        for (int ty = 0; ty < h; ty++) {
-          for (int tx = 0; tx < w; tx++) {
-            const int index = tx + w * ty;
-
-            if (tempPoints[index].tri_index != -1) {
-              ed->n_index[final_index[index]] = n_pos;
-              ed->n_num[final_index[index]] = 0;
-
-              if (tempPoints[index].neighbor_pixel != -1) {
-                ed->flags[final_index[index]] |= ADJ_BORDER_PIXEL;
-                total_border++;
-              }
+        /* The neighbor search (especially the island border lookups) dominates surface setup
+         * on high resolutions, so run it per scanline over the task scheduler. */
+        DynamicPaintCreateUVSurfaceAdjData adj_data = {
+            .data = &data,
+            .vert_to_looptri_map = vert_to_looptri_map,
+            .final_index = final_index,
+            .ed = ed,
+        };
+        {
+          TaskParallelSettings settings;
+          BLI_parallel_range_settings_defaults(&settings);
+          settings.use_threading = (h > 64);
+          BLI_task_parallel_range(0, h, &adj_data, dynamic_paint_create_uv_surface_adj_cb, &settings);
+        }
 
-              for (int i = 0; i < 8; i++) {
-                /* Try to find a neighboring pixel in defined direction.
-                 * If not found, -1 is returned */
-                const int n_target = dynamic_paint_find_neighbor_pixel(
-                    &data, vert_to_looptri_map, w, h, tx, ty, i);
-
-                if (n_target >= 0 && n_target != index) {
-                  if (!dynamicPaint_pointHasNeighbor(
-                          ed, final_index[index], final_index[n_target])) {
-                    ed->n_target[n_pos] = final_index[n_target];
-                    ed->n_num[final_index[index]]++;
-                    n_pos++;
-                  }
-                }
-                else if (ELEM(n_target, ON_MESH_EDGE, OUT_OF_TEXTURE)) {
-                  ed->flags[final_index[index]] |= ADJ_ON_MESH_EDGE;
-                }
-              }
-            }
+        int total_border = 0;
+        for (int i = 0; i < active_points; i++) {
+          if (ed->flags[i] & ADJ_BORDER_PIXEL) {
+            total_border++;
           }
         }
 
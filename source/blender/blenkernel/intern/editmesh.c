@@ -28,6 +28,7 @@
 #include "DNA_object_types.h"
 
 #include "BLI_bitmap.h"
+#include "BLI_ghash.h"
 #include "BLI_math.h"
 
 #include "BKE_DerivedMesh.h"
@@ -68,6 +69,9 @@ BMEditMesh *BKE_editmesh_copy(BMEditMesh *em)
    * tessellation only when/if that copy ends up getting used. */
   em_copy->looptris = NULL;
 
+  /* Lookup caches are not shared, the copy rebuilds them on demand. */
+  em_copy->spatial_cache = NULL;
+
   /* Copy various settings. */
   em_copy->selectmode = em->selectmode;
   em_copy->mat_nr = em->mat_nr;
@@ -226,6 +230,8 @@ void BKE_editmesh_free_data(BMEditMesh *em)
 {
   BKE_editmesh_free_derived_caches(em);
 
+  BKE_editmesh_spatial_cache_free(em);
+
   if (em->looptris) {
     MEM_freeN(em->looptris);
   }
@@ -235,6 +241,236 @@ void BKE_editmesh_free_data(BMEditMesh *em)
   }
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Vertex Spatial Cache
+ *
+ * A uniform grid hash over the vertex coordinates for bounded-radius nearest-vertex
+ * lookups (x-mirror, symmetry snapping, auto-merge). Unlike a KD-tree it supports cheap
+ * per-vertex re-insertion, so it can be kept valid over vertex moves from the partial
+ * update sets used by transform, instead of being rebuilt from scratch every operation.
+ *
+ * The cache stores vertex indices and relies on them being stable: any change to the
+ * mesh topology or vertex order must free it (see #EDBM_update).
+ * \{ */
+
+typedef struct BMEditMeshSpatialCache {
+  /** Maps packed cell coordinates to the first vertex index of the cell's chain. */
+  GHash *cell_map;
+  /** Per vertex, the next vertex index in its cell's chain (-1 terminated). */
+  int *vert_next;
+  /** Per vertex, the packed cell it is currently stored in. */
+  uint64_t *vert_cell;
+  int totvert;
+  float cell_size;
+} BMEditMeshSpatialCache;
+
+/** Cell coordinates are biased into 21 unsigned bits per axis. */
+#define SPATIAL_CELL_BIAS 0x100000
+
+static uint64_t editmesh_spatial_cell_key(const int cell[3])
+{
+  uint64_t key = 0;
+  for (int axis = 0; axis < 3; axis++) {
+    const int c = clamp_i(cell[axis], -SPATIAL_CELL_BIAS, SPATIAL_CELL_BIAS - 1);
+    key = (key << 21) | (uint64_t)(c + SPATIAL_CELL_BIAS);
+  }
+  return key;
+}
+
+static uint64_t editmesh_spatial_cell_key_from_co(const float co[3], const float cell_size_inv)
+{
+  const int cell[3] = {
+      (int)floorf(co[0] * cell_size_inv),
+      (int)floorf(co[1] * cell_size_inv),
+      (int)floorf(co[2] * cell_size_inv),
+  };
+  return editmesh_spatial_cell_key(cell);
+}
+
+static void editmesh_spatial_cache_vert_insert(BMEditMeshSpatialCache *cache,
+                                               const int i,
+                                               const uint64_t key)
+{
+  void **val_p;
+  if (BLI_ghash_ensure_p(cache->cell_map, (void *)(uintptr_t)key, &val_p)) {
+    cache->vert_next[i] = POINTER_AS_INT(*val_p);
+  }
+  else {
+    cache->vert_next[i] = -1;
+  }
+  *val_p = POINTER_FROM_INT(i);
+  cache->vert_cell[i] = key;
+}
+
+static void editmesh_spatial_cache_vert_remove(BMEditMeshSpatialCache *cache, const int i)
+{
+  const uint64_t key = cache->vert_cell[i];
+  void **val_p = BLI_ghash_lookup_p(cache->cell_map, (void *)(uintptr_t)key);
+  if (val_p == NULL) {
+    return;
+  }
+  if (POINTER_AS_INT(*val_p) == i) {
+    if (cache->vert_next[i] == -1) {
+      BLI_ghash_remove(cache->cell_map, (void *)(uintptr_t)key, NULL, NULL);
+    }
+    else {
+      *val_p = POINTER_FROM_INT(cache->vert_next[i]);
+    }
+  }
+  else {
+    int j = POINTER_AS_INT(*val_p);
+    while (cache->vert_next[j] != -1 && cache->vert_next[j] != i) {
+      j = cache->vert_next[j];
+    }
+    if (cache->vert_next[j] == i) {
+      cache->vert_next[j] = cache->vert_next[i];
+    }
+  }
+}
+
+/**
+ * Return the spatial cache, building it when absent. An existing cache is reused when its
+ * cell size covers \a cell_size_min (queries may not exceed the cell size as search radius)
+ * and the vertex count still matches, otherwise it is rebuilt.
+ */
+BMEditMeshSpatialCache *BKE_editmesh_spatial_cache_ensure(BMEditMesh *em,
+                                                          const float cell_size_min)
+{
+  BMesh *bm = em->bm;
+  const float cell_size = max_ff(cell_size_min, FLT_EPSILON);
+  BMEditMeshSpatialCache *cache = em->spatial_cache;
+
+  if (cache && (cache->totvert != bm->totvert || cache->cell_size < cell_size)) {
+    BKE_editmesh_spatial_cache_free(em);
+    cache = NULL;
+  }
+  if (cache) {
+    return cache;
+  }
+
+  BM_mesh_elem_table_ensure(bm, BM_VERT);
+  BM_mesh_elem_index_ensure(bm, BM_VERT);
+
+  cache = MEM_callocN(sizeof(*cache), __func__);
+  cache->totvert = bm->totvert;
+  cache->cell_size = cell_size;
+  cache->vert_next = MEM_malloc_arrayN((size_t)bm->totvert, sizeof(int), __func__);
+  cache->vert_cell = MEM_malloc_arrayN((size_t)bm->totvert, sizeof(uint64_t), __func__);
+  cache->cell_map = BLI_ghash_ptr_new_ex(__func__, (uint)bm->totvert);
+
+  const float cell_size_inv = 1.0f / cell_size;
+  for (int i = 0; i < bm->totvert; i++) {
+    const BMVert *v = BM_vert_at_index(bm, i);
+    editmesh_spatial_cache_vert_insert(
+        cache, i, editmesh_spatial_cell_key_from_co(v->co, cell_size_inv));
+  }
+
+  em->spatial_cache = cache;
+  return cache;
+}
+
+/**
+ * Re-insert the vertices of a partial update set after their coordinates changed.
+ * Does nothing when no cache is built.
+ */
+void BKE_editmesh_spatial_cache_update_verts(BMEditMesh *em, const BMPartialUpdate *bmpinfo)
+{
+  BMEditMeshSpatialCache *cache = em->spatial_cache;
+  if (cache == NULL) {
+    return;
+  }
+  if (cache->totvert != em->bm->totvert) {
+    /* Should have been freed on the topology change, don't risk stale indices. */
+    BKE_editmesh_spatial_cache_free(em);
+    return;
+  }
+
+  const float cell_size_inv = 1.0f / cache->cell_size;
+  for (int i = 0; i < bmpinfo->verts_len; i++) {
+    const BMVert *v = bmpinfo->verts[i];
+    const int index = BM_elem_index_get(v);
+    const uint64_t key = editmesh_spatial_cell_key_from_co(v->co, cell_size_inv);
+    if (cache->vert_cell[index] != key) {
+      editmesh_spatial_cache_vert_remove(cache, index);
+      editmesh_spatial_cache_vert_insert(cache, index, key);
+    }
+  }
+}
+
+void BKE_editmesh_spatial_cache_free(BMEditMesh *em)
+{
+  BMEditMeshSpatialCache *cache = em->spatial_cache;
+  if (cache == NULL) {
+    return;
+  }
+  BLI_ghash_free(cache->cell_map, NULL, NULL);
+  MEM_freeN(cache->vert_next);
+  MEM_freeN(cache->vert_cell);
+  MEM_freeN(cache);
+  em->spatial_cache = NULL;
+}
+
+/**
+ * Find the vertex nearest to \a co within \a maxdist, or NULL.
+ * \a maxdist must not exceed the cell size the cache was built with
+ * (pass it to #BKE_editmesh_spatial_cache_ensure).
+ *
+ * \param filter_fn: Optional, vertices for which it returns false are skipped.
+ */
+BMVert *BKE_editmesh_spatial_cache_find_nearest(BMEditMesh *em,
+                                                const float co[3],
+                                                const float maxdist,
+                                                bool (*filter_fn)(BMVert *v, void *user_data),
+                                                void *user_data)
+{
+  BMesh *bm = em->bm;
+  BMEditMeshSpatialCache *cache = em->spatial_cache;
+  BLI_assert(cache != NULL);
+  BLI_assert(maxdist <= cache->cell_size);
+
+  BM_mesh_elem_table_ensure(bm, BM_VERT);
+
+  const float cell_size_inv = 1.0f / cache->cell_size;
+  int cell_min[3], cell_max[3];
+  for (int axis = 0; axis < 3; axis++) {
+    cell_min[axis] = (int)floorf((co[axis] - maxdist) * cell_size_inv);
+    cell_max[axis] = (int)floorf((co[axis] + maxdist) * cell_size_inv);
+  }
+
+  BMVert *v_best = NULL;
+  float dist_best_sq = square_f(maxdist);
+
+  int cell[3];
+  for (cell[0] = cell_min[0]; cell[0] <= cell_max[0]; cell[0]++) {
+    for (cell[1] = cell_min[1]; cell[1] <= cell_max[1]; cell[1]++) {
+      for (cell[2] = cell_min[2]; cell[2] <= cell_max[2]; cell[2]++) {
+        const uint64_t key = editmesh_spatial_cell_key(cell);
+        void **val_p = BLI_ghash_lookup_p(cache->cell_map, (void *)(uintptr_t)key);
+        if (val_p == NULL) {
+          continue;
+        }
+        for (int i = POINTER_AS_INT(*val_p); i != -1; i = cache->vert_next[i]) {
+          BMVert *v = BM_vert_at_index(bm, i);
+          const float dist_sq = len_squared_v3v3(co, v->co);
+          if (dist_sq < dist_best_sq) {
+            if (filter_fn && !filter_fn(v, user_data)) {
+              continue;
+            }
+            v_best = v;
+            dist_best_sq = dist_sq;
+          }
+        }
+      }
+    }
+  }
+
+  return v_best;
+}
+
+#undef SPATIAL_CELL_BIAS
+
+/** \} */
+
 struct CageUserData {
   int totvert;
   float (*cos_cage)[3];
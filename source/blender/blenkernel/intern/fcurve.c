@@ -84,6 +84,9 @@ void BKE_fcurve_free(FCurve *fcu)
     return;
   }
 
+  /* So a later F-Curve allocated at the same address can't pick up the table. */
+  BKE_fcurve_bake_cache_invalidate(fcu);
+
   /* Free curve data. */
   MEM_SAFE_FREE(fcu->bezt);
   MEM_SAFE_FREE(fcu->fpt);
@@ -1307,6 +1310,10 @@ void calchandles_fcurve_ex(FCurve *fcu, eBezTriple_Flag handle_sel_flag)
   BezTriple *bezt, *prev, *next;
   int a = fcu->totvert;
 
+  /* Handles are recalculated after every keyframe edit,
+   * which makes this the central place to drop stale baked tables. */
+  BKE_fcurve_bake_cache_invalidate(fcu);
+
   /* Error checking:
    * - Need at least two points.
    * - Need bezier keys.
@@ -2272,7 +2279,7 @@ float calculate_fcurve(PathResolvedRNA *anim_rna,
   if (fcu->driver) {
     curval = evaluate_fcurve_driver(anim_rna, fcu, fcu->driver, anim_eval_context);
   }
-  else {
+  else if (!BKE_fcurve_bake_cache_evaluate(fcu, anim_eval_context->eval_time, &curval)) {
     curval = evaluate_fcurve(fcu, anim_eval_context->eval_time);
   }
   fcu->curval = curval; /* Debug display only, not thread safe! */
@@ -20,15 +20,20 @@
  * Cache F-Curve look-ups.
  */
 
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "MEM_guardedalloc.h"
 
+#include "atomic_ops.h"
+
 #include "DNA_anim_types.h"
 
 #include "BLI_ghash.h"
 #include "BLI_listbase.h"
+#include "BLI_math_base.h"
+#include "BLI_threads.h"
 
 #include "BKE_fcurve.h"
 
@@ -187,3 +192,194 @@ int BKE_fcurve_pathcache_find_array(struct FCurvePathCache *fcache,
 }
 
 /** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name F-Curve Bake Cache
+ *
+ * Opt-in uniform-sample tables for keyframed F-Curves, turning playback
+ * evaluation into a single lerp per channel instead of a binary search and
+ * cubic solve. Only enabled for the duration of animation playback (see
+ * #ED_screen_animation_timer), tables are built lazily on the first
+ * evaluation of each curve and invalidated when its keyframes are edited
+ * (see #calchandles_fcurve_ex).
+ * \{ */
+
+/** Sample density, sub-frame accuracy is approximate between samples. */
+#define FCURVE_BAKE_SAMPLES_PER_FRAME 4
+/** Don't bake very long curves, direct evaluation is cheap next to the memory cost. */
+#define FCURVE_BAKE_SAMPLES_MAX 16384
+
+typedef struct FCurveBakeTable {
+  /** Frame of the first/last sample (the F-Curve's keyed range). */
+  float start, end;
+  /** Time in frames between two samples. */
+  float step;
+  int sample_len;
+  /** NULL for curves that were found to be unbakeable (avoids re-checking). */
+  float *samples;
+} FCurveBakeTable;
+
+static struct {
+  /** Map an #FCurve pointer to its #FCurveBakeTable, NULL until first use. */
+  GHash *table_from_fcu;
+  bool enabled;
+} g_bake_cache = {NULL, false};
+
+static ThreadRWMutex g_bake_cache_lock = BLI_RWLOCK_INITIALIZER;
+
+/** Bumped on every keyframe edit or F-Curve free, see #BKE_fcurve_edit_generation. */
+static uint64_t g_fcurve_edit_generation = 0;
+
+static void fcurve_bake_table_free(void *val)
+{
+  FCurveBakeTable *table = val;
+  MEM_SAFE_FREE(table->samples);
+  MEM_freeN(table);
+}
+
+static bool fcurve_bake_is_supported(const FCurve *fcu)
+{
+  /* Only plain keyframed channels: drivers, F-Modifiers, sampled (fpt) curves
+   * and integer/discrete snapping take other code paths or would not survive
+   * linear interpolation of the samples. */
+  return (fcu->bezt != NULL) && (fcu->totvert >= 2) && (fcu->driver == NULL) &&
+         BLI_listbase_is_empty(&fcu->modifiers) &&
+         (fcu->flag & (FCURVE_INT_VALUES | FCURVE_DISCRETE_VALUES)) == 0;
+}
+
+static FCurveBakeTable *fcurve_bake_table_create(FCurve *fcu)
+{
+  FCurveBakeTable *table = MEM_callocN(sizeof(FCurveBakeTable), __func__);
+
+  const float start = fcu->bezt[0].vec[1][0];
+  const float end = fcu->bezt[fcu->totvert - 1].vec[1][0];
+  const double sample_len_d = (double)(end - start) * FCURVE_BAKE_SAMPLES_PER_FRAME + 1.0;
+  if (!(end > start) || (sample_len_d > (double)FCURVE_BAKE_SAMPLES_MAX)) {
+    /* Keep the table as an "unbakeable" marker (samples stays NULL). */
+    return table;
+  }
+  /* Constant interpolation steps would be smoothed over by the lerp. */
+  for (uint i = 0; i < fcu->totvert; i++) {
+    if (fcu->bezt[i].ipo == BEZT_IPO_CONST) {
+      return table;
+    }
+  }
+
+  const int sample_len = max_ii((int)ceil(sample_len_d), 2);
+  table->start = start;
+  table->end = end;
+  table->step = (end - start) / (float)(sample_len - 1);
+  table->sample_len = sample_len;
+  table->samples = MEM_malloc_arrayN(sample_len, sizeof(float), __func__);
+  for (int i = 0; i < sample_len; i++) {
+    table->samples[i] = evaluate_fcurve(fcu, start + table->step * (float)i);
+  }
+  return table;
+}
+
+/**
+ * Evaluate \a fcu at \a evaltime from its baked sample table, building the
+ * table on first use. Safe to call from multiple threads.
+ *
+ * \return false when the curve has to be evaluated directly (baking disabled,
+ * curve not bakeable, or \a evaltime outside the keyed range where
+ * extrapolation applies).
+ */
+bool BKE_fcurve_bake_cache_evaluate(struct FCurve *fcu, float evaltime, float *r_value)
+{
+  if (!g_bake_cache.enabled || !fcurve_bake_is_supported(fcu)) {
+    return false;
+  }
+
+  BLI_rw_mutex_lock(&g_bake_cache_lock, THREAD_LOCK_READ);
+  FCurveBakeTable *table = (g_bake_cache.table_from_fcu != NULL) ?
+                               BLI_ghash_lookup(g_bake_cache.table_from_fcu, fcu) :
+                               NULL;
+  BLI_rw_mutex_unlock(&g_bake_cache_lock);
+
+  if (table == NULL) {
+    table = fcurve_bake_table_create(fcu);
+
+    BLI_rw_mutex_lock(&g_bake_cache_lock, THREAD_LOCK_WRITE);
+    if (!g_bake_cache.enabled) {
+      /* Playback stopped while baking. */
+      BLI_rw_mutex_unlock(&g_bake_cache_lock);
+      fcurve_bake_table_free(table);
+      return false;
+    }
+    if (g_bake_cache.table_from_fcu == NULL) {
+      g_bake_cache.table_from_fcu = BLI_ghash_ptr_new(__func__);
+    }
+    FCurveBakeTable *existing = BLI_ghash_lookup(g_bake_cache.table_from_fcu, fcu);
+    if (existing != NULL) {
+      /* Another thread won the race, use its table. */
+      fcurve_bake_table_free(table);
+      table = existing;
+    }
+    else {
+      BLI_ghash_insert(g_bake_cache.table_from_fcu, fcu, table);
+    }
+    BLI_rw_mutex_unlock(&g_bake_cache_lock);
+  }
+
+  if (table->samples == NULL) {
+    return false;
+  }
+  if (evaltime < table->start || evaltime > table->end) {
+    return false;
+  }
+
+  const float t = (evaltime - table->start) / table->step;
+  const int index = min_ii((int)t, table->sample_len - 2);
+  const float frac = t - (float)index;
+  *r_value = table->samples[index] * (1.0f - frac) + table->samples[index + 1] * frac;
+  return true;
+}
+
+/**
+ * Enable or disable baked evaluation. Disabling frees all tables, so this is
+ * meant to bracket playback, not to toggle per evaluation.
+ */
+void BKE_fcurve_bake_cache_set_enabled(const bool enabled)
+{
+  BLI_rw_mutex_lock(&g_bake_cache_lock, THREAD_LOCK_WRITE);
+  g_bake_cache.enabled = enabled;
+  if (!enabled && g_bake_cache.table_from_fcu != NULL) {
+    BLI_ghash_free(g_bake_cache.table_from_fcu, NULL, fcurve_bake_table_free);
+    g_bake_cache.table_from_fcu = NULL;
+  }
+  BLI_rw_mutex_unlock(&g_bake_cache_lock);
+}
+
+/**
+ * Throw away the baked table of \a fcu (if any), to be called whenever its
+ * keyframes change or the curve is freed.
+ */
+void BKE_fcurve_bake_cache_invalidate(struct FCurve *fcu)
+{
+  /* Every caller is a keyframe edit or a curve being freed, so this doubles
+   * as the place to bump the global edit generation. */
+  atomic_add_and_fetch_uint64(&g_fcurve_edit_generation, 1);
+
+  /* Unlocked fast path: edits outside playback never allocate the hash. */
+  if (g_bake_cache.table_from_fcu == NULL) {
+    return;
+  }
+  BLI_rw_mutex_lock(&g_bake_cache_lock, THREAD_LOCK_WRITE);
+  if (g_bake_cache.table_from_fcu != NULL) {
+    BLI_ghash_remove(g_bake_cache.table_from_fcu, fcu, NULL, fcurve_bake_table_free);
+  }
+  BLI_rw_mutex_unlock(&g_bake_cache_lock);
+}
+
+/**
+ * Generation counter that changes whenever any F-Curve's keyframes are edited
+ * or an F-Curve is freed. Caches of evaluated curve values can compare this
+ * instead of hooking into every edit path themselves.
+ */
+uint64_t BKE_fcurve_edit_generation(void)
+{
+  return atomic_add_and_fetch_uint64(&g_fcurve_edit_generation, 0);
+}
+
+/** \} */
@@ -4066,6 +4066,18 @@ static void BKE_fluid_modifier_processDomain(FluidModifierData *fmd,
       read_all = !read_partial && with_resumable_cache;
       has_data = manta_read_data(fds->fluid, fmd, data_frame, read_all);
     }
+
+    /* Hint the OS to load the next cache frames into memory in the background. Decompression
+     * still runs on the main thread inside the Mantaflow interpreter, but with the file I/O
+     * already done playback no longer stalls on cold caches. */
+    if (!bake_cache) {
+      const int read_ahead_frames = 2;
+      for (int i = 1; i <= read_ahead_frames; i++) {
+        if (data_frame + i <= fds->cache_frame_end) {
+          manta_cache_read_ahead(fds->fluid, fmd, data_frame + i);
+        }
+      }
+    }
   }
 
   /* Cache mode specific settings */
@@ -37,6 +37,7 @@
 #include "BLI_path_util.h"
 #include "BLI_string.h"
 #include "BLI_string_utf8.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 #include "BLI_vfontdata.h"
@@ -679,6 +680,71 @@ static float char_width(Curve *cu, VChar *che, CharInfo *info)
   return che->width;
 }
 
+typedef struct VFontBuildCharsData {
+  Curve *cu;
+  VFontData *vfd;
+  const char32_t *mem;
+  CharInfo *custrinfo;
+  struct CharTrans *chartransdata;
+  int slen;
+  float font_size;
+  float xtrax;
+  /* Per-character destination lists, merged into the final nurb list in order. */
+  ListBase *char_nubases;
+} VFontBuildCharsData;
+
+/**
+ * Build the curve geometry for one laid out character. Characters only read the glyph cache
+ * (fully filled during layout) and write to their own list, so this runs per character from
+ * #BLI_task_parallel_range.
+ */
+static void vfont_to_curve_build_char_fn(void *__restrict userdata,
+                                         const int i,
+                                         const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  VFontBuildCharsData *data = userdata;
+  Curve *cu = data->cu;
+  CharInfo *info = &data->custrinfo[i];
+  struct CharTrans *ct = &data->chartransdata[i];
+  ListBase *nubase = &data->char_nubases[i];
+
+  unsigned int cha = (unsigned int)data->mem[i];
+  if (info->flag & CU_CHINFO_SMALLCAPS_CHECK) {
+    cha = towupper(cha);
+  }
+
+  /* We do not want to see any character for \n or \r */
+  if (cha != '\n') {
+    buildchar(cu, nubase, cha, info, ct->xof, ct->yof, ct->rot, i, data->font_size);
+  }
+
+  if ((info->flag & CU_CHINFO_UNDERLINE) && (cha != '\n')) {
+    float ulwidth, uloverlap = 0.0f;
+    rctf rect;
+
+    if ((i < (data->slen - 1)) && (data->mem[i + 1] != '\n') &&
+        ((data->mem[i + 1] != ' ') || (data->custrinfo[i + 1].flag & CU_CHINFO_UNDERLINE)) &&
+        ((data->custrinfo[i + 1].flag & CU_CHINFO_WRAP) == 0)) {
+      uloverlap = data->xtrax + 0.1f;
+    }
+    /* Find the character, the characters has to be in the memory already
+     * since character checking has been done earlier already. */
+    VChar *che = find_vfont_char(data->vfd, cha);
+
+    const float twidth = char_width(cu, che, info);
+    ulwidth = (twidth * (1.0f + (info->kern / 40.0f))) + uloverlap;
+
+    rect.xmin = ct->xof;
+    rect.xmax = rect.xmin + ulwidth;
+
+    rect.ymin = ct->yof;
+    rect.ymax = rect.ymin - cu->ulheight;
+
+    build_underline(
+        cu, nubase, &rect, cu->ulpos - 0.05f, ct->rot, i, info->mat_nr, data->font_size);
+  }
+}
+
 static void textbox_scale(TextBox *tb_dst, const TextBox *tb_src, float scale)
 {
   tb_dst->x = tb_src->x * scale;
@@ -1469,20 +1535,18 @@ static bool vfont_to_curve(Object *ob,
     /* make nurbdata */
     BKE_nurbList_free(r_nubase);
 
-    ct = chartransdata;
+    /* Serial pre-pass: clamp illegal material indices and find the truncation point, the
+     * per-character curve building below runs in parallel. */
+    int build_len = slen;
     for (i = 0; i < slen; i++) {
-      unsigned int cha = (unsigned int)mem[i];
       info = &(custrinfo[i]);
 
       if ((cu->overflow == CU_OVERFLOW_TRUNCATE) && (ob && ob->mode != OB_MODE_EDIT) &&
           (info->flag & CU_CHINFO_OVERFLOW)) {
+        build_len = i;
         break;
       }
 
-      if (info->flag & CU_CHINFO_SMALLCAPS_CHECK) {
-        cha = towupper(cha);
-      }
-
       /* Only do that check in case we do have an object, otherwise all materials get erased every
        * time that code is called without an object... */
       if (ob != NULL && (info->mat_nr > (ob->totcol))) {
@@ -1490,37 +1554,30 @@ static bool vfont_to_curve(Object *ob,
         //     &LOG, "Illegal material index (%d) in text object, setting to 0", info->mat_nr);
         info->mat_nr = 0;
       }
-      /* We do not want to see any character for \n or \r */
-      if (cha != '\n') {
-        buildchar(cu, r_nubase, cha, info, ct->xof, ct->yof, ct->rot, i, font_size);
-      }
-
-      if ((info->flag & CU_CHINFO_UNDERLINE) && (cha != '\n')) {
-        float ulwidth, uloverlap = 0.0f;
-        rctf rect;
-
-        if ((i < (slen - 1)) && (mem[i + 1] != '\n') &&
-            ((mem[i + 1] != ' ') || (custrinfo[i + 1].flag & CU_CHINFO_UNDERLINE)) &&
-            ((custrinfo[i + 1].flag & CU_CHINFO_WRAP) == 0)) {
-          uloverlap = xtrax + 0.1f;
-        }
-        /* Find the character, the characters has to be in the memory already
-         * since character checking has been done earlier already. */
-        che = find_vfont_char(vfd, cha);
-
-        twidth = char_width(cu, che, info);
-        ulwidth = (twidth * (1.0f + (info->kern / 40.0f))) + uloverlap;
-
-        rect.xmin = ct->xof;
-        rect.xmax = rect.xmin + ulwidth;
-
-        rect.ymin = ct->yof;
-        rect.ymax = rect.ymin - cu->ulheight;
+    }
 
-        build_underline(
-            cu, r_nubase, &rect, cu->ulpos - 0.05f, ct->rot, i, info->mat_nr, font_size);
+    if (build_len > 0) {
+      VFontBuildCharsData build_data = {
+          .cu = cu,
+          .vfd = vfd,
+          .mem = mem,
+          .custrinfo = custrinfo,
+          .chartransdata = chartransdata,
+          .slen = slen,
+          .font_size = font_size,
+          .xtrax = xtrax,
+          .char_nubases = MEM_callocN(sizeof(ListBase) * build_len, __func__),
+      };
+
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      settings.min_iter_per_thread = 32;
+      BLI_task_parallel_range(0, build_len, &build_data, vfont_to_curve_build_char_fn, &settings);
+
+      for (i = 0; i < build_len; i++) {
+        BLI_movelisttolist(r_nubase, &build_data.char_nubases[i]);
       }
-      ct++;
+      MEM_freeN(build_data.char_nubases);
     }
   }
 
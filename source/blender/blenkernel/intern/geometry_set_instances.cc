@@ -14,6 +14,8 @@
  * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+#include "BLI_task.hh"
+
 #include "BKE_geometry_set_instances.hh"
 #include "BKE_material.h"
 #include "BKE_mesh.h"
@@ -728,14 +730,24 @@ GeometrySet geometry_set_realize_instances(const GeometrySet &geometry_set)
     return geometry_set;
   }
 
-  GeometrySet new_geometry_set;
-
   Vector<GeometryInstanceGroup> set_groups;
   geometry_set_gather_instances(geometry_set, set_groups);
-  join_instance_groups_mesh(set_groups, false, new_geometry_set);
-  join_instance_groups_pointcloud(set_groups, new_geometry_set);
-  join_instance_groups_volume(set_groups, new_geometry_set);
-  join_instance_groups_curve(set_groups, new_geometry_set);
+
+  /* Each component type is joined independently from the same read-only instance groups.
+   * Build every component into its own set so the joins can run in parallel,
+   * then gather the resulting components. */
+  GeometrySet mesh_set, pointcloud_set, volume_set, curve_set;
+  threading::parallel_invoke([&]() { join_instance_groups_mesh(set_groups, false, mesh_set); },
+                             [&]() { join_instance_groups_pointcloud(set_groups, pointcloud_set); },
+                             [&]() { join_instance_groups_volume(set_groups, volume_set); },
+                             [&]() { join_instance_groups_curve(set_groups, curve_set); });
+
+  GeometrySet new_geometry_set;
+  for (const GeometrySet *set : {&mesh_set, &pointcloud_set, &volume_set, &curve_set}) {
+    for (const GeometryComponent *component : set->get_components_for_read()) {
+      new_geometry_set.add(*component);
+    }
+  }
 
   return new_geometry_set;
 }
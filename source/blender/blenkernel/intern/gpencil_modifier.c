@@ -29,6 +29,7 @@
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.h"
 #include "BLI_string_utils.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -806,6 +807,65 @@ void BKE_gpencil_prepare_eval_data(Depsgraph *depsgraph, Scene *scene, Object *o
   BKE_gpencil_update_orig_pointers(ob_orig, ob);
 }
 
+typedef struct tGpencilDeformStrokesData {
+  GpencilModifierData *md;
+  const GpencilModifierTypeInfo *mti;
+  struct Depsgraph *depsgraph;
+  Object *ob;
+  bGPDlayer *gpl;
+  bGPDframe *gpf;
+  bGPDstroke **strokes;
+} tGpencilDeformStrokesData;
+
+static void gpencil_deform_stroke_task_cb(void *__restrict userdata,
+                                          const int i,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  tGpencilDeformStrokesData *data = userdata;
+  data->mti->deformStroke(
+      data->md, data->depsgraph, data->ob, data->gpl, data->gpf, data->strokes[i]);
+}
+
+/**
+ * Deform all strokes of \a gpf in parallel. Only valid for modifiers that set
+ * #eGpencilModifierTypeFlag_SupportsThreading.
+ */
+static void gpencil_modifier_deform_strokes_threaded(GpencilModifierData *md,
+                                                     const GpencilModifierTypeInfo *mti,
+                                                     struct Depsgraph *depsgraph,
+                                                     Object *ob,
+                                                     bGPDlayer *gpl,
+                                                     bGPDframe *gpf)
+{
+  const int tot_strokes = BLI_listbase_count(&gpf->strokes);
+  if (tot_strokes == 0) {
+    return;
+  }
+
+  bGPDstroke **strokes = MEM_mallocN(sizeof(bGPDstroke *) * tot_strokes, __func__);
+  int i = 0;
+  LISTBASE_FOREACH (bGPDstroke *, gps, &gpf->strokes) {
+    strokes[i++] = gps;
+  }
+
+  tGpencilDeformStrokesData data = {
+      .md = md,
+      .mti = mti,
+      .depsgraph = depsgraph,
+      .ob = ob,
+      .gpl = gpl,
+      .gpf = gpf,
+      .strokes = strokes,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 8;
+  BLI_task_parallel_range(0, tot_strokes, &data, gpencil_deform_stroke_task_cb, &settings);
+
+  MEM_freeN(strokes);
+}
+
 /**
  * Calculate gpencil modifiers.
  * \param depsgraph: Current depsgraph
@@ -860,9 +920,20 @@ void BKE_gpencil_modifiers_calc(Depsgraph *depsgraph, Scene *scene, Object *ob)
             continue;
           }
 
+          /* Hidden layers are neither drawn nor rendered: skip their deform cost. The time
+           * remap above still runs, so the right frame shows when the layer is unhidden. */
+          if (gpl->flag & GP_LAYER_HIDE) {
+            continue;
+          }
+
           if (mti->deformStroke) {
-            LISTBASE_FOREACH (bGPDstroke *, gps, &gpf->strokes) {
-              mti->deformStroke(md, depsgraph, ob, gpl, gpf, gps);
+            if (mti->flags & eGpencilModifierTypeFlag_SupportsThreading) {
+              gpencil_modifier_deform_strokes_threaded(md, mti, depsgraph, ob, gpl, gpf);
+            }
+            else {
+              LISTBASE_FOREACH (bGPDstroke *, gps, &gpf->strokes) {
+                mti->deformStroke(md, depsgraph, ob, gpl, gpf, gps);
+              }
             }
           }
         }
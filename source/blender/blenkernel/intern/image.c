@@ -5042,6 +5042,9 @@ static ImBuf *image_acquire_ibuf(Image *ima, ImageUser *iuser, void **r_lock)
       }
     }
     else if (ima->source == IMA_SRC_TILED) {
+      /* Tiles load on demand: only the tile the caller asks for (`iuser->tile`) is read,
+       * each one is a separate cache entry keyed by its tile number, and the movie cache
+       * limiter evicts least-recently-used tiles once the cache limit is reached. */
       if (ima->type == IMA_TYPE_IMAGE) {
         /* regular files, ibufs in flipbook, allows saving */
         ibuf = image_load_sequence_file(ima, iuser, entry, 0);
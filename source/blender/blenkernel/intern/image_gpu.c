@@ -653,7 +653,7 @@ static void gpu_texture_update_scaled(GPUTexture *tex,
   void *data = (ibuf->rect_float) ? (void *)(ibuf->rect_float) : (void *)(ibuf->rect);
   eGPUDataFormat data_format = (ibuf->rect_float) ? GPU_DATA_FLOAT : GPU_DATA_UBYTE;
 
-  GPU_texture_update_sub(tex, data_format, data, x, y, layer, w, h, 1);
+  GPU_texture_update_sub_async(tex, data_format, data, x, y, layer, w, h, 1);
 
   IMB_freeImBuf(ibuf);
 }
@@ -683,7 +683,7 @@ static void gpu_texture_update_unscaled(GPUTexture *tex,
    * subset of a possible larger buffer than what we are updating. */
   GPU_unpack_row_length_set(tex_stride);
 
-  GPU_texture_update_sub(tex, data_format, data, x, y, layer, w, h, 1);
+  GPU_texture_update_sub_async(tex, data_format, data, x, y, layer, w, h, 1);
   /* Restore default. */
   GPU_unpack_row_length_set(0);
 }
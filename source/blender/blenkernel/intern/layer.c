@@ -1261,6 +1261,162 @@ void BKE_layer_collection_sync(const Scene *scene, ViewLayer *view_layer)
   }
 }
 
+/**
+ * Re-resolve visibility and selectability on an existing layer collection tree.
+ *
+ * This is the flags-only counterpart of #layer_collection_sync: it walks the current
+ * #LayerCollection hierarchy in lock-step with the Collection one and recomputes
+ * `runtime_flag` and the collection-controlled #Base flags, without rebuilding layer
+ * collections or object bases.
+ *
+ * Returns false when the two hierarchies do not match anymore (collections were added,
+ * removed or re-ordered), in which case a full structural resync is required.
+ *
+ * NOTE: Base flags accumulate over all collections instancing an object, so this always
+ * processes the whole tree even when a single collection was toggled. This remains orders
+ * of magnitude cheaper than the structural resync, as it performs no allocation and no
+ * list or hash rebuilding.
+ */
+static bool layer_collection_visibility_sync(ViewLayer *view_layer,
+                                             LayerCollection *layer,
+                                             const short collection_restrict,
+                                             const short layer_restrict)
+{
+  CollectionChild *child = layer->collection->children.first;
+  LayerCollection *child_layer = layer->layer_collections.first;
+
+  for (; child != NULL && child_layer != NULL;
+       child = child->next, child_layer = child_layer->next) {
+    if (child_layer->collection != child->collection) {
+      return false;
+    }
+
+    /* Collection restrict is inherited. */
+    short child_collection_restrict = collection_restrict;
+    short child_layer_restrict = layer_restrict;
+    if (!(child->collection->flag & COLLECTION_IS_MASTER)) {
+      child_collection_restrict |= child->collection->flag;
+      child_layer_restrict |= child_layer->flag;
+    }
+
+    if (!layer_collection_visibility_sync(
+            view_layer, child_layer, child_collection_restrict, child_layer_restrict)) {
+      return false;
+    }
+
+    /* Same flag resolution as in #layer_collection_sync, only keeping
+     * #LAYER_COLLECTION_HAS_OBJECTS which depends on unchanged collection contents. */
+    child_layer->runtime_flag &= LAYER_COLLECTION_HAS_OBJECTS;
+    if (child_layer->flag & LAYER_COLLECTION_EXCLUDE) {
+      continue;
+    }
+
+    if (child_collection_restrict & COLLECTION_RESTRICT_VIEWPORT) {
+      child_layer->runtime_flag |= LAYER_COLLECTION_RESTRICT_VIEWPORT;
+    }
+
+    if (((child_layer->runtime_flag & LAYER_COLLECTION_RESTRICT_VIEWPORT) == 0) &&
+        ((child_layer_restrict & LAYER_COLLECTION_HIDE) == 0)) {
+      child_layer->runtime_flag |= LAYER_COLLECTION_VISIBLE_VIEW_LAYER;
+    }
+  }
+
+  /* Both lists must have matched till their very end. */
+  if (child != NULL || child_layer != NULL) {
+    return false;
+  }
+
+  if ((layer->flag & LAYER_COLLECTION_EXCLUDE) != 0) {
+    return true;
+  }
+
+  LISTBASE_FOREACH (CollectionObject *, cob, &layer->collection->gobject) {
+    if (cob->ob == NULL) {
+      continue;
+    }
+
+    Base *base = BLI_ghash_lookup(view_layer->object_bases_hash, cob->ob);
+    if (base == NULL) {
+      /* Collection contents changed without a resync, bases are missing. */
+      return false;
+    }
+
+    if ((collection_restrict & COLLECTION_RESTRICT_VIEWPORT) == 0) {
+      base->flag_from_collection |= (BASE_ENABLED_VIEWPORT | BASE_VISIBLE_DEPSGRAPH);
+      if ((layer_restrict & LAYER_COLLECTION_HIDE) == 0) {
+        base->flag_from_collection |= BASE_VISIBLE_VIEWLAYER;
+      }
+      if (((collection_restrict & COLLECTION_RESTRICT_SELECT) == 0)) {
+        base->flag_from_collection |= BASE_SELECTABLE;
+      }
+    }
+
+    if ((collection_restrict & COLLECTION_RESTRICT_RENDER) == 0) {
+      base->flag_from_collection |= BASE_ENABLED_RENDER;
+    }
+
+    if (layer->flag & LAYER_COLLECTION_HOLDOUT) {
+      base->flag_from_collection |= BASE_HOLDOUT;
+    }
+    if (layer->flag & LAYER_COLLECTION_INDIRECT_ONLY) {
+      base->flag_from_collection |= BASE_INDIRECT_ONLY;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Cheap resync for visibility changes (hide flags, restriction flags, holdout, ...) that
+ * cannot add or remove layer collections or object bases.
+ *
+ * Falls back to #BKE_layer_collection_sync when the layer tree is not (or no longer)
+ * structurally in sync with the collections, so it is always safe to call - callers only
+ * need to guarantee that the change they made is a flag change.
+ */
+void BKE_layer_collection_sync_visibility(const Scene *scene, ViewLayer *view_layer)
+{
+  if (no_resync) {
+    return;
+  }
+
+  if (!scene->master_collection) {
+    /* Happens for old files that don't have versioning applied yet. */
+    return;
+  }
+
+  LayerCollection *master_layer = view_layer->layer_collections.first;
+  if (master_layer == NULL || master_layer->collection != scene->master_collection ||
+      view_layer->object_bases_hash == NULL) {
+    BKE_layer_collection_sync(scene, view_layer);
+    return;
+  }
+
+  /* Clear visible and selectable flags to be reset. */
+  LISTBASE_FOREACH (Base *, base, &view_layer->object_bases) {
+    base->flag &= ~g_base_collection_flags;
+    base->flag_from_collection &= ~g_base_collection_flags;
+  }
+
+  const short parent_restrict = 0, parent_layer_restrict = 0;
+  if (!layer_collection_visibility_sync(
+          view_layer, master_layer, parent_restrict, parent_layer_restrict)) {
+    /* The collection hierarchy changed underneath us, do a full structural resync. */
+    BKE_layer_collection_sync(scene, view_layer);
+    return;
+  }
+
+  LISTBASE_FOREACH (Base *, base, &view_layer->object_bases) {
+    BKE_base_eval_flags(base);
+  }
+
+  /* The active collection may have been hidden by this change. */
+  LayerCollection *active = view_layer->active_collection;
+  if (active && layer_collection_hidden(view_layer, active)) {
+    BKE_layer_collection_activate_parent(view_layer, active);
+  }
+}
+
 void BKE_scene_collection_sync(const Scene *scene)
 {
   if (no_resync) {
@@ -1425,7 +1581,7 @@ void BKE_base_set_visible(Scene *scene, ViewLayer *view_layer, Base *base, bool
     base->flag ^= BASE_HIDDEN;
   }
 
-  BKE_layer_collection_sync(scene, view_layer);
+  BKE_layer_collection_sync_visibility(scene, view_layer);
 }
 
 bool BKE_base_is_visible(const View3D *v3d, const Base *base)
@@ -1551,7 +1707,7 @@ void BKE_layer_collection_isolate_global(Scene *scene,
     BKE_layer_collection_activate(view_layer, lc);
   }
 
-  BKE_layer_collection_sync(scene, view_layer);
+  BKE_layer_collection_sync_visibility(scene, view_layer);
 }
 
 static void layer_collection_local_visibility_set_recursive(LayerCollection *layer_collection,
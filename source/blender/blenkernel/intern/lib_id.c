@@ -69,6 +69,7 @@
 #include "BKE_lib_query.h"
 #include "BKE_lib_remap.h"
 #include "BKE_main.h"
+#include "BKE_main_idmap.h"
 #include "BKE_node.h"
 #include "BKE_rigidbody.h"
 
@@ -164,6 +165,9 @@ static void lib_id_clear_library_data_ex(Main *bmain, ID *id)
   id->tag &= ~(LIB_TAG_INDIRECT | LIB_TAG_EXTERN);
   id->flag &= ~LIB_INDIRECT_WEAK_LINK;
   if (id_in_mainlist) {
+    /* Name, library and session UUID of the ID all change here,
+     * simpler to let the lookup cache be rebuilt. */
+    BKE_main_idmap_cache_invalidate(bmain);
     if (BKE_id_new_name_validate(which_libbase(bmain, GS(id->name)), id, NULL, false)) {
       bmain->is_memfile_undo_written = false;
     }
@@ -643,8 +647,14 @@ ID *BKE_id_copy(Main *bmain, const ID *id)
 /**
  * Invokes the appropriate copy method for the block and returns the result in
  * newid, unless test. Returns true if the block can be copied.
+ *
+ * \param copy_flags: #LIB_ID_COPY_... flags passed down to #BKE_id_copy_ex, callers with no
+ * special needs should pass #LIB_ID_COPY_DEFAULT.
  */
-ID *BKE_id_copy_for_duplicate(Main *bmain, ID *id, const eDupli_ID_Flags duplicate_flags)
+ID *BKE_id_copy_for_duplicate(Main *bmain,
+                              ID *id,
+                              const eDupli_ID_Flags duplicate_flags,
+                              const int copy_flags)
 {
   if (id == NULL) {
     return id;
@@ -655,7 +665,7 @@ ID *BKE_id_copy_for_duplicate(Main *bmain, ID *id, const eDupli_ID_Flags duplica
       return id;
     }
 
-    ID *id_new = BKE_id_copy(bmain, id);
+    ID *id_new = BKE_id_copy_ex(bmain, id, NULL, copy_flags);
     /* Copying add one user by default, need to get rid of that one. */
     id_us_min(id_new);
     ID_NEW_SET(id, id_new);
@@ -715,6 +725,10 @@ static void id_swap(Main *bmain, ID *id_a, ID *id_b, const bool do_full_id)
   }
 
   if (bmain != NULL) {
+    if (do_full_id) {
+      /* Names and session UUIDs were exchanged between the two IDs. */
+      BKE_main_idmap_cache_invalidate(bmain);
+    }
     /* Swap will have broken internal references to itself, restore them. */
     BKE_libblock_relink_ex(bmain, id_a, id_b, id_a, ID_REMAP_SKIP_NEVER_NULL_USAGE);
     BKE_libblock_relink_ex(bmain, id_b, id_a, id_b, ID_REMAP_SKIP_NEVER_NULL_USAGE);
@@ -842,6 +856,8 @@ void BKE_libblock_management_main_add(Main *bmain, void *idv)
   BKE_main_unlock(bmain);
 
   BKE_lib_libblock_session_uuid_ensure(id);
+
+  BKE_main_idmap_cache_insert_id(bmain, id);
 }
 
 /** Remove a data-block from given main (set it to 'NO_MAIN' status). */
@@ -858,6 +874,7 @@ void BKE_libblock_management_main_remove(Main *bmain, void *idv)
 
   ListBase *lb = which_libbase(bmain, GS(id->name));
   BKE_main_lock(bmain);
+  BKE_main_idmap_cache_remove_id(bmain, id);
   BLI_remlink(lb, id);
   id->tag |= LIB_TAG_NO_MAIN;
   bmain->is_memfile_undo_written = false;
@@ -1114,6 +1131,11 @@ void *BKE_libblock_alloc(Main *bmain, short type, const char *name, const int fl
     if ((flag & LIB_ID_CREATE_NO_ALLOCATE) == 0) {
       BKE_lib_libblock_session_uuid_ensure(id);
     }
+
+    /* Only once the session UUID exists, the ID can go into the lookup cache. */
+    if ((flag & LIB_ID_CREATE_NO_MAIN) == 0) {
+      BKE_main_idmap_cache_insert_id(bmain, id);
+    }
   }
 
   return id;
@@ -1330,9 +1352,24 @@ ID *BKE_libblock_find_name(struct Main *bmain, const short type, const char *nam
 {
   ListBase *lb = which_libbase(bmain, type);
   BLI_assert(lb != NULL);
+  /* Local IDs are resolved through the cached lookup map. */
+  ID *id = BKE_main_idmap_lookup_name(BKE_main_idmap_ensure(bmain), type, name, NULL);
+  if (id != NULL) {
+    return id;
+  }
+  /* Fall back to a list scan, which can also match a linked ID of that name. */
   return BLI_findstring(lb, name, offsetof(ID, name) + 2);
 }
 
+ID *BKE_libblock_find_session_uuid(Main *bmain, const short type, const uint32_t session_uuid)
+{
+  ID *id = BKE_main_idmap_lookup_uuid(BKE_main_idmap_ensure(bmain), session_uuid);
+  if (id != NULL && GS(id->name) != type) {
+    return NULL;
+  }
+  return id;
+}
+
 /**
  * Sort given \a id into given \a lb list, using case-insensitive comparison of the id names.
  *
@@ -2211,9 +2248,12 @@ void BKE_libblock_rename(Main *bmain, ID *id, const char *name)
 {
   BLI_assert(!ID_IS_LINKED(id));
   ListBase *lb = which_libbase(bmain, GS(id->name));
+  /* The lookup cache is keyed by name, so re-insert under the new one. */
+  BKE_main_idmap_cache_remove_id(bmain, id);
   if (BKE_id_new_name_validate(lb, id, name, false)) {
     bmain->is_memfile_undo_written = false;
   }
+  BKE_main_idmap_cache_insert_id(bmain, id);
 }
 
 /**
@@ -40,6 +40,7 @@
 #include "BKE_lib_remap.h"
 #include "BKE_library.h"
 #include "BKE_main.h"
+#include "BKE_main_idmap.h"
 
 #include "lib_intern.h"
 
@@ -180,6 +181,7 @@ void BKE_id_free_ex(Main *bmain, void *idv, int flag, const bool use_flag_from_i
 
   if ((flag & LIB_ID_FREE_NO_MAIN) == 0) {
     ListBase *lb = which_libbase(bmain, type);
+    BKE_main_idmap_cache_remove_id(bmain, id);
     BLI_remlink(lb, id);
   }
 
@@ -279,6 +281,7 @@ static size_t id_delete(Main *bmain, const bool do_tagged_deletion)
           id_next = id->next;
           /* NOTE: in case we delete a library, we also delete all its datablocks! */
           if ((id->tag & tag) || (id->lib != NULL && (id->lib->id.tag & tag))) {
+            BKE_main_idmap_cache_remove_id(bmain, id);
             BLI_remlink(lb, id);
             BLI_addtail(&tagged_deleted_ids, id);
             /* Do not tag as no_main now, we want to unlink it first (lower-level ID management
@@ -293,22 +296,40 @@ static size_t id_delete(Main *bmain, const bool do_tagged_deletion)
         dummy_link.next = tagged_deleted_ids.first;
         last_remapped_id = (ID *)(&dummy_link);
       }
+      int remaps_num = 0;
       for (id = last_remapped_id->next; id; id = id->next) {
-        /* Will tag 'never NULL' users of this ID too.
+        remaps_num++;
+      }
+      if (remaps_num != 0) {
+        /* Will tag 'never NULL' users of those IDs too.
          * Note that we cannot use BKE_libblock_unlink() here,
          * since it would ignore indirect (and proxy!)
          * links, this can lead to nasty crashing here in second, actual deleting loop.
          * Also, this will also flag users of deleted data that cannot be unlinked
-         * (object using deleted obdata, etc.), so that they also get deleted. */
-        BKE_libblock_remap_locked(bmain,
-                                  id,
-                                  NULL,
-                                  (ID_REMAP_FLAG_NEVER_NULL_USAGE |
-                                   ID_REMAP_FORCE_NEVER_NULL_USAGE |
-                                   ID_REMAP_FORCE_INTERNAL_RUNTIME_POINTERS));
-        /* Since we removed ID from Main,
-         * we also need to unlink its own other IDs usages ourself. */
-        BKE_libblock_relink_ex(bmain, id, NULL, NULL, ID_REMAP_FORCE_INTERNAL_RUNTIME_POINTERS);
+         * (object using deleted obdata, etc.), so that they also get deleted.
+         *
+         * All IDs deleted in this pass are unlinked in a single batch,
+         * i.e. a single traversal of the whole Main database. */
+        IDRemapPair *remaps = MEM_mallocN(sizeof(*remaps) * (size_t)remaps_num, __func__);
+        int remap_index = 0;
+        for (id = last_remapped_id->next; id; id = id->next) {
+          remaps[remap_index].old_id = id;
+          remaps[remap_index].new_id = NULL;
+          remap_index++;
+        }
+        BKE_libblock_remap_multiple_locked(bmain,
+                                           remaps,
+                                           remaps_num,
+                                           (ID_REMAP_FLAG_NEVER_NULL_USAGE |
+                                            ID_REMAP_FORCE_NEVER_NULL_USAGE |
+                                            ID_REMAP_FORCE_INTERNAL_RUNTIME_POINTERS));
+        MEM_freeN(remaps);
+
+        for (id = last_remapped_id->next; id; id = id->next) {
+          /* Since we removed ID from Main,
+           * we also need to unlink its own other IDs usages ourself. */
+          BKE_libblock_relink_ex(bmain, id, NULL, NULL, ID_REMAP_FORCE_INTERNAL_RUNTIME_POINTERS);
+        }
       }
     }
 
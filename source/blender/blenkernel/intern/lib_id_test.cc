@@ -170,4 +170,37 @@ TEST(lib_id_main_unique_name, linked_ids_1)
   test_lib_id_main_sort_free(&ctx);
 }
 
+TEST(lib_id_main_lookup, find_name_and_uuid)
+{
+  LibIDMainSortTestContext ctx = {nullptr};
+  test_lib_id_main_sort_init(&ctx);
+
+  ID *id_a = static_cast<ID *>(BKE_id_new(ctx.bmain, ID_OB, "OB_A"));
+  ID *id_b = static_cast<ID *>(BKE_id_new(ctx.bmain, ID_OB, "OB_B"));
+
+  EXPECT_EQ(BKE_libblock_find_name(ctx.bmain, ID_OB, "OB_A"), id_a);
+  EXPECT_EQ(BKE_libblock_find_name(ctx.bmain, ID_OB, "OB_B"), id_b);
+  EXPECT_EQ(BKE_libblock_find_name(ctx.bmain, ID_OB, "OB_C"), nullptr);
+
+  EXPECT_EQ(BKE_libblock_find_session_uuid(ctx.bmain, ID_OB, id_a->session_uuid), id_a);
+  EXPECT_EQ(BKE_libblock_find_session_uuid(ctx.bmain, ID_ME, id_a->session_uuid), nullptr);
+
+  /* Cache must follow renames and additions after it was first built. */
+  BKE_libblock_rename(ctx.bmain, id_a, "OB_A_NEW");
+  EXPECT_EQ(BKE_libblock_find_name(ctx.bmain, ID_OB, "OB_A_NEW"), id_a);
+  EXPECT_EQ(BKE_libblock_find_name(ctx.bmain, ID_OB, "OB_A"), nullptr);
+
+  ID *id_c = static_cast<ID *>(BKE_id_new(ctx.bmain, ID_OB, "OB_C"));
+  EXPECT_EQ(BKE_libblock_find_name(ctx.bmain, ID_OB, "OB_C"), id_c);
+  EXPECT_EQ(BKE_libblock_find_session_uuid(ctx.bmain, ID_OB, id_c->session_uuid), id_c);
+
+  /* And deletions. */
+  const uint id_b_uuid = id_b->session_uuid;
+  BKE_id_free(ctx.bmain, id_b);
+  EXPECT_EQ(BKE_libblock_find_name(ctx.bmain, ID_OB, "OB_B"), nullptr);
+  EXPECT_EQ(BKE_libblock_find_session_uuid(ctx.bmain, ID_OB, id_b_uuid), nullptr);
+
+  test_lib_id_main_sort_free(&ctx);
+}
+
 }  // namespace blender::bke::tests
@@ -38,6 +38,7 @@
 #include "DEG_depsgraph_build.h"
 
 #include "BKE_armature.h"
+#include "BKE_bpath.h"
 #include "BKE_collection.h"
 #include "BKE_global.h"
 #include "BKE_idtype.h"
@@ -2750,23 +2751,36 @@ void BKE_lib_override_library_update(Main *bmain, ID *local)
    * if based on reference than on current override.
    * So we work on temp copy of reference, and 'swap' its content with local. */
 
-  /* XXX We need a way to get off-Main copies of IDs (similar to localized mats/texts/ etc.)!
-   *     However, this is whole bunch of code work in itself, so for now plain stupid ID copy
-   *     will do, as inefficient as it is. :/
-   *     Actually, maybe not! Since we are swapping with original ID's local content, we want to
-   *     keep user-count in correct state when freeing tmp_id
-   *     (and that user-counts of IDs used by 'new' local data also remain correct). */
-  /* This would imply change in handling of user-count all over RNA
-   * (and possibly all over Blender code).
-   * Not impossible to do, but would rather see first if extra useless usual user handling
-   * is actually a (performances) issue here. */
-
-  ID *tmp_id = BKE_id_copy(bmain, local->override_library->reference);
+  /* Keep the temp copy out of Main: it only exists to get its content swapped into `local` and
+   * be freed right after, so there is no reason to pay for name uniquification, ID sorting and
+   * depsgraph tagging of a real Main data-block here (this dominates the cost of updating
+   * thousands of overrides on file load). Since we are swapping with original ID's local
+   * content, user-counts of IDs used by the copy are still maintained (and transferred to
+   * `local` by the swap), so that freeing tmp_id afterwards releases the old data correctly. */
+  ID *tmp_id = BKE_id_copy_ex(bmain,
+                              local->override_library->reference,
+                              NULL,
+                              LIB_ID_COPY_DEFAULT | LIB_ID_CREATE_NO_MAIN);
 
   if (tmp_id == NULL) {
     return;
   }
 
+  /* Making a Main copy of a linked ID would make it local (remapping its file paths relative to
+   * the local blend-file, and flagging the linked IDs it uses as directly linked data), do the
+   * same for our out-of-Main copy since its content ends up in `local`. */
+  if (ID_IS_LINKED(local->override_library->reference)) {
+    const char *bpath_user_data[2] = {BKE_main_blendfile_path(bmain),
+                                      local->override_library->reference->lib->filepath_abs};
+    BKE_bpath_traverse_id(bmain,
+                          tmp_id,
+                          BKE_bpath_relocate_visitor,
+                          BKE_BPATH_TRAVERSE_SKIP_MULTIFILE,
+                          (void *)bpath_user_data);
+  }
+  tmp_id->lib = NULL;
+  BKE_lib_id_expand_local(bmain, tmp_id);
+
   /* This ID name is problematic, since it is an 'rna name property' it should not be editable or
    * different from reference linked ID. But local ID names need to be unique in a given type
    * list of Main, so we cannot always keep it identical, which is why we need this special
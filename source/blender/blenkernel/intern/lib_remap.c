@@ -22,6 +22,9 @@
 
 #include "CLG_log.h"
 
+#include "MEM_guardedalloc.h"
+
+#include "BLI_ghash.h"
 #include "BLI_utildefines.h"
 
 #include "DNA_collection_types.h"
@@ -64,13 +67,9 @@ void BKE_library_callback_remap_editor_id_reference_set(
   remap_editor_id_reference_cb = func;
 }
 
-typedef struct IDRemap {
-  Main *bmain; /* Only used to trigger depsgraph updates in the right bmain. */
+typedef struct IDRemapEntry {
   ID *old_id;
   ID *new_id;
-  /** The ID in which we are replacing old_id by new_id usages. */
-  ID *id_owner;
-  short flag;
 
   /* 'Output' data. */
   short status;
@@ -80,6 +79,18 @@ typedef struct IDRemap {
   int skipped_indirect;
   /** Number of skipped use cases that refcount the data-block. */
   int skipped_refcounted;
+} IDRemapEntry;
+
+typedef struct IDRemap {
+  Main *bmain; /* Only used to trigger depsgraph updates in the right bmain. */
+  /** Remappings to apply, each maps usages of its `old_id` to its `new_id` (may be NULL). */
+  IDRemapEntry *entries;
+  int entries_num;
+  /** `old ID -> IDRemapEntry` lookup, only created when there are several entries. */
+  GHash *entries_map;
+  /** The ID in which we are replacing old_id by new_id usages. */
+  ID *id_owner;
+  short flag;
 } IDRemap;
 
 /* IDRemap->flag enums defined in BKE_lib.h */
@@ -103,14 +114,26 @@ static int foreach_libblock_remap_callback(LibraryIDLinkCallbackData *cb_data)
   ID *id_self = cb_data->id_self;
   ID **id_p = cb_data->id_pointer;
   IDRemap *id_remap_data = cb_data->user_data;
-  ID *old_id = id_remap_data->old_id;
-  ID *new_id = id_remap_data->new_id;
+  IDRemapEntry *entry;
 
   /* Those asserts ensure the general sanity of ID tags regarding 'embedded' ID data (root
    * nodetrees and co). */
   BLI_assert(id_owner == id_remap_data->id_owner);
   BLI_assert(id_self == id_owner || (id_self->flag & LIB_EMBEDDED_DATA) != 0);
 
+  if (id_remap_data->entries_map != NULL) {
+    entry = (*id_p != NULL) ? BLI_ghash_lookup(id_remap_data->entries_map, *id_p) : NULL;
+    if (entry == NULL) {
+      return IDWALK_RET_NOP;
+    }
+  }
+  else {
+    entry = &id_remap_data->entries[0];
+  }
+
+  ID *old_id = entry->old_id;
+  ID *new_id = entry->new_id;
+
   if (!old_id) { /* Used to cleanup all IDs used by a specific one. */
     BLI_assert(!new_id);
     old_id = *id_p;
@@ -167,28 +190,28 @@ static int foreach_libblock_remap_callback(LibraryIDLinkCallbackData *cb_data)
         (is_obj_editmode && (((Object *)id_owner)->data == *id_p) && new_id != NULL) ||
         (skip_indirect && is_indirect) || (is_reference && skip_reference)) {
       if (is_indirect) {
-        id_remap_data->skipped_indirect++;
+        entry->skipped_indirect++;
         if (is_obj) {
           Object *ob = (Object *)id_owner;
           if (ob->data == *id_p && ob->proxy != NULL) {
             /* And another 'Proudly brought to you by Proxy Hell' hack!
              * This will allow us to avoid clearing 'LIB_EXTERN' flag of obdata of proxies... */
-            id_remap_data->skipped_direct++;
+            entry->skipped_direct++;
           }
         }
       }
       else if (is_never_null || is_obj_editmode || is_reference) {
-        id_remap_data->skipped_direct++;
+        entry->skipped_direct++;
       }
       else {
         BLI_assert(0);
       }
       if (cb_flag & IDWALK_CB_USER) {
-        id_remap_data->skipped_refcounted++;
+        entry->skipped_refcounted++;
       }
       else if (cb_flag & IDWALK_CB_USER_ONE) {
         /* No need to count number of times this happens, just a flag is enough. */
-        id_remap_data->status |= ID_REMAP_IS_USER_ONE_SKIPPED;
+        entry->status |= ID_REMAP_IS_USER_ONE_SKIPPED;
       }
     }
     else {
@@ -224,7 +247,7 @@ static int foreach_libblock_remap_callback(LibraryIDLinkCallbackData *cb_data)
          * are assumed to be set as needed, that extra user is processed in final handling. */
       }
       if (!is_indirect || is_obj_proxy) {
-        id_remap_data->status |= ID_REMAP_IS_LINKED_DIRECT;
+        entry->status |= ID_REMAP_IS_LINKED_DIRECT;
       }
       /* We need to remap proxy_from pointer of remapped proxy... sigh. */
       if (is_obj_proxy && new_id != NULL) {
@@ -239,13 +262,12 @@ static int foreach_libblock_remap_callback(LibraryIDLinkCallbackData *cb_data)
   return IDWALK_RET_NOP;
 }
 
-static void libblock_remap_data_preprocess(IDRemap *r_id_remap_data)
+static void libblock_remap_data_preprocess(ID *id_owner, ID *old_id)
 {
-  switch (GS(r_id_remap_data->id_owner->name)) {
+  switch (GS(id_owner->name)) {
     case ID_OB: {
-      ID *old_id = r_id_remap_data->old_id;
       if (!old_id || GS(old_id->name) == ID_AR) {
-        Object *ob = (Object *)r_id_remap_data->id_owner;
+        Object *ob = (Object *)id_owner;
         /* Object's pose holds reference to armature bones. sic */
         /* Note that in theory, we should have to bother about linked/non-linked/never-null/etc.
          * flags/states.
@@ -365,14 +387,13 @@ static void libblock_remap_data_postprocess_nodetree_update(Main *bmain, ID *new
  * \param bmain: the Main data storage to operate on (must never be NULL).
  * \param id: the data-block to operate on
  * (can be NULL, in which case we operate over all IDs from given bmain).
- * \param old_id: the data-block to dereference (may be NULL if \a id is non-NULL).
- * \param new_id: the new data-block to replace \a old_id references with (may be NULL).
- * \param r_id_remap_data: if non-NULL, the IDRemap struct to use
- * (uselful to retrieve info about remapping process).
+ * \param entries: the remappings to perform, see #IDRemapEntry. Only a single entry is supported
+ * when \a id is non-NULL, and only then may its `old_id` be NULL (clearing all ID usages).
+ * On return, the 'output' fields of the entries describe the remapping process.
  */
-ATTR_NONNULL(1)
+ATTR_NONNULL(1, 3)
 static void libblock_remap_data(
-    Main *bmain, ID *id, ID *old_id, ID *new_id, const short remap_flags, IDRemap *r_id_remap_data)
+    Main *bmain, ID *id, IDRemapEntry *entries, const int entries_num, const short remap_flags)
 {
   IDRemap id_remap_data;
   const int foreach_id_flags = ((remap_flags & ID_REMAP_NO_INDIRECT_PROXY_DATA_USAGE) != 0 ?
@@ -382,27 +403,37 @@ static void libblock_remap_data(
                                     IDWALK_DO_INTERNAL_RUNTIME_POINTERS :
                                     IDWALK_NOP);
 
-  if (r_id_remap_data == NULL) {
-    r_id_remap_data = &id_remap_data;
+  id_remap_data.bmain = bmain;
+  id_remap_data.entries = entries;
+  id_remap_data.entries_num = entries_num;
+  id_remap_data.entries_map = NULL;
+  id_remap_data.id_owner = NULL;
+  id_remap_data.flag = remap_flags;
+
+  for (int i = 0; i < entries_num; i++) {
+    entries[i].status = 0;
+    entries[i].skipped_direct = 0;
+    entries[i].skipped_indirect = 0;
+    entries[i].skipped_refcounted = 0;
+  }
+
+  if (entries_num > 1) {
+    id_remap_data.entries_map = BLI_ghash_ptr_new_ex(__func__, (uint)entries_num);
+    for (int i = 0; i < entries_num; i++) {
+      BLI_assert(entries[i].old_id != NULL);
+      BLI_ghash_insert(id_remap_data.entries_map, entries[i].old_id, &entries[i]);
+    }
   }
-  r_id_remap_data->bmain = bmain;
-  r_id_remap_data->old_id = old_id;
-  r_id_remap_data->new_id = new_id;
-  r_id_remap_data->id_owner = NULL;
-  r_id_remap_data->flag = remap_flags;
-  r_id_remap_data->status = 0;
-  r_id_remap_data->skipped_direct = 0;
-  r_id_remap_data->skipped_indirect = 0;
-  r_id_remap_data->skipped_refcounted = 0;
 
   if (id) {
 #ifdef DEBUG_PRINT
     printf("\tchecking id %s (%p, %p)\n", id->name, id, id->lib);
 #endif
-    r_id_remap_data->id_owner = id;
-    libblock_remap_data_preprocess(r_id_remap_data);
+    BLI_assert(entries_num == 1);
+    id_remap_data.id_owner = id;
+    libblock_remap_data_preprocess(id, entries[0].old_id);
     BKE_library_foreach_ID_link(
-        NULL, id, foreach_libblock_remap_callback, (void *)r_id_remap_data, foreach_id_flags);
+        NULL, id, foreach_libblock_remap_callback, (void *)&id_remap_data, foreach_id_flags);
   }
   else {
     /* Note that this is a very 'brute force' approach,
@@ -411,66 +442,73 @@ static void libblock_remap_data(
     ID *id_curr;
 
     FOREACH_MAIN_ID_BEGIN (bmain, id_curr) {
-      if (BKE_library_id_can_use_idtype(id_curr, GS(old_id->name))) {
+      bool can_use_any = false;
+      for (int i = 0; i < entries_num && !can_use_any; i++) {
+        can_use_any = BKE_library_id_can_use_idtype(id_curr, GS(entries[i].old_id->name));
+      }
+      if (can_use_any) {
         /* Note that we cannot skip indirect usages of old_id here (if requested),
          * we still need to check it for the user count handling...
          * XXX No more true (except for debug usage of those skipping counters). */
-        r_id_remap_data->id_owner = id_curr;
-        libblock_remap_data_preprocess(r_id_remap_data);
+        id_remap_data.id_owner = id_curr;
+        for (int i = 0; i < entries_num; i++) {
+          libblock_remap_data_preprocess(id_curr, entries[i].old_id);
+        }
         BKE_library_foreach_ID_link(NULL,
                                     id_curr,
                                     foreach_libblock_remap_callback,
-                                    (void *)r_id_remap_data,
+                                    (void *)&id_remap_data,
                                     foreach_id_flags);
       }
     }
     FOREACH_MAIN_ID_END;
   }
 
-  if ((remap_flags & ID_REMAP_SKIP_USER_CLEAR) == 0) {
-    /* XXX We may not want to always 'transfer' fake-user from old to new id...
-     *     Think for now it's desired behavior though,
-     *     we can always add an option (flag) to control this later if needed. */
-    if (old_id && (old_id->flag & LIB_FAKEUSER)) {
-      id_fake_user_clear(old_id);
-      id_fake_user_set(new_id);
-    }
+  for (int i = 0; i < entries_num; i++) {
+    ID *old_id = entries[i].old_id;
+    ID *new_id = entries[i].new_id;
+
+    if ((remap_flags & ID_REMAP_SKIP_USER_CLEAR) == 0) {
+      /* XXX We may not want to always 'transfer' fake-user from old to new id...
+       *     Think for now it's desired behavior though,
+       *     we can always add an option (flag) to control this later if needed. */
+      if (old_id && (old_id->flag & LIB_FAKEUSER)) {
+        id_fake_user_clear(old_id);
+        id_fake_user_set(new_id);
+      }
 
-    id_us_clear_real(old_id);
-  }
+      id_us_clear_real(old_id);
+    }
 
-  if (new_id && (new_id->tag & LIB_TAG_INDIRECT) &&
-      (r_id_remap_data->status & ID_REMAP_IS_LINKED_DIRECT)) {
-    new_id->tag &= ~LIB_TAG_INDIRECT;
-    new_id->flag &= ~LIB_INDIRECT_WEAK_LINK;
-    new_id->tag |= LIB_TAG_EXTERN;
-  }
+    if (new_id && (new_id->tag & LIB_TAG_INDIRECT) &&
+        (entries[i].status & ID_REMAP_IS_LINKED_DIRECT)) {
+      new_id->tag &= ~LIB_TAG_INDIRECT;
+      new_id->flag &= ~LIB_INDIRECT_WEAK_LINK;
+      new_id->tag |= LIB_TAG_EXTERN;
+    }
 
 #ifdef DEBUG_PRINT
-  printf("%s: %d occurrences skipped (%d direct and %d indirect ones)\n",
-         __func__,
-         r_id_remap_data->skipped_direct + r_id_remap_data->skipped_indirect,
-         r_id_remap_data->skipped_direct,
-         r_id_remap_data->skipped_indirect);
+    printf("%s: %d occurrences skipped (%d direct and %d indirect ones)\n",
+           __func__,
+           entries[i].skipped_direct + entries[i].skipped_indirect,
+           entries[i].skipped_direct,
+           entries[i].skipped_indirect);
 #endif
+  }
+
+  if (id_remap_data.entries_map != NULL) {
+    BLI_ghash_free(id_remap_data.entries_map, NULL, NULL);
+  }
 }
 
-/**
- * Replace all references in given Main to \a old_id by \a new_id
- * (if \a new_id is NULL, it unlinks \a old_id).
- */
-void BKE_libblock_remap_locked(Main *bmain, void *old_idv, void *new_idv, const short remap_flags)
+static void libblock_remap_postprocess_entry(Main *bmain,
+                                             IDRemapEntry *entry,
+                                             const short remap_flags)
 {
-  IDRemap id_remap_data;
-  ID *old_id = old_idv;
-  ID *new_id = new_idv;
-  int skipped_direct, skipped_refcounted;
-
-  BLI_assert(old_id != NULL);
-  BLI_assert((new_id == NULL) || GS(old_id->name) == GS(new_id->name));
-  BLI_assert(old_id != new_id);
-
-  libblock_remap_data(bmain, NULL, old_id, new_id, remap_flags, &id_remap_data);
+  ID *old_id = entry->old_id;
+  ID *new_id = entry->new_id;
+  const int skipped_direct = entry->skipped_direct;
+  const int skipped_refcounted = entry->skipped_refcounted;
 
   if (free_notifier_reference_cb) {
     free_notifier_reference_cb(old_id);
@@ -483,15 +521,12 @@ void BKE_libblock_remap_locked(Main *bmain, void *old_idv, void *new_idv, const
     remap_editor_id_reference_cb(old_id, new_id);
   }
 
-  skipped_direct = id_remap_data.skipped_direct;
-  skipped_refcounted = id_remap_data.skipped_refcounted;
-
   if ((remap_flags & ID_REMAP_SKIP_USER_CLEAR) == 0) {
     /* If old_id was used by some ugly 'user_one' stuff (like Image or Clip editors...), and user
      * count has actually been incremented for that, we have to decrease once more its user
      * count... unless we had to skip some 'user_one' cases. */
     if ((old_id->tag & LIB_TAG_EXTRAUSER_SET) &&
-        !(id_remap_data.status & ID_REMAP_IS_USER_ONE_SKIPPED)) {
+        !(entry->status & ID_REMAP_IS_USER_ONE_SKIPPED)) {
       id_us_clear_real(old_id);
     }
   }
@@ -550,6 +585,23 @@ void BKE_libblock_remap_locked(Main *bmain, void *old_idv, void *new_idv, const
   BKE_main_unlock(bmain);
   libblock_remap_data_postprocess_nodetree_update(bmain, new_id);
   BKE_main_lock(bmain);
+}
+
+/**
+ * Replace all references in given Main to \a old_id by \a new_id
+ * (if \a new_id is NULL, it unlinks \a old_id).
+ */
+void BKE_libblock_remap_locked(Main *bmain, void *old_idv, void *new_idv, const short remap_flags)
+{
+  IDRemapEntry entry = {.old_id = old_idv, .new_id = new_idv};
+
+  BLI_assert(entry.old_id != NULL);
+  BLI_assert((entry.new_id == NULL) || GS(entry.old_id->name) == GS(entry.new_id->name));
+  BLI_assert(entry.old_id != entry.new_id);
+
+  libblock_remap_data(bmain, NULL, &entry, 1, remap_flags);
+
+  libblock_remap_postprocess_entry(bmain, &entry, remap_flags);
 
   /* Full rebuild of DEG! */
   DEG_relations_tag_update(bmain);
@@ -564,6 +616,57 @@ void BKE_libblock_remap(Main *bmain, void *old_idv, void *new_idv, const short r
   BKE_main_unlock(bmain);
 }
 
+/**
+ * Batched version of #BKE_libblock_remap_locked: apply all given remappings in a single
+ * traversal of the whole Main database, instead of one traversal per remapped ID.
+ *
+ * \param remaps: Array of (old ID, new ID) pairs, a NULL `new_id` unlinks its `old_id`.
+ * Old IDs must all be different from each other.
+ */
+void BKE_libblock_remap_multiple_locked(Main *bmain,
+                                        const IDRemapPair *remaps,
+                                        const int remaps_num,
+                                        const short remap_flags)
+{
+  if (remaps_num == 0) {
+    return;
+  }
+
+  IDRemapEntry *entries = MEM_callocN(sizeof(*entries) * (size_t)remaps_num, __func__);
+
+  for (int i = 0; i < remaps_num; i++) {
+    BLI_assert(remaps[i].old_id != NULL);
+    BLI_assert((remaps[i].new_id == NULL) ||
+               GS(remaps[i].old_id->name) == GS(remaps[i].new_id->name));
+    BLI_assert(remaps[i].old_id != remaps[i].new_id);
+    entries[i].old_id = remaps[i].old_id;
+    entries[i].new_id = remaps[i].new_id;
+  }
+
+  libblock_remap_data(bmain, NULL, entries, remaps_num, remap_flags);
+
+  for (int i = 0; i < remaps_num; i++) {
+    libblock_remap_postprocess_entry(bmain, &entries[i], remap_flags);
+  }
+
+  MEM_freeN(entries);
+
+  /* Full rebuild of DEG! */
+  DEG_relations_tag_update(bmain);
+}
+
+void BKE_libblock_remap_multiple(Main *bmain,
+                                 const IDRemapPair *remaps,
+                                 const int remaps_num,
+                                 const short remap_flags)
+{
+  BKE_main_lock(bmain);
+
+  BKE_libblock_remap_multiple_locked(bmain, remaps, remaps_num, remap_flags);
+
+  BKE_main_unlock(bmain);
+}
+
 /**
  * Unlink given \a id from given \a bmain
  * (does not touch to indirect, i.e. library, usages of the ID).
@@ -621,7 +724,8 @@ void BKE_libblock_relink_ex(
     BLI_assert(new_id == NULL);
   }
 
-  libblock_remap_data(bmain, id, old_id, new_id, remap_flags, NULL);
+  IDRemapEntry entry = {.old_id = old_id, .new_id = new_id};
+  libblock_remap_data(bmain, id, &entry, 1, remap_flags);
 
   /* Some after-process updates.
    * This is a bit ugly, but cannot see a way to avoid it.
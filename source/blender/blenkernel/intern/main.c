@@ -199,6 +199,10 @@ void BKE_main_free(Main *mainvar)
     BKE_main_idmap_destroy(mainvar->id_map);
   }
 
+  if (mainvar->id_lookup_map) {
+    BKE_main_idmap_destroy(mainvar->id_lookup_map);
+  }
+
   BLI_spin_end((SpinLock *)mainvar->lock);
   MEM_freeN(mainvar->lock);
   MEM_freeN(mainvar);
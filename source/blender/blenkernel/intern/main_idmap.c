@@ -310,3 +310,45 @@ void BKE_main_idmap_destroy(struct IDNameLib_Map *id_map)
 }
 
 /** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Persistent Per-Main Lookup Cache
+ *
+ * Unlike a plain #IDNameLib_Map, this cache stays valid across data-block additions, renames and
+ * deletions, because the ID management code in `lib_id.c` updates it on those operations.
+ * Code paths that modify ID names or Main listbases without going through that code must call
+ * #BKE_main_idmap_cache_invalidate, the cache is then rebuilt on the next lookup.
+ * \{ */
+
+struct IDNameLib_Map *BKE_main_idmap_ensure(struct Main *bmain)
+{
+  if (bmain->id_lookup_map == NULL) {
+    bmain->id_lookup_map = BKE_main_idmap_create(
+        bmain, false, NULL, MAIN_IDMAP_TYPE_NAME | MAIN_IDMAP_TYPE_UUID);
+  }
+  return bmain->id_lookup_map;
+}
+
+void BKE_main_idmap_cache_insert_id(struct Main *bmain, ID *id)
+{
+  if (bmain->id_lookup_map != NULL) {
+    BKE_main_idmap_insert_id(bmain->id_lookup_map, id);
+  }
+}
+
+void BKE_main_idmap_cache_remove_id(struct Main *bmain, ID *id)
+{
+  if (bmain->id_lookup_map != NULL) {
+    BKE_main_idmap_remove_id(bmain->id_lookup_map, id);
+  }
+}
+
+void BKE_main_idmap_cache_invalidate(struct Main *bmain)
+{
+  if (bmain->id_lookup_map != NULL) {
+    BKE_main_idmap_destroy(bmain->id_lookup_map);
+    bmain->id_lookup_map = NULL;
+  }
+}
+
+/** \} */
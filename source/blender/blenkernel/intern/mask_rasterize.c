@@ -569,6 +569,53 @@ static void layer_bucket_init(MaskRasterLayer *layer, const float pixel_size)
   BLI_memarena_free(arena);
 }
 
+/**
+ * Differentiated points for a single spline, computed up-front so the (serial) scan-fill
+ * assembly in #BKE_maskrasterize_handle_init only has to consume the arrays.
+ */
+typedef struct MaskRasterSplineDiff {
+  MaskSpline *spline;
+
+  float (*diff_points)[2];
+  unsigned int tot_diff_point;
+
+  float (*diff_feather_points)[2];
+  unsigned int tot_diff_feather_points;
+} MaskRasterSplineDiff;
+
+typedef struct MaskRasterSplineDiffData {
+  MaskRasterSplineDiff *spline_diffs;
+  int width, height;
+  bool do_feather;
+} MaskRasterSplineDiffData;
+
+static void maskrasterize_spline_diff_task_cb(void *__restrict userdata,
+                                              const int index,
+                                              const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  MaskRasterSplineDiffData *data = userdata;
+  MaskRasterSplineDiff *spline_diff = &data->spline_diffs[index];
+  MaskSpline *spline = spline_diff->spline;
+
+  const unsigned int resol_a = BKE_mask_spline_resolution(spline, data->width, data->height) / 4;
+  const unsigned int resol_b = BKE_mask_spline_feather_resolution(spline, data->width, data->height) /
+                               4;
+  const unsigned int resol = CLAMPIS(MAX2(resol_a, resol_b), 4, 512);
+
+  spline_diff->diff_points = BKE_mask_spline_differentiate_with_resolution(
+      spline, resol, &spline_diff->tot_diff_point);
+
+  if (data->do_feather) {
+    spline_diff->diff_feather_points = BKE_mask_spline_feather_differentiated_points_with_resolution(
+        spline, resol, false, &spline_diff->tot_diff_feather_points);
+    BLI_assert(spline_diff->diff_feather_points);
+  }
+  else {
+    spline_diff->tot_diff_feather_points = 0;
+    spline_diff->diff_feather_points = NULL;
+  }
+}
+
 void BKE_maskrasterize_handle_init(MaskRasterHandle *mr_handle,
                                    struct Mask *mask,
                                    const int width,
@@ -595,6 +642,47 @@ void BKE_maskrasterize_handle_init(MaskRasterHandle *mr_handle,
 
   sf_arena = BLI_memarena_new(BLI_SCANFILL_ARENA_SIZE, __func__);
 
+  /* Differentiating the splines (the feather points especially) is the heavy part of
+   * initialization for roto-heavy masks and is a pure per-spline computation,
+   * so do it in parallel up-front. The scan-fill assembly below shares state
+   * between splines and stays serial, consuming the arrays in the same order. */
+  MaskRasterSplineDiffData diff_data;
+  unsigned int spline_diff_tot = 0;
+  unsigned int spline_diff_index = 0;
+
+  for (masklay = mask->masklayers.first; masklay; masklay = masklay->next) {
+    if (masklay->restrictflag & MASK_RESTRICT_RENDER) {
+      continue;
+    }
+    spline_diff_tot += (unsigned int)BLI_listbase_count(&masklay->splines);
+  }
+
+  diff_data.spline_diffs = MEM_mallocN(sizeof(*diff_data.spline_diffs) * spline_diff_tot,
+                                       __func__);
+  diff_data.width = width;
+  diff_data.height = height;
+  diff_data.do_feather = do_feather;
+
+  for (masklay = mask->masklayers.first; masklay; masklay = masklay->next) {
+    if (masklay->restrictflag & MASK_RESTRICT_RENDER) {
+      continue;
+    }
+    MaskSpline *spline;
+    for (spline = masklay->splines.first; spline; spline = spline->next) {
+      diff_data.spline_diffs[spline_diff_index++].spline = spline;
+    }
+  }
+
+  {
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.use_threading = (spline_diff_tot > 1);
+    BLI_task_parallel_range(
+        0, (int)spline_diff_tot, &diff_data, maskrasterize_spline_diff_task_cb, &settings);
+  }
+
+  spline_diff_index = 0;
+
   for (masklay = mask->masklayers.first, masklay_index = 0; masklay;
        masklay = masklay->next, masklay_index++) {
 
@@ -642,21 +730,14 @@ void BKE_maskrasterize_handle_init(MaskRasterHandle *mr_handle,
       float(*diff_feather_points_flip)[2];
       unsigned int tot_diff_feather_points;
 
-      const unsigned int resol_a = BKE_mask_spline_resolution(spline, width, height) / 4;
-      const unsigned int resol_b = BKE_mask_spline_feather_resolution(spline, width, height) / 4;
-      const unsigned int resol = CLAMPIS(MAX2(resol_a, resol_b), 4, 512);
+      MaskRasterSplineDiff *spline_diff = &diff_data.spline_diffs[spline_diff_index++];
+      BLI_assert(spline_diff->spline == spline);
 
-      diff_points = BKE_mask_spline_differentiate_with_resolution(spline, resol, &tot_diff_point);
+      diff_points = spline_diff->diff_points;
+      tot_diff_point = spline_diff->tot_diff_point;
 
-      if (do_feather) {
-        diff_feather_points = BKE_mask_spline_feather_differentiated_points_with_resolution(
-            spline, resol, false, &tot_diff_feather_points);
-        BLI_assert(diff_feather_points);
-      }
-      else {
-        tot_diff_feather_points = 0;
-        diff_feather_points = NULL;
-      }
+      diff_feather_points = spline_diff->diff_feather_points;
+      tot_diff_feather_points = spline_diff->tot_diff_feather_points;
 
       if (tot_diff_point > 3) {
         ScanFillVert *sf_vert_prev;
@@ -1220,6 +1301,8 @@ void BKE_maskrasterize_handle_init(MaskRasterHandle *mr_handle,
     BLI_scanfill_end_arena(&sf_ctx, sf_arena);
   }
 
+  MEM_freeN(diff_data.spline_diffs);
+
   BLI_memarena_free(sf_arena);
 }
 
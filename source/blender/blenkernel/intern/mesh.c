@@ -1771,10 +1771,23 @@ void BKE_mesh_vert_coords_apply(Mesh *mesh, const float (*vert_coords)[3])
   /* This will just return the pointer if it wasn't a referenced layer. */
   MVert *mv = CustomData_duplicate_referenced_layer(&mesh->vdata, CD_MVERT, mesh->totvert);
   mesh->mvert = mv;
+
+  /* Track the range of vertices that actually moved, so deform modifiers limited to a
+   * vertex group only dirty the normals of the affected region. */
+  int changed_start = -1;
+  int changed_end = -1;
   for (int i = 0; i < mesh->totvert; i++, mv++) {
-    copy_v3_v3(mv->co, vert_coords[i]);
+    if (!equals_v3v3(mv->co, vert_coords[i])) {
+      copy_v3_v3(mv->co, vert_coords[i]);
+      if (changed_start == -1) {
+        changed_start = i;
+      }
+      changed_end = i;
+    }
+  }
+  if (changed_start != -1) {
+    BKE_mesh_normals_tag_dirty_range(mesh, changed_start, changed_end - changed_start + 1);
   }
-  mesh->runtime.cd_dirty_vert |= CD_MASK_NORMAL;
 }
 
 void BKE_mesh_vert_coords_apply_with_mat4(Mesh *mesh,
@@ -1787,7 +1800,7 @@ void BKE_mesh_vert_coords_apply_with_mat4(Mesh *mesh,
   for (int i = 0; i < mesh->totvert; i++, mv++) {
     mul_v3_m4v3(mv->co, mat, vert_coords[i]);
   }
-  mesh->runtime.cd_dirty_vert |= CD_MASK_NORMAL;
+  BKE_mesh_normals_tag_dirty(mesh);
 }
 
 void BKE_mesh_vert_normals_apply(Mesh *mesh, const short (*vert_normals)[3])
@@ -1799,6 +1812,8 @@ void BKE_mesh_vert_normals_apply(Mesh *mesh, const short (*vert_normals)[3])
     copy_v3_v3_short(mv->no, vert_normals[i]);
   }
   mesh->runtime.cd_dirty_vert &= ~CD_MASK_NORMAL;
+  mesh->runtime.dirty_normal_range_start = 0;
+  mesh->runtime.dirty_normal_range_len = 0;
 }
 
 /**
@@ -1876,6 +1891,8 @@ void BKE_mesh_calc_normals_split_ex(Mesh *mesh, MLoopNorSpaceArray *r_lnors_spac
   mesh->runtime.cd_dirty_vert &= ~CD_MASK_NORMAL;
   mesh->runtime.cd_dirty_poly &= ~CD_MASK_NORMAL;
   mesh->runtime.cd_dirty_loop &= ~CD_MASK_NORMAL;
+  mesh->runtime.dirty_normal_range_start = 0;
+  mesh->runtime.dirty_normal_range_len = 0;
 }
 
 void BKE_mesh_calc_normals_split(Mesh *mesh)
@@ -36,7 +36,6 @@
 
 #include "BLI_alloca.h"
 #include "BLI_bitmap.h"
-
 #include "BLI_linklist.h"
 #include "BLI_linklist_stack.h"
 #include "BLI_math.h"
@@ -67,6 +66,38 @@ void BKE_mesh_normals_tag_dirty(Mesh *mesh)
 {
   mesh->runtime.cd_dirty_vert |= CD_MASK_NORMAL;
   mesh->runtime.cd_dirty_poly |= CD_MASK_NORMAL;
+  /* The whole mesh is dirty, drop any recorded deform range. */
+  mesh->runtime.dirty_normal_range_start = 0;
+  mesh->runtime.dirty_normal_range_len = 0;
+}
+
+/**
+ * Tag normals dirty for a deform-only update of the given vertex range, so the next
+ * recalculation can be limited to the affected region. Ranges from successive calls are
+ * merged; a whole-mesh tag from #BKE_mesh_normals_tag_dirty always wins.
+ */
+void BKE_mesh_normals_tag_dirty_range(Mesh *mesh, const int vert_start, const int vert_len)
+{
+  if (vert_len <= 0) {
+    return;
+  }
+  if (mesh->runtime.cd_dirty_vert & CD_MASK_NORMAL) {
+    if (mesh->runtime.dirty_normal_range_len <= 0) {
+      /* Already tagged as fully dirty. */
+      return;
+    }
+    const int start = min_ii(mesh->runtime.dirty_normal_range_start, vert_start);
+    const int end = max_ii(
+        mesh->runtime.dirty_normal_range_start + mesh->runtime.dirty_normal_range_len,
+        vert_start + vert_len);
+    mesh->runtime.dirty_normal_range_start = start;
+    mesh->runtime.dirty_normal_range_len = end - start;
+    return;
+  }
+  mesh->runtime.cd_dirty_vert |= CD_MASK_NORMAL;
+  mesh->runtime.cd_dirty_poly |= CD_MASK_NORMAL;
+  mesh->runtime.dirty_normal_range_start = vert_start;
+  mesh->runtime.dirty_normal_range_len = vert_len;
 }
 
 /**
@@ -376,6 +407,146 @@ void BKE_mesh_calc_normals_poly(MVert *mverts,
   MEM_freeN(lnors_weighted);
 }
 
+/**
+ * Recompute only the normals affected by a deform of the vertex range
+ * `[vert_start, vert_start + vert_len)`. Polygons using a moved vertex get a new polygon
+ * normal, and every vertex of such a polygon rebuilds its normal from all of its adjacent
+ * polygons (including ones whose own normal did not change).
+ *
+ * Runs single threaded: it is only worth using for ranges well below the mesh size, where
+ * the work is dominated by the two cheap tagging passes over the polygons.
+ */
+static void mesh_normals_calc_partial(MVert *mverts,
+                                      int numVerts,
+                                      const MLoop *mloop,
+                                      const MPoly *mpolys,
+                                      int numPolys,
+                                      float (*r_polynors)[3],
+                                      const int vert_start,
+                                      const int vert_len)
+{
+  const uint vert_end = (uint)min_ii(vert_start + vert_len, numVerts);
+
+  BLI_bitmap *vert_tag = BLI_BITMAP_NEW((size_t)numVerts, __func__);
+
+  /* Tag the moved vertices themselves, so isolated vertices (which fall back to their
+   * normalized coordinate for a normal) are updated too. */
+  for (uint vidx = (uint)vert_start; vidx < vert_end; vidx++) {
+    BLI_BITMAP_ENABLE(vert_tag, vidx);
+  }
+
+  /* Polygons using a moved vertex: their normals changed, and so did the normals of every
+   * vertex they use. */
+  for (int pidx = 0; pidx < numPolys; pidx++) {
+    const MPoly *mp = &mpolys[pidx];
+    const MLoop *ml = &mloop[mp->loopstart];
+    bool affected = false;
+    for (int i = 0; i < mp->totloop; i++) {
+      if (ml[i].v >= (uint)vert_start && ml[i].v < vert_end) {
+        affected = true;
+        break;
+      }
+    }
+    if (affected) {
+      for (int i = 0; i < mp->totloop; i++) {
+        BLI_BITMAP_ENABLE(vert_tag, ml[i].v);
+      }
+    }
+  }
+
+  float(*vnors)[3] = (float(*)[3])MEM_calloc_arrayN((size_t)numVerts, sizeof(*vnors), __func__);
+
+  /* Accumulate angle weighted normals from every polygon using a tagged vertex, following
+   * #mesh_calc_normals_poly_prepare_cb. Untouched polygons recompute to the same normal,
+   * so writing them back into \a r_polynors is harmless. */
+  for (int pidx = 0; pidx < numPolys; pidx++) {
+    const MPoly *mp = &mpolys[pidx];
+    const MLoop *ml = &mloop[mp->loopstart];
+    const int nverts = mp->totloop;
+
+    bool contributes = false;
+    for (int i = 0; i < nverts; i++) {
+      if (BLI_BITMAP_TEST(vert_tag, ml[i].v)) {
+        contributes = true;
+        break;
+      }
+    }
+    if (!contributes) {
+      continue;
+    }
+
+    float(*edgevecbuf)[3] = (float(*)[3])BLI_array_alloca(edgevecbuf, (size_t)nverts);
+    float pnor[3];
+
+    {
+      int i_prev = nverts - 1;
+      const float *v_prev = mverts[ml[i_prev].v].co;
+      const float *v_curr;
+
+      zero_v3(pnor);
+      /* Newell's Method */
+      for (int i = 0; i < nverts; i++) {
+        v_curr = mverts[ml[i].v].co;
+        add_newell_cross_v3_v3v3(pnor, v_prev, v_curr);
+
+        sub_v3_v3v3(edgevecbuf[i_prev], v_prev, v_curr);
+        normalize_v3(edgevecbuf[i_prev]);
+        i_prev = i;
+
+        v_prev = v_curr;
+      }
+      if (UNLIKELY(normalize_v3(pnor) == 0.0f)) {
+        pnor[2] = 1.0f; /* other axes set to 0.0 */
+      }
+    }
+
+    if (r_polynors) {
+      copy_v3_v3(r_polynors[pidx], pnor);
+    }
+
+    const float *prev_edge = edgevecbuf[nverts - 1];
+    for (int i = 0; i < nverts; i++) {
+      const float *cur_edge = edgevecbuf[i];
+      const uint vidx = ml[i].v;
+
+      if (BLI_BITMAP_TEST(vert_tag, vidx)) {
+        const float fac = saacos(-dot_v3v3(cur_edge, prev_edge));
+        madd_v3_v3fl(vnors[vidx], pnor, fac);
+      }
+      prev_edge = cur_edge;
+    }
+  }
+
+  /* Normalize and validate the rebuilt vertex normals. */
+  for (int vidx = 0; vidx < numVerts; vidx++) {
+    if (!BLI_BITMAP_TEST(vert_tag, vidx)) {
+      continue;
+    }
+    MVert *mv = &mverts[vidx];
+    float *no = vnors[vidx];
+
+    if (UNLIKELY(normalize_v3(no) == 0.0f)) {
+      /* following Mesh convention; we use vertex coordinate itself for normal in this case */
+      normalize_v3_v3(no, mv->co);
+    }
+    normal_float_to_short_v3(mv->no, no);
+  }
+
+  MEM_freeN(vnors);
+  MEM_freeN(vert_tag);
+}
+
+/**
+ * True when the recorded dirty vertex range is small enough for the partial recompute in
+ * #mesh_normals_calc_partial to beat the threaded full rebuild.
+ */
+static bool mesh_normals_use_partial_range(const Mesh *mesh)
+{
+  const int range_len = mesh->runtime.dirty_normal_range_len;
+  return (mesh->runtime.cd_dirty_vert & CD_MASK_NORMAL) && range_len > 0 &&
+         mesh->runtime.dirty_normal_range_start >= 0 && range_len < mesh->totvert / 2;
+}
+
 void BKE_mesh_ensure_normals(Mesh *mesh)
 {
   if (mesh->runtime.cd_dirty_vert & CD_MASK_NORMAL) {
@@ -416,16 +587,29 @@ void BKE_mesh_ensure_normals_for_display(Mesh *mesh)
           (size_t)mesh->totpoly, sizeof(*poly_nors), __func__);
     }
 
-    /* calculate poly/vert normals */
-    BKE_mesh_calc_normals_poly(mesh->mvert,
-                               nullptr,
-                               mesh->totvert,
-                               mesh->mloop,
-                               mesh->mpoly,
-                               mesh->totloop,
-                               mesh->totpoly,
-                               poly_nors,
-                               !do_vert_normals);
+    if (!do_add_poly_nors_cddata && do_vert_normals && mesh_normals_use_partial_range(mesh)) {
+      /* Deform-only update with a known vertex range, avoid rebuilding all normals. */
+      mesh_normals_calc_partial(mesh->mvert,
+                                mesh->totvert,
+                                mesh->mloop,
+                                mesh->mpoly,
+                                mesh->totpoly,
+                                poly_nors,
+                                mesh->runtime.dirty_normal_range_start,
+                                mesh->runtime.dirty_normal_range_len);
+    }
+    else {
+      /* calculate poly/vert normals */
+      BKE_mesh_calc_normals_poly(mesh->mvert,
+                                 nullptr,
+                                 mesh->totvert,
+                                 mesh->mloop,
+                                 mesh->mpoly,
+                                 mesh->totloop,
+                                 mesh->totpoly,
+                                 poly_nors,
+                                 !do_vert_normals);
+    }
 
     if (do_add_poly_nors_cddata) {
       CustomData_add_layer(&mesh->pdata, CD_NORMAL, CD_ASSIGN, poly_nors, mesh->totpoly);
@@ -433,6 +617,8 @@ void BKE_mesh_ensure_normals_for_display(Mesh *mesh)
 
     mesh->runtime.cd_dirty_vert &= ~CD_MASK_NORMAL;
     mesh->runtime.cd_dirty_poly &= ~CD_MASK_NORMAL;
+    mesh->runtime.dirty_normal_range_start = 0;
+    mesh->runtime.dirty_normal_range_len = 0;
   }
 }
 
@@ -443,19 +629,34 @@ void BKE_mesh_calc_normals(Mesh *mesh)
 #ifdef DEBUG_TIME
   TIMEIT_START_AVERAGED(BKE_mesh_calc_normals);
 #endif
-  BKE_mesh_calc_normals_poly(mesh->mvert,
-                             nullptr,
-                             mesh->totvert,
-                             mesh->mloop,
-                             mesh->mpoly,
-                             mesh->totloop,
-                             mesh->totpoly,
-                             nullptr,
-                             false);
+  if (mesh_normals_use_partial_range(mesh)) {
+    /* Deform-only update with a known vertex range, avoid rebuilding all normals. */
+    mesh_normals_calc_partial(mesh->mvert,
+                              mesh->totvert,
+                              mesh->mloop,
+                              mesh->mpoly,
+                              mesh->totpoly,
+                              nullptr,
+                              mesh->runtime.dirty_normal_range_start,
+                              mesh->runtime.dirty_normal_range_len);
+  }
+  else {
+    BKE_mesh_calc_normals_poly(mesh->mvert,
+                               nullptr,
+                               mesh->totvert,
+                               mesh->mloop,
+                               mesh->mpoly,
+                               mesh->totloop,
+                               mesh->totpoly,
+                               nullptr,
+                               false);
+  }
 #ifdef DEBUG_TIME
   TIMEIT_END_AVERAGED(BKE_mesh_calc_normals);
 #endif
   mesh->runtime.cd_dirty_vert &= ~CD_MASK_NORMAL;
+  mesh->runtime.dirty_normal_range_start = 0;
+  mesh->runtime.dirty_normal_range_len = 0;
 }
 
 void BKE_mesh_calc_normals_looptri(MVert *mverts,
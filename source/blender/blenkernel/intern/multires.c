@@ -378,7 +378,8 @@ int multires_get_level(const Scene *scene,
     return mmd->lvl;
   }
 
-  return (scene != NULL) ? get_render_subsurf_level(&scene->r, mmd->lvl, false) : mmd->lvl;
+  return (scene != NULL) ? get_render_subsurf_level_for_object(scene, ob, mmd->lvl, false) :
+                           mmd->lvl;
 }
 
 void multires_set_tot_level(Object *ob, MultiresModifierData *mmd, int lvl)
@@ -99,6 +99,9 @@ void BKE_nlastrip_free(ListBase *strips, NlaStrip *strip, bool do_id_user)
   /* free own F-Modifiers */
   free_fmodifiers(&strip->modifiers);
 
+  /* free cached evaluation result */
+  BKE_nlastrip_eval_cache_free(strip);
+
   /* free the strip itself */
   if (strips) {
     BLI_freelinkN(strips, strip);
@@ -185,6 +188,9 @@ NlaStrip *BKE_nlastrip_copy(Main *bmain,
   strip_d = MEM_dupallocN(strip);
   strip_d->next = strip_d->prev = NULL;
 
+  /* runtime only, the copy evaluates its own */
+  strip_d->eval_cache = NULL;
+
   /* handle action */
   if (strip_d->act) {
     if (use_same_action) {
@@ -2271,6 +2277,9 @@ static void blend_write_nla_strips(BlendWriter *writer, ListBase *strips)
 static void blend_data_read_nla_strips(BlendDataReader *reader, ListBase *strips)
 {
   LISTBASE_FOREACH (NlaStrip *, strip, strips) {
+    /* runtime */
+    strip->eval_cache = NULL;
+
     /* strip's child strips */
     BLO_read_list(reader, &strip->strips);
     blend_data_read_nla_strips(reader, &strip->strips);
@@ -1762,6 +1762,8 @@ void BKE_object_free_derived_caches(Object *ob)
     BKE_geometry_set_free(ob->runtime.geometry_set_eval);
     ob->runtime.geometry_set_eval = NULL;
   }
+
+  BKE_object_modifier_prefix_cache_free(ob);
 }
 
 void BKE_object_free_caches(Object *object)
@@ -2625,7 +2627,8 @@ Object *BKE_object_duplicate(Main *bmain,
 
   Material ***matarar;
 
-  Object *obn = (Object *)BKE_id_copy_for_duplicate(bmain, &ob->id, dupflag);
+  Object *obn = (Object *)BKE_id_copy_for_duplicate(
+      bmain, &ob->id, dupflag, LIB_ID_COPY_DEFAULT);
 
   /* 0 == full linked. */
   if (dupflag == 0) {
@@ -2636,13 +2639,13 @@ Object *BKE_object_duplicate(Main *bmain,
 
   if (dupflag & USER_DUP_MAT) {
     for (int i = 0; i < obn->totcol; i++) {
-      BKE_id_copy_for_duplicate(bmain, (ID *)obn->mat[i], dupflag);
+      BKE_id_copy_for_duplicate(bmain, (ID *)obn->mat[i], dupflag, LIB_ID_COPY_DEFAULT);
     }
   }
   if (dupflag & USER_DUP_PSYS) {
     ParticleSystem *psys;
     for (psys = obn->particlesystem.first; psys; psys = psys->next) {
-      BKE_id_copy_for_duplicate(bmain, (ID *)psys->part, dupflag);
+      BKE_id_copy_for_duplicate(bmain, (ID *)psys->part, dupflag, LIB_ID_COPY_DEFAULT);
     }
   }
 
@@ -2650,80 +2653,90 @@ Object *BKE_object_duplicate(Main *bmain,
   ID *id_new = NULL;
   const bool need_to_duplicate_obdata = (id_old != NULL) && (id_old->newid == NULL);
 
+  /* Ideally obdata would share its CustomData layers with the source here
+   * (#LIB_ID_COPY_CD_REFERENCE), which makes duplicating heavy meshes nearly free: reference
+   * counting of shared layer data handles the life-time, and
+   * #CustomData_duplicate_referenced_layer un-shares a layer before it is written. That works for
+   * evaluated copies because all their write paths are mediated, but with both data-blocks in
+   * Main, code writing through cached DNA pointers (RNA accessors, sculpt/paint...) on *either*
+   * side would modify the still-shared arrays of the other one. Keep eager copies until those
+   * write paths un-share first. */
+  const int obdata_copy_flags = LIB_ID_COPY_DEFAULT;
+
   switch (obn->type) {
     case OB_MESH:
       if (dupflag & USER_DUP_MESH) {
-        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag);
+        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag, obdata_copy_flags);
       }
       break;
     case OB_CURVE:
       if (dupflag & USER_DUP_CURVE) {
-        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag);
+        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag, obdata_copy_flags);
       }
       break;
     case OB_SURF:
       if (dupflag & USER_DUP_SURF) {
-        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag);
+        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag, obdata_copy_flags);
       }
       break;
     case OB_FONT:
       if (dupflag & USER_DUP_FONT) {
-        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag);
+        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag, obdata_copy_flags);
       }
       break;
     case OB_MBALL:
       if (dupflag & USER_DUP_MBALL) {
-        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag);
+        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag, obdata_copy_flags);
       }
       break;
     case OB_LAMP:
       if (dupflag & USER_DUP_LAMP) {
-        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag);
+        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag, obdata_copy_flags);
       }
       break;
     case OB_ARMATURE:
       if (dupflag & USER_DUP_ARM) {
-        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag);
+        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag, obdata_copy_flags);
       }
       break;
     case OB_LATTICE:
       if (dupflag != 0) {
-        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag);
+        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag, obdata_copy_flags);
       }
       break;
     case OB_CAMERA:
       if (dupflag != 0) {
-        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag);
+        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag, obdata_copy_flags);
       }
       break;
     case OB_LIGHTPROBE:
       if (dupflag & USER_DUP_LIGHTPROBE) {
-        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag);
+        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag, obdata_copy_flags);
       }
       break;
     case OB_SPEAKER:
       if (dupflag != 0) {
-        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag);
+        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag, obdata_copy_flags);
       }
       break;
     case OB_GPENCIL:
       if (dupflag & USER_DUP_GPENCIL) {
-        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag);
+        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag, obdata_copy_flags);
       }
       break;
     case OB_HAIR:
       if (dupflag & USER_DUP_HAIR) {
-        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag);
+        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag, obdata_copy_flags);
       }
       break;
     case OB_POINTCLOUD:
       if (dupflag & USER_DUP_POINTCLOUD) {
-        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag);
+        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag, obdata_copy_flags);
       }
       break;
     case OB_VOLUME:
       if (dupflag & USER_DUP_VOLUME) {
-        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag);
+        id_new = BKE_id_copy_for_duplicate(bmain, id_old, dupflag, obdata_copy_flags);
       }
       break;
   }
@@ -2734,7 +2747,7 @@ Object *BKE_object_duplicate(Main *bmain,
       matarar = BKE_object_material_array_p(obn);
       if (matarar) {
         for (int i = 0; i < obn->totcol; i++) {
-          BKE_id_copy_for_duplicate(bmain, (ID *)(*matarar)[i], dupflag);
+          BKE_id_copy_for_duplicate(bmain, (ID *)(*matarar)[i], dupflag, LIB_ID_COPY_DEFAULT);
         }
       }
     }
@@ -3859,6 +3872,64 @@ void BKE_object_boundbox_calc_from_mesh(struct Object *ob, const struct Mesh *me
   ob->runtime.bb->flag &= ~BOUNDBOX_DIRTY;
 }
 
+/**
+ * Estimate which fraction of the camera view is covered by the object's bounds:
+ * 0 when the bounds lie entirely outside the view frustum,
+ * 1 when their projection spans the full view.
+ *
+ * This is a bounding-sphere based approximation intended for coarse level of detail
+ * decisions (see Simplify), not for exact culling.
+ */
+float BKE_object_camera_coverage_estimate(const Object *camera, const Object *ob)
+{
+  const BoundBox *bb = BKE_object_boundbox_get((Object *)ob);
+  if (bb == NULL || camera == NULL || camera->type != OB_CAMERA) {
+    return 1.0f;
+  }
+  const Camera *cam = camera->data;
+
+  /* World space bounding sphere of the object. */
+  float bb_min[3], bb_max[3];
+  INIT_MINMAX(bb_min, bb_max);
+  BKE_boundbox_minmax(bb, ob->obmat, bb_min, bb_max);
+  float center[3];
+  mid_v3_v3v3(center, bb_min, bb_max);
+  const float radius = len_v3v3(center, bb_max);
+
+  /* Offset from the camera, decomposed along the view axis (cameras look along -Z). */
+  float view_dir[3], offset[3], lateral[3];
+  negate_v3_v3(view_dir, camera->obmat[2]);
+  normalize_v3(view_dir);
+  sub_v3_v3v3(offset, center, camera->obmat[3]);
+  const float depth = dot_v3v3(offset, view_dir);
+  madd_v3_v3v3fl(lateral, offset, view_dir, -depth);
+  const float lateral_dist = len_v3(lateral);
+
+  if (cam->type == CAM_ORTHO) {
+    const float half_extent = max_ff(cam->ortho_scale * 0.5f, 1e-6f);
+    /* Use the diagonal extent to stay aspect ratio independent. */
+    if (lateral_dist - radius > half_extent * (float)M_SQRT2) {
+      return 0.0f;
+    }
+    return min_ff(radius / half_extent, 1.0f);
+  }
+
+  if (depth < -radius) {
+    /* Entirely behind the camera. */
+    return 0.0f;
+  }
+
+  const float sensor = max_ff(cam->sensor_x, cam->sensor_y);
+  const float tan_half_fov = max_ff(tanf(focallength_to_fov(cam->lens, sensor) * 0.5f), 1e-6f);
+  /* Conservative frustum test, again using the diagonal extent. */
+  if (lateral_dist - radius > (depth + radius) * tan_half_fov * (float)M_SQRT2) {
+    return 0.0f;
+  }
+
+  const float dist = max_ff(depth, radius);
+  return min_ff(radius / (dist * tan_half_fov), 1.0f);
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -5122,6 +5193,7 @@ void BKE_object_runtime_reset_on_copy(Object *object, const int UNUSED(flag))
   runtime->object_as_temp_mesh = NULL;
   runtime->object_as_temp_curve = NULL;
   runtime->geometry_set_eval = NULL;
+  runtime->modifier_prefix_cache = NULL;
 }
 
 /**
@@ -439,10 +439,11 @@ static void ocean_compute_htilda(void *__restrict userdata,
     fftw_complex exp_param2;
     fftw_complex conj_param;
 
+    /* `e^(-i*w*t)` is the conjugate of `e^(i*w*t)` (the argument is purely imaginary),
+     * saving an #omega and an #exp_complex evaluation per element. */
     init_complex(exp_param1, 0.0, omega(o->_k[i * (1 + o->_N / 2) + j], o->_depth) * t);
-    init_complex(exp_param2, 0.0, -omega(o->_k[i * (1 + o->_N / 2) + j], o->_depth) * t);
     exp_complex(exp_param1, exp_param1);
-    exp_complex(exp_param2, exp_param2);
+    conj_complex(exp_param2, exp_param1);
     conj_complex(conj_param, o->_h0_minus[i * o->_N + j]);
 
     mul_complex_c(exp_param1, o->_h0[i * o->_N + j], exp_param1);
@@ -467,18 +468,17 @@ static void ocean_compute_displacement_x(TaskPool *__restrict pool, void *UNUSED
   const Ocean *o = osd->o;
   const float scale = osd->scale;
   const float chop_amount = osd->chop_amount;
+  fftw_complex mul_param_base;
   int i, j;
 
+  /* `((-scale, 0) * chop_amount) * -i`, loop invariant. */
+  init_complex(mul_param_base, 0.0, scale * chop_amount);
+
   for (i = 0; i < o->_M; i++) {
     for (j = 0; j <= o->_N / 2; j++) {
       fftw_complex mul_param;
-      fftw_complex minus_i;
 
-      init_complex(minus_i, 0.0, -1.0);
-      init_complex(mul_param, -scale, 0);
-      mul_complex_f(mul_param, mul_param, chop_amount);
-      mul_complex_c(mul_param, mul_param, minus_i);
-      mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
+      mul_complex_c(mul_param, mul_param_base, o->_htilda[i * (1 + o->_N / 2) + j]);
       mul_complex_f(mul_param,
                     mul_param,
                     ((o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
@@ -496,18 +496,17 @@ static void ocean_compute_displacement_z(TaskPool *__restrict pool, void *UNUSED
   const Ocean *o = osd->o;
   const float scale = osd->scale;
   const float chop_amount = osd->chop_amount;
+  fftw_complex mul_param_base;
   int i, j;
 
+  /* `((-scale, 0) * chop_amount) * -i`, loop invariant. */
+  init_complex(mul_param_base, 0.0, scale * chop_amount);
+
   for (i = 0; i < o->_M; i++) {
     for (j = 0; j <= o->_N / 2; j++) {
       fftw_complex mul_param;
-      fftw_complex minus_i;
 
-      init_complex(minus_i, 0.0, -1.0);
-      init_complex(mul_param, -scale, 0);
-      mul_complex_f(mul_param, mul_param, chop_amount);
-      mul_complex_c(mul_param, mul_param, minus_i);
-      mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
+      mul_complex_c(mul_param, mul_param_base, o->_htilda[i * (1 + o->_N / 2) + j]);
       mul_complex_f(mul_param,
                     mul_param,
                     ((o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
@@ -528,19 +527,14 @@ static void ocean_compute_jacobian_jxx(TaskPool *__restrict pool, void *UNUSED(t
 
   for (i = 0; i < o->_M; i++) {
     for (j = 0; j <= o->_N / 2; j++) {
-      fftw_complex mul_param;
-
-      /* init_complex(mul_param, -scale, 0); */
-      init_complex(mul_param, -1, 0);
-
-      mul_complex_f(mul_param, mul_param, chop_amount);
-      mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
-      mul_complex_f(mul_param,
-                    mul_param,
-                    ((o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
-                         0.0f :
-                         o->_kx[i] * o->_kx[i] / o->_k[i * (1 + o->_N / 2) + j]));
-      init_complex(o->_fft_in_jxx[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
+      /* The multiplier is purely real, `(-1, 0) * chop_amount * (kx * kx / k)`. */
+      const float mul_param = (o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
+                                  0.0f :
+                                  -chop_amount * o->_kx[i] * o->_kx[i] /
+                                      o->_k[i * (1 + o->_N / 2) + j];
+      mul_complex_f(o->_fft_in_jxx[i * (1 + o->_N / 2) + j],
+                    o->_htilda[i * (1 + o->_N / 2) + j],
+                    mul_param);
     }
   }
   fftw_execute(o->_Jxx_plan);
@@ -561,19 +555,14 @@ static void ocean_compute_jacobian_jzz(TaskPool *__restrict pool, void *UNUSED(t
 
   for (i = 0; i < o->_M; i++) {
     for (j = 0; j <= o->_N / 2; j++) {
-      fftw_complex mul_param;
-
-      /* init_complex(mul_param, -scale, 0); */
-      init_complex(mul_param, -1, 0);
-
-      mul_complex_f(mul_param, mul_param, chop_amount);
-      mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
-      mul_complex_f(mul_param,
-                    mul_param,
-                    ((o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
-                         0.0f :
-                         o->_kz[j] * o->_kz[j] / o->_k[i * (1 + o->_N / 2) + j]));
-      init_complex(o->_fft_in_jzz[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
+      /* The multiplier is purely real, `(-1, 0) * chop_amount * (kz * kz / k)`. */
+      const float mul_param = (o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
+                                  0.0f :
+                                  -chop_amount * o->_kz[j] * o->_kz[j] /
+                                      o->_k[i * (1 + o->_N / 2) + j];
+      mul_complex_f(o->_fft_in_jzz[i * (1 + o->_N / 2) + j],
+                    o->_htilda[i * (1 + o->_N / 2) + j],
+                    mul_param);
     }
   }
   fftw_execute(o->_Jzz_plan);
@@ -594,19 +583,14 @@ static void ocean_compute_jacobian_jxz(TaskPool *__restrict pool, void *UNUSED(t
 
   for (i = 0; i < o->_M; i++) {
     for (j = 0; j <= o->_N / 2; j++) {
-      fftw_complex mul_param;
-
-      /* init_complex(mul_param, -scale, 0); */
-      init_complex(mul_param, -1, 0);
-
-      mul_complex_f(mul_param, mul_param, chop_amount);
-      mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
-      mul_complex_f(mul_param,
-                    mul_param,
-                    ((o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
-                         0.0f :
-                         o->_kx[i] * o->_kz[j] / o->_k[i * (1 + o->_N / 2) + j]));
-      init_complex(o->_fft_in_jxz[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
+      /* The multiplier is purely real, `(-1, 0) * chop_amount * (kx * kz / k)`. */
+      const float mul_param = (o->_k[i * (1 + o->_N / 2) + j] == 0.0f) ?
+                                  0.0f :
+                                  -chop_amount * o->_kx[i] * o->_kz[j] /
+                                      o->_k[i * (1 + o->_N / 2) + j];
+      mul_complex_f(o->_fft_in_jxz[i * (1 + o->_N / 2) + j],
+                    o->_htilda[i * (1 + o->_N / 2) + j],
+                    mul_param);
     }
   }
   fftw_execute(o->_Jxz_plan);
@@ -616,14 +600,16 @@ static void ocean_compute_normal_x(TaskPool *__restrict pool, void *UNUSED(taskd
 {
   OceanSimulateData *osd = BLI_task_pool_user_data(pool);
   const Ocean *o = osd->o;
+  fftw_complex minus_i;
   int i, j;
 
+  init_complex(minus_i, 0.0, -1.0);
+
   for (i = 0; i < o->_M; i++) {
     for (j = 0; j <= o->_N / 2; j++) {
       fftw_complex mul_param;
 
-      init_complex(mul_param, 0.0, -1.0);
-      mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
+      mul_complex_c(mul_param, minus_i, o->_htilda[i * (1 + o->_N / 2) + j]);
       mul_complex_f(mul_param, mul_param, o->_kx[i]);
       init_complex(o->_fft_in_nx[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
     }
@@ -635,14 +621,16 @@ static void ocean_compute_normal_z(TaskPool *__restrict pool, void *UNUSED(taskd
 {
   OceanSimulateData *osd = BLI_task_pool_user_data(pool);
   const Ocean *o = osd->o;
+  fftw_complex minus_i;
   int i, j;
 
+  init_complex(minus_i, 0.0, -1.0);
+
   for (i = 0; i < o->_M; i++) {
     for (j = 0; j <= o->_N / 2; j++) {
       fftw_complex mul_param;
 
-      init_complex(mul_param, 0.0, -1.0);
-      mul_complex_c(mul_param, mul_param, o->_htilda[i * (1 + o->_N / 2) + j]);
+      mul_complex_c(mul_param, minus_i, o->_htilda[i * (1 + o->_N / 2) + j]);
       mul_complex_f(mul_param, mul_param, o->_kz[i]);
       init_complex(o->_fft_in_nz[i * (1 + o->_N / 2) + j], real_c(mul_param), image_c(mul_param));
     }
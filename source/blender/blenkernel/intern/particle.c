@@ -1274,7 +1274,8 @@ static void get_pointcache_keys_for_time(Object *UNUSED(ob),
                                          ParticleKey *key1,
                                          ParticleKey *key2)
 {
-  static PTCacheMem *pm = NULL;
+  /* Keep this local: paths of multiple particles are interpolated from threads at once. */
+  PTCacheMem *pm = NULL;
   int index1, index2;
 
   if (index < 0) { /* initialize */
@@ -3273,223 +3274,277 @@ static void cache_key_incremental_rotation(ParticleCacheKey *key0,
  * - Useful for making use of opengl vertex arrays for super fast strand drawing.
  * - Makes child strands possible and creates them too into the cache.
  * - Cached path data is also used to determine cut position for the editmode tool. */
-void psys_cache_paths(ParticleSimulationData *sim, float cfra, const bool use_render_params)
+typedef struct CachePathsIterData {
+  ParticleSimulationData *sim;
+  ParticleCacheKey **cache;
+  struct Mesh *hair_mesh;
+  float cfra;
+  int segments;
+  int keyed;
+  int baked;
+  float col[4];
+  float *vg_effector;
+  float *vg_length;
+} CachePathsIterData;
+
+static void psys_cache_paths_iter(void *__restrict iter_data_v,
+                                  const int p,
+                                  const TaskParallelTLS *__restrict UNUSED(tls))
 {
+  CachePathsIterData *iter_data = (CachePathsIterData *)iter_data_v;
+  ParticleSimulationData *sim = iter_data->sim;
   PARTICLE_PSMD;
-  ParticleEditSettings *pset = &sim->scene->toolsettings->particle;
   ParticleSystem *psys = sim->psys;
   ParticleSettings *part = psys->part;
-  ParticleCacheKey *ca, **cache;
-
-  Mesh *hair_mesh = (psys->part->type == PART_HAIR && psys->flag & PSYS_HAIR_DYNAMICS) ?
-                        psys->hair_out_mesh :
-                        NULL;
+  ParticleData *pa = &psys->particles[p];
+  ParticleCacheKey *ca, **cache = iter_data->cache;
+  Mesh *hair_mesh = iter_data->hair_mesh;
+  const int segments = iter_data->segments;
+  const int keyed = iter_data->keyed;
+  const int baked = iter_data->baked;
 
   ParticleKey result;
-
-  Material *ma;
   ParticleInterpolationData pind;
   ParticleTexture ptex;
 
-  PARTICLE_P;
-
   float birthtime = 0.0, dietime = 0.0;
   float t, time = 0.0, dfra = 1.0 /* , frs_sec = sim->scene->r.frs_sec*/ /*UNUSED*/;
-  float col[4] = {0.5f, 0.5f, 0.5f, 1.0f};
   float prev_tangent[3] = {0.0f, 0.0f, 0.0f}, hairmat[4][4];
   float rotmat[3][3];
   int k;
-  int segments = (int)pow(2.0, (double)((use_render_params) ? part->ren_step : part->draw_step));
-  int totpart = psys->totpart;
   float length, vec[3];
-  float *vg_effector = NULL;
-  float *vg_length = NULL, pa_length = 1.0f;
-  int keyed, baked;
+  float pa_length = 1.0f;
 
-  /* we don't have anything valid to create paths from so let's quit here */
-  if ((psys->flag & PSYS_HAIR_DONE || psys->flag & PSYS_KEYED || psys->pointcache) == 0) {
-    return;
-  }
-
-  if (psys_in_edit_mode(sim->depsgraph, psys)) {
-    if ((psys->edit == NULL || pset->flag & PE_DRAW_PART) == 0) {
-      return;
+  if (!psys->totchild) {
+    psys_get_texture(sim, pa, &ptex, PAMAP_LENGTH, 0.0f);
+    pa_length = ptex.length * (1.0f - part->randlength * psys_frand(psys, psys->seed + p));
+    if (iter_data->vg_length) {
+      pa_length *= psys_particle_value_from_verts(
+          psmd->mesh_final, part->from, pa, iter_data->vg_length);
     }
   }
 
-  keyed = psys->flag & PSYS_KEYED;
-  baked = psys->pointcache->mem_cache.first && psys->part->type != PART_HAIR;
+  pind.keyed = keyed;
+  pind.cache = baked ? psys->pointcache : NULL;
+  pind.epoint = NULL;
+  pind.bspline = (psys->part->flag & PART_HAIR_BSPLINE);
+  pind.mesh = hair_mesh;
 
-  /* clear out old and create new empty path cache */
-  psys_free_path_cache(psys, psys->edit);
-  cache = psys->pathcache = psys_alloc_path_cache_buffers(
-      &psys->pathcachebufs, totpart, segments + 1);
+  memset(cache[p], 0, sizeof(*cache[p]) * (segments + 1));
 
-  psys->lattice_deform_data = psys_create_lattice_deform_data(sim);
-  ma = BKE_object_material_get(sim->ob, psys->part->omat);
-  if (ma && (psys->part->draw_col == PART_DRAW_COL_MAT)) {
-    copy_v3_v3(col, &ma->r);
-  }
+  cache[p]->segments = segments;
 
-  if ((psys->flag & PSYS_GLOBAL_HAIR) == 0) {
-    if ((psys->part->flag & PART_CHILD_EFFECT) == 0) {
-      vg_effector = psys_cache_vgroup(psmd->mesh_final, psys, PSYS_VG_EFFECTOR);
-    }
+  /*--get the first data points--*/
+  init_particle_interpolation(sim->ob, sim->psys, pa, &pind);
 
-    if (!psys->totchild) {
-      vg_length = psys_cache_vgroup(psmd->mesh_final, psys, PSYS_VG_LENGTH);
-    }
-  }
+  /* 'hairmat' is needed for non-hair particle too so we get proper rotations. */
+  psys_mat_hair_to_global(sim->ob, psmd->mesh_final, psys->part->from, pa, hairmat);
+  copy_v3_v3(rotmat[0], hairmat[2]);
+  copy_v3_v3(rotmat[1], hairmat[1]);
+  copy_v3_v3(rotmat[2], hairmat[0]);
 
-  /* ensure we have tessfaces to be used for mapping */
-  if (part->from != PART_FROM_VERT) {
-    BKE_mesh_tessface_ensure(psmd->mesh_final);
+  if (part->draw & PART_ABS_PATH_TIME) {
+    birthtime = MAX2(pind.birthtime, part->path_start);
+    dietime = MIN2(pind.dietime, part->path_end);
+  }
+  else {
+    float tb = pind.birthtime;
+    birthtime = tb + part->path_start * (pind.dietime - tb);
+    dietime = tb + part->path_end * (pind.dietime - tb);
   }
 
-  /*---first main loop: create all actual particles' paths---*/
-  LOOP_PARTICLES
-  {
-    if (!psys->totchild) {
-      psys_get_texture(sim, pa, &ptex, PAMAP_LENGTH, 0.0f);
-      pa_length = ptex.length * (1.0f - part->randlength * psys_frand(psys, psys->seed + p));
-      if (vg_length) {
-        pa_length *= psys_particle_value_from_verts(psmd->mesh_final, part->from, pa, vg_length);
-      }
-    }
+  if (birthtime >= dietime) {
+    cache[p]->segments = -1;
+    return;
+  }
 
-    pind.keyed = keyed;
-    pind.cache = baked ? psys->pointcache : NULL;
-    pind.epoint = NULL;
-    pind.bspline = (psys->part->flag & PART_HAIR_BSPLINE);
-    pind.mesh = hair_mesh;
+  dietime = birthtime + pa_length * (dietime - birthtime);
 
-    memset(cache[p], 0, sizeof(*cache[p]) * (segments + 1));
+  /*--interpolate actual path from data points--*/
+  for (k = 0, ca = cache[p]; k <= segments; k++, ca++) {
+    time = (float)k / (float)segments;
+    t = birthtime + time * (dietime - birthtime);
+    result.time = -t;
+    do_particle_interpolation(psys, p, pa, t, &pind, &result);
+    copy_v3_v3(ca->co, result.co);
 
-    cache[p]->segments = segments;
+    /* dynamic hair is in object space */
+    /* keyed and baked are already in global space */
+    if (hair_mesh) {
+      mul_m4_v3(sim->ob->obmat, ca->co);
+    }
+    else if (!keyed && !baked && !(psys->flag & PSYS_GLOBAL_HAIR)) {
+      mul_m4_v3(hairmat, ca->co);
+    }
 
-    /*--get the first data points--*/
-    init_particle_interpolation(sim->ob, sim->psys, pa, &pind);
+    copy_v3_v3(ca->col, iter_data->col);
+  }
 
-    /* 'hairmat' is needed for non-hair particle too so we get proper rotations. */
-    psys_mat_hair_to_global(sim->ob, psmd->mesh_final, psys->part->from, pa, hairmat);
-    copy_v3_v3(rotmat[0], hairmat[2]);
-    copy_v3_v3(rotmat[1], hairmat[1]);
-    copy_v3_v3(rotmat[2], hairmat[0]);
+  if (part->type == PART_HAIR) {
+    HairKey *hkey;
 
-    if (part->draw & PART_ABS_PATH_TIME) {
-      birthtime = MAX2(pind.birthtime, part->path_start);
-      dietime = MIN2(pind.dietime, part->path_end);
-    }
-    else {
-      float tb = pind.birthtime;
-      birthtime = tb + part->path_start * (pind.dietime - tb);
-      dietime = tb + part->path_end * (pind.dietime - tb);
+    for (k = 0, hkey = pa->hair; k < pa->totkey; k++, hkey++) {
+      mul_v3_m4v3(hkey->world_co, hairmat, hkey->co);
     }
+  }
 
-    if (birthtime >= dietime) {
-      cache[p]->segments = -1;
-      continue;
-    }
+  /*--modify paths and calculate rotation & velocity--*/
 
-    dietime = birthtime + pa_length * (dietime - birthtime);
+  if (!(psys->flag & PSYS_GLOBAL_HAIR)) {
+    /* apply effectors */
+    if ((psys->part->flag & PART_CHILD_EFFECT) == 0) {
+      float effector = 1.0f;
+      if (iter_data->vg_effector) {
+        effector *= psys_particle_value_from_verts(
+            psmd->mesh_final, psys->part->from, pa, iter_data->vg_effector);
+      }
 
-    /*--interpolate actual path from data points--*/
-    for (k = 0, ca = cache[p]; k <= segments; k++, ca++) {
-      time = (float)k / (float)segments;
-      t = birthtime + time * (dietime - birthtime);
-      result.time = -t;
-      do_particle_interpolation(psys, p, pa, t, &pind, &result);
-      copy_v3_v3(ca->co, result.co);
+      sub_v3_v3v3(vec, (cache[p] + 1)->co, cache[p]->co);
+      length = len_v3(vec);
 
-      /* dynamic hair is in object space */
-      /* keyed and baked are already in global space */
-      if (hair_mesh) {
-        mul_m4_v3(sim->ob->obmat, ca->co);
+      for (k = 1, ca = cache[p] + 1; k <= segments; k++, ca++) {
+        do_path_effectors(sim,
+                          p,
+                          ca,
+                          k,
+                          segments,
+                          cache[p]->co,
+                          effector,
+                          dfra,
+                          iter_data->cfra,
+                          &length,
+                          vec);
       }
-      else if (!keyed && !baked && !(psys->flag & PSYS_GLOBAL_HAIR)) {
-        mul_m4_v3(hairmat, ca->co);
+    }
+
+    /* apply guide curves to path data */
+    if (sim->psys->effectors && (psys->part->flag & PART_CHILD_EFFECT) == 0) {
+      for (k = 0, ca = cache[p]; k <= segments; k++, ca++) {
+        /* ca is safe to cast, since only co and vel are used */
+        do_guides(sim->depsgraph,
+                  sim->psys->part,
+                  sim->psys->effectors,
+                  (ParticleKey *)ca,
+                  p,
+                  (float)k / (float)segments);
       }
+    }
 
-      copy_v3_v3(ca->col, col);
+    /* lattices have to be calculated separately to avoid mixups between effector calculations */
+    if (psys->lattice_deform_data) {
+      for (k = 0, ca = cache[p]; k <= segments; k++, ca++) {
+        BKE_lattice_deform_data_eval_co(psys->lattice_deform_data, ca->co, psys->lattice_strength);
+      }
     }
+  }
 
-    if (part->type == PART_HAIR) {
-      HairKey *hkey;
+  /* finally do rotation & velocity */
+  for (k = 1, ca = cache[p] + 1; k <= segments; k++, ca++) {
+    cache_key_incremental_rotation(ca, ca - 1, ca - 2, prev_tangent, k);
 
-      for (k = 0, hkey = pa->hair; k < pa->totkey; k++, hkey++) {
-        mul_v3_m4v3(hkey->world_co, hairmat, hkey->co);
-      }
+    if (k == segments) {
+      copy_qt_qt(ca->rot, (ca - 1)->rot);
     }
 
-    /*--modify paths and calculate rotation & velocity--*/
+    /* set velocity */
+    sub_v3_v3v3(ca->vel, ca->co, (ca - 1)->co);
 
-    if (!(psys->flag & PSYS_GLOBAL_HAIR)) {
-      /* apply effectors */
-      if ((psys->part->flag & PART_CHILD_EFFECT) == 0) {
-        float effector = 1.0f;
-        if (vg_effector) {
-          effector *= psys_particle_value_from_verts(
-              psmd->mesh_final, psys->part->from, pa, vg_effector);
-        }
+    if (k == 1) {
+      copy_v3_v3((ca - 1)->vel, ca->vel);
+    }
 
-        sub_v3_v3v3(vec, (cache[p] + 1)->co, cache[p]->co);
-        length = len_v3(vec);
+    ca->time = (float)k / (float)segments;
+  }
+  /* First rotation is based on emitting face orientation.
+   * This is way better than having flipping rotations resulting
+   * from using a global axis as a rotation pole (vec_to_quat()).
+   * It's not an ideal solution though since it disregards the
+   * initial tangent, but taking that in to account will allow
+   * the possibility of flipping again. -jahka
+   */
+  mat3_to_quat_is_ok(cache[p]->rot, rotmat);
+}
 
-        for (k = 1, ca = cache[p] + 1; k <= segments; k++, ca++) {
-          do_path_effectors(
-              sim, p, ca, k, segments, cache[p]->co, effector, dfra, cfra, &length, vec);
-        }
-      }
+void psys_cache_paths(ParticleSimulationData *sim, float cfra, const bool use_render_params)
+{
+  PARTICLE_PSMD;
+  ParticleEditSettings *pset = &sim->scene->toolsettings->particle;
+  ParticleSystem *psys = sim->psys;
+  ParticleSettings *part = psys->part;
+  ParticleCacheKey **cache;
 
-      /* apply guide curves to path data */
-      if (sim->psys->effectors && (psys->part->flag & PART_CHILD_EFFECT) == 0) {
-        for (k = 0, ca = cache[p]; k <= segments; k++, ca++) {
-          /* ca is safe to cast, since only co and vel are used */
-          do_guides(sim->depsgraph,
-                    sim->psys->part,
-                    sim->psys->effectors,
-                    (ParticleKey *)ca,
-                    p,
-                    (float)k / (float)segments);
-        }
-      }
+  Mesh *hair_mesh = (psys->part->type == PART_HAIR && psys->flag & PSYS_HAIR_DYNAMICS) ?
+                        psys->hair_out_mesh :
+                        NULL;
 
-      /* lattices have to be calculated separately to avoid mixups between effector calculations */
-      if (psys->lattice_deform_data) {
-        for (k = 0, ca = cache[p]; k <= segments; k++, ca++) {
-          BKE_lattice_deform_data_eval_co(
-              psys->lattice_deform_data, ca->co, psys->lattice_strength);
-        }
-      }
+  Material *ma;
+
+  int segments = (int)pow(2.0, (double)((use_render_params) ? part->ren_step : part->draw_step));
+  int totpart = psys->totpart;
+  float *vg_effector = NULL;
+  float *vg_length = NULL;
+  int keyed, baked;
+
+  /* we don't have anything valid to create paths from so let's quit here */
+  if ((psys->flag & PSYS_HAIR_DONE || psys->flag & PSYS_KEYED || psys->pointcache) == 0) {
+    return;
+  }
+
+  if (psys_in_edit_mode(sim->depsgraph, psys)) {
+    if ((psys->edit == NULL || pset->flag & PE_DRAW_PART) == 0) {
+      return;
     }
+  }
 
-    /* finally do rotation & velocity */
-    for (k = 1, ca = cache[p] + 1; k <= segments; k++, ca++) {
-      cache_key_incremental_rotation(ca, ca - 1, ca - 2, prev_tangent, k);
+  keyed = psys->flag & PSYS_KEYED;
+  baked = psys->pointcache->mem_cache.first && psys->part->type != PART_HAIR;
 
-      if (k == segments) {
-        copy_qt_qt(ca->rot, (ca - 1)->rot);
-      }
+  /* clear out old and create new empty path cache */
+  psys_free_path_cache(psys, psys->edit);
+  cache = psys->pathcache = psys_alloc_path_cache_buffers(
+      &psys->pathcachebufs, totpart, segments + 1);
 
-      /* set velocity */
-      sub_v3_v3v3(ca->vel, ca->co, (ca - 1)->co);
+  psys->lattice_deform_data = psys_create_lattice_deform_data(sim);
 
-      if (k == 1) {
-        copy_v3_v3((ca - 1)->vel, ca->vel);
-      }
+  CachePathsIterData iter_data;
+  iter_data.sim = sim;
+  iter_data.cache = cache;
+  iter_data.hair_mesh = hair_mesh;
+  iter_data.cfra = cfra;
+  iter_data.segments = segments;
+  iter_data.keyed = keyed;
+  iter_data.baked = baked;
+  copy_v4_fl4(iter_data.col, 0.5f, 0.5f, 0.5f, 1.0f);
+  iter_data.vg_effector = NULL;
+  iter_data.vg_length = NULL;
+
+  ma = BKE_object_material_get(sim->ob, psys->part->omat);
+  if (ma && (psys->part->draw_col == PART_DRAW_COL_MAT)) {
+    copy_v3_v3(iter_data.col, &ma->r);
+  }
+
+  if ((psys->flag & PSYS_GLOBAL_HAIR) == 0) {
+    if ((psys->part->flag & PART_CHILD_EFFECT) == 0) {
+      vg_effector = iter_data.vg_effector = psys_cache_vgroup(
+          psmd->mesh_final, psys, PSYS_VG_EFFECTOR);
+    }
 
-      ca->time = (float)k / (float)segments;
+    if (!psys->totchild) {
+      vg_length = iter_data.vg_length = psys_cache_vgroup(
+          psmd->mesh_final, psys, PSYS_VG_LENGTH);
     }
-    /* First rotation is based on emitting face orientation.
-     * This is way better than having flipping rotations resulting
-     * from using a global axis as a rotation pole (vec_to_quat()).
-     * It's not an ideal solution though since it disregards the
-     * initial tangent, but taking that in to account will allow
-     * the possibility of flipping again. -jahka
-     */
-    mat3_to_quat_is_ok(cache[p]->rot, rotmat);
   }
 
+  /* ensure we have tessfaces to be used for mapping */
+  if (part->from != PART_FROM_VERT) {
+    BKE_mesh_tessface_ensure(psmd->mesh_final);
+  }
+
+  /*---create all actual particles' paths, each particle is independent---*/
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  BLI_task_parallel_range(0, totpart, &iter_data, psys_cache_paths_iter, &settings);
+
   psys->totcached = totpart;
 
   if (psys->lattice_deform_data) {
@@ -3758,6 +3758,67 @@ static void dynamics_step_sph_ddr_task_cb_ex(void *__restrict userdata,
   }
 }
 
+static void dynamics_step_newton_task_cb_ex(void *__restrict userdata,
+                                            const int p,
+                                            const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  DynamicStepSolverTaskData *data = userdata;
+  ParticleSimulationData *sim = data->sim;
+  ParticleSystem *psys = sim->psys;
+  ParticleSettings *part = psys->part;
+
+  ParticleData *pa;
+
+  if ((pa = psys->particles + p)->state.time <= 0.0f) {
+    return;
+  }
+
+  /* do global forces & effectors */
+  basic_integrate(sim, p, pa->state.time, data->cfra);
+
+  /* deflection */
+  if (sim->colliders) {
+    collision_check(sim, p, pa->state.time, data->cfra);
+  }
+
+  /* rotations */
+  basic_rotate(part, pa, pa->state.time, data->timestep);
+}
+
+typedef struct BoidsStepTask {
+  BoidBrainData bbd;
+  int begin, end;
+} BoidsStepTask;
+
+static void exec_boids_step(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  BoidsStepTask *task = taskdata;
+  BoidBrainData *bbd = &task->bbd;
+  ParticleSimulationData *sim = bbd->sim;
+  ParticleSystem *psys = sim->psys;
+  ParticleData *pa;
+  int p;
+
+  for (p = task->begin; p < task->end; p++) {
+    if ((pa = psys->particles + p)->state.time <= 0.0f) {
+      continue;
+    }
+
+    bbd->goal_ob = NULL;
+
+    boid_brain(bbd, p, pa);
+
+    if (pa->alive != PARS_DYING) {
+      boid_body(bbd, pa);
+
+      /* deflection */
+      if (sim->colliders) {
+        collision_check(sim, p, pa->state.time, bbd->cfra);
+      }
+    }
+  }
+}
+
 static void dynamics_step_sph_classical_basic_integrate_task_cb_ex(
     void *__restrict userdata, const int p, const TaskParallelTLS *__restrict UNUSED(tls))
 {
@@ -3953,36 +4014,51 @@ static void dynamics_step(ParticleSimulationData *sim, float cfra)
 
   switch (part->phystype) {
     case PART_PHYS_NEWTON: {
-      LOOP_DYNAMIC_PARTICLES
-      {
-        /* do global forces & effectors */
-        basic_integrate(sim, p, pa->state.time, cfra);
-
-        /* deflection */
-        if (sim->colliders) {
-          collision_check(sim, p, pa->state.time, cfra);
-        }
+      /* Particles only read their own state and the shared (read-only) effector and collider
+       * caches here, just as in the SPH solvers below, so each one can be stepped on its own. */
+      DynamicStepSolverTaskData task_data = {
+          .sim = sim,
+          .cfra = cfra,
+          .timestep = timestep,
+          .dtime = dtime,
+      };
 
-        /* rotations */
-        basic_rotate(part, pa, pa->state.time, timestep);
-      }
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      settings.use_threading = (psys->totpart > 100);
+      BLI_task_parallel_range(
+          0, psys->totpart, &task_data, dynamics_step_newton_task_cb_ex, &settings);
       break;
     }
     case PART_PHYS_BOIDS: {
-      LOOP_DYNAMIC_PARTICLES
-      {
-        bbd.goal_ob = NULL;
-
-        boid_brain(&bbd, p, pa);
+      /* Rules only read other boids through prev_state and the kd-tree frozen at step start, so
+       * boids can be stepped in parallel. Each task gets its own brain data and its own RNG; all
+       * RNGs use the step seed, like psys_task_init_path does for distribution tasks. */
+      int numtasks = min_ii(BLI_system_thread_count() * 4, psys->totpart);
+
+      if (numtasks > 0) {
+        TaskPool *task_pool = BLI_task_pool_create(NULL, TASK_PRIORITY_LOW);
+        BoidsStepTask *tasks = MEM_callocN(sizeof(BoidsStepTask) * numtasks, "BoidsStepTask");
+        int particles_per_task = psys->totpart / numtasks;
+        int remainder = psys->totpart - particles_per_task * numtasks;
+        int i, begin = 0;
+
+        for (i = 0; i < numtasks; i++) {
+          tasks[i].bbd = bbd;
+          tasks[i].bbd.rng = BLI_rng_new_srandom(31415926 + (int)cfra + psys->seed);
+          tasks[i].begin = begin;
+          begin += particles_per_task + (i < remainder ? 1 : 0);
+          tasks[i].end = begin;
+          BLI_task_pool_push(task_pool, exec_boids_step, &tasks[i], false, NULL);
+        }
 
-        if (pa->alive != PARS_DYING) {
-          boid_body(&bbd, pa);
+        BLI_task_pool_work_and_wait(task_pool);
+        BLI_task_pool_free(task_pool);
 
-          /* deflection */
-          if (sim->colliders) {
-            collision_check(sim, p, pa->state.time, cfra);
-          }
+        for (i = 0; i < numtasks; i++) {
+          BLI_rng_free(tasks[i].bbd.rng);
         }
+        MEM_freeN(tasks);
       }
       break;
     }
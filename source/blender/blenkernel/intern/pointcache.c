@@ -47,6 +47,7 @@
 #include "BLI_endian_switch.h"
 #include "BLI_math.h"
 #include "BLI_string.h"
+#include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -1939,9 +1940,124 @@ static void ptcache_find_frames_around(PTCacheID *pid, unsigned int frame, int *
   }
 }
 
+/* Asynchronous disk cache writing.
+ *
+ * While baking, frame compression and file I/O run on a dedicated writer thread so the
+ * simulation can start on the next frame without waiting on the disk. The queue is kept
+ * shallow (double buffering): the bake thread only runs a couple of frames ahead of the
+ * writer, which bounds the extra memory use. All read and clear paths drain the queue first,
+ * so readers always see a consistent cache. */
+
+static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm);
+
+typedef struct PTCacheAsyncWrite {
+  PTCacheID pid;
+  PTCacheMem *pm;
+} PTCacheAsyncWrite;
+
+#define PTCACHE_ASYNC_WRITE_PENDING_MAX 2
+
+static ThreadQueue *ptcache_write_queue = NULL;
+static ListBase ptcache_writer_threads = {NULL, NULL};
+static ThreadMutex ptcache_write_mutex = BLI_MUTEX_INITIALIZER;
+static ThreadCondition ptcache_write_cond;
+static int ptcache_write_pending = 0;
+
+static void *ptcache_async_writer(void *UNUSED(arg))
+{
+  PTCacheAsyncWrite *task;
+
+  while ((task = BLI_thread_queue_pop(ptcache_write_queue))) {
+    ptcache_mem_frame_to_disk(&task->pid, task->pm);
+    ptcache_mem_clear(task->pm);
+    MEM_freeN(task->pm);
+    MEM_freeN(task);
+
+    BLI_mutex_lock(&ptcache_write_mutex);
+    ptcache_write_pending--;
+    BLI_condition_notify_all(&ptcache_write_cond);
+    BLI_mutex_unlock(&ptcache_write_mutex);
+  }
+
+  return NULL;
+}
+
+/* Wait until all queued frames have reached the disk. */
+static void ptcache_async_write_flush(void)
+{
+  if (ptcache_write_queue == NULL) {
+    return;
+  }
+
+  BLI_mutex_lock(&ptcache_write_mutex);
+  while (ptcache_write_pending > 0) {
+    BLI_condition_wait(&ptcache_write_cond, &ptcache_write_mutex);
+  }
+  BLI_mutex_unlock(&ptcache_write_mutex);
+}
+
+static void ptcache_async_write_begin(void)
+{
+  BLI_assert(ptcache_write_queue == NULL);
+
+  BLI_condition_init(&ptcache_write_cond);
+  ptcache_write_queue = BLI_thread_queue_init();
+  BLI_threadpool_init(&ptcache_writer_threads, ptcache_async_writer, 1);
+  BLI_threadpool_insert(&ptcache_writer_threads, NULL);
+}
+
+static void ptcache_async_write_end(void)
+{
+  if (ptcache_write_queue == NULL) {
+    return;
+  }
+
+  ptcache_async_write_flush();
+
+  BLI_thread_queue_nowait(ptcache_write_queue);
+  BLI_threadpool_end(&ptcache_writer_threads);
+
+  ThreadQueue *queue = ptcache_write_queue;
+  ptcache_write_queue = NULL;
+  BLI_thread_queue_free(queue);
+  BLI_condition_end(&ptcache_write_cond);
+}
+
+/* Take ownership of pm and schedule it for writing. Returns false when no writer thread is
+ * active, in which case the caller has to write synchronously. */
+static bool ptcache_mem_frame_to_disk_async(PTCacheID *pid, PTCacheMem *pm)
+{
+  if (ptcache_write_queue == NULL) {
+    return false;
+  }
+
+  /* Unlink a possible stale file for this frame on the bake thread, so the writer thread
+   * itself never has to interact with BKE_ptcache_id_clear (which drains the queue). */
+  BKE_ptcache_id_clear(pid, PTCACHE_CLEAR_FRAME, pm->frame);
+
+  PTCacheAsyncWrite *task = MEM_callocN(sizeof(PTCacheAsyncWrite), "PTCacheAsyncWrite");
+  task->pid = *pid;
+  task->pm = pm;
+
+  BLI_mutex_lock(&ptcache_write_mutex);
+  while (ptcache_write_pending >= PTCACHE_ASYNC_WRITE_PENDING_MAX) {
+    BLI_condition_wait(&ptcache_write_cond, &ptcache_write_mutex);
+  }
+  ptcache_write_pending++;
+  BLI_mutex_unlock(&ptcache_write_mutex);
+
+  BLI_thread_queue_push(ptcache_write_queue, task);
+
+  return true;
+}
+
 static PTCacheMem *ptcache_disk_frame_to_mem(PTCacheID *pid, int cfra)
 {
-  PTCacheFile *pf = ptcache_file_open(pid, PTCACHE_FILE_READ, cfra);
+  PTCacheFile *pf;
+
+  ptcache_async_write_flush();
+
+  pf = ptcache_file_open(pid, PTCACHE_FILE_READ, cfra);
   PTCacheMem *pm = NULL;
   unsigned int i, error = 0;
 
@@ -2030,13 +2146,14 @@ static PTCacheMem *ptcache_disk_frame_to_mem(PTCacheID *pid, int cfra)
 
   return pm;
 }
+/* Serialize one frame to its cache file. Only reads the given frame data and immutable pid
+ * members, so it may also run on the writer thread; clearing a previous file for the frame is
+ * the caller's responsibility. */
 static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
 {
   PTCacheFile *pf = NULL;
   unsigned int i, error = 0;
 
-  BKE_ptcache_id_clear(pid, PTCACHE_CLEAR_FRAME, pm->frame);
-
   pf = ptcache_file_open(pid, PTCACHE_FILE_WRITE, pm->frame);
 
   if (pf == NULL) {
@@ -2475,18 +2592,27 @@ static int ptcache_write(PTCacheID *pid, int cfra, int overwrite)
   pm->frame = cfra;
 
   if (cache->flag & PTCACHE_DISK_CACHE) {
-    error += !ptcache_mem_frame_to_disk(pid, pm);
-
-    // if (pm) /* pm is always set */
-    {
+    if (ptcache_mem_frame_to_disk_async(pid, pm)) {
+      /* Ownership of pm passed to the writer thread. */
+      pm = NULL;
+    }
+    else {
+      BKE_ptcache_id_clear(pid, PTCACHE_CLEAR_FRAME, pm->frame);
+      error += !ptcache_mem_frame_to_disk(pid, pm);
       ptcache_mem_clear(pm);
       MEM_freeN(pm);
     }
 
     if (pm2) {
-      error += !ptcache_mem_frame_to_disk(pid, pm2);
-      ptcache_mem_clear(pm2);
-      MEM_freeN(pm2);
+      if (ptcache_mem_frame_to_disk_async(pid, pm2)) {
+        pm2 = NULL;
+      }
+      else {
+        BKE_ptcache_id_clear(pid, PTCACHE_CLEAR_FRAME, pm2->frame);
+        error += !ptcache_mem_frame_to_disk(pid, pm2);
+        ptcache_mem_clear(pm2);
+        MEM_freeN(pm2);
+      }
     }
   }
   else {
@@ -2622,6 +2748,13 @@ void BKE_ptcache_id_clear(PTCacheID *pid, int mode, unsigned int cfra)
     return;
   }
 
+  /* Clearing a single frame is what the write path itself does right before scheduling the
+   * new frame, so it must not drain the queue; all wider clears have to wait for pending
+   * writes or the writer would re-create files behind them. */
+  if (mode != PTCACHE_CLEAR_FRAME) {
+    ptcache_async_write_flush();
+  }
+
   sta = pid->cache->startframe;
   end = pid->cache->endframe;
 
@@ -2770,6 +2903,8 @@ bool BKE_ptcache_id_exist(PTCacheID *pid, int cfra)
   if (pid->cache->flag & PTCACHE_DISK_CACHE) {
     char filename[MAX_PTCACHE_FILE];
 
+    ptcache_async_write_flush();
+
     ptcache_filename(pid, filename, cfra, 1, 1);
 
     return BLI_exists(filename);
@@ -3322,6 +3457,13 @@ void BKE_ptcache_bake(PTCacheBaker *baker)
     }
   }
 
+  /* Restrict to the requested sub-range, for bakes distributed over multiple instances. */
+  const bool is_range_bake = (baker->range_endframe > 0);
+  if (is_range_bake) {
+    startframe = MAX2(startframe, baker->range_startframe);
+    endframe = MIN2(endframe, baker->range_endframe);
+  }
+
   CFRA = startframe;
   scene->r.framelen = 1.0;
 
@@ -3334,6 +3476,9 @@ void BKE_ptcache_bake(PTCacheBaker *baker)
 
   stime = ptime = PIL_check_seconds_timer();
 
+  /* Let disk cache frames be compressed and written in the background. */
+  ptcache_async_write_begin();
+
   for (int fr = CFRA; fr <= endframe; fr += baker->quick_step, CFRA = fr) {
     BKE_scene_graph_update_for_newframe(depsgraph);
 
@@ -3376,6 +3521,8 @@ void BKE_ptcache_bake(PTCacheBaker *baker)
     CFRA += 1;
   }
 
+  ptcache_async_write_end();
+
   if (use_timer) {
     /* start with newline because of \r above */
     ptcache_dt_to_str(run, PIL_check_seconds_timer() - stime);
@@ -3389,7 +3536,7 @@ void BKE_ptcache_bake(PTCacheBaker *baker)
   if (pid) {
     cache->flag &= ~(PTCACHE_BAKING | PTCACHE_REDO_NEEDED);
     cache->flag |= PTCACHE_SIMULATION_VALID;
-    if (bake) {
+    if (bake && !is_range_bake) {
       cache->flag |= PTCACHE_BAKED;
       /* write info file */
       if (cache->flag & PTCACHE_DISK_CACHE) {
@@ -3419,7 +3566,7 @@ void BKE_ptcache_bake(PTCacheBaker *baker)
 
         cache->flag |= PTCACHE_SIMULATION_VALID;
 
-        if (bake) {
+        if (bake && !is_range_bake) {
           cache->flag |= PTCACHE_BAKED;
           if (cache->flag & PTCACHE_DISK_CACHE) {
             BKE_ptcache_write(pid, 0);
@@ -35,6 +35,8 @@
 
 #include "BLI_listbase.h"
 #include "BLI_math.h"
+#include "BLI_task.h"
+#include "BLI_threads.h"
 
 #ifdef WITH_BULLET
 #  include "RBI_api.h"
@@ -813,10 +815,9 @@ static void rigidbody_validate_sim_object(RigidBodyWorld *rbw, Object *ob, bool
     return;
   }
 
-  /* make sure collision shape exists */
-  /* FIXME we shouldn't always have to rebuild collision shapes when rebuilding objects,
-   * but it's needed for constraints to update correctly. */
-  if (rbo->shared->physics_shape == NULL || rebuild) {
+  /* Make sure collision shape exists. On rebuild the shape has already been recreated by
+   * rigidbody_update_simulation_precompute_shapes(), so only ensure one is present here. */
+  if (rbo->shared->physics_shape == NULL) {
     rigidbody_validate_sim_shape(rbw, ob, true);
   }
 
@@ -1151,7 +1152,10 @@ void BKE_rigidbody_validate_sim_world(Scene *scene, RigidBodyWorld *rbw, bool re
     if (rbw->shared->physics_world) {
       RB_dworld_delete(rbw->shared->physics_world);
     }
-    rbw->shared->physics_world = RB_dworld_new(scene->physics_settings.gravity);
+    rbw->shared->physics_world = RB_dworld_new(scene->physics_settings.gravity,
+                                               (rbw->flag & RBW_FLAG_USE_PARALLEL_SOLVER) ?
+                                                   BLI_system_thread_count() :
+                                                   1);
   }
 
   RB_dworld_set_solver_iterations(rbw->shared->physics_world, rbw->num_solver_iterations);
@@ -1771,6 +1775,63 @@ static void rigidbody_update_sim_ob(
  *
  * \param rebuild: Rebuild entire simulation
  */
+typedef struct RigidBodyShapeTaskData {
+  RigidBodyWorld *rbw;
+  Object **objects;
+} RigidBodyShapeTaskData;
+
+static void rigidbody_precompute_shape_task_cb(void *__restrict userdata,
+                                               const int i,
+                                               const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  RigidBodyShapeTaskData *data = userdata;
+  rigidbody_validate_sim_shape(data->rbw, data->objects[i], true);
+}
+
+/* Build the collision shapes of all tagged objects in parallel. Shape creation (most notably
+ * convex hull and triangle mesh generation) only reads the object's evaluated mesh and writes the
+ * object's own shape, so it can be taken out of the serial world update below; the per-object
+ * validation then finds an up to date shape in place. */
+static void rigidbody_update_simulation_precompute_shapes(RigidBodyWorld *rbw, bool rebuild)
+{
+  int totobject = 0;
+
+  FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
+    if (ob->type == OB_MESH && ob->rigidbody_object != NULL) {
+      totobject++;
+    }
+  }
+  FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
+
+  if (totobject == 0) {
+    return;
+  }
+
+  RigidBodyShapeTaskData task_data = {
+      .rbw = rbw,
+      .objects = MEM_mallocN(sizeof(Object *) * totobject, __func__),
+  };
+  int num_shapes = 0;
+
+  FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
+    RigidBodyOb *rbo = (ob->type == OB_MESH) ? ob->rigidbody_object : NULL;
+    if (rbo != NULL &&
+        (rebuild || rbo->shared->physics_shape == NULL || (rbo->flag & RBO_FLAG_NEEDS_RESHAPE))) {
+      task_data.objects[num_shapes++] = ob;
+    }
+  }
+  FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
+
+  if (num_shapes > 0) {
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 1;
+    BLI_task_parallel_range(0, num_shapes, &task_data, rigidbody_precompute_shape_task_cb, &settings);
+  }
+
+  MEM_freeN(task_data.objects);
+}
+
 static void rigidbody_update_simulation(Depsgraph *depsgraph,
                                         Scene *scene,
                                         RigidBodyWorld *rbw,
@@ -1805,6 +1866,8 @@ static void rigidbody_update_simulation(Depsgraph *depsgraph,
     FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
   }
 
+  rigidbody_update_simulation_precompute_shapes(rbw, rebuild);
+
   /* update objects */
   FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
     if (ob->type == OB_MESH) {
@@ -1842,8 +1905,8 @@ static void rigidbody_update_simulation(Depsgraph *depsgraph,
         }
         /* refresh shape... */
         if (rbo->flag & RBO_FLAG_NEEDS_RESHAPE) {
-          /* mesh/shape data changed, so force shape refresh */
-          rigidbody_validate_sim_shape(rbw, ob, true);
+          /* Mesh/shape data changed; the refreshed shape was already built by the parallel
+           * precompute pass above. */
           /* now tell RB sim about it */
           /* XXX: we assume that this can only get applied for active/passive shapes
            * that will be included as rigidbodies. */
@@ -1999,15 +1999,16 @@ Scene *BKE_scene_duplicate(Main *bmain, Scene *sce, eSceneCopyMethod type)
     /* Copy Freestyle LineStyle datablocks. */
     LISTBASE_FOREACH (ViewLayer *, view_layer_dst, &sce_copy->view_layers) {
       LISTBASE_FOREACH (FreestyleLineSet *, lineset, &view_layer_dst->freestyle_config.linesets) {
-        BKE_id_copy_for_duplicate(bmain, (ID *)lineset->linestyle, duplicate_flags);
+        BKE_id_copy_for_duplicate(
+            bmain, (ID *)lineset->linestyle, duplicate_flags, LIB_ID_COPY_DEFAULT);
       }
     }
 
     /* Full copy of world (included animations) */
-    BKE_id_copy_for_duplicate(bmain, (ID *)sce->world, duplicate_flags);
+    BKE_id_copy_for_duplicate(bmain, (ID *)sce->world, duplicate_flags, LIB_ID_COPY_DEFAULT);
 
     /* Full copy of GreasePencil. */
-    BKE_id_copy_for_duplicate(bmain, (ID *)sce->gpd, duplicate_flags);
+    BKE_id_copy_for_duplicate(bmain, (ID *)sce->gpd, duplicate_flags, LIB_ID_COPY_DEFAULT);
 
     /* Deep-duplicate collections and objects (using preferences' settings for which sub-data to
      * duplicate along the object itself). */
@@ -2860,6 +2861,38 @@ int get_render_subsurf_level(const RenderData *r, int lvl, bool for_render)
   return lvl;
 }
 
+/**
+ * Same as #get_render_subsurf_level, additionally reducing the level for objects that cover
+ * little of the camera view (or none of it), when a Simplify level of detail threshold is set.
+ *
+ * NOTE: This uses the camera state at the time the object is evaluated: objects are not
+ * re-evaluated when only the camera moves. For animation preview, where objects update on
+ * frame changes anyway, that is acceptable.
+ */
+int get_render_subsurf_level_for_object(const Scene *scene,
+                                        const Object *ob,
+                                        int lvl,
+                                        bool for_render)
+{
+  int level = get_render_subsurf_level(&scene->r, lvl, for_render);
+
+  /* Coverage based level of detail only applies to viewport evaluation. */
+  if (for_render || level == 0 || (scene->r.mode & R_SIMPLIFY) == 0 ||
+      scene->r.simplify_lod_threshold <= 0.0f || scene->camera == NULL || ob == NULL) {
+    return level;
+  }
+
+  float factor = BKE_object_camera_coverage_estimate(scene->camera, ob) /
+                 scene->r.simplify_lod_threshold;
+  /* Drop one subdivision level each time the screen coverage halves below the threshold. */
+  while (level > 0 && factor < 1.0f) {
+    level--;
+    factor *= 2.0f;
+  }
+
+  return level;
+}
+
 int get_render_child_particle_number(const RenderData *r, int num, bool for_render)
 {
   if (r->mode & R_SIMPLIFY) {
@@ -3487,8 +3520,12 @@ static Depsgraph **scene_ensure_depsgraph_p(Main *bmain, Scene *scene, ViewLayer
   }
 
   /* Allocate a new depsgraph. scene_get_depsgraph_p() already ensured that the pointer is stored
-   * in the scene's depsgraph hash. */
-  *depsgraph_ptr = DEG_graph_new(bmain, scene, view_layer, DAG_EVAL_VIEWPORT);
+   * in the scene's depsgraph hash. Adopt the graph pre-built in the background during file load
+   * when there is one for this context. */
+  *depsgraph_ptr = DEG_graph_warm_build_take(bmain, scene, view_layer);
+  if (*depsgraph_ptr == NULL) {
+    *depsgraph_ptr = DEG_graph_new(bmain, scene, view_layer, DAG_EVAL_VIEWPORT);
+  }
 
   /* TODO(sergey): Would be cool to avoid string format print,
    * but is a bit tricky because we can't know in advance whether
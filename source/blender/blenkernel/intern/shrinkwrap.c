@@ -109,7 +109,11 @@ bool BKE_shrinkwrap_needs_normals(int shrinkType, int shrinkMode)
           shrinkMode == MOD_SHRINKWRAP_ABOVE_SURFACE);
 }
 
-/* Initializes the mesh data structure from the given mesh and settings. */
+/* Initializes the mesh data structure from the given mesh and settings.
+ *
+ * The BVH tree comes from the runtime cache of the evaluated target mesh, so any number of
+ * objects shrinkwrapping to the same target share a single tree build; freeing the tree data
+ * only releases this local reference. */
 bool BKE_shrinkwrap_init_tree(
     ShrinkwrapTreeData *data, Mesh *mesh, int shrinkType, int shrinkMode, bool force_normals)
 {
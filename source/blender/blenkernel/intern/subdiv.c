@@ -27,8 +27,11 @@
 #include "DNA_meshdata_types.h"
 #include "DNA_modifier_types.h"
 
+#include "BLI_hash_mm2a.h"
 #include "BLI_utildefines.h"
 
+#include "BKE_customdata.h"
+
 #include "MEM_guardedalloc.h"
 
 #include "subdiv_converter.h"
@@ -173,14 +176,69 @@ Subdiv *BKE_subdiv_update_from_converter(Subdiv *subdiv,
   return BKE_subdiv_new_from_converter(settings, converter);
 }
 
+/* Hash all inputs of the mesh which define the topology refiner: geometry
+ * arrays, creases and UV coordinates (UVs define face-varying topology).
+ * Vertex coordinates are deliberately not included, so deform-only updates
+ * produce the same hash.
+ *
+ * Two independently seeded 32 bit hashes are combined into a 64 bit value to
+ * make an accidental match practically impossible. */
+static uint64_t coarse_mesh_topology_hash_calc(const Mesh *mesh)
+{
+  BLI_HashMurmur2A hash_lo, hash_hi;
+  BLI_hash_mm2a_init(&hash_lo, 0);
+  BLI_hash_mm2a_init(&hash_hi, 0xabcdef12);
+  const int num_uv_layers = CustomData_number_of_layers(&mesh->ldata, CD_MLOOPUV);
+  const int counts[5] = {mesh->totvert, mesh->totedge, mesh->totpoly, mesh->totloop, num_uv_layers};
+  for (int pass = 0; pass < 2; pass++) {
+    BLI_HashMurmur2A *hash = (pass == 0) ? &hash_lo : &hash_hi;
+    BLI_hash_mm2a_add(hash, (const uchar *)counts, sizeof(counts));
+    BLI_hash_mm2a_add(hash, (const uchar *)mesh->mloop, sizeof(MLoop) * (size_t)mesh->totloop);
+    for (int poly_index = 0; poly_index < mesh->totpoly; poly_index++) {
+      const MPoly *poly = &mesh->mpoly[poly_index];
+      BLI_hash_mm2a_add_int(hash, poly->loopstart);
+      BLI_hash_mm2a_add_int(hash, poly->totloop);
+    }
+    for (int edge_index = 0; edge_index < mesh->totedge; edge_index++) {
+      const MEdge *edge = &mesh->medge[edge_index];
+      BLI_hash_mm2a_add_int(hash, edge->v1);
+      BLI_hash_mm2a_add_int(hash, edge->v2);
+      BLI_hash_mm2a_add(hash, &edge->crease, sizeof(edge->crease));
+    }
+    for (int layer_index = 0; layer_index < num_uv_layers; layer_index++) {
+      const MLoopUV *mloopuv = CustomData_get_layer_n(&mesh->ldata, CD_MLOOPUV, layer_index);
+      for (int loop_index = 0; loop_index < mesh->totloop; loop_index++) {
+        BLI_hash_mm2a_add(hash, (const uchar *)mloopuv[loop_index].uv, sizeof(float[2]));
+      }
+    }
+  }
+  const uint64_t hash_lo_value = BLI_hash_mm2a_end(&hash_lo);
+  const uint64_t hash_hi_value = BLI_hash_mm2a_end(&hash_hi);
+  return (hash_hi_value << 32) | hash_lo_value;
+}
+
 Subdiv *BKE_subdiv_update_from_mesh(Subdiv *subdiv,
                                     const SubdivSettings *settings,
                                     const Mesh *mesh)
 {
+  /* Cheap fast path for deform-only updates: when neither settings nor any of
+   * the topology inputs changed, keep the existing refiner and evaluator (and
+   * with it the stencil tables) alive, so only the stencils are re-applied to
+   * the new coordinates. This avoids building a converter and running the
+   * full topology comparison on every depsgraph evaluation. */
+  const uint64_t topology_hash = coarse_mesh_topology_hash_calc(mesh);
+  if (subdiv != NULL && subdiv->topology_refiner != NULL &&
+      subdiv->coarse_mesh_topology_hash == topology_hash &&
+      BKE_subdiv_settings_equal(&subdiv->settings, settings)) {
+    return subdiv;
+  }
   OpenSubdiv_Converter converter;
   BKE_subdiv_converter_init_for_mesh(&converter, settings, mesh);
   subdiv = BKE_subdiv_update_from_converter(subdiv, settings, &converter);
   BKE_subdiv_converter_free(&converter);
+  if (subdiv != NULL) {
+    subdiv->coarse_mesh_topology_hash = topology_hash;
+  }
   return subdiv;
 }
 
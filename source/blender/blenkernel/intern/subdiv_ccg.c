@@ -28,6 +28,8 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "atomic_ops.h"
+
 #include "BLI_ghash.h"
 #include "BLI_math_bits.h"
 #include "BLI_math_vector.h"
@@ -412,20 +414,87 @@ static CCGElem *subdiv_ccg_coord_to_elem(const CCGKey *key,
   return CCG_grid_elem(key, subdiv_ccg->grids[coord->grid_index], coord->x, coord->y);
 }
 
-/* Returns storage where boundary elements are to be stored. */
-static SubdivCCGCoord *subdiv_ccg_adjacent_edge_add_face(SubdivCCG *subdiv_ccg,
-                                                         SubdivCCGAdjacentEdge *adjacent_edge)
+/* Data for the parallel fill of edge/vertex adjacency. Slots in the per-element arrays are
+ * claimed atomically via the fill cursors, which makes the slot order depend on scheduling.
+ * That is fine: all consumers either average or search the adjacent faces, never rely on
+ * their order. */
+typedef struct CCGNeighborhoodFillData {
+  SubdivCCG *subdiv_ccg;
+  /* Per edge / per vertex cursor for the next free adjacent face slot. */
+  int *fill_cursor;
+} CCGNeighborhoodFillData;
+
+typedef struct CCGNeighborhoodFillTLS {
+  StaticOrHeapIntStorage face_vertices_storage;
+  StaticOrHeapIntStorage face_edges_storage;
+} CCGNeighborhoodFillTLS;
+
+static void subdiv_ccg_neighborhood_fill_tls_free(const void *__restrict UNUSED(userdata),
+                                                  void *__restrict tls_v)
+{
+  CCGNeighborhoodFillTLS *tls = tls_v;
+  static_or_heap_storage_free(&tls->face_vertices_storage);
+  static_or_heap_storage_free(&tls->face_edges_storage);
+}
+
+static void subdiv_ccg_init_faces_edge_neighborhood_task(void *__restrict userdata_v,
+                                                         const int face_index,
+                                                         const TaskParallelTLS *__restrict tls_v)
 {
-  const int grid_size = subdiv_ccg->grid_size * 2;
-  const int adjacent_face_index = adjacent_edge->num_adjacent_faces;
-  ++adjacent_edge->num_adjacent_faces;
-  /* Allocate memory for the boundary elements. */
-  adjacent_edge->boundary_coords = MEM_reallocN(adjacent_edge->boundary_coords,
-                                                adjacent_edge->num_adjacent_faces *
-                                                    sizeof(*adjacent_edge->boundary_coords));
-  adjacent_edge->boundary_coords[adjacent_face_index] = MEM_malloc_arrayN(
-      grid_size * 2, sizeof(SubdivCCGCoord), "ccg adjacent boundary");
-  return adjacent_edge->boundary_coords[adjacent_face_index];
+  CCGNeighborhoodFillData *data = userdata_v;
+  CCGNeighborhoodFillTLS *tls = tls_v->userdata_chunk;
+  SubdivCCG *subdiv_ccg = data->subdiv_ccg;
+  OpenSubdiv_TopologyRefiner *topology_refiner = subdiv_ccg->subdiv->topology_refiner;
+  const int grid_size = subdiv_ccg->grid_size;
+  SubdivCCGFace *face = &subdiv_ccg->faces[face_index];
+  const int num_face_grids = face->num_grids;
+  const int num_face_edges = num_face_grids;
+  int *face_vertices = static_or_heap_storage_get(&tls->face_vertices_storage, num_face_edges);
+  topology_refiner->getFaceVertices(topology_refiner, face_index, face_vertices);
+  /* Note that order of edges is same as order of MLoops, which also
+   * means it's the same as order of grids. */
+  int *face_edges = static_or_heap_storage_get(&tls->face_edges_storage, num_face_edges);
+  topology_refiner->getFaceEdges(topology_refiner, face_index, face_edges);
+  /* Store grids adjacency for this edge. */
+  for (int corner = 0; corner < num_face_edges; corner++) {
+    const int vertex_index = face_vertices[corner];
+    const int edge_index = face_edges[corner];
+    int edge_vertices[2];
+    topology_refiner->getEdgeVertices(topology_refiner, edge_index, edge_vertices);
+    const bool is_edge_flipped = (edge_vertices[0] != vertex_index);
+    /* Grid which is adjacent to the current corner. */
+    const int current_grid_index = face->start_grid_index + corner;
+    /* Grid which is adjacent to the next corner. */
+    const int next_grid_index = face->start_grid_index + (corner + 1) % num_face_grids;
+    /* Claim a slot on the adjacent edge and allocate its boundary elements. */
+    SubdivCCGAdjacentEdge *adjacent_edge = &subdiv_ccg->adjacent_edges[edge_index];
+    const int slot = atomic_fetch_and_add_int32(&data->fill_cursor[edge_index], 1);
+    SubdivCCGCoord *boundary_coords = MEM_malloc_arrayN(
+        (size_t)grid_size * 4, sizeof(SubdivCCGCoord), "ccg adjacent boundary");
+    adjacent_edge->boundary_coords[slot] = boundary_coords;
+    /* Fill CCG elements along the edge. */
+    int boundary_element_index = 0;
+    if (is_edge_flipped) {
+      for (int i = 0; i < grid_size; i++) {
+        boundary_coords[boundary_element_index++] = subdiv_ccg_coord(
+            next_grid_index, grid_size - i - 1, grid_size - 1);
+      }
+      for (int i = 0; i < grid_size; i++) {
+        boundary_coords[boundary_element_index++] = subdiv_ccg_coord(
+            current_grid_index, grid_size - 1, i);
+      }
+    }
+    else {
+      for (int i = 0; i < grid_size; i++) {
+        boundary_coords[boundary_element_index++] = subdiv_ccg_coord(
+            current_grid_index, grid_size - 1, grid_size - i - 1);
+      }
+      for (int i = 0; i < grid_size; i++) {
+        boundary_coords[boundary_element_index++] = subdiv_ccg_coord(
+            next_grid_index, i, grid_size - 1);
+      }
+    }
+  }
 }
 
 static void subdiv_ccg_init_faces_edge_neighborhood(SubdivCCG *subdiv_ccg)
@@ -434,71 +503,51 @@ static void subdiv_ccg_init_faces_edge_neighborhood(SubdivCCG *subdiv_ccg)
   SubdivCCGFace *faces = subdiv_ccg->faces;
   OpenSubdiv_TopologyRefiner *topology_refiner = subdiv->topology_refiner;
   const int num_edges = topology_refiner->getNumEdges(topology_refiner);
-  const int grid_size = subdiv_ccg->grid_size;
   if (num_edges == 0) {
     /* Early output, nothing to do in this case. */
     return;
   }
   subdiv_ccg_allocate_adjacent_edges(subdiv_ccg, num_edges);
-  /* Initialize storage. */
-  StaticOrHeapIntStorage face_vertices_storage;
+  /* Count the number of adjacent faces of every edge, so the pointer arrays can be allocated
+   * at their final size up-front instead of being re-allocated for every face. */
   StaticOrHeapIntStorage face_edges_storage;
-  static_or_heap_storage_init(&face_vertices_storage);
   static_or_heap_storage_init(&face_edges_storage);
-  /* Store adjacency for all faces. */
   const int num_faces = subdiv_ccg->num_faces;
   for (int face_index = 0; face_index < num_faces; face_index++) {
     SubdivCCGFace *face = &faces[face_index];
-    const int num_face_grids = face->num_grids;
-    const int num_face_edges = num_face_grids;
-    int *face_vertices = static_or_heap_storage_get(&face_vertices_storage, num_face_edges);
-    topology_refiner->getFaceVertices(topology_refiner, face_index, face_vertices);
-    /* Note that order of edges is same as order of MLoops, which also
-     * means it's the same as order of grids. */
+    const int num_face_edges = face->num_grids;
     int *face_edges = static_or_heap_storage_get(&face_edges_storage, num_face_edges);
     topology_refiner->getFaceEdges(topology_refiner, face_index, face_edges);
-    /* Store grids adjacency for this edge. */
     for (int corner = 0; corner < num_face_edges; corner++) {
-      const int vertex_index = face_vertices[corner];
-      const int edge_index = face_edges[corner];
-      int edge_vertices[2];
-      topology_refiner->getEdgeVertices(topology_refiner, edge_index, edge_vertices);
-      const bool is_edge_flipped = (edge_vertices[0] != vertex_index);
-      /* Grid which is adjacent to the current corner. */
-      const int current_grid_index = face->start_grid_index + corner;
-      /* Grid which is adjacent to the next corner. */
-      const int next_grid_index = face->start_grid_index + (corner + 1) % num_face_grids;
-      /* Add new face to the adjacent edge. */
-      SubdivCCGAdjacentEdge *adjacent_edge = &subdiv_ccg->adjacent_edges[edge_index];
-      SubdivCCGCoord *boundary_coords = subdiv_ccg_adjacent_edge_add_face(subdiv_ccg,
-                                                                          adjacent_edge);
-      /* Fill CCG elements along the edge. */
-      int boundary_element_index = 0;
-      if (is_edge_flipped) {
-        for (int i = 0; i < grid_size; i++) {
-          boundary_coords[boundary_element_index++] = subdiv_ccg_coord(
-              next_grid_index, grid_size - i - 1, grid_size - 1);
-        }
-        for (int i = 0; i < grid_size; i++) {
-          boundary_coords[boundary_element_index++] = subdiv_ccg_coord(
-              current_grid_index, grid_size - 1, i);
-        }
-      }
-      else {
-        for (int i = 0; i < grid_size; i++) {
-          boundary_coords[boundary_element_index++] = subdiv_ccg_coord(
-              current_grid_index, grid_size - 1, grid_size - i - 1);
-        }
-        for (int i = 0; i < grid_size; i++) {
-          boundary_coords[boundary_element_index++] = subdiv_ccg_coord(
-              next_grid_index, i, grid_size - 1);
-        }
-      }
+      subdiv_ccg->adjacent_edges[face_edges[corner]].num_adjacent_faces++;
     }
   }
-  /* Free possibly heap-allocated storage. */
-  static_or_heap_storage_free(&face_vertices_storage);
   static_or_heap_storage_free(&face_edges_storage);
+  for (int edge_index = 0; edge_index < num_edges; edge_index++) {
+    SubdivCCGAdjacentEdge *adjacent_edge = &subdiv_ccg->adjacent_edges[edge_index];
+    if (adjacent_edge->num_adjacent_faces == 0) {
+      continue;
+    }
+    adjacent_edge->boundary_coords = MEM_malloc_arrayN(adjacent_edge->num_adjacent_faces,
+                                                       sizeof(*adjacent_edge->boundary_coords),
+                                                       "ccg adjacent boundary pointers");
+  }
+  /* Store adjacency for all faces, claiming slots through the shared cursors. */
+  CCGNeighborhoodFillData data = {
+      .subdiv_ccg = subdiv_ccg,
+      .fill_cursor = MEM_calloc_arrayN(num_edges, sizeof(int), "ccg adjacent edge cursor"),
+  };
+  CCGNeighborhoodFillTLS tls_data;
+  static_or_heap_storage_init(&tls_data.face_vertices_storage);
+  static_or_heap_storage_init(&tls_data.face_edges_storage);
+  TaskParallelSettings parallel_range_settings;
+  BLI_parallel_range_settings_defaults(&parallel_range_settings);
+  parallel_range_settings.userdata_chunk = &tls_data;
+  parallel_range_settings.userdata_chunk_size = sizeof(tls_data);
+  parallel_range_settings.func_free = subdiv_ccg_neighborhood_fill_tls_free;
+  BLI_task_parallel_range(
+      0, num_faces, &data, subdiv_ccg_init_faces_edge_neighborhood_task, &parallel_range_settings);
+  MEM_freeN(data.fill_cursor);
 }
 
 static void subdiv_ccg_allocate_adjacent_vertices(SubdivCCG *subdiv_ccg, const int num_vertices)
@@ -509,18 +558,29 @@ static void subdiv_ccg_allocate_adjacent_vertices(SubdivCCG *subdiv_ccg, const i
                                                     "ccg adjacent vertices");
 }
 
-/* Returns storage where corner elements are to be stored. This is a pointer
- * to the actual storage. */
-static SubdivCCGCoord *subdiv_ccg_adjacent_vertex_add_face(
-    SubdivCCGAdjacentVertex *adjacent_vertex)
+static void subdiv_ccg_init_faces_vertex_neighborhood_task(void *__restrict userdata_v,
+                                                           const int face_index,
+                                                           const TaskParallelTLS *__restrict tls_v)
 {
-  const int adjacent_face_index = adjacent_vertex->num_adjacent_faces;
-  ++adjacent_vertex->num_adjacent_faces;
-  /* Allocate memory for the boundary elements. */
-  adjacent_vertex->corner_coords = MEM_reallocN(adjacent_vertex->corner_coords,
-                                                adjacent_vertex->num_adjacent_faces *
-                                                    sizeof(*adjacent_vertex->corner_coords));
-  return &adjacent_vertex->corner_coords[adjacent_face_index];
+  CCGNeighborhoodFillData *data = userdata_v;
+  CCGNeighborhoodFillTLS *tls = tls_v->userdata_chunk;
+  SubdivCCG *subdiv_ccg = data->subdiv_ccg;
+  OpenSubdiv_TopologyRefiner *topology_refiner = subdiv_ccg->subdiv->topology_refiner;
+  const int grid_size = subdiv_ccg->grid_size;
+  SubdivCCGFace *face = &subdiv_ccg->faces[face_index];
+  const int num_face_grids = face->num_grids;
+  int *face_vertices = static_or_heap_storage_get(&tls->face_vertices_storage, num_face_grids);
+  topology_refiner->getFaceVertices(topology_refiner, face_index, face_vertices);
+  for (int corner = 0; corner < num_face_grids; corner++) {
+    const int vertex_index = face_vertices[corner];
+    /* Grid which is adjacent to the current corner. */
+    const int grid_index = face->start_grid_index + corner;
+    /* Claim a slot on the adjacent vertex and store the corner element. */
+    SubdivCCGAdjacentVertex *adjacent_vertex = &subdiv_ccg->adjacent_vertices[vertex_index];
+    const int slot = atomic_fetch_and_add_int32(&data->fill_cursor[vertex_index], 1);
+    adjacent_vertex->corner_coords[slot] = subdiv_ccg_coord(
+        grid_index, grid_size - 1, grid_size - 1);
+  }
 }
 
 static void subdiv_ccg_init_faces_vertex_neighborhood(SubdivCCG *subdiv_ccg)
@@ -529,38 +589,54 @@ static void subdiv_ccg_init_faces_vertex_neighborhood(SubdivCCG *subdiv_ccg)
   SubdivCCGFace *faces = subdiv_ccg->faces;
   OpenSubdiv_TopologyRefiner *topology_refiner = subdiv->topology_refiner;
   const int num_vertices = topology_refiner->getNumVertices(topology_refiner);
-  const int grid_size = subdiv_ccg->grid_size;
   if (num_vertices == 0) {
     /* Early output, nothing to do in this case. */
     return;
   }
   subdiv_ccg_allocate_adjacent_vertices(subdiv_ccg, num_vertices);
-  /* Initialize storage. */
+  /* Count the number of adjacent faces of every vertex, so the corner element arrays can be
+   * allocated at their final size up-front. */
   StaticOrHeapIntStorage face_vertices_storage;
   static_or_heap_storage_init(&face_vertices_storage);
-  /* Key to access elements. */
-  CCGKey key;
-  BKE_subdiv_ccg_key_top_level(&key, subdiv_ccg);
-  /* Store adjacency for all faces. */
   const int num_faces = subdiv_ccg->num_faces;
   for (int face_index = 0; face_index < num_faces; face_index++) {
     SubdivCCGFace *face = &faces[face_index];
     const int num_face_grids = face->num_grids;
-    const int num_face_edges = num_face_grids;
-    int *face_vertices = static_or_heap_storage_get(&face_vertices_storage, num_face_edges);
+    int *face_vertices = static_or_heap_storage_get(&face_vertices_storage, num_face_grids);
     topology_refiner->getFaceVertices(topology_refiner, face_index, face_vertices);
-    for (int corner = 0; corner < num_face_edges; corner++) {
-      const int vertex_index = face_vertices[corner];
-      /* Grid which is adjacent to the current corner. */
-      const int grid_index = face->start_grid_index + corner;
-      /* Add new face to the adjacent edge. */
-      SubdivCCGAdjacentVertex *adjacent_vertex = &subdiv_ccg->adjacent_vertices[vertex_index];
-      SubdivCCGCoord *corner_coord = subdiv_ccg_adjacent_vertex_add_face(adjacent_vertex);
-      *corner_coord = subdiv_ccg_coord(grid_index, grid_size - 1, grid_size - 1);
+    for (int corner = 0; corner < num_face_grids; corner++) {
+      subdiv_ccg->adjacent_vertices[face_vertices[corner]].num_adjacent_faces++;
     }
   }
-  /* Free possibly heap-allocated storage. */
   static_or_heap_storage_free(&face_vertices_storage);
+  for (int vertex_index = 0; vertex_index < num_vertices; vertex_index++) {
+    SubdivCCGAdjacentVertex *adjacent_vertex = &subdiv_ccg->adjacent_vertices[vertex_index];
+    if (adjacent_vertex->num_adjacent_faces == 0) {
+      continue;
+    }
+    adjacent_vertex->corner_coords = MEM_malloc_arrayN(adjacent_vertex->num_adjacent_faces,
+                                                       sizeof(*adjacent_vertex->corner_coords),
+                                                       "ccg adjacent vertex corners");
+  }
+  /* Store adjacency for all faces, claiming slots through the shared cursors. */
+  CCGNeighborhoodFillData data = {
+      .subdiv_ccg = subdiv_ccg,
+      .fill_cursor = MEM_calloc_arrayN(num_vertices, sizeof(int), "ccg adjacent vertex cursor"),
+  };
+  CCGNeighborhoodFillTLS tls_data;
+  static_or_heap_storage_init(&tls_data.face_vertices_storage);
+  static_or_heap_storage_init(&tls_data.face_edges_storage);
+  TaskParallelSettings parallel_range_settings;
+  BLI_parallel_range_settings_defaults(&parallel_range_settings);
+  parallel_range_settings.userdata_chunk = &tls_data;
+  parallel_range_settings.userdata_chunk_size = sizeof(tls_data);
+  parallel_range_settings.func_free = subdiv_ccg_neighborhood_fill_tls_free;
+  BLI_task_parallel_range(0,
+                          num_faces,
+                          &data,
+                          subdiv_ccg_init_faces_vertex_neighborhood_task,
+                          &parallel_range_settings);
+  MEM_freeN(data.fill_cursor);
 }
 
 static void subdiv_ccg_init_faces_neighborhood(SubdivCCG *subdiv_ccg)
@@ -604,7 +680,7 @@ Mesh *BKE_subdiv_to_ccg_mesh(Subdiv *subdiv,
 {
   /* Make sure evaluator is ready. */
   BKE_subdiv_stats_begin(&subdiv->stats, SUBDIV_STATS_SUBDIV_TO_CCG);
-  if (!BKE_subdiv_eval_begin_from_mesh(subdiv, coarse_mesh, NULL)) {
+  if (!BKE_subdiv_eval_begin_from_mesh(subdiv, coarse_mesh, NULL, SUBDIV_EVALUATOR_TYPE_CPU)) {
     if (coarse_mesh->totpoly) {
       return NULL;
     }
@@ -750,6 +750,36 @@ void BKE_texture_get_value(const Scene *scene,
   BKE_texture_get_value_ex(scene, texture, tex_co, texres, NULL, use_color_management);
 }
 
+void BKE_texture_get_value_span(const Scene *scene,
+                                Tex *texture,
+                                const float (*tex_co)[3],
+                                TexResult *texres,
+                                const int num,
+                                struct ImagePool *pool,
+                                bool use_color_management)
+{
+  bool do_color_manage = false;
+
+  if (scene && use_color_management) {
+    do_color_manage = BKE_scene_check_color_management_enabled(scene);
+  }
+
+  /* Evaluating a whole span in one call keeps the color-management lookup and the
+   * result-type fix-up out of the per-sample path, callers can batch over vertex blocks. */
+  for (int i = 0; i < num; i++) {
+    texres[i].nor = NULL;
+    const int result_type = multitex_ext_safe(
+        texture, tex_co[i], &texres[i], pool, do_color_manage, false);
+
+    if (result_type & TEX_RGB) {
+      texres[i].tin = (1.0f / 3.0f) * (texres[i].tr + texres[i].tg + texres[i].tb);
+    }
+    else {
+      copy_v3_fl(&texres[i].tr, texres[i].tin);
+    }
+  }
+}
+
 static void texture_nodes_fetch_images_for_pool(Tex *texture,
                                                 bNodeTree *ntree,
                                                 struct ImagePool *pool)
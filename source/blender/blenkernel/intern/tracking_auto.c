@@ -571,6 +571,13 @@ AutoTrackContext *BKE_autotrack_context_new(MovieClip *clip,
 
 /* -------------------------------------------------------------------- */
 /** \name Threaded context step (tracking process).
+ *
+ * Markers are tracked concurrently: every step runs all markers of the current frame through a
+ * parallel range, with per-thread result lists reduced afterwards. Frame pixels are pulled
+ * lazily through the image accessor, so the first marker needing a new frame decodes it behind
+ * the movie clip lock and the rest read from the cache. Filling the cache ahead of the playhead
+ * (so that decode overlaps with tracking) is the job of the clip prefetching, see
+ * clip_start_prefetch_job.
  * \{ */
 
 /* NOTE: This is a TLS in a sense that this struct is never accessed from multiple threads, and
@@ -101,6 +101,15 @@ typedef struct FFMpegContext {
 
   struct StampData *stamp_data;
 
+  /* Pipelined encoding: the caller queues copied frames and a dedicated thread encodes and
+   * muxes them, so export time approaches the slower of the two stages instead of their sum.
+   * NULL queues mean encoding happens synchronously in #BKE_ffmpeg_append. */
+  ListBase encode_threads;
+  ThreadQueue *frame_queue_free;
+  ThreadQueue *frame_queue_pending;
+  size_t frame_queue_pixels_size;
+  int encode_error;
+
 #  ifdef WITH_AUDASPACE
   AUD_Device *audio_mixdown_device;
 #  endif
@@ -1388,6 +1397,13 @@ int BKE_ffmpeg_start(void *context_v,
         scene, specs, preview ? rd->psfra : rd->sfra, rd->ffcodecdata.audio_volume);
   }
 #  endif
+
+  /* Auto-split keeps the synchronous path: splitting checks the muxed file size after every
+   * frame and re-creates the whole output mid-stream. */
+  if (success && context->video_stream && !context->ffmpeg_autosplit) {
+    ffmpeg_encode_pipeline_begin(context, rectx, recty);
+  }
+
   return success;
 }
 
@@ -1406,6 +1422,87 @@ static void write_audio_frames(FFMpegContext *context, double to_pts)
 }
 #  endif
 
+/* A frame handed over from the render thread to the encode thread. */
+typedef struct FFMpegFrameJob {
+  uint8_t *pixels; /* Copy of the rendered RGBA byte buffer. */
+  int cfra;
+  double audio_pts; /* Mix and encode audio up to this point after the video frame. */
+} FFMpegFrameJob;
+
+static void *ffmpeg_encode_thread_do(void *context_v)
+{
+  FFMpegContext *context = context_v;
+  FFMpegFrameJob *job;
+
+  while ((job = BLI_thread_queue_pop(context->frame_queue_pending))) {
+    if (context->encode_error == 0) {
+      AVFrame *avframe = generate_video_frame(context, job->pixels);
+      if (!(avframe && write_video_frame(context, job->cfra, avframe, NULL))) {
+        context->encode_error = 1;
+      }
+#  ifdef WITH_AUDASPACE
+      if (context->encode_error == 0) {
+        write_audio_frames(context, job->audio_pts);
+      }
+#  endif
+    }
+
+    BLI_thread_queue_push(context->frame_queue_free, job);
+  }
+
+  return NULL;
+}
+
+/**
+ * Start the encode thread and the double buffered frame hand-off, so encoding a frame overlaps
+ * rendering the next one. All encoding and muxing (audio included) happens on the encode thread
+ * from here on, #BKE_ffmpeg_append only copies pixels and queues them.
+ */
+static void ffmpeg_encode_pipeline_begin(FFMpegContext *context, int rectx, int recty)
+{
+  BLI_assert(context->frame_queue_pending == NULL);
+
+  context->encode_error = 0;
+  context->frame_queue_pixels_size = sizeof(int) * (size_t)rectx * (size_t)recty;
+  context->frame_queue_free = BLI_thread_queue_init();
+  context->frame_queue_pending = BLI_thread_queue_init();
+
+  /* Two staging buffers: the render thread fills one while the other encodes, and blocks in
+   * #BKE_ffmpeg_append when the encoder falls more than a frame behind. */
+  for (int i = 0; i < 2; i++) {
+    FFMpegFrameJob *job = MEM_callocN(sizeof(FFMpegFrameJob), "ffmpeg frame job");
+    job->pixels = MEM_mallocN(context->frame_queue_pixels_size, "ffmpeg frame job pixels");
+    BLI_thread_queue_push(context->frame_queue_free, job);
+  }
+
+  BLI_threadpool_init(&context->encode_threads, ffmpeg_encode_thread_do, 1);
+  BLI_threadpool_insert(&context->encode_threads, context);
+}
+
+/* Finish the queued frames and tear the encode thread down again. */
+static void ffmpeg_encode_pipeline_end(FFMpegContext *context)
+{
+  if (context->frame_queue_pending == NULL) {
+    return;
+  }
+
+  BLI_thread_queue_nowait(context->frame_queue_pending);
+  BLI_threadpool_end(&context->encode_threads);
+
+  /* After the join all staging buffers are back in the free queue. */
+  BLI_thread_queue_nowait(context->frame_queue_free);
+  FFMpegFrameJob *job;
+  while ((job = BLI_thread_queue_pop(context->frame_queue_free))) {
+    MEM_freeN(job->pixels);
+    MEM_freeN(job);
+  }
+
+  BLI_thread_queue_free(context->frame_queue_free);
+  BLI_thread_queue_free(context->frame_queue_pending);
+  context->frame_queue_free = NULL;
+  context->frame_queue_pending = NULL;
+}
+
 int BKE_ffmpeg_append(void *context_v,
                       RenderData *rd,
                       int start_frame,
@@ -1426,6 +1523,23 @@ int BKE_ffmpeg_append(void *context_v,
   //  write_audio_frames(frame / (((double)rd->frs_sec) / rd->frs_sec_base));
 
   if (context->video_stream) {
+    if (context->frame_queue_pending != NULL) {
+      /* Pipelined path: copy the pixels into a staging buffer and hand them to the encode
+       * thread, blocking only when it is more than a frame behind. Failures on the encode
+       * thread surface on the next append call (or through flushing at the end). */
+      FFMpegFrameJob *job = BLI_thread_queue_pop(context->frame_queue_free);
+      memcpy(job->pixels, pixels, context->frame_queue_pixels_size);
+      job->cfra = frame - start_frame;
+      job->audio_pts = (frame - start_frame) / (((double)rd->frs_sec) / (double)rd->frs_sec_base);
+      BLI_thread_queue_push(context->frame_queue_pending, job);
+
+      if (context->encode_error) {
+        BKE_report(reports, RPT_ERROR, "Error writing frame");
+        return 0;
+      }
+      return 1;
+    }
+
     avframe = generate_video_frame(context, (unsigned char *)pixels);
     success = (avframe && write_video_frame(context, frame - start_frame, avframe, reports));
 
@@ -1449,6 +1563,8 @@ static void end_ffmpeg_impl(FFMpegContext *context, int is_autosplit)
 {
   PRINT("Closing ffmpeg...\n");
 
+  ffmpeg_encode_pipeline_end(context);
+
 #  ifdef WITH_AUDASPACE
   if (is_autosplit == false) {
     if (context->audio_mixdown_device) {
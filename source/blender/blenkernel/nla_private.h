@@ -60,6 +60,23 @@ enum eNlaEvalStrip_StripMode {
   NES_TIME_TRANSITION_END,
 };
 
+/* Cached raw (pre-blend) evaluation result of an action-clip strip, so strips
+ * whose inputs did not change between frames (hold extensions, static layers)
+ * don't re-evaluate their F-Curves. Stored on the strip (NlaStrip.eval_cache),
+ * owned by the evaluation code in anim_sys.c. */
+typedef struct NlaStripEvalCache {
+  /* Inputs the cached values were computed from. */
+  bAction *act;
+  float strip_time;
+  uint64_t fcurve_generation;
+
+  /* Values of the action's evaluatable F-Curves, in action order. */
+  int value_len;
+  float *values;
+} NlaStripEvalCache;
+
+void BKE_nlastrip_eval_cache_free(NlaStrip *strip);
+
 struct NlaEvalChannel;
 struct NlaEvalData;
 
@@ -217,6 +217,24 @@ int BLI_bvhtree_ray_cast(BVHTree *tree,
                          BVHTree_RayCastCallback callback,
                          void *userdata);
 
+/**
+ * Cast a span of rays at once, testing the bounding boxes of several nodes per step with SIMD
+ * where supported. Prefer this over calling #BLI_bvhtree_ray_cast in a loop when many rays target
+ * the same tree (collision queries, snapping).
+ *
+ * \param hits: An array of `ray_num` hits, each initialized by the caller like the `hit` argument
+ * of #BLI_bvhtree_ray_cast (`index` to -1 and `dist` to the maximum range of the matching ray).
+ * \return The number of rays that hit (i.e. have their `hits` index set).
+ */
+int BLI_bvhtree_ray_cast_batch(BVHTree *tree,
+                               const float (*co_array)[3],
+                               const float (*dir_array)[3],
+                               float radius,
+                               int ray_num,
+                               BVHTreeRayHit *hits,
+                               BVHTree_RayCastCallback callback,
+                               void *userdata);
+
 void BLI_bvhtree_ray_cast_all_ex(BVHTree *tree,
                                  const float co[3],
                                  const float dir[3],
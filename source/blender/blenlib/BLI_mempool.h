@@ -57,6 +57,37 @@ void **BLI_mempool_as_tableN(BLI_mempool *pool,
                              const char *allocstr) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT
     ATTR_NONNULL(1, 2);
 void BLI_mempool_as_array(BLI_mempool *pool, void *data) ATTR_NONNULL(1, 2);
+
+/**
+ * Thread-local allocation cache on top of a shared pool.
+ *
+ * Each worker thread owns one cache; allocations and frees through the cache touch only the
+ * thread's private free list, and elements are handed out from (or given back to) the shared
+ * pool in batches under an internal lock. This lets task-pool workers allocate from one pool
+ * concurrently without serializing on a global mutex.
+ *
+ * Rules:
+ * - The pool must not be used directly (alloc/free/clear/iterate) while caches hold elements;
+ *   call #BLI_mempool_cache_flush on every cache first (elements held by a cache still count as
+ *   used by #BLI_mempool_len until then).
+ * - A cache must only be used by one thread at a time.
+ */
+typedef struct BLI_mempool_cache {
+  BLI_mempool *pool;
+  /** Private free list (#BLI_freenode), lock-free since only the owning thread touches it. */
+  void *free;
+  unsigned int free_num;
+} BLI_mempool_cache;
+
+/**
+ * \param pool: May be NULL as long as the cache is only ever flushed
+ * (flushing an empty cache is a no-op), never allocated from or freed into.
+ */
+void BLI_mempool_cache_init(BLI_mempool *pool, BLI_mempool_cache *cache) ATTR_NONNULL(2);
+void *BLI_mempool_cache_alloc(BLI_mempool_cache *cache)
+    ATTR_MALLOC ATTR_WARN_UNUSED_RESULT ATTR_RETURNS_NONNULL ATTR_NONNULL(1);
+void BLI_mempool_cache_free(BLI_mempool_cache *cache, void *addr) ATTR_NONNULL(1, 2);
+void BLI_mempool_cache_flush(BLI_mempool_cache *cache) ATTR_NONNULL(1);
 void *BLI_mempool_as_arrayN(BLI_mempool *pool,
                             const char *allocstr) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT
     ATTR_NONNULL(1, 2);
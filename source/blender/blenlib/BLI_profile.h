@@ -0,0 +1,93 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * Zoned profiling instrumentation.
+ *
+ * Call sites mark named begin/end scopes with #BLI_PROFILE_SCOPE_BEGIN and
+ * #BLI_PROFILE_SCOPE_END (or the RAII #BLI_PROFILE_SCOPE from C++). The macros compile to
+ * no-ops unless the build enables `WITH_PROFILE`, so instrumented hot loops cost nothing in
+ * regular builds. In profile builds recording is still off until #BLI_profile_enable() is
+ * called, and begin/end then only touch a thread-local buffer.
+ *
+ * Recorded events can be written out with #BLI_profile_save_json in the Trace Event format
+ * that `chrome://tracing` (and compatible viewers such as Perfetto) load directly.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Start/stop recording of profile scopes (no-op unless built with `WITH_PROFILE`). */
+void BLI_profile_enable(void);
+void BLI_profile_disable(void);
+bool BLI_profile_is_enabled(void);
+
+/** Discard all recorded events. */
+void BLI_profile_clear(void);
+
+/**
+ * Write recorded events to \a filepath in chrome-trace JSON format.
+ * \return true on success.
+ */
+bool BLI_profile_save_json(const char *filepath);
+
+/* Internal, use the macros below so call sites compile out. */
+void _bli_profile_scope_begin(const char *name);
+void _bli_profile_scope_end(void);
+
+#ifdef WITH_PROFILE
+#  define BLI_PROFILE_SCOPE_BEGIN(name) _bli_profile_scope_begin(name)
+#  define BLI_PROFILE_SCOPE_END() _bli_profile_scope_end()
+#else
+#  define BLI_PROFILE_SCOPE_BEGIN(name) ((void)0)
+#  define BLI_PROFILE_SCOPE_END() ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+
+#  ifdef WITH_PROFILE
+
+namespace blender::profile {
+
+class ProfileScope {
+ public:
+  ProfileScope(const char *name)
+  {
+    _bli_profile_scope_begin(name);
+  }
+
+  ~ProfileScope()
+  {
+    _bli_profile_scope_end();
+  }
+};
+
+}  // namespace blender::profile
+
+/** Record a scope covering the rest of the current C++ block. */
+#    define BLI_PROFILE_SCOPE(name) blender::profile::ProfileScope profile_scope(name)
+#  else
+/* Important not to evaluate the name expression, it may be costly to compute. */
+#    define BLI_PROFILE_SCOPE(name) ((void)0)
+#  endif
+
+#endif
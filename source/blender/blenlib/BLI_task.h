@@ -325,10 +325,20 @@ typedef void (*TaskGraphNodeFreeFunction)(void *task_data);
 struct TaskGraph *BLI_task_graph_create(void);
 void BLI_task_graph_work_and_wait(struct TaskGraph *task_graph);
 void BLI_task_graph_free(struct TaskGraph *task_graph);
+/**
+ * Nodes run at normal priority. Nodes that gate a lot of successors (the root of a sub-graph
+ * e.g.) can be created with #TASK_PRIORITY_HIGH through the `_ex` variant, so the scheduler
+ * prefers them when multiple graphs compete for workers and successors become available sooner.
+ */
 struct TaskNode *BLI_task_graph_node_create(struct TaskGraph *task_graph,
                                             TaskGraphNodeRunFunction run,
                                             void *user_data,
                                             TaskGraphNodeFreeFunction free_func);
+struct TaskNode *BLI_task_graph_node_create_ex(struct TaskGraph *task_graph,
+                                               TaskGraphNodeRunFunction run,
+                                               void *user_data,
+                                               TaskGraphNodeFreeFunction free_func,
+                                               TaskPriority priority);
 bool BLI_task_graph_node_push_work(struct TaskNode *task_node);
 void BLI_task_graph_edge_create(struct TaskNode *from_node, struct TaskNode *to_node);
 
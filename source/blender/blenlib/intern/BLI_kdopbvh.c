@@ -44,6 +44,7 @@
 #include "BLI_heap_simple.h"
 #include "BLI_kdopbvh.h"
 #include "BLI_math.h"
+#include "BLI_simd.h"
 #include "BLI_stack.h"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
@@ -387,30 +388,74 @@ static void create_kdop_hull(
 /**
  * \note depends on the fact that the BVH's for each face is already built
  */
+typedef struct BVHRefitHullData {
+  const BVHTree *tree;
+} BVHRefitHullData;
+
+static void refit_kdop_hull_merge_bv(const BVHTree *tree,
+                                     float *__restrict bv,
+                                     const float *__restrict node_bv)
+{
+  for (axis_t axis_iter = tree->start_axis; axis_iter < tree->stop_axis; axis_iter++) {
+    const float newmin = node_bv[(2 * axis_iter)];
+    if ((newmin < bv[(2 * axis_iter)])) {
+      bv[(2 * axis_iter)] = newmin;
+    }
+
+    const float newmax = node_bv[(2 * axis_iter) + 1];
+    if ((newmax > bv[(2 * axis_iter) + 1])) {
+      bv[(2 * axis_iter) + 1] = newmax;
+    }
+  }
+}
+
+static void refit_kdop_hull_task_cb(void *__restrict userdata,
+                                    const int j,
+                                    const TaskParallelTLS *__restrict tls)
+{
+  BVHRefitHullData *data = userdata;
+  float *bv = tls->userdata_chunk;
+  refit_kdop_hull_merge_bv(data->tree, bv, data->tree->nodes[j]->bv);
+}
+
+static void refit_kdop_hull_reduce_cb(const void *__restrict userdata,
+                                      void *__restrict chunk_join,
+                                      void *__restrict chunk)
+{
+  const BVHRefitHullData *data = userdata;
+  refit_kdop_hull_merge_bv(data->tree, chunk_join, chunk);
+}
+
 static void refit_kdop_hull(const BVHTree *tree, BVHNode *node, int start, int end)
 {
-  float newmin, newmax;
-  float *__restrict bv = node->bv;
   int j;
-  axis_t axis_iter;
 
   node_minmax_init(tree, node);
 
-  for (j = start; j < end; j++) {
-    float *__restrict node_bv = tree->nodes[j]->bv;
+  /* Branches near the root cover most of the leaves, while their build level has too few
+   * branches to occupy all threads; reduce their hull over a parallel range instead
+   * (ranges this size only exist in the first few levels, deeper levels parallelize over
+   * the branches themselves). */
+  if (end - start > KDOPBVH_THREAD_LEAF_THRESHOLD * 4) {
+    BVHRefitHullData data = {.tree = tree};
+    /* `tree->axis` is at most 26 (13 min/max pairs). */
+    float bv[26];
+    const size_t bv_size = sizeof(float) * (size_t)tree->axis;
+    memcpy(bv, node->bv, bv_size);
 
-    /* for all Axes. */
-    for (axis_iter = tree->start_axis; axis_iter < tree->stop_axis; axis_iter++) {
-      newmin = node_bv[(2 * axis_iter)];
-      if ((newmin < bv[(2 * axis_iter)])) {
-        bv[(2 * axis_iter)] = newmin;
-      }
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.userdata_chunk = bv;
+    settings.userdata_chunk_size = bv_size;
+    settings.func_reduce = refit_kdop_hull_reduce_cb;
+    BLI_task_parallel_range(start, end, &data, refit_kdop_hull_task_cb, &settings);
 
-      newmax = node_bv[(2 * axis_iter) + 1];
-      if ((newmax > bv[(2 * axis_iter) + 1])) {
-        bv[(2 * axis_iter) + 1] = newmax;
-      }
-    }
+    memcpy(node->bv, bv, bv_size);
+    return;
+  }
+
+  for (j = start; j < end; j++) {
+    refit_kdop_hull_merge_bv(tree, node->bv, tree->nodes[j]->bv);
   }
 }
 
@@ -1993,6 +2038,140 @@ int BLI_bvhtree_ray_cast(BVHTree *tree,
       tree, co, dir, radius, hit, callback, userdata, BVH_RAYCAST_DEFAULT);
 }
 
+#ifdef BLI_HAVE_SSE2
+/**
+ * Slab test of one ray against the bounding boxes of up to 4 nodes at once
+ * (4-lane version of #fast_ray_nearest_hit, with matching results):
+ * the distance the ray travels to a hit box, FLT_MAX for a miss.
+ */
+static void fast_ray_nearest_hit_simd4(const BVHRayCastData *data,
+                                       BVHNode *const *nodes,
+                                       const int node_num,
+                                       float r_dist[4])
+{
+  float bv_near[3][4], bv_far[3][4];
+
+  for (int k = 0; k < node_num; k++) {
+    const float *bv = nodes[k]->bv;
+    for (int i = 0; i < 3; i++) {
+      bv_near[i][k] = bv[data->index[2 * i]];
+      bv_far[i][k] = bv[data->index[2 * i + 1]];
+    }
+  }
+  /* Pad with the first node, the duplicate lanes are simply unused. */
+  for (int k = node_num; k < 4; k++) {
+    for (int i = 0; i < 3; i++) {
+      bv_near[i][k] = bv_near[i][0];
+      bv_far[i][k] = bv_far[i][0];
+    }
+  }
+
+  const __m128 flt_max = _mm_set1_ps(FLT_MAX);
+  __m128 tmin = _mm_set1_ps(-FLT_MAX);
+  __m128 tmax = flt_max;
+  for (int i = 0; i < 3; i++) {
+    const __m128 origin = _mm_set1_ps(data->ray.origin[i]);
+    const __m128 idot = _mm_set1_ps(data->idot_axis[i]);
+    tmin = _mm_max_ps(tmin, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(bv_near[i]), origin), idot));
+    tmax = _mm_min_ps(tmax, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(bv_far[i]), origin), idot));
+  }
+  __m128 mask = _mm_and_ps(_mm_cmple_ps(tmin, tmax), _mm_cmpge_ps(tmax, _mm_setzero_ps()));
+  mask = _mm_and_ps(mask, _mm_cmplt_ps(tmin, _mm_set1_ps(data->hit.dist)));
+  _mm_storeu_ps(r_dist, _mm_or_ps(_mm_and_ps(mask, tmin), _mm_andnot_ps(mask, flt_max)));
+}
+
+/**
+ * A version of #dfs_raycast that rejects the children of a node 4 at a time,
+ * instead of re-testing each child's bounding box on entry.
+ * Only used for `radius == 0` rays (same limitation as #fast_ray_nearest_hit).
+ */
+static void dfs_raycast_simd(BVHRayCastData *data, BVHNode *node)
+{
+  float child_dist[MAX_TREETYPE];
+  const int totnode = node->totnode;
+
+  for (int i = 0; i < totnode; i += 4) {
+    fast_ray_nearest_hit_simd4(data, node->children + i, MIN2(totnode - i, 4), child_dist + i);
+  }
+
+  /* pick loop direction to dive into the tree (based on ray direction and split axis) */
+  const bool forward = data->ray_dot_axis[node->main_axis] > 0.0f;
+  for (int n = 0; n < totnode; n++) {
+    const int i = forward ? n : totnode - 1 - n;
+    /* Test against the hit distance again, it may have shrunk since the batched test. */
+    if (child_dist[i] >= data->hit.dist) {
+      continue;
+    }
+    BVHNode *child = node->children[i];
+    if (child->totnode == 0) {
+      if (data->callback) {
+        data->callback(data->userdata, child->index, &data->ray, &data->hit);
+      }
+      else {
+        data->hit.index = child->index;
+        data->hit.dist = child_dist[i];
+        madd_v3_v3v3fl(data->hit.co, data->ray.origin, data->ray.direction, child_dist[i]);
+      }
+    }
+    else {
+      dfs_raycast_simd(data, child);
+    }
+  }
+}
+#endif /* BLI_HAVE_SSE2 */
+
+int BLI_bvhtree_ray_cast_batch(BVHTree *tree,
+                               const float (*co_array)[3],
+                               const float (*dir_array)[3],
+                               float radius,
+                               int ray_num,
+                               BVHTreeRayHit *hits,
+                               BVHTree_RayCastCallback callback,
+                               void *userdata)
+{
+  BVHNode *root = tree->nodes[tree->totleaf];
+  int hits_num = 0;
+
+  for (int ray_i = 0; ray_i < ray_num; ray_i++) {
+    BVHRayCastData data;
+
+    data.tree = tree;
+    data.callback = callback;
+    data.userdata = userdata;
+
+    copy_v3_v3(data.ray.origin, co_array[ray_i]);
+    copy_v3_v3(data.ray.direction, dir_array[ray_i]);
+    data.ray.radius = radius;
+
+    BLI_ASSERT_UNIT_V3(data.ray.direction);
+
+    bvhtree_ray_cast_data_precalc(&data, BVH_RAYCAST_DEFAULT);
+
+    memcpy(&data.hit, &hits[ray_i], sizeof(data.hit));
+
+    if (root) {
+#ifdef BLI_HAVE_SSE2
+      if ((data.ray.radius == 0.0f) && (root->totnode != 0)) {
+        if (fast_ray_nearest_hit(&data, root) < data.hit.dist) {
+          dfs_raycast_simd(&data, root);
+        }
+      }
+      else
+#endif
+      {
+        dfs_raycast(&data, root);
+      }
+    }
+
+    memcpy(&hits[ray_i], &data.hit, sizeof(data.hit));
+    if (data.hit.index != -1) {
+      hits_num++;
+    }
+  }
+
+  return hits_num;
+}
+
 float BLI_bvhtree_bb_raycast(const float bv[6],
                              const float light_start[3],
                              const float light_end[3],
@@ -39,6 +39,8 @@
 #include "BLI_mempool.h"         /* own include */
 #include "BLI_mempool_private.h" /* own include */
 
+#include "BLI_threads.h"
+
 #include "MEM_guardedalloc.h"
 
 #include "BLI_strict_flags.h" /* keep last */
@@ -130,8 +132,10 @@ struct BLI_mempool {
   BLI_freenode *free;
   /** Use to know how many chunks to keep for #BLI_mempool_clear. */
   uint maxchunks;
-  /** Number of elements currently in use. */
+  /** Number of elements currently in use (including elements held by a #BLI_mempool_cache). */
   uint totused;
+  /** Serializes the shared free list between thread-local caches, see #BLI_mempool_cache_init. */
+  SpinLock cache_lock;
 #ifdef USE_TOTALLOC
   /** Number of elements allocated in total. */
   uint totalloc;
@@ -311,6 +315,7 @@ BLI_mempool *BLI_mempool_create(uint esize, uint totelem, uint pchunk, uint flag
   pool->pchunk = pchunk;
   pool->flag = flag;
   pool->free = NULL; /* mempool_chunk_add assigns */
+  BLI_spin_init(&pool->cache_lock);
   pool->maxchunks = maxchunks;
 #ifdef USE_TOTALLOC
   pool->totalloc = 0;
@@ -452,6 +457,118 @@ void BLI_mempool_free(BLI_mempool *pool, void *addr)
   }
 }
 
+/* -------------------------------------------------------------------- */
+/* Thread-local allocation caches. */
+
+/**
+ * One shared-lock round-trip hands out this many elements,
+ * everything in between is lock-free thread-private list manipulation.
+ */
+#define MEMPOOL_CACHE_BATCH_SIZE 64
+
+void BLI_mempool_cache_init(BLI_mempool *pool, BLI_mempool_cache *cache)
+{
+  cache->pool = pool;
+  cache->free = NULL;
+  cache->free_num = 0;
+}
+
+void *BLI_mempool_cache_alloc(BLI_mempool_cache *cache)
+{
+  BLI_mempool *pool = cache->pool;
+
+  if (UNLIKELY(cache->free == NULL)) {
+    /* Batched chunk handout: grab #MEMPOOL_CACHE_BATCH_SIZE free elements from the shared pool
+     * in one locked section. The elements keep their freeword while they sit in the cache, so
+     * iteration (which the caller must only do from one thread anyway) skips them. */
+    BLI_freenode *batch = NULL;
+    uint batch_num = 0;
+
+    BLI_spin_lock(&pool->cache_lock);
+    while (batch_num < MEMPOOL_CACHE_BATCH_SIZE) {
+      if (UNLIKELY(pool->free == NULL)) {
+        BLI_mempool_chunk *mpchunk = mempool_chunk_alloc(pool);
+        mempool_chunk_add(pool, mpchunk, NULL);
+      }
+      BLI_freenode *node = pool->free;
+      pool->free = node->next;
+      node->next = batch;
+      batch = node;
+      batch_num++;
+    }
+    pool->totused += batch_num;
+    BLI_spin_unlock(&pool->cache_lock);
+
+    cache->free = batch;
+    cache->free_num = batch_num;
+  }
+
+  BLI_freenode *free_pop = cache->free;
+  cache->free = free_pop->next;
+  cache->free_num--;
+
+  if (pool->flag & BLI_MEMPOOL_ALLOW_ITER) {
+    free_pop->freeword = USEDWORD;
+  }
+
+#ifdef WITH_MEM_VALGRIND
+  VALGRIND_MEMPOOL_ALLOC(pool, free_pop, pool->esize);
+#endif
+
+  return (void *)free_pop;
+}
+
+void BLI_mempool_cache_free(BLI_mempool_cache *cache, void *addr)
+{
+  BLI_freenode *newhead = addr;
+
+  if (cache->pool->flag & BLI_MEMPOOL_ALLOW_ITER) {
+#ifndef NDEBUG
+    /* This will detect double free's. */
+    BLI_assert(newhead->freeword != FREEWORD);
+#endif
+    newhead->freeword = FREEWORD;
+  }
+
+  newhead->next = cache->free;
+  cache->free = newhead;
+  cache->free_num++;
+
+#ifdef WITH_MEM_VALGRIND
+  VALGRIND_MEMPOOL_FREE(cache->pool, addr);
+#endif
+
+  /* Bound the private list, so a thread doing mostly frees feeds the other threads again. */
+  if (UNLIKELY(cache->free_num >= MEMPOOL_CACHE_BATCH_SIZE * 2)) {
+    BLI_mempool_cache_flush(cache);
+  }
+}
+
+void BLI_mempool_cache_flush(BLI_mempool_cache *cache)
+{
+  BLI_mempool *pool = cache->pool;
+
+  if (cache->free == NULL) {
+    return;
+  }
+
+  BLI_freenode *tail = cache->free;
+  while (tail->next != NULL) {
+    tail = tail->next;
+  }
+
+  BLI_spin_lock(&pool->cache_lock);
+  tail->next = pool->free;
+  pool->free = cache->free;
+  pool->totused -= cache->free_num;
+  BLI_spin_unlock(&pool->cache_lock);
+
+  cache->free = NULL;
+  cache->free_num = 0;
+}
+
+#undef MEMPOOL_CACHE_BATCH_SIZE
+
 int BLI_mempool_len(const BLI_mempool *pool)
 {
   return (int)pool->totused;
@@ -781,6 +898,7 @@ void BLI_mempool_clear(BLI_mempool *pool)
  */
 void BLI_mempool_destroy(BLI_mempool *pool)
 {
+  BLI_spin_end(&pool->cache_lock);
   mempool_chunk_free_all(pool->chunks);
 
 #ifdef WITH_MEM_VALGRIND
@@ -24,6 +24,7 @@
 #include "BLI_mmap.h"
 #include "BLI_fileops.h"
 #include "BLI_listbase.h"
+#include "BLI_threads.h"
 #include "MEM_guardedalloc.h"
 
 #include <string.h>
@@ -73,6 +74,11 @@ static struct error_handler_data {
   void (*next_handler)(int, siginfo_t *, void *);
 } error_handler = {0};
 
+/* Files may be mapped and unmapped from multiple threads (e.g. concurrently opened library
+ * files), so mutations of the list need a lock. The signal handler itself runs on the faulting
+ * thread and cannot take locks, it only walks the list. */
+static ThreadMutex open_mmaps_mutex = BLI_MUTEX_INITIALIZER;
+
 static void sigbus_handler(int sig, siginfo_t *siginfo, void *ptr)
 {
   /* We only handle SIGBUS here for now. */
@@ -111,6 +117,9 @@ static void sigbus_handler(int sig, siginfo_t *siginfo, void *ptr)
 /* Ensures that the error handler is set up and ready. */
 static bool sigbus_handler_setup(void)
 {
+  bool success = true;
+
+  BLI_mutex_lock(&open_mmaps_mutex);
   if (!error_handler.configured) {
     struct sigaction newact = {0}, oldact = {0};
 
@@ -118,29 +127,35 @@ static bool sigbus_handler_setup(void)
     newact.sa_flags = SA_SIGINFO;
 
     if (sigaction(SIGBUS, &newact, &oldact)) {
-      return false;
+      success = false;
+    }
+    else {
+      /* Remember the previously configured handler to fall back to it if the error
+       * does not belong to any of the mapped files. */
+      error_handler.next_handler = oldact.sa_sigaction;
+      error_handler.configured = 1;
     }
-
-    /* Remember the previously configured handler to fall back to it if the error
-     * does not belong to any of the mapped files. */
-    error_handler.next_handler = oldact.sa_sigaction;
-    error_handler.configured = 1;
   }
+  BLI_mutex_unlock(&open_mmaps_mutex);
 
-  return true;
+  return success;
 }
 
 /* Adds a file to the list that the error handler checks. */
 static void sigbus_handler_add(BLI_mmap_file *file)
 {
+  BLI_mutex_lock(&open_mmaps_mutex);
   BLI_addtail(&error_handler.open_mmaps, BLI_genericNodeN(file));
+  BLI_mutex_unlock(&open_mmaps_mutex);
 }
 
 /* Removes a file from the list that the error handler checks. */
 static void sigbus_handler_remove(BLI_mmap_file *file)
 {
+  BLI_mutex_lock(&open_mmaps_mutex);
   LinkData *link = BLI_findptr(&error_handler.open_mmaps, file, offsetof(LinkData, data));
   BLI_freelinkN(&error_handler.open_mmaps, link);
+  BLI_mutex_unlock(&open_mmaps_mutex);
 }
 #endif
 
@@ -223,6 +238,23 @@ void *BLI_mmap_get_pointer(BLI_mmap_file *file)
   return file->memory;
 }
 
+void BLI_mmap_read_ahead(BLI_mmap_file *file, size_t offset, size_t length)
+{
+  if (file->io_error || (offset + length > file->length)) {
+    return;
+  }
+
+#if !defined(WIN32) && defined(MADV_WILLNEED)
+  /* Round down to page boundaries as required by madvise. */
+  const size_t page_mask = (size_t)sysconf(_SC_PAGESIZE) - 1;
+  const size_t start = offset & ~page_mask;
+  madvise(file->memory + start, length + (offset - start), MADV_WILLNEED);
+#else
+  /* No portable read-ahead hint, pages are simply faulted in on access. */
+  (void)file;
+#endif
+}
+
 void BLI_mmap_free(BLI_mmap_file *file)
 {
 #ifndef WIN32
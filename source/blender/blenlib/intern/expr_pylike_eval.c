@@ -31,7 +31,7 @@
  *  - Constants:
  *      pi, True, False
  *  - Operators:
- *      +, -, *, /, ==, !=, <, <=, >, >=, and, or, not, ternary if
+ *      +, -, *, /, %, **, //, ==, !=, <, <=, >, >=, and, or, not, ternary if
  *  - Functions:
  *      min, max, radians, degrees,
  *      abs, fabs, floor, ceil, trunc, int,
@@ -325,6 +325,21 @@ static double op_sub(double a, double b)
   return a - b;
 }
 
+static double op_mod(double a, double b)
+{
+  /* Match Python: the result takes the sign of the divisor. */
+  double r = fmod(a, b);
+  if (r != 0.0 && (r < 0.0) != (b < 0.0)) {
+    r += b;
+  }
+  return r;
+}
+
+static double op_floordiv(double a, double b)
+{
+  return floor(a / b);
+}
+
 static double op_radians(double arg)
 {
   return arg * M_PI / 180.0;
@@ -477,6 +492,8 @@ static BuiltinOpDef builtin_ops[] = {
 #define TOKEN_NOT MAKE_CHAR2('N', 'O')
 #define TOKEN_IF MAKE_CHAR2('I', 'F')
 #define TOKEN_ELSE MAKE_CHAR2('E', 'L')
+#define TOKEN_POW MAKE_CHAR2('*', '*')
+#define TOKEN_FLOORDIV MAKE_CHAR2('/', '/')
 
 static const char *token_eq_characters = "!=><";
 static const char *token_characters = "~`!@#$%^&*+-=/\\?:;<>(){}[]|.,\"'";
@@ -713,6 +730,13 @@ static bool parse_next_token(ExprParseState *state)
     return (end == out);
   }
 
+  /* ** and // operators */
+  if ((state->cur[0] == '*' || state->cur[0] == '/') && state->cur[1] == state->cur[0]) {
+    state->token = MAKE_CHAR2(state->cur[0], state->cur[1]);
+    state->cur += 2;
+    return true;
+  }
+
   /* ?= tokens */
   if (state->cur[1] == '=' && strchr(token_eq_characters, state->cur[0])) {
     state->token = MAKE_CHAR2(state->cur[0], state->cur[1]);
@@ -757,6 +781,7 @@ static bool parse_next_token(ExprParseState *state)
  * \{ */
 
 static bool parse_expr(ExprParseState *state);
+static bool parse_pow(ExprParseState *state);
 
 static int parse_function_args(ExprParseState *state)
 {
@@ -798,10 +823,12 @@ static bool parse_unary(ExprParseState *state)
 
   switch (state->token) {
     case '+':
-      return parse_next_token(state) && parse_unary(state);
+      /* Recurse into parse_pow so that like in Python, ** binds
+       * tighter than unary minus on its left: -x**2 == -(x**2). */
+      return parse_next_token(state) && parse_pow(state);
 
     case '-':
-      CHECK_ERROR(parse_next_token(state) && parse_unary(state));
+      CHECK_ERROR(parse_next_token(state) && parse_pow(state));
       parse_add_func(state, OPCODE_FUNC1, 1, op_negate);
       return true;
 
@@ -875,22 +902,45 @@ static bool parse_unary(ExprParseState *state)
   }
 }
 
-static bool parse_mul(ExprParseState *state)
+static bool parse_pow(ExprParseState *state)
 {
   CHECK_ERROR(parse_unary(state));
 
+  if (state->token == TOKEN_POW) {
+    /* Right associative, and the right operand may be a unary expression. */
+    CHECK_ERROR(parse_next_token(state) && parse_pow(state));
+    parse_add_func(state, OPCODE_FUNC2, 2, pow);
+  }
+
+  return true;
+}
+
+static bool parse_mul(ExprParseState *state)
+{
+  CHECK_ERROR(parse_pow(state));
+
   for (;;) {
     switch (state->token) {
       case '*':
-        CHECK_ERROR(parse_next_token(state) && parse_unary(state));
+        CHECK_ERROR(parse_next_token(state) && parse_pow(state));
         parse_add_func(state, OPCODE_FUNC2, 2, op_mul);
         break;
 
       case '/':
-        CHECK_ERROR(parse_next_token(state) && parse_unary(state));
+        CHECK_ERROR(parse_next_token(state) && parse_pow(state));
         parse_add_func(state, OPCODE_FUNC2, 2, op_div);
         break;
 
+      case TOKEN_FLOORDIV:
+        CHECK_ERROR(parse_next_token(state) && parse_pow(state));
+        parse_add_func(state, OPCODE_FUNC2, 2, op_floordiv);
+        break;
+
+      case '%':
+        CHECK_ERROR(parse_next_token(state) && parse_pow(state));
+        parse_add_func(state, OPCODE_FUNC2, 2, op_mod);
+        break;
+
       default:
         return true;
     }
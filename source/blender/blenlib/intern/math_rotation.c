@@ -24,6 +24,7 @@
  */
 
 #include "BLI_math.h"
+#include "BLI_simd.h"
 
 #include "BLI_strict_flags.h"
 
@@ -2079,6 +2080,17 @@ void add_weighted_dq_dq(DualQuat *dq_sum, const DualQuat *dq, float weight)
   }
 
   /* interpolate rotation and translation */
+#ifdef BLI_HAVE_SSE2
+  {
+    const __m128 weight_vec = _mm_set1_ps(weight);
+    _mm_storeu_ps(dq_sum->quat,
+                  _mm_add_ps(_mm_loadu_ps(dq_sum->quat),
+                             _mm_mul_ps(weight_vec, _mm_loadu_ps(dq->quat))));
+    _mm_storeu_ps(dq_sum->trans,
+                  _mm_add_ps(_mm_loadu_ps(dq_sum->trans),
+                             _mm_mul_ps(weight_vec, _mm_loadu_ps(dq->trans))));
+  }
+#else
   dq_sum->quat[0] += weight * dq->quat[0];
   dq_sum->quat[1] += weight * dq->quat[1];
   dq_sum->quat[2] += weight * dq->quat[2];
@@ -2088,6 +2100,7 @@ void add_weighted_dq_dq(DualQuat *dq_sum, const DualQuat *dq, float weight)
   dq_sum->trans[1] += weight * dq->trans[1];
   dq_sum->trans[2] += weight * dq->trans[2];
   dq_sum->trans[3] += weight * dq->trans[3];
+#endif
 
   /* Interpolate scale - but only if there is scale present. If any dual
    * quaternions without scale are added, they will be compensated for in
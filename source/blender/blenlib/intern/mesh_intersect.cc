@@ -2699,32 +2699,37 @@ static void calc_cluster_tris(Array<IMesh> &tri_subdivided,
                               const Array<CDT_data> &cluster_subdivided,
                               IMeshArena *arena)
 {
-  for (int c : clinfo.index_range()) {
-    const CoplanarCluster &cl = clinfo.cluster(c);
-    const CDT_data &cd = cluster_subdivided[c];
-    /* Each triangle in cluster c should be an input triangle in cd.input_faces.
-     * (See prepare_cdt_input_for_cluster.)
-     * So accumulate a Vector of Face* for each input face by going through the
-     * output faces and making a Face for each input face that it is part of.
-     * (The Boolean algorithm wants duplicates if a given output triangle is part
-     * of more than one input triangle.)
-     */
-    int n_cluster_tris = cl.tot_tri();
-    const CDT_result<mpq_class> &cdt_out = cd.cdt_out;
-    BLI_assert(cd.input_face.size() == n_cluster_tris);
-    Array<Vector<Face *>> face_vec(n_cluster_tris);
-    for (int cdt_out_t : cdt_out.face.index_range()) {
-      for (int cdt_in_t : cdt_out.face_orig[cdt_out_t]) {
-        Face *f = cdt_tri_as_imesh_face(cdt_out_t, cdt_in_t, cd, tm, arena);
-        face_vec[cdt_in_t].append(f);
+  /* A triangle is part of at most one cluster, so the clusters write into
+   * disjoint parts of tri_subdivided and can be processed in parallel
+   * (the arena is locked internally when multi-threading). */
+  threading::parallel_for(clinfo.index_range(), 1, [&](IndexRange range) {
+    for (int c : range) {
+      const CoplanarCluster &cl = clinfo.cluster(c);
+      const CDT_data &cd = cluster_subdivided[c];
+      /* Each triangle in cluster c should be an input triangle in cd.input_faces.
+       * (See prepare_cdt_input_for_cluster.)
+       * So accumulate a Vector of Face* for each input face by going through the
+       * output faces and making a Face for each input face that it is part of.
+       * (The Boolean algorithm wants duplicates if a given output triangle is part
+       * of more than one input triangle.)
+       */
+      int n_cluster_tris = cl.tot_tri();
+      const CDT_result<mpq_class> &cdt_out = cd.cdt_out;
+      BLI_assert(cd.input_face.size() == n_cluster_tris);
+      Array<Vector<Face *>> face_vec(n_cluster_tris);
+      for (int cdt_out_t : cdt_out.face.index_range()) {
+        for (int cdt_in_t : cdt_out.face_orig[cdt_out_t]) {
+          Face *f = cdt_tri_as_imesh_face(cdt_out_t, cdt_in_t, cd, tm, arena);
+          face_vec[cdt_in_t].append(f);
+        }
+      }
+      for (int cdt_in_t : cd.input_face.index_range()) {
+        int tm_t = cd.input_face[cdt_in_t];
+        BLI_assert(tri_subdivided[tm_t].face_size() == 0);
+        tri_subdivided[tm_t] = IMesh(face_vec[cdt_in_t]);
       }
     }
-    for (int cdt_in_t : cd.input_face.index_range()) {
-      int tm_t = cd.input_face[cdt_in_t];
-      BLI_assert(tri_subdivided[tm_t].face_size() == 0);
-      tri_subdivided[tm_t] = IMesh(face_vec[cdt_in_t]);
-    }
-  }
+  });
 }
 
 static CDT_data calc_cluster_subdivided(const CoplanarClusterInfo &clinfo,
@@ -3079,10 +3084,15 @@ IMesh trimesh_nary_intersect(const IMesh &tm_in,
   std::cout << "subdivided non-cluster tris found, time = " << subdivided_tris_time - itt_time
             << "\n";
 #  endif
+  /* The CDT sub-problems for separate clusters are independent, and there are
+   * usually few but expensive clusters, hence the grain size of 1. */
   Array<CDT_data> cluster_subdivided(clinfo.tot_cluster());
-  for (int c : clinfo.index_range()) {
-    cluster_subdivided[c] = calc_cluster_subdivided(clinfo, c, *tm_clean, tri_ov, itt_map, arena);
-  }
+  threading::parallel_for(clinfo.index_range(), 1, [&](IndexRange range) {
+    for (int c : range) {
+      cluster_subdivided[c] = calc_cluster_subdivided(
+          clinfo, c, *tm_clean, tri_ov, itt_map, arena);
+    }
+  });
 #  ifdef PERFDEBUG
   double cluster_subdivide_time = PIL_check_seconds_timer();
   std::cout << "subdivided clusters found, time = "
@@ -0,0 +1,186 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/** \file
+ * \ingroup bli
+ *
+ * Zoned profiling instrumentation, see BLI_profile.h for an overview.
+ *
+ * Open scopes are tracked on a thread-local stack so begin/end need no synchronization;
+ * only completed events take the shared mutex, once per scope. Zones are coarse grained
+ * (depsgraph operations, draw passes, modifiers), so this does not measurably serialize
+ * the threads being measured.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "BLI_profile.h"
+#include "BLI_utildefines.h"
+
+namespace blender::profile {
+
+using Clock = std::chrono::steady_clock;
+
+struct ProfileEvent {
+  std::string name;
+  uint64_t begin_ns;
+  uint64_t end_ns;
+  uint32_t thread_id;
+};
+
+struct ProfileScopeStackEntry {
+  std::string name;
+  uint64_t begin_ns;
+};
+
+static std::atomic<bool> profile_enabled = false;
+
+static std::mutex events_mutex;
+static std::vector<ProfileEvent> events;
+static std::atomic<uint32_t> thread_id_next = 0;
+
+/* Scopes that have begun but not ended yet on this thread. */
+static thread_local std::vector<ProfileScopeStackEntry> scope_stack;
+static thread_local uint32_t thread_id = 0;
+static thread_local bool thread_id_assigned = false;
+
+static uint64_t now_ns()
+{
+  return uint64_t(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch())
+          .count());
+}
+
+static void scope_begin(const char *name)
+{
+  if (!thread_id_assigned) {
+    thread_id = thread_id_next.fetch_add(1);
+    thread_id_assigned = true;
+  }
+  scope_stack.push_back({name, now_ns()});
+}
+
+static void scope_end()
+{
+  /* Recording may have been enabled while scopes were already open, or cleared in between;
+   * silently ignore unmatched ends. */
+  if (scope_stack.empty()) {
+    return;
+  }
+  const uint64_t end_ns = now_ns();
+  ProfileScopeStackEntry entry = std::move(scope_stack.back());
+  scope_stack.pop_back();
+
+  std::lock_guard<std::mutex> lock(events_mutex);
+  events.push_back({std::move(entry.name), entry.begin_ns, end_ns, thread_id});
+}
+
+static void json_write_escaped(FILE *file, const std::string &str)
+{
+  for (const char c : str) {
+    if (ELEM(c, '"', '\\')) {
+      fputc('\\', file);
+      fputc(c, file);
+    }
+    else if (uchar(c) < 0x20) {
+      fprintf(file, "\\u%04x", int(uchar(c)));
+    }
+    else {
+      fputc(c, file);
+    }
+  }
+}
+
+static bool save_json(const char *filepath)
+{
+  std::lock_guard<std::mutex> lock(events_mutex);
+
+  FILE *file = fopen(filepath, "w");
+  if (file == nullptr) {
+    return false;
+  }
+
+  /* Chrome Trace Event format, "X" (complete) events with microsecond timestamps. */
+  fprintf(file, "{\"traceEvents\":[");
+  bool first = true;
+  for (const ProfileEvent &event : events) {
+    fprintf(file,
+            "%s\n{\"name\":\"",
+            first ? "" : ",");
+    json_write_escaped(file, event.name);
+    fprintf(file,
+            "\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+            event.thread_id,
+            double(event.begin_ns) / 1000.0,
+            double(event.end_ns - event.begin_ns) / 1000.0);
+    first = false;
+  }
+  fprintf(file, "\n]}\n");
+
+  const bool success = (fclose(file) == 0);
+  return success;
+}
+
+}  // namespace blender::profile
+
+using namespace blender::profile;
+
+void BLI_profile_enable()
+{
+  profile_enabled.store(true, std::memory_order_relaxed);
+}
+
+void BLI_profile_disable()
+{
+  profile_enabled.store(false, std::memory_order_relaxed);
+}
+
+bool BLI_profile_is_enabled()
+{
+  return profile_enabled.load(std::memory_order_relaxed);
+}
+
+void BLI_profile_clear()
+{
+  std::lock_guard<std::mutex> lock(events_mutex);
+  events.clear();
+}
+
+bool BLI_profile_save_json(const char *filepath)
+{
+  return save_json(filepath);
+}
+
+void _bli_profile_scope_begin(const char *name)
+{
+  if (!BLI_profile_is_enabled()) {
+    return;
+  }
+  scope_begin(name);
+}
+
+void _bli_profile_scope_end()
+{
+  if (!BLI_profile_is_enabled() && scope_stack.empty()) {
+    return;
+  }
+  scope_end();
+}
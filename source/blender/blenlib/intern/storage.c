@@ -225,6 +225,35 @@ size_t BLI_file_size(const char *path)
   return stats.st_size;
 }
 
+/**
+ * Hint the operating system to asynchronously load a file into its cache.
+ *
+ * Returns immediately: the actual read happens in the background, so a later read of the same
+ * file is served from memory. Only a hint, missing files and platforms without support are
+ * silently ignored.
+ */
+void BLI_file_read_ahead(const char *path)
+{
+#ifdef WIN32
+  /* No light-weight read-ahead hint available, rely on the system cache heuristics. */
+  (void)path;
+#else
+  int file = open(path, O_RDONLY);
+  if (file == -1) {
+    return;
+  }
+#  ifdef __APPLE__
+  struct radvisory ra;
+  ra.ra_offset = 0;
+  ra.ra_count = (int)BLI_file_descriptor_size(file);
+  fcntl(file, F_RDADVISE, &ra);
+#  else
+  posix_fadvise(file, 0, 0, POSIX_FADV_WILLNEED);
+#  endif
+  close(file);
+#endif
+}
+
 /* Return file attributes. Apple version of this function is defined in storage_apple.mm */
 #ifndef __APPLE__
 eFileAttributes BLI_file_attributes(const char *path)
@@ -62,12 +62,19 @@ struct TaskNode {
   TaskNode(TaskGraph *task_graph,
            TaskGraphNodeRunFunction run_func,
            void *task_data,
-           TaskGraphNodeFreeFunction free_func)
+           TaskGraphNodeFreeFunction free_func,
+           TaskPriority priority)
       :
 #ifdef WITH_TBB
         tbb_node(task_graph->tbb_graph,
                  tbb::flow::unlimited,
-                 [&](const tbb::flow::continue_msg input) { run(input); }),
+                 [&](const tbb::flow::continue_msg input) { run(input); }
+#  if TBB_INTERFACE_VERSION_MAJOR >= 11
+                 ,
+                 (priority == TASK_PRIORITY_HIGH) ? tbb::flow::node_priority_t(1) :
+                                                    tbb::flow::no_priority
+#  endif
+                 ),
 #endif
         run_func(run_func),
         task_data(task_data),
@@ -75,6 +82,9 @@ struct TaskNode {
   {
 #ifndef WITH_TBB
     UNUSED_VARS(task_graph);
+#endif
+#if !defined(WITH_TBB) || TBB_INTERFACE_VERSION_MAJOR < 11
+    UNUSED_VARS(priority);
 #endif
   }
 
@@ -133,7 +143,16 @@ struct TaskNode *BLI_task_graph_node_create(struct TaskGraph *task_graph,
                                             void *user_data,
                                             TaskGraphNodeFreeFunction free_func)
 {
-  TaskNode *task_node = new TaskNode(task_graph, run, user_data, free_func);
+  return BLI_task_graph_node_create_ex(task_graph, run, user_data, free_func, TASK_PRIORITY_LOW);
+}
+
+struct TaskNode *BLI_task_graph_node_create_ex(struct TaskGraph *task_graph,
+                                               TaskGraphNodeRunFunction run,
+                                               void *user_data,
+                                               TaskGraphNodeFreeFunction free_func,
+                                               const TaskPriority priority)
+{
+  TaskNode *task_node = new TaskNode(task_graph, run, user_data, free_func, priority);
   task_graph->nodes.push_back(std::unique_ptr<TaskNode>(task_node));
   return task_node;
 }
@@ -42,6 +42,12 @@ static int task_scheduler_num_threads = 1;
 static tbb::global_control *task_scheduler_global_control = nullptr;
 #endif
 
+/* NOTE: There is no NUMA-aware pool creation here on purpose. All task pools and parallel ranges
+ * share TBB's global worker pool, so binding workers to a node on behalf of one pool would pin
+ * every other user of the scheduler as well (including external libraries running on our
+ * workers). Pinning the whole process to one node was tried before and disabled again for this
+ * reason, see #BLI_thread_put_process_on_fast_node in `threads.cc`. Code that owns its threads
+ * and really wants node binding can do so per thread (Cycles does this for its CPU device). */
 void BLI_task_scheduler_init()
 {
 #ifdef WITH_TBB_GLOBAL_CONTROL
@@ -0,0 +1,110 @@
+/* Apache License, Version 2.0 */
+
+#include "BLI_concurrent_map.hh"
+#include "BLI_strict_flags.h"
+#include "BLI_task.h"
+
+#include "testing/testing.h"
+
+namespace blender::tests {
+
+TEST(concurrent_map, DefaultConstructor)
+{
+  ConcurrentMap<int, int> map;
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_TRUE(map.is_empty());
+}
+
+TEST(concurrent_map, AddLookup)
+{
+  ConcurrentMap<int, int> map;
+  EXPECT_TRUE(map.add(1, 10));
+  EXPECT_TRUE(map.add(2, 20));
+  EXPECT_FALSE(map.add(1, 100));
+
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_TRUE(map.contains(1));
+  EXPECT_FALSE(map.contains(3));
+  EXPECT_EQ(map.lookup(1), 10);
+  EXPECT_EQ(map.lookup_default(3, -1), -1);
+
+  int value = 0;
+  EXPECT_TRUE(map.lookup(2, value));
+  EXPECT_EQ(value, 20);
+  EXPECT_FALSE(map.lookup(3, value));
+}
+
+TEST(concurrent_map, AddOverwrite)
+{
+  ConcurrentMap<int, int> map;
+  EXPECT_TRUE(map.add_overwrite(1, 10));
+  EXPECT_FALSE(map.add_overwrite(1, 20));
+  EXPECT_EQ(map.lookup(1), 20);
+}
+
+TEST(concurrent_map, Remove)
+{
+  ConcurrentMap<int, int> map;
+  map.add(1, 10);
+  EXPECT_TRUE(map.remove(1));
+  EXPECT_FALSE(map.remove(1));
+  EXPECT_TRUE(map.is_empty());
+}
+
+TEST(concurrent_map, AddOrModify)
+{
+  ConcurrentMap<int, int> map;
+  auto create_value = []() { return 0; };
+  auto modify_value = [](int *value) { return ++*value; };
+  EXPECT_EQ(map.add_or_modify(1, create_value, modify_value), 1);
+  EXPECT_EQ(map.add_or_modify(1, create_value, modify_value), 2);
+  EXPECT_EQ(map.lookup(1), 2);
+}
+
+TEST(concurrent_map, ForeachItem)
+{
+  ConcurrentMap<int, int> map;
+  map.add(3, 30);
+  map.add(4, 40);
+  int keys_sum = 0;
+  int values_sum = 0;
+  map.foreach_item([&](int key, int value) {
+    keys_sum += key;
+    values_sum += value;
+  });
+  EXPECT_EQ(keys_sum, 7);
+  EXPECT_EQ(values_sum, 70);
+}
+
+TEST(concurrent_map, ConcurrentAddAndLookup)
+{
+  ConcurrentMap<int, int> map;
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = true;
+  settings.min_iter_per_thread = 1;
+
+  struct TaskData {
+    ConcurrentMap<int, int> *map;
+  } data = {&map};
+
+  BLI_task_parallel_range(
+      0,
+      10000,
+      &data,
+      [](void *__restrict userdata, const int i, const TaskParallelTLS *__restrict /*tls*/) {
+        TaskData &data = *static_cast<TaskData *>(userdata);
+        data.map->add(i, i * 2);
+        /* Interleave lookups of keys that are guaranteed to be present already. */
+        EXPECT_EQ(data.map->lookup(i), i * 2);
+      },
+      &settings);
+
+  EXPECT_EQ(map.size(), 10000);
+  for (int i = 0; i < 10000; i++) {
+    EXPECT_EQ(map.lookup(i), i * 2);
+  }
+}
+
+}  // namespace blender::tests
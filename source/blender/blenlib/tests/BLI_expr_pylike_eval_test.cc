@@ -111,6 +111,9 @@ TEST_PARSE_FAIL(Truncated7, "1 and")
 TEST_PARSE_FAIL(Truncated8, "1 or")
 TEST_PARSE_FAIL(Truncated9, "sqrt(1")
 TEST_PARSE_FAIL(Truncated10, "fmod(1,")
+TEST_PARSE_FAIL(Truncated11, "2 **")
+TEST_PARSE_FAIL(Truncated12, "7 //")
+TEST_PARSE_FAIL(Truncated13, "7 %")
 
 /* Constant expression with working constant folding */
 #define TEST_CONST(name, str, value) \
@@ -155,6 +158,22 @@ TEST_EVAL(FMod, "fmod(x, 2)", 3.5, 1.5)
 TEST_CONST(Pow, "pow(4, 0.5)", 2.0)
 TEST_EVAL(Pow, "pow(4, x)", 0.5, 2.0)
 
+TEST_CONST(PowOp1, "4 ** 0.5", 2.0)
+TEST_CONST(PowOp2, "2 ** 3 ** 2", 512.0)
+TEST_CONST(PowOp3, "-2 ** 2", -4.0)
+TEST_CONST(PowOp4, "2 ** -1", 0.5)
+TEST_CONST(PowOp5, "2 * 3 ** 2", 18.0)
+TEST_EVAL(PowOp, "x ** 2", 3.0, 9.0)
+
+TEST_CONST(ModOp1, "7 % 3", 1.0)
+TEST_CONST(ModOp2, "-7 % 3", 2.0)
+TEST_CONST(ModOp3, "7 % -3", -2.0)
+TEST_EVAL(ModOp, "x % 2", 3.5, 1.5)
+
+TEST_CONST(FloorDivOp1, "7 // 2", 3.0)
+TEST_CONST(FloorDivOp2, "-7 // 2", -4.0)
+TEST_EVAL(FloorDivOp, "x // 2", 7.0, 3.0)
+
 TEST_CONST(Log2_1, "log(4, 2)", 2.0)
 
 TEST_CONST(Round1, "round(-0.5)", -1.0)
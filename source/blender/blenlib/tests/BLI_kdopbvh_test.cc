@@ -132,3 +132,107 @@ TEST(kdopbvh, OptimalFindNearest_500)
 {
   find_nearest_points_test(500, 1.0, 1000, 12, true);
 }
+
+/**
+ * Check that #BLI_bvhtree_ray_cast_batch gives the same results as casting each ray with
+ * #BLI_bvhtree_ray_cast. `radius == 0` rays take the SIMD traversal on SSE2 builds, rays with
+ * a radius take the regular per-node traversal (the batch API's fallback path).
+ */
+static void ray_cast_batch_test(int tree_size, int ray_num, int random_seed, float radius)
+{
+  struct RNG *rng = BLI_rng_new(random_seed);
+  BVHTree *tree = BLI_bvhtree_new(tree_size, 0.0, 8, 8);
+
+  for (int i = 0; i < tree_size; i++) {
+    float co[2][3];
+    rng_v3_round(co[0], 3, rng, 1000, 1.0f);
+    /* Full precision random extents, so exact distance ties between leaves can't occur. */
+    for (int axis = 0; axis < 3; axis++) {
+      co[1][axis] = co[0][axis] + BLI_rng_get_float(rng) * 0.1f;
+    }
+    BLI_bvhtree_insert(tree, i, co[0], 2);
+  }
+  BLI_bvhtree_balance(tree);
+
+  float(*ray_co)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * ray_num, __func__);
+  float(*ray_dir)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * ray_num, __func__);
+  BVHTreeRayHit *hits_single = (BVHTreeRayHit *)MEM_mallocN(sizeof(BVHTreeRayHit) * ray_num,
+                                                            __func__);
+  BVHTreeRayHit *hits_batch = (BVHTreeRayHit *)MEM_mallocN(sizeof(BVHTreeRayHit) * ray_num,
+                                                           __func__);
+
+  for (int i = 0; i < ray_num; i++) {
+    rng_v3_round(ray_co[i], 3, rng, 1000, 2.0f);
+    do {
+      rng_v3_round(ray_dir[i], 3, rng, 1000, 1.0f);
+    } while (normalize_v3(ray_dir[i]) < FLT_EPSILON);
+
+    hits_single[i].index = -1;
+    hits_single[i].dist = BVH_RAYCAST_DIST_MAX;
+    hits_batch[i].index = -1;
+    hits_batch[i].dist = BVH_RAYCAST_DIST_MAX;
+  }
+
+  int hits_single_num = 0;
+  for (int i = 0; i < ray_num; i++) {
+    BLI_bvhtree_ray_cast(tree, ray_co[i], ray_dir[i], radius, &hits_single[i], nullptr, nullptr);
+    if (hits_single[i].index != -1) {
+      hits_single_num++;
+    }
+  }
+
+  const int hits_batch_num = BLI_bvhtree_ray_cast_batch(
+      tree, ray_co, ray_dir, radius, ray_num, hits_batch, nullptr, nullptr);
+
+  EXPECT_EQ(hits_batch_num, hits_single_num);
+  for (int i = 0; i < ray_num; i++) {
+    EXPECT_EQ(hits_batch[i].index, hits_single[i].index);
+    if (hits_single[i].index != -1) {
+      EXPECT_NEAR(hits_batch[i].dist, hits_single[i].dist, 1e-5f);
+      EXPECT_V3_NEAR(hits_batch[i].co, hits_single[i].co, 1e-5f);
+    }
+  }
+
+  BLI_bvhtree_free(tree);
+  BLI_rng_free(rng);
+  MEM_freeN(ray_co);
+  MEM_freeN(ray_dir);
+  MEM_freeN(hits_single);
+  MEM_freeN(hits_batch);
+}
+
+TEST(kdopbvh, RayCastBatch_1)
+{
+  ray_cast_batch_test(1, 16, 1234, 0.0f);
+}
+TEST(kdopbvh, RayCastBatch_500)
+{
+  ray_cast_batch_test(500, 100, 123, 0.0f);
+}
+TEST(kdopbvh, RayCastBatch_Radius_500)
+{
+  ray_cast_batch_test(500, 100, 12, 0.05f);
+}
+
+TEST(kdopbvh, RayCastBatch_NoHit)
+{
+  BVHTree *tree = BLI_bvhtree_new(1, 0.0, 8, 8);
+  {
+    float co[3] = {0};
+    BLI_bvhtree_insert(tree, 0, co, 1);
+  }
+  BLI_bvhtree_balance(tree);
+
+  /* A ray pointing away from the only node must leave the hit untouched. */
+  const float ray_co[1][3] = {{0.0f, 0.0f, 10.0f}};
+  const float ray_dir[1][3] = {{0.0f, 0.0f, 1.0f}};
+  BVHTreeRayHit hit;
+  hit.index = -1;
+  hit.dist = BVH_RAYCAST_DIST_MAX;
+
+  EXPECT_EQ(BLI_bvhtree_ray_cast_batch(tree, ray_co, ray_dir, 0.0f, 1, &hit, nullptr, nullptr), 0);
+  EXPECT_EQ(hit.index, -1);
+  EXPECT_EQ(hit.dist, BVH_RAYCAST_DIST_MAX);
+
+  BLI_bvhtree_free(tree);
+}
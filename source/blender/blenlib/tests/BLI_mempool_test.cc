@@ -0,0 +1,119 @@
+/* Apache License, Version 2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_mempool.h"
+#include "BLI_utildefines.h"
+
+/* Larger than the internal batch handout size, so refilling a cache is covered. */
+#define CACHE_ALLOC_NUM 200
+
+static int mempool_iter_count(BLI_mempool *pool)
+{
+  BLI_mempool_iter iter;
+  BLI_mempool_iternew(pool, &iter);
+  int count = 0;
+  while (BLI_mempool_iterstep(&iter)) {
+    count++;
+  }
+  return count;
+}
+
+TEST(mempool, CacheAllocFree)
+{
+  BLI_mempool *pool = BLI_mempool_create(sizeof(void *[2]), 0, 512, BLI_MEMPOOL_NOP);
+  BLI_mempool_cache cache;
+  BLI_mempool_cache_init(pool, &cache);
+
+  void *elems[CACHE_ALLOC_NUM];
+  for (int i = 0; i < CACHE_ALLOC_NUM; i++) {
+    elems[i] = BLI_mempool_cache_alloc(&cache);
+    EXPECT_NE(elems[i], nullptr);
+    for (int j = 0; j < i; j++) {
+      EXPECT_NE(elems[i], elems[j]);
+    }
+  }
+
+  /* Elements still sitting in the cache count as used until the flush. */
+  EXPECT_GE(BLI_mempool_len(pool), CACHE_ALLOC_NUM);
+  BLI_mempool_cache_flush(&cache);
+  EXPECT_EQ(BLI_mempool_len(pool), CACHE_ALLOC_NUM);
+
+  /* Free half back through the cache, the shared count only drops on flush. */
+  for (int i = 0; i < CACHE_ALLOC_NUM / 2; i++) {
+    BLI_mempool_cache_free(&cache, elems[i]);
+  }
+  EXPECT_GE(BLI_mempool_len(pool), CACHE_ALLOC_NUM / 2);
+  BLI_mempool_cache_flush(&cache);
+  EXPECT_EQ(BLI_mempool_len(pool), CACHE_ALLOC_NUM / 2);
+
+  /* With all caches flushed the pool can be used directly again. */
+  void *elem = BLI_mempool_alloc(pool);
+  EXPECT_NE(elem, nullptr);
+  EXPECT_EQ(BLI_mempool_len(pool), CACHE_ALLOC_NUM / 2 + 1);
+  BLI_mempool_free(pool, elem);
+
+  BLI_mempool_destroy(pool);
+}
+
+TEST(mempool, CacheMultiple)
+{
+  /* Two caches on one pool must hand out disjoint elements. */
+  BLI_mempool *pool = BLI_mempool_create(sizeof(void *[2]), 0, 512, BLI_MEMPOOL_NOP);
+  BLI_mempool_cache cache_a, cache_b;
+  BLI_mempool_cache_init(pool, &cache_a);
+  BLI_mempool_cache_init(pool, &cache_b);
+
+  void *elems[CACHE_ALLOC_NUM];
+  for (int i = 0; i < CACHE_ALLOC_NUM; i++) {
+    BLI_mempool_cache *cache = (i % 2) ? &cache_b : &cache_a;
+    elems[i] = BLI_mempool_cache_alloc(cache);
+    for (int j = 0; j < i; j++) {
+      EXPECT_NE(elems[i], elems[j]);
+    }
+  }
+
+  BLI_mempool_cache_flush(&cache_a);
+  BLI_mempool_cache_flush(&cache_b);
+  EXPECT_EQ(BLI_mempool_len(pool), CACHE_ALLOC_NUM);
+
+  BLI_mempool_destroy(pool);
+}
+
+TEST(mempool, CacheIterSkip)
+{
+  /* Elements held by a cache keep their freeword, so iteration skips them. */
+  BLI_mempool *pool = BLI_mempool_create(sizeof(void *[2]), 0, 512, BLI_MEMPOOL_ALLOW_ITER);
+
+  void *direct[3];
+  for (int i = 0; i < 3; i++) {
+    direct[i] = BLI_mempool_alloc(pool);
+  }
+  EXPECT_EQ(mempool_iter_count(pool), 3);
+
+  BLI_mempool_cache cache;
+  BLI_mempool_cache_init(pool, &cache);
+
+  /* Pulls a whole batch into the cache, only the allocated elements are visible. */
+  void *cached_a = BLI_mempool_cache_alloc(&cache);
+  void *cached_b = BLI_mempool_cache_alloc(&cache);
+  EXPECT_EQ(mempool_iter_count(pool), 5);
+
+  /* Freeing into the cache hides the element from iteration again,
+   * while #BLI_mempool_len keeps counting it until the flush. */
+  BLI_mempool_cache_free(&cache, cached_b);
+  EXPECT_EQ(mempool_iter_count(pool), 4);
+  EXPECT_GE(BLI_mempool_len(pool), 5);
+
+  BLI_mempool_cache_flush(&cache);
+  EXPECT_EQ(mempool_iter_count(pool), 4);
+  EXPECT_EQ(BLI_mempool_len(pool), 4);
+
+  BLI_mempool_free(pool, cached_a);
+  for (int i = 0; i < 3; i++) {
+    BLI_mempool_free(pool, direct[i]);
+  }
+  EXPECT_EQ(BLI_mempool_len(pool), 0);
+
+  BLI_mempool_destroy(pool);
+}
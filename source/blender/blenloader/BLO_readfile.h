@@ -128,6 +128,12 @@ typedef enum eBLOReadSkip {
   BLO_READ_SKIP_DATA = (1 << 1),
   /** Do not attempt to re-use IDs from old bmain for unchanged ones in case of undo. */
   BLO_READ_SKIP_UNDO_OLD_MAIN = (1 << 2),
+  /**
+   * Do not read window-manager, screen and workspace data-blocks at all. Only valid when the
+   * load will not use the file's UI anyway (background mode e.g.), since #setup_app_data then
+   * discards these data-blocks unused, reading them is pure overhead.
+   */
+  BLO_READ_SKIP_UI = (1 << 3),
 } eBLOReadSkip;
 #define BLO_READ_SKIP_ALL (BLO_READ_SKIP_USERDEF | BLO_READ_SKIP_DATA)
 
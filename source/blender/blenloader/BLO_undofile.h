@@ -74,6 +74,11 @@ void BLO_memfile_write_finalize(MemFileWriteData *mem_data);
 
 void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t size);
 
+/* Instead of serializing an ID that did not change since the reference undo step, share all of
+ * its chunks from that step directly. Returns false when the ID has no chunks in the reference
+ * step (i.e. it's a new ID), in which case it has to be written normally. */
+bool BLO_memfile_id_chunks_reuse(MemFileWriteData *mem_data, unsigned int id_session_uuid);
+
 /* exports */
 extern void BLO_memfile_free(MemFile *memfile);
 extern void BLO_memfile_merge(MemFile *first, MemFile *second);
@@ -235,6 +235,9 @@ LinkNode *BLO_blendhandle_get_previews(BlendHandle *bh, int ofblocktype, int *r_
   PreviewImage *new_prv = NULL;
   int tot = 0;
 
+  /* Linear search over all DNA structs, resolve it once instead of for every DATA block. */
+  const int sdna_nr_preview_image = DNA_struct_find_nr(fd->filesdna, "PreviewImage");
+
   for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
     if (bhead->code == ofblocktype) {
       const char *idname = blo_bhead_id_name(fd, bhead);
@@ -259,7 +262,7 @@ LinkNode *BLO_blendhandle_get_previews(BlendHandle *bh, int ofblocktype, int *r_
     }
     else if (bhead->code == DATA) {
       if (looking) {
-        if (bhead->SDNAnr == DNA_struct_find_nr(fd->filesdna, "PreviewImage")) {
+        if (bhead->SDNAnr == sdna_nr_preview_image) {
           prv = BLO_library_read_struct(fd, bhead, "PreviewImage");
 
           if (prv) {
@@ -72,6 +72,7 @@
 #include "BLI_memarena.h"
 #include "BLI_mempool.h"
 #include "BLI_mmap.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 
 #include "PIL_time.h"
@@ -470,6 +471,8 @@ void blo_join_main(ListBase *mainlist)
     BKE_main_idmap_destroy(mainl->id_map);
     mainl->id_map = NULL;
   }
+  /* Same for the lookup cache. */
+  BKE_main_idmap_cache_invalidate(mainl);
 
   while ((tojoin = mainl->next)) {
     add_main_to_main(mainl, tojoin);
@@ -514,6 +517,8 @@ void blo_split_main(ListBase *mainlist, Main *main)
     BKE_main_idmap_destroy(main->id_map);
     main->id_map = NULL;
   }
+  /* Same for the lookup cache. */
+  BKE_main_idmap_cache_invalidate(main);
 
   /* (Library.temp_index -> Main), lookup table */
   const uint lib_main_array_len = BLI_listbase_count(&main->libraries);
@@ -994,6 +999,160 @@ static BHead *blo_bhead_read_full(FileData *fd, BHead *thisblock)
   }
   return &new_bhead_data->bhead;
 }
+
+/* -------------------------------------------------------------------- */
+/** \name Parallel Data Pre-Fetch
+ *
+ * With #USE_BHEAD_READ_ON_DEMAND the payload of `DATA` blocks is normally read lazily,
+ * one block at a time, while the single-threaded decode loop runs. For big files this
+ * interleaves many small reads/seeks with DNA reconstruction. Instead, once the whole
+ * BHead index has been scanned, all delayed payloads can be fetched up-front:
+ *
+ * - For memory-mapped readers the fetch is a pure copy at a known offset,
+ *   so it is distributed over a task range.
+ * - For plain file descriptors the fetch is a single forward sweep in file order,
+ *   avoiding the per-block seek-back during decode.
+ *
+ * In-memory readers (undo, packed files) have no seek callback so they never delay
+ * payloads in the first place, see #get_bhead.
+ *
+ * Either way #blo_read_file_internal then deserializes purely from memory.
+ * \{ */
+
+/** Total delayed payload size under which pre-fetching isn't worth the overhead. */
+#define BHEAD_PREFETCH_SIZE_MIN (8 << 20)
+
+/**
+ * Blocks above this size are not materialized into the BHead index at all. Large raw arrays
+ * (mesh vertex/edge/loop arrays, image buffers) are virtually always layout-identical between
+ * file and memory (`SDNA_CMP_EQUAL`), so #read_struct reads them from the file straight into
+ * their final allocation in a single copy. Materializing them here would double both the work
+ * and the peak memory use. For memory-mapped files the pages are hinted for read-ahead instead.
+ */
+#define BHEAD_PREFETCH_BLOCK_SIZE_MAX (256 << 10)
+
+typedef struct BHeadPrefetchData {
+  FileData *fd;
+  /** Delayed (`has_data == false`) blocks, in file order. */
+  BHeadN **delayed;
+  /** Filled replacement blocks (`has_data == true`), or NULL when the read failed. */
+  BHeadN **filled;
+} BHeadPrefetchData;
+
+static void blo_bhead_prefetch_task_cb(void *__restrict userdata,
+                                       const int n,
+                                       const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  BHeadPrefetchData *data = userdata;
+  FileData *fd = data->fd;
+  BHeadN *bhead_delayed = data->delayed[n];
+  const size_t offset = (size_t)bhead_delayed->file_offset;
+  const size_t len = (size_t)bhead_delayed->bhead.len;
+
+  BHeadN *bhead_data = MEM_mallocN(sizeof(BHeadN) + len, "new_bhead");
+  bhead_data->bhead = bhead_delayed->bhead;
+  bhead_data->file_offset = bhead_delayed->file_offset;
+  bhead_data->has_data = true;
+  bhead_data->is_memchunk_identical = false;
+
+  /* Only memory-mapped readers delay payloads and take the threaded path,
+   * see #blo_bhead_prefetch_all. */
+  const bool success = BLI_mmap_read(fd->mmap_file, bhead_data + 1, offset, len);
+
+  if (UNLIKELY(!success)) {
+    MEM_freeN(bhead_data);
+    bhead_data = NULL;
+  }
+  data->filled[n] = bhead_data;
+}
+
+/**
+ * Scan the remainder of the file so `fd->bhead_list` holds the complete BHead index,
+ * then fetch all delayed `DATA` payloads, replacing the delayed list entries in place.
+ *
+ * Failed blocks simply keep their delayed entry and are read on demand as before.
+ */
+static void blo_bhead_prefetch_all(FileData *fd)
+{
+  /* Complete the index first (this is sequential by nature of the format). */
+  for (BHead *bhead = blo_bhead_first(fd); bhead && bhead->code != ENDB;
+       bhead = blo_bhead_next(fd, bhead)) {
+    /* Pass. */
+  }
+
+  int delayed_num = 0;
+  size_t delayed_size = 0;
+  LISTBASE_FOREACH (BHeadN *, new_bhead, &fd->bhead_list) {
+    if (new_bhead->has_data == false) {
+      if ((size_t)new_bhead->bhead.len > BHEAD_PREFETCH_BLOCK_SIZE_MAX) {
+        /* Large raw arrays skip the index and go file -> destination in one copy,
+         * see #BHEAD_PREFETCH_BLOCK_SIZE_MAX. */
+        if (fd->mmap_file != NULL) {
+          BLI_mmap_read_ahead(
+              fd->mmap_file, (size_t)new_bhead->file_offset, (size_t)new_bhead->bhead.len);
+        }
+        continue;
+      }
+      delayed_num++;
+      delayed_size += (size_t)new_bhead->bhead.len;
+    }
+  }
+  if (delayed_num == 0 || delayed_size < BHEAD_PREFETCH_SIZE_MIN) {
+    return;
+  }
+
+  BHeadPrefetchData data = {
+      .fd = fd,
+      .delayed = MEM_mallocN(sizeof(BHeadN *) * (size_t)delayed_num, __func__),
+      .filled = MEM_callocN(sizeof(BHeadN *) * (size_t)delayed_num, __func__),
+  };
+  delayed_num = 0;
+  LISTBASE_FOREACH (BHeadN *, new_bhead, &fd->bhead_list) {
+    if ((new_bhead->has_data == false) &&
+        ((size_t)new_bhead->bhead.len <= BHEAD_PREFETCH_BLOCK_SIZE_MAX)) {
+      data.delayed[delayed_num++] = new_bhead;
+    }
+  }
+
+  if (fd->mmap_file != NULL) {
+    /* Memory mapped: workers copy at absolute offsets without touching shared state. */
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 8;
+    BLI_task_parallel_range(0, delayed_num, &data, blo_bhead_prefetch_task_cb, &settings);
+  }
+  else {
+    /* Plain file: a single sweep in file order (the array is already sorted by offset). */
+    for (int n = 0; n < delayed_num; n++) {
+      BHeadN *bhead_delayed = data.delayed[n];
+      BHeadN *bhead_data = MEM_mallocN(sizeof(BHeadN) + bhead_delayed->bhead.len, "new_bhead");
+      bhead_data->bhead = bhead_delayed->bhead;
+      bhead_data->file_offset = bhead_delayed->file_offset;
+      bhead_data->has_data = true;
+      bhead_data->is_memchunk_identical = false;
+      if (blo_bhead_read_data(fd, &bhead_delayed->bhead, bhead_data + 1)) {
+        data.filled[n] = bhead_data;
+      }
+      else {
+        MEM_freeN(bhead_data);
+      }
+    }
+  }
+
+  /* Splice the filled blocks into the index (serially, the list is shared state). */
+  for (int n = 0; n < delayed_num; n++) {
+    if (data.filled[n] != NULL) {
+      BLI_insertlinkreplace(&fd->bhead_list, data.delayed[n], data.filled[n]);
+      MEM_freeN(data.delayed[n]);
+    }
+  }
+
+  MEM_freeN(data.delayed);
+  MEM_freeN(data.filled);
+}
+
+/** \} */
+
 #endif /* USE_BHEAD_READ_ON_DEMAND */
 
 /* Warning! Caller's responsibility to ensure given bhead **is** an ID one! */
@@ -1523,20 +1682,32 @@ static ssize_t fd_read_gzip_from_memory(FileData *filedata,
   filedata->strm.next_out = (Bytef *)buffer;
   filedata->strm.avail_out = (uint)size;
 
-  /* Inflate another chunk. */
-  err = inflate(&filedata->strm, Z_SYNC_FLUSH);
+  /* Inflate until the requested size is available, stepping over gzip member boundaries:
+   * files saved with the chunked writer are a concatenation of independent members. */
+  while (filedata->strm.avail_out > 0) {
+    err = inflate(&filedata->strm, Z_SYNC_FLUSH);
 
-  if (err == Z_STREAM_END) {
-    return 0;
-  }
-  if (err != Z_OK) {
-    CLOG_ERROR(&LOG, "ZLib error (code %d)", err);
-    return 0;
+    if (err == Z_STREAM_END) {
+      if (filedata->strm.avail_in == 0) {
+        break;
+      }
+      /* Next gzip member follows, restart the inflate state for it. */
+      err = inflateReset(&filedata->strm);
+      if (err != Z_OK) {
+        CLOG_ERROR(&LOG, "ZLib error (code %d)", err);
+        return 0;
+      }
+    }
+    else if (err != Z_OK) {
+      CLOG_ERROR(&LOG, "ZLib error (code %d)", err);
+      return 0;
+    }
   }
 
-  filedata->file_offset += size;
+  const size_t readsize = size - filedata->strm.avail_out;
+  filedata->file_offset += readsize;
 
-  return (ssize_t)size;
+  return (ssize_t)readsize;
 }
 
 static int fd_read_gzip_from_memory_init(FileData *fd)
@@ -4204,6 +4375,15 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
     }
   }
 
+#ifdef USE_BHEAD_READ_ON_DEMAND
+  /* Undo reads from memfile chunks directly and skip-data passes barely touch payloads,
+   * otherwise fetch all delayed data up-front (threaded for memory backed files). */
+  if ((fd->memfile == NULL) && (fd->skip_flags & BLO_READ_SKIP_DATA) == 0) {
+    blo_bhead_prefetch_all(fd);
+    bhead = blo_bhead_first(fd);
+  }
+#endif
+
   while (bhead) {
     switch (bhead->code) {
       case DATA:
@@ -4249,6 +4429,11 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
         if (fd->skip_flags & BLO_READ_SKIP_DATA) {
           bhead = blo_bhead_next(fd, bhead);
         }
+        else if ((fd->skip_flags & BLO_READ_SKIP_UI) && ELEM(bhead->code, ID_WM, ID_SCR, ID_WS)) {
+          /* UI data-blocks are not going to be used (they are replaced by the current session's
+           * ones in #setup_app_data), skip reading them entirely. */
+          bhead = blo_bhead_next(fd, bhead);
+        }
         else {
           bhead = read_libblock(fd, bfd->main, bhead, LIB_TAG_LOCAL, false, NULL);
         }
@@ -5506,7 +5691,10 @@ static void read_library_clear_weak_links(FileData *basefd, ListBase *mainlist,
   }
 }
 
-static FileData *read_library_file_data(FileData *basefd,
+/* NOTE: May run from a worker thread (see #read_libraries), which is why reports are an explicit
+ * parameter here instead of `basefd->reports`: each task writes into its own report data, only
+ * touching its own library's #Main otherwise. */
+static FileData *read_library_file_data(BlendFileReadReport *reports,
                                         ListBase *mainlist,
                                         Main *mainl,
                                         Main *mainptr)
@@ -5522,25 +5710,25 @@ static FileData *read_library_file_data(FileData *basefd,
     /* Read packed file. */
     PackedFile *pf = mainptr->curlib->packedfile;
 
-    BLO_reportf_wrap(basefd->reports,
+    BLO_reportf_wrap(reports,
                      RPT_INFO,
                      TIP_("Read packed library:  '%s', parent '%s'"),
                      mainptr->curlib->filepath,
                      library_parent_filepath(mainptr->curlib));
-    fd = blo_filedata_from_memory(pf->data, pf->size, basefd->reports);
+    fd = blo_filedata_from_memory(pf->data, pf->size, reports);
 
     /* Needed for library_append and read_libraries. */
     BLI_strncpy(fd->relabase, mainptr->curlib->filepath_abs, sizeof(fd->relabase));
   }
   else {
     /* Read file on disk. */
-    BLO_reportf_wrap(basefd->reports,
+    BLO_reportf_wrap(reports,
                      RPT_INFO,
                      TIP_("Read library:  '%s', '%s', parent '%s'"),
                      mainptr->curlib->filepath_abs,
                      mainptr->curlib->filepath,
                      library_parent_filepath(mainptr->curlib));
-    fd = blo_filedata_from_file(mainptr->curlib->filepath_abs, basefd->reports);
+    fd = blo_filedata_from_file(mainptr->curlib->filepath_abs, reports);
   }
 
   if (fd) {
@@ -5550,7 +5738,7 @@ static FileData *read_library_file_data(FileData *basefd,
      * libraries properly. */
     fd->mainlist = mainlist;
 
-    fd->reports = basefd->reports;
+    fd->reports = reports;
 
     if (fd->libmap) {
       oldnewmap_free(fd->libmap);
@@ -5577,13 +5765,33 @@ static FileData *read_library_file_data(FileData *basefd,
 
   if (fd == NULL) {
     BLO_reportf_wrap(
-        basefd->reports, RPT_INFO, TIP_("Cannot find lib '%s'"), mainptr->curlib->filepath_abs);
-    basefd->reports->count.missing_libraries++;
+        reports, RPT_INFO, TIP_("Cannot find lib '%s'"), mainptr->curlib->filepath_abs);
+    reports->count.missing_libraries++;
   }
 
   return fd;
 }
 
+typedef struct ReadLibraryFileTask {
+  struct ReadLibraryFileTask *next, *prev;
+
+  ListBase *mainlist;
+  Main *mainl;
+  Main *mainptr;
+
+  /* Reports generated while opening the file, kept per task so concurrently read libraries do
+   * not write into the shared report list, and merged back in list order afterwards. */
+  BlendFileReadReport reports;
+  ReportList report_list;
+} ReadLibraryFileTask;
+
+static void read_library_file_data_task_cb(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  ReadLibraryFileTask *task = taskdata;
+
+  read_library_file_data(&task->reports, task->mainlist, task->mainl, task->mainptr);
+}
+
 static void read_libraries(FileData *basefd, ListBase *mainlist)
 {
   Main *mainl = mainlist->first;
@@ -5602,37 +5810,80 @@ static void read_libraries(FileData *basefd, ListBase *mainlist)
   while (do_it) {
     do_it = false;
 
-    /* Loop over mains of all library blend files encountered so far. Note
-     * this list gets longer as more indirectly library blends are found. */
+    /* Gather all libraries with linked data-blocks left to read, and open their files from a
+     * task pool: reading the file from disk and decompressing it into BHead blocks only touches
+     * the library's own #FileData and #Main, and dominates load time with many libraries.
+     *
+     * Reading the linked data-blocks themselves has to stay sequential, since it moves IDs
+     * between Mains, updates the lib-maps of all other opened libraries, and may append new
+     * libraries to \a mainlist. Libraries discovered that way are handled by the next iteration
+     * of the outer loop. */
+    ListBase tasks = {NULL, NULL};
+    TaskPool *task_pool = BLI_task_pool_create(NULL, TASK_PRIORITY_HIGH);
+
     for (Main *mainptr = mainl->next; mainptr; mainptr = mainptr->next) {
       /* Does this library have any more linked data-blocks we need to read? */
-      if (has_linked_ids_to_read(mainptr)) {
-        CLOG_INFO(&LOG,
-                  3,
-                  "Reading linked data-blocks from %s (%s)",
-                  mainptr->curlib->id.name,
-                  mainptr->curlib->filepath);
+      if (!has_linked_ids_to_read(mainptr)) {
+        continue;
+      }
 
-        /* Open file if it has not been done yet. */
-        FileData *fd = read_library_file_data(basefd, mainlist, mainl, mainptr);
+      CLOG_INFO(&LOG,
+                3,
+                "Reading linked data-blocks from %s (%s)",
+                mainptr->curlib->id.name,
+                mainptr->curlib->filepath);
+
+      ReadLibraryFileTask *task = MEM_callocN(sizeof(*task), __func__);
+      task->mainlist = mainlist;
+      task->mainl = mainl;
+      task->mainptr = mainptr;
+      if (basefd->reports->reports != NULL) {
+        /* Match the filtering of the shared report list, so merging the local one back is not
+         * observable. */
+        BKE_reports_init(&task->report_list, basefd->reports->reports->flag);
+        task->report_list.printlevel = basefd->reports->reports->printlevel;
+        task->report_list.storelevel = basefd->reports->reports->storelevel;
+        task->reports.reports = &task->report_list;
+      }
+      BLI_addtail(&tasks, task);
 
-        if (fd) {
-          do_it = true;
+      /* Open file if it has not been done yet. */
+      BLI_task_pool_push(task_pool, read_library_file_data_task_cb, task, false, NULL);
+    }
 
-          if (mainptr->id_map == NULL) {
-            mainptr->id_map = BKE_main_idmap_create(mainptr, false, NULL, MAIN_IDMAP_TYPE_NAME);
-          }
-        }
+    BLI_task_pool_work_and_wait(task_pool);
+    BLI_task_pool_free(task_pool);
 
-        /* Read linked data-locks for each link placeholder, and replace
-         * the placeholder with the real data-lock. */
-        read_library_linked_ids(basefd, fd, mainlist, mainptr);
+    LISTBASE_FOREACH (ReadLibraryFileTask *, task, &tasks) {
+      Main *mainptr = task->mainptr;
+      FileData *fd = mainptr->curlib->filedata;
 
-        /* Test if linked data-locks need to read further linked data-locks
-         * and create link placeholders for them. */
-        BLO_expand_main(fd, mainptr);
+      /* Move task-local reports over to the shared list. */
+      if (basefd->reports->reports != NULL) {
+        BLI_movelisttolist(&basefd->reports->reports->list, &task->report_list.list);
       }
+      basefd->reports->count.missing_libraries += task->reports.count.missing_libraries;
+
+      if (fd) {
+        do_it = true;
+        /* From here on reports go to the shared list directly again. */
+        fd->reports = basefd->reports;
+
+        if (mainptr->id_map == NULL) {
+          mainptr->id_map = BKE_main_idmap_create(mainptr, false, NULL, MAIN_IDMAP_TYPE_NAME);
+        }
+      }
+
+      /* Read linked data-locks for each link placeholder, and replace
+       * the placeholder with the real data-lock. */
+      read_library_linked_ids(basefd, fd, mainlist, mainptr);
+
+      /* Test if linked data-locks need to read further linked data-locks
+       * and create link placeholders for them. */
+      BLO_expand_main(fd, mainptr);
     }
+
+    BLI_freelistN(&tasks);
   }
 
   Main *main_newid = BKE_main_new();
@@ -192,6 +192,40 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
   }
 }
 
+bool BLO_memfile_id_chunks_reuse(MemFileWriteData *mem_data, uint id_session_uuid)
+{
+  if (mem_data->id_session_uuid_mapping == NULL) {
+    return false;
+  }
+  MemFileChunk *ref_chunk = BLI_ghash_lookup(mem_data->id_session_uuid_mapping,
+                                             POINTER_FROM_UINT(id_session_uuid));
+  if (ref_chunk == NULL) {
+    return false;
+  }
+
+  /* Share all of the ID's chunks from the reference step, without re-serializing the ID at all.
+   * This gives the same result as #BLO_memfile_chunk_add finding every chunk binary-identical,
+   * at none of the serialization and comparison cost. */
+  MemFile *memfile = mem_data->written_memfile;
+  for (; ref_chunk != NULL && ref_chunk->id_session_uuid == id_session_uuid;
+       ref_chunk = ref_chunk->next) {
+    MemFileChunk *curchunk = MEM_mallocN(sizeof(MemFileChunk), "MemFileChunk");
+    curchunk->size = ref_chunk->size;
+    curchunk->buf = ref_chunk->buf;
+    curchunk->is_identical = true;
+    curchunk->is_identical_future = true;
+    curchunk->id_session_uuid = id_session_uuid;
+    BLI_addtail(&memfile->chunks, curchunk);
+
+    ref_chunk->is_identical_future = true;
+  }
+
+  /* Continue the sequential chunk matching right after the reused ID. */
+  mem_data->reference_current_chunk = ref_chunk;
+
+  return true;
+}
+
 struct Main *BLO_memfile_main_get(struct MemFile *memfile,
                                   struct Main *bmain,
                                   struct Scene **r_scene)
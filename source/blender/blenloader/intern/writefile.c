@@ -102,6 +102,8 @@
 #include "BLI_blenlib.h"
 #include "BLI_endian_defines.h"
 #include "BLI_mempool.h"
+#include "BLI_task.h"
+#include "BLI_threads.h"
 #include "MEM_guardedalloc.h" /* MEM_freeN */
 
 #include "BKE_blender_version.h"
@@ -163,7 +165,7 @@ struct WriteWrap {
   /* internal */
   union {
     int file_handle;
-    gzFile gz_handle;
+    struct ZlibWriteState *zlib_state;
   } _user_data;
 };
 
@@ -193,29 +195,176 @@ static size_t ww_write_none(WriteWrap *ww, const char *buf, size_t buf_len)
 }
 #undef FILE_HANDLE
 
-/* zlib */
-#define FILE_HANDLE(ww) (ww)->_user_data.gz_handle
+/* zlib
+ *
+ * The stream is written as a sequence of independent gzip members of at most
+ * #ZLIB_CHUNK_SIZE uncompressed bytes each (concatenated members are a valid gzip
+ * stream, see RFC 1952). Each member is compressed by a task on a pool, so save
+ * time scales with core count instead of stalling the file job on one core,
+ * and a reader may decompress the members in parallel too.
+ * The writer thread appends incoming data to the current chunk, and flushes
+ * finished members to disk in order as their tasks complete. */
+
+#define ZLIB_CHUNK_SIZE (1 << 20)
+/* Matches the previous `BLI_gzopen(filepath, "wb1")`: fast but still effective on DNA data. */
+#define ZLIB_COMPRESSION_LEVEL 1
+
+typedef struct ZlibChunk {
+  struct ZlibChunk *next, *prev;
+  /** Compressed gzip member, allocated by the worker task. */
+  void *compressed;
+  size_t compressed_len;
+  /** Set by the worker (under #ZlibWriteState.mutex) when `compressed` is usable. */
+  bool done;
+  bool compress_error;
+  /** Uncompressed payload, stored in the remainder of the allocation. */
+  size_t data_len;
+  char data[0];
+} ZlibChunk;
+
+typedef struct ZlibWriteState {
+  int file_handle;
+  TaskPool *task_pool;
+  ThreadMutex mutex;
+  /** Chunks in stream order, flushed (and freed) front to back once `done`. */
+  ListBase chunks;
+  /** Chunk currently being filled, not yet in `chunks`. */
+  ZlibChunk *chunk_cur;
+  bool write_error;
+} ZlibWriteState;
+
+#define FILE_HANDLE(ww) ((ZlibWriteState *)(ww)->_user_data.zlib_state)
+
+static void ww_zlib_compress_task_fn(TaskPool *__restrict pool, void *taskdata)
+{
+  ZlibWriteState *state = BLI_task_pool_user_data(pool);
+  ZlibChunk *chunk = taskdata;
+
+  z_stream strm = {0};
+  bool success = false;
+  /* windowBits + 16 requests a gzip wrapper around the deflate stream. */
+  if (deflateInit2(&strm,
+                   ZLIB_COMPRESSION_LEVEL,
+                   Z_DEFLATED,
+                   16 + MAX_WBITS,
+                   8,
+                   Z_DEFAULT_STRATEGY) == Z_OK) {
+    const size_t compressed_size_max = deflateBound(&strm, (uLong)chunk->data_len);
+    chunk->compressed = MEM_mallocN(compressed_size_max, "zlib chunk");
+    strm.next_in = (Bytef *)chunk->data;
+    strm.avail_in = (uInt)chunk->data_len;
+    strm.next_out = (Bytef *)chunk->compressed;
+    strm.avail_out = (uInt)compressed_size_max;
+    if (deflate(&strm, Z_FINISH) == Z_STREAM_END) {
+      chunk->compressed_len = compressed_size_max - strm.avail_out;
+      success = true;
+    }
+    deflateEnd(&strm);
+  }
 
-static bool ww_open_zlib(WriteWrap *ww, const char *filepath)
+  BLI_mutex_lock(&state->mutex);
+  chunk->compress_error = !success;
+  chunk->done = true;
+  BLI_mutex_unlock(&state->mutex);
+}
+
+/** Write out (in stream order) and free all leading chunks whose tasks have finished. */
+static void ww_zlib_flush_completed(ZlibWriteState *state)
 {
-  gzFile file;
+  BLI_mutex_lock(&state->mutex);
+  ZlibChunk *chunk;
+  while ((chunk = state->chunks.first) && chunk->done) {
+    BLI_remlink(&state->chunks, chunk);
+    BLI_mutex_unlock(&state->mutex);
+
+    if (chunk->compress_error ||
+        write(state->file_handle, chunk->compressed, chunk->compressed_len) !=
+            (ssize_t)chunk->compressed_len) {
+      state->write_error = true;
+    }
+    if (chunk->compressed) {
+      MEM_freeN(chunk->compressed);
+    }
+    MEM_freeN(chunk);
+
+    BLI_mutex_lock(&state->mutex);
+  }
+  BLI_mutex_unlock(&state->mutex);
+}
 
-  file = BLI_gzopen(filepath, "wb1");
+static void ww_zlib_chunk_dispatch(ZlibWriteState *state)
+{
+  ZlibChunk *chunk = state->chunk_cur;
+  if (chunk == NULL) {
+    return;
+  }
+  state->chunk_cur = NULL;
+  BLI_mutex_lock(&state->mutex);
+  BLI_addtail(&state->chunks, chunk);
+  BLI_mutex_unlock(&state->mutex);
+  BLI_task_pool_push(state->task_pool, ww_zlib_compress_task_fn, chunk, false, NULL);
+}
 
-  if (file != Z_NULL) {
-    FILE_HANDLE(ww) = file;
-    return true;
+static bool ww_open_zlib(WriteWrap *ww, const char *filepath)
+{
+  const int file = BLI_open(filepath, O_BINARY + O_WRONLY + O_CREAT + O_TRUNC, 0666);
+  if (file == -1) {
+    return false;
   }
 
-  return false;
+  ZlibWriteState *state = MEM_callocN(sizeof(*state), "ZlibWriteState");
+  state->file_handle = file;
+  state->task_pool = BLI_task_pool_create(state, TASK_PRIORITY_HIGH);
+  BLI_mutex_init(&state->mutex);
+  ww->_user_data.zlib_state = state;
+  return true;
 }
 static bool ww_close_zlib(WriteWrap *ww)
 {
-  return (gzclose(FILE_HANDLE(ww)) == Z_OK);
+  ZlibWriteState *state = FILE_HANDLE(ww);
+
+  ww_zlib_chunk_dispatch(state);
+  BLI_task_pool_work_and_wait(state->task_pool);
+  ww_zlib_flush_completed(state);
+  BLI_assert(BLI_listbase_is_empty(&state->chunks));
+
+  BLI_task_pool_free(state->task_pool);
+  BLI_mutex_end(&state->mutex);
+
+  bool success = !state->write_error;
+  if (close(state->file_handle) == -1) {
+    success = false;
+  }
+  MEM_freeN(state);
+  return success;
 }
 static size_t ww_write_zlib(WriteWrap *ww, const char *buf, size_t buf_len)
 {
-  return gzwrite(FILE_HANDLE(ww), buf, buf_len);
+  ZlibWriteState *state = FILE_HANDLE(ww);
+
+  for (size_t done = 0; done < buf_len;) {
+    ZlibChunk *chunk = state->chunk_cur;
+    if (chunk == NULL) {
+      chunk = state->chunk_cur = MEM_mallocN(sizeof(ZlibChunk) + ZLIB_CHUNK_SIZE, "ZlibChunk");
+      memset(chunk, 0, sizeof(ZlibChunk));
+    }
+
+    const size_t chunk_remaining = ZLIB_CHUNK_SIZE - chunk->data_len;
+    const size_t step = MIN2(buf_len - done, chunk_remaining);
+    memcpy(chunk->data + chunk->data_len, buf + done, step);
+    chunk->data_len += step;
+    done += step;
+
+    if (chunk->data_len == ZLIB_CHUNK_SIZE) {
+      ww_zlib_chunk_dispatch(state);
+      /* Opportunistically write out finished members to bound memory use. */
+      ww_zlib_flush_completed(state);
+    }
+  }
+
+  /* Compression and the actual write happen asynchronously,
+   * errors are detected on close. */
+  return state->write_error ? 0 : buf_len;
 }
 #undef FILE_HANDLE
 
@@ -915,6 +1064,34 @@ static void write_thumb(WriteData *wd, const BlendThumbnail *thumb)
  * \{ */
 
 /* if MemFile * there's filesave to memory */
+/**
+ * Check whether an ID did not change since the reference undo step, so its memfile chunks can be
+ * shared wholesale through #BLO_memfile_id_chunks_reuse instead of being re-serialized and
+ * binary-compared chunk by chunk.
+ *
+ * This relies on editing code properly tagging IDs (the same assumption underlying
+ * `recalc_up_to_undo_push` handling below), including for the embedded IDs that are serialized
+ * as part of their owner.
+ */
+static bool write_file_handle_id_unchanged_check(ID *id)
+{
+  if (id->recalc_after_undo_push != 0) {
+    return false;
+  }
+  bNodeTree *nodetree = ntreeFromID(id);
+  if (nodetree != NULL && nodetree->id.recalc_after_undo_push != 0) {
+    return false;
+  }
+  if (GS(id->name) == ID_SCE) {
+    Scene *scene = (Scene *)id;
+    if (scene->master_collection != NULL &&
+        scene->master_collection->id.recalc_after_undo_push != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
 static bool write_file_handle(Main *mainvar,
                               WriteWrap *ww,
                               MemFile *compare,
@@ -982,6 +1159,15 @@ static bool write_file_handle(Main *mainvar,
         BLI_assert(
             (id->tag & (LIB_TAG_NO_MAIN | LIB_TAG_NO_USER_REFCOUNT | LIB_TAG_NOT_ALLOCATED)) == 0);
 
+        /* Undo push: IDs that were not tagged since the reference step share their chunks from
+         * that step, skipping serialization entirely. Their `recalc_up_to_undo_push` handling
+         * below would be a no-op as well since `recalc_after_undo_push` is zero.
+         * New IDs (not present in the reference step) take the normal write path. */
+        if (wd->use_memfile && write_file_handle_id_unchanged_check(id) &&
+            BLO_memfile_id_chunks_reuse(&wd->mem, id->session_uuid)) {
+          continue;
+        }
+
         const bool do_override = !ELEM(override_storage, NULL, bmain) &&
                                  ID_IS_OVERRIDE_LIBRARY_REAL(id);
 
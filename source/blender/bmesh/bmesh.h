@@ -217,6 +217,7 @@ extern "C" {
 #include "intern/bmesh_mesh_duplicate.h"
 #include "intern/bmesh_mesh_normals.h"
 #include "intern/bmesh_mesh_partial_update.h"
+#include "intern/bmesh_mesh_soa.h"
 #include "intern/bmesh_mesh_tessellate.h"
 #include "intern/bmesh_mesh_validate.h"
 #include "intern/bmesh_mods.h"
@@ -1106,6 +1106,205 @@ void BM_mesh_remap(BMesh *bm, const uint *vert_idx, const uint *edge_idx, const
   }
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Spatial Element Reordering
+ * \{ */
+
+/**
+ * Map 3D coordinates (quantized to #SPATIAL_SORT_BITS per axis) onto a Hilbert curve index,
+ * using Skilling's transpose method, see "Programming the Hilbert curve" (2004).
+ *
+ * \note Modifies \a x in-place.
+ */
+#define SPATIAL_SORT_BITS 10
+
+static uint bm_elem_hilbert_code_3d(uint x[3])
+{
+  const uint m = 1 << (SPATIAL_SORT_BITS - 1);
+  uint p, q, t;
+  int i;
+
+  /* Inverse undo excess work. */
+  for (q = m; q > 1; q >>= 1) {
+    p = q - 1;
+    for (i = 0; i < 3; i++) {
+      if (x[i] & q) {
+        x[0] ^= p;
+      }
+      else {
+        t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  /* Gray encode. */
+  for (i = 1; i < 3; i++) {
+    x[i] ^= x[i - 1];
+  }
+  t = 0;
+  for (q = m; q > 1; q >>= 1) {
+    if (x[2] & q) {
+      t ^= q - 1;
+    }
+  }
+  for (i = 0; i < 3; i++) {
+    x[i] ^= t;
+  }
+
+  /* Interleave the transposed bits into a single index (x[0] most significant). */
+  uint code = 0;
+  for (int b = SPATIAL_SORT_BITS - 1; b >= 0; b--) {
+    code = (code << 3) | (((x[0] >> b) & 1) << 2) | (((x[1] >> b) & 1) << 1) | ((x[2] >> b) & 1);
+  }
+  return code;
+}
+
+struct BMElemReorderSpatial {
+  uint key;
+  uint org_index;
+};
+
+static int bm_elem_reorder_spatial_cmp(const void *a_v, const void *b_v)
+{
+  const struct BMElemReorderSpatial *a = a_v;
+  const struct BMElemReorderSpatial *b = b_v;
+  if (a->key != b->key) {
+    return (a->key > b->key) ? 1 : -1;
+  }
+  /* Keep the sort stable so repeated use gives identical results. */
+  return (a->org_index > b->org_index) ? 1 : (a->org_index < b->org_index) ? -1 : 0;
+}
+
+/**
+ * Reorder the vertices, edges & faces of \a bm along a Hilbert curve over the vertex positions,
+ * then re-pack the element pools in the new order.
+ *
+ * After heavy editing the mempool order (which defines both the index order and the memory
+ * layout) becomes effectively random, so iteration over topology during modifier evaluation and
+ * draw extraction hits scattered cache-lines. Sorting spatially places topologically and
+ * spatially close elements on the same cache-lines again.
+ *
+ * \warning All BMesh element pointers and indices are invalidated by this call,
+ * tool flags are cleared (see #BM_mesh_rebuild).
+ */
+void BM_mesh_elem_reorder_spatial(BMesh *bm)
+{
+  if (bm->totvert == 0) {
+    return;
+  }
+
+  BM_mesh_elem_index_ensure(bm, BM_VERT | BM_EDGE | BM_FACE);
+
+  uint *vert_idx = MEM_mallocN(sizeof(*vert_idx) * bm->totvert, __func__);
+  uint *edge_idx = (bm->totedge != 0) ? MEM_mallocN(sizeof(*edge_idx) * bm->totedge, __func__) :
+                                        NULL;
+  uint *face_idx = (bm->totface != 0) ? MEM_mallocN(sizeof(*face_idx) * bm->totface, __func__) :
+                                        NULL;
+  struct BMElemReorderSpatial *sort_data = MEM_mallocN(
+      sizeof(*sort_data) * (size_t)MAX3(bm->totvert, bm->totedge, bm->totface), __func__);
+
+  BMIter iter;
+  int i;
+
+  /* Vertices: sort by the Hilbert index of their quantized position. */
+  {
+    float bbmin[3], bbmax[3], scale[3];
+    BMVert *v;
+
+    INIT_MINMAX(bbmin, bbmax);
+    BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
+      minmax_v3v3_v3(bbmin, bbmax, v->co);
+    }
+    for (int axis = 0; axis < 3; axis++) {
+      const float size = bbmax[axis] - bbmin[axis];
+      scale[axis] = (size > FLT_EPSILON) ? (float)((1 << SPATIAL_SORT_BITS) - 1) / size : 0.0f;
+    }
+
+    BM_ITER_MESH_INDEX (v, &iter, bm, BM_VERTS_OF_MESH, i) {
+      uint x[3];
+      for (int axis = 0; axis < 3; axis++) {
+        x[axis] = (uint)((v->co[axis] - bbmin[axis]) * scale[axis]);
+      }
+      sort_data[i].key = bm_elem_hilbert_code_3d(x);
+      sort_data[i].org_index = (uint)i;
+    }
+    qsort(sort_data, bm->totvert, sizeof(*sort_data), bm_elem_reorder_spatial_cmp);
+    for (i = 0; i < bm->totvert; i++) {
+      vert_idx[sort_data[i].org_index] = (uint)i;
+    }
+  }
+
+  /* Edges & faces: sort by the lowest new index of their vertices,
+   * interleaving them with the vertex stream they reference. */
+  if (edge_idx) {
+    BMEdge *e;
+    BM_ITER_MESH_INDEX (e, &iter, bm, BM_EDGES_OF_MESH, i) {
+      sort_data[i].key = min_ii(vert_idx[BM_elem_index_get(e->v1)],
+                                vert_idx[BM_elem_index_get(e->v2)]);
+      sort_data[i].org_index = (uint)i;
+    }
+    qsort(sort_data, bm->totedge, sizeof(*sort_data), bm_elem_reorder_spatial_cmp);
+    for (i = 0; i < bm->totedge; i++) {
+      edge_idx[sort_data[i].org_index] = (uint)i;
+    }
+  }
+
+  if (face_idx) {
+    BMFace *f;
+    BM_ITER_MESH_INDEX (f, &iter, bm, BM_FACES_OF_MESH, i) {
+      BMLoop *l_iter, *l_first;
+      uint key = (uint)bm->totvert;
+      l_iter = l_first = BM_FACE_FIRST_LOOP(f);
+      do {
+        key = min_ii(key, vert_idx[BM_elem_index_get(l_iter->v)]);
+      } while ((l_iter = l_iter->next) != l_first);
+      sort_data[i].key = key;
+      sort_data[i].org_index = (uint)i;
+    }
+    qsort(sort_data, bm->totface, sizeof(*sort_data), bm_elem_reorder_spatial_cmp);
+    for (i = 0; i < bm->totface; i++) {
+      face_idx[sort_data[i].org_index] = (uint)i;
+    }
+  }
+
+  MEM_freeN(sort_data);
+
+  BM_mesh_remap(bm, vert_idx, edge_idx, face_idx);
+
+  MEM_freeN(vert_idx);
+  if (edge_idx) {
+    MEM_freeN(edge_idx);
+  }
+  if (face_idx) {
+    MEM_freeN(face_idx);
+  }
+
+  /* Re-pack the pools so memory order matches the new iteration order
+   * (remapping only permutes element contents within the existing pools). */
+  if (bm->use_toolflags) {
+    BM_mesh_elem_toolflags_clear(bm);
+  }
+
+  const BMAllocTemplate allocsize = BMALLOC_TEMPLATE_FROM_BM(bm);
+  BLI_mempool *vpool_dst, *epool_dst, *lpool_dst, *fpool_dst;
+  bm_mempool_init_ex(&allocsize, bm->use_toolflags, &vpool_dst, &epool_dst, &lpool_dst, &fpool_dst);
+
+  BM_mesh_rebuild(bm,
+                  &((struct BMeshCreateParams){
+                      .use_toolflags = bm->use_toolflags,
+                  }),
+                  vpool_dst,
+                  epool_dst,
+                  lpool_dst,
+                  fpool_dst);
+}
+
+#undef SPATIAL_SORT_BITS
+
+/** \} */
+
 /**
  * Use new memory pools for this mesh.
  *
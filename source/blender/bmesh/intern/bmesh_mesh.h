@@ -93,6 +93,8 @@ int BM_mesh_elem_count(BMesh *bm, const char htype);
 
 void BM_mesh_remap(BMesh *bm, const uint *vert_idx, const uint *edge_idx, const uint *face_idx);
 
+void BM_mesh_elem_reorder_spatial(BMesh *bm);
+
 void BM_mesh_rebuild(BMesh *bm,
                      const struct BMeshCreateParams *params,
                      struct BLI_mempool *vpool,
@@ -81,6 +81,8 @@
 #include "BLI_alloca.h"
 #include "BLI_listbase.h"
 #include "BLI_math_vector.h"
+#include "BLI_mempool.h"
+#include "BLI_task.h"
 
 #include "BKE_customdata.h"
 #include "BKE_mesh.h"
@@ -176,6 +178,126 @@ static BMFace *bm_face_create_from_mpoly(
   return BM_face_create(bm, verts, edges, mp->totloop, NULL, BM_CREATE_SKIP_CD);
 }
 
+/* Copying the custom-data is the dominant cost of the conversion and every element writes only
+ * into its own block, so it can run over the task scheduler. Element creation itself has to
+ * stay single threaded: it allocates from shared mempools and links the disk and radial cycles
+ * of neighboring elements. The custom-data blocks however are allocated from within the tasks,
+ * through per-worker #BLI_mempool_cache allocation caches on the block pools. */
+typedef struct MeshToBMeshLayerCopyData {
+  const Mesh *me;
+  BMesh *bm;
+  BMVert **vtable;
+  BMEdge **etable;
+  BMFace **ftable;
+  bool calc_face_normal;
+  int cd_vert_bweight_offset;
+  int cd_edge_bweight_offset;
+  int cd_edge_crease_offset;
+  int cd_shape_key_offset;
+  int cd_shape_keyindex_offset;
+  int tot_shape_keys;
+  const float (**shape_key_table)[3];
+} MeshToBMeshLayerCopyData;
+
+/** Per-worker state, initialized by copying the `userdata_chunk` template. */
+typedef struct MeshToBMeshLayerCopyTLS {
+  /** Cache on the pool of the task's element domain (vert/edge/face blocks). */
+  BLI_mempool_cache elem_cache;
+  /** Cache on the loop block pool, only used by the face task. */
+  BLI_mempool_cache loop_cache;
+} MeshToBMeshLayerCopyTLS;
+
+static void bm_from_me_copy_tls_free(const void *__restrict UNUSED(userdata),
+                                     void *__restrict tls_v)
+{
+  MeshToBMeshLayerCopyTLS *tls = tls_v;
+  BLI_mempool_cache_flush(&tls->elem_cache);
+  BLI_mempool_cache_flush(&tls->loop_cache);
+}
+
+static void bm_from_me_copy_vert_task(void *__restrict userdata,
+                                      const int i,
+                                      const TaskParallelTLS *__restrict tls)
+{
+  MeshToBMeshLayerCopyData *data = userdata;
+  MeshToBMeshLayerCopyTLS *cd_tls = tls->userdata_chunk;
+  const Mesh *me = data->me;
+  BMVert *v = data->vtable[i];
+
+  CustomData_bmesh_ensure_block_cached(&data->bm->vdata, &v->head.data, &cd_tls->elem_cache);
+  CustomData_to_bmesh_block(&me->vdata, &data->bm->vdata, i, &v->head.data, true);
+
+  if (data->cd_vert_bweight_offset != -1) {
+    BM_ELEM_CD_SET_FLOAT(v, data->cd_vert_bweight_offset, (float)me->mvert[i].bweight / 255.0f);
+  }
+
+  /* Set shape key original index. */
+  if (data->cd_shape_keyindex_offset != -1) {
+    BM_ELEM_CD_SET_INT(v, data->cd_shape_keyindex_offset, i);
+  }
+
+  /* Set shape-key data. */
+  if (data->tot_shape_keys) {
+    float(*co_dst)[3] = BM_ELEM_CD_GET_VOID_P(v, data->cd_shape_key_offset);
+    for (int j = 0; j < data->tot_shape_keys; j++, co_dst++) {
+      copy_v3_v3(*co_dst, data->shape_key_table[j][i]);
+    }
+  }
+}
+
+static void bm_from_me_copy_edge_task(void *__restrict userdata,
+                                      const int i,
+                                      const TaskParallelTLS *__restrict tls)
+{
+  MeshToBMeshLayerCopyData *data = userdata;
+  MeshToBMeshLayerCopyTLS *cd_tls = tls->userdata_chunk;
+  const Mesh *me = data->me;
+  BMEdge *e = data->etable[i];
+
+  CustomData_bmesh_ensure_block_cached(&data->bm->edata, &e->head.data, &cd_tls->elem_cache);
+  CustomData_to_bmesh_block(&me->edata, &data->bm->edata, i, &e->head.data, true);
+
+  if (data->cd_edge_bweight_offset != -1) {
+    BM_ELEM_CD_SET_FLOAT(e, data->cd_edge_bweight_offset, (float)me->medge[i].bweight / 255.0f);
+  }
+  if (data->cd_edge_crease_offset != -1) {
+    BM_ELEM_CD_SET_FLOAT(e, data->cd_edge_crease_offset, (float)me->medge[i].crease / 255.0f);
+  }
+}
+
+static void bm_from_me_copy_face_task(void *__restrict userdata,
+                                      const int i,
+                                      const TaskParallelTLS *__restrict tls)
+{
+  MeshToBMeshLayerCopyData *data = userdata;
+  MeshToBMeshLayerCopyTLS *cd_tls = tls->userdata_chunk;
+  const Mesh *me = data->me;
+  BMFace *f = data->ftable[i];
+
+  if (UNLIKELY(f == NULL)) {
+    /* Bad face which was skipped during creation. */
+    return;
+  }
+
+  const MPoly *mp = &me->mpoly[i];
+  int j = mp->loopstart;
+  BMLoop *l_iter;
+  BMLoop *l_first;
+  l_iter = l_first = BM_FACE_FIRST_LOOP(f);
+  do {
+    CustomData_bmesh_ensure_block_cached(
+        &data->bm->ldata, &l_iter->head.data, &cd_tls->loop_cache);
+    CustomData_to_bmesh_block(&me->ldata, &data->bm->ldata, j++, &l_iter->head.data, true);
+  } while ((l_iter = l_iter->next) != l_first);
+
+  CustomData_bmesh_ensure_block_cached(&data->bm->pdata, &f->head.data, &cd_tls->elem_cache);
+  CustomData_to_bmesh_block(&me->pdata, &data->bm->pdata, i, &f->head.data, true);
+
+  if (data->calc_face_normal) {
+    BM_face_normal_update(f);
+  }
+}
+
 /**
  * \brief Mesh -> BMesh
  * \param bm: The mesh to write into, while this is typically a newly created BMesh,
@@ -346,25 +468,8 @@ void BM_mesh_bm_from_me(BMesh *bm, const Mesh *me, const struct BMeshFromMeshPar
 
     normal_short_to_float_v3(v->no, mvert->no);
 
-    /* Copy Custom Data */
-    CustomData_to_bmesh_block(&me->vdata, &bm->vdata, i, &v->head.data, true);
-
-    if (cd_vert_bweight_offset != -1) {
-      BM_ELEM_CD_SET_FLOAT(v, cd_vert_bweight_offset, (float)mvert->bweight / 255.0f);
-    }
-
-    /* Set shape key original index. */
-    if (cd_shape_keyindex_offset != -1) {
-      BM_ELEM_CD_SET_INT(v, cd_shape_keyindex_offset, i);
-    }
-
-    /* Set shape-key data. */
-    if (tot_shape_keys) {
-      float(*co_dst)[3] = BM_ELEM_CD_GET_VOID_P(v, cd_shape_key_offset);
-      for (int j = 0; j < tot_shape_keys; j++, co_dst++) {
-        copy_v3_v3(*co_dst, shape_key_table[j][i]);
-      }
-    }
+    /* Custom data (including the block allocation, through per-thread
+     * allocation caches) is copied in parallel afterwards. */
   }
   if (is_new) {
     bm->elem_index_dirty &= ~BM_VERT; /* Added in order, clear dirty flag. */
@@ -385,25 +490,13 @@ void BM_mesh_bm_from_me(BMesh *bm, const Mesh *me, const struct BMeshFromMeshPar
     if (medge->flag & SELECT) {
       BM_edge_select_set(bm, e, true);
     }
-
-    /* Copy Custom Data */
-    CustomData_to_bmesh_block(&me->edata, &bm->edata, i, &e->head.data, true);
-
-    if (cd_edge_bweight_offset != -1) {
-      BM_ELEM_CD_SET_FLOAT(e, cd_edge_bweight_offset, (float)medge->bweight / 255.0f);
-    }
-    if (cd_edge_crease_offset != -1) {
-      BM_ELEM_CD_SET_FLOAT(e, cd_edge_crease_offset, (float)medge->crease / 255.0f);
-    }
   }
   if (is_new) {
     bm->elem_index_dirty &= ~BM_EDGE; /* Added in order, clear dirty flag. */
   }
 
-  /* Only needed for selection. */
-  if (me->mselect && me->totselect != 0) {
-    ftable = MEM_mallocN(sizeof(BMFace **) * me->totpoly, __func__);
-  }
+  /* Needed for the parallel custom data copy, also used for selection. */
+  ftable = MEM_mallocN(sizeof(BMFace **) * me->totpoly, __func__);
 
   mloop = me->mloop;
   mp = me->mpoly;
@@ -411,10 +504,7 @@ void BM_mesh_bm_from_me(BMesh *bm, const Mesh *me, const struct BMeshFromMeshPar
     BMLoop *l_iter;
     BMLoop *l_first;
 
-    f = bm_face_create_from_mpoly(mp, mloop + mp->loopstart, bm, vtable, etable);
-    if (ftable != NULL) {
-      ftable[i] = f;
-    }
+    f = ftable[i] = bm_face_create_from_mpoly(mp, mloop + mp->loopstart, bm, vtable, etable);
 
     if (UNLIKELY(f == NULL)) {
       printf(
@@ -442,27 +532,55 @@ void BM_mesh_bm_from_me(BMesh *bm, const Mesh *me, const struct BMeshFromMeshPar
       bm->act_face = f;
     }
 
-    int j = mp->loopstart;
     l_iter = l_first = BM_FACE_FIRST_LOOP(f);
     do {
       /* Don't use 'j' since we may have skipped some faces, hence some loops. */
       BM_elem_index_set(l_iter, totloops++); /* set_ok */
-
-      /* Save index of corresponding #MLoop. */
-      CustomData_to_bmesh_block(&me->ldata, &bm->ldata, j++, &l_iter->head.data, true);
     } while ((l_iter = l_iter->next) != l_first);
-
-    /* Copy Custom Data */
-    CustomData_to_bmesh_block(&me->pdata, &bm->pdata, i, &f->head.data, true);
-
-    if (params->calc_face_normal) {
-      BM_face_normal_update(f);
-    }
   }
   if (is_new) {
     bm->elem_index_dirty &= ~(BM_FACE | BM_LOOP); /* Added in order, clear dirty flag. */
   }
 
+  /* Copy custom data (and calculate face normals when requested) over the task scheduler.
+   * The blocks are allocated from within the tasks through per-worker allocation caches,
+   * flushed back to the shared pools when each worker finishes. */
+  {
+    MeshToBMeshLayerCopyData data = {
+        .me = me,
+        .bm = bm,
+        .vtable = vtable,
+        .etable = etable,
+        .ftable = ftable,
+        .calc_face_normal = params->calc_face_normal,
+        .cd_vert_bweight_offset = cd_vert_bweight_offset,
+        .cd_edge_bweight_offset = cd_edge_bweight_offset,
+        .cd_edge_crease_offset = cd_edge_crease_offset,
+        .cd_shape_key_offset = cd_shape_key_offset,
+        .cd_shape_keyindex_offset = cd_shape_keyindex_offset,
+        .tot_shape_keys = tot_shape_keys,
+        .shape_key_table = shape_key_table,
+    };
+    MeshToBMeshLayerCopyTLS tls_template;
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 1024;
+    settings.userdata_chunk = &tls_template;
+    settings.userdata_chunk_size = sizeof(tls_template);
+    settings.func_free = bm_from_me_copy_tls_free;
+
+    BLI_mempool_cache_init(bm->vdata.pool, &tls_template.elem_cache);
+    BLI_mempool_cache_init(NULL, &tls_template.loop_cache);
+    BLI_task_parallel_range(0, me->totvert, &data, bm_from_me_copy_vert_task, &settings);
+
+    BLI_mempool_cache_init(bm->edata.pool, &tls_template.elem_cache);
+    BLI_task_parallel_range(0, me->totedge, &data, bm_from_me_copy_edge_task, &settings);
+
+    BLI_mempool_cache_init(bm->pdata.pool, &tls_template.elem_cache);
+    BLI_mempool_cache_init(bm->ldata.pool, &tls_template.loop_cache);
+    BLI_task_parallel_range(0, me->totpoly, &data, bm_from_me_copy_face_task, &settings);
+  }
+
   /* -------------------------------------------------------------------- */
   /* MSelect clears the array elements (avoid adding multiple times).
    *
@@ -0,0 +1,104 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/** \file
+ * \ingroup bmesh
+ *
+ * Structure-of-arrays mirror of #BMesh vertex data.
+ *
+ * Bulk operations which touch every vertex (transform, normal calculation,
+ * rule based selection) spend most of their time waiting on scattered loads
+ * when they walk the pointer based #BMVert storage. This mirror gathers the
+ * hot per-vertex data into flat arrays once, lets the operation iterate them
+ * sequentially, and scatters the result back afterwards.
+ */
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_math_vector.h"
+#include "BLI_utildefines.h"
+
+#include "bmesh.h"
+
+BMVertsSoA *BM_mesh_verts_soa_create(BMesh *bm, const BMVertsSoA_Params *params)
+{
+  /* The mirror indexes vertices by their vertex table position. */
+  BM_mesh_elem_table_ensure(bm, BM_VERT);
+
+  BMVertsSoA *soa = MEM_callocN(sizeof(*soa), __func__);
+  soa->verts_len = bm->totvert;
+  soa->params = *params;
+
+  soa->co = MEM_malloc_arrayN(bm->totvert, sizeof(*soa->co), __func__);
+  if (params->use_normals) {
+    soa->no = MEM_malloc_arrayN(bm->totvert, sizeof(*soa->no), __func__);
+  }
+  if (params->use_hflags) {
+    soa->hflag = MEM_malloc_arrayN(bm->totvert, sizeof(*soa->hflag), __func__);
+  }
+
+  for (int i = 0; i < bm->totvert; i++) {
+    const BMVert *v = bm->vtable[i];
+    copy_v3_v3(soa->co[i], v->co);
+    if (soa->no != NULL) {
+      copy_v3_v3(soa->no[i], v->no);
+    }
+    if (soa->hflag != NULL) {
+      soa->hflag[i] = v->head.hflag;
+    }
+  }
+  return soa;
+}
+
+/**
+ * Return true when the mirror still matches the topology of \a bm,
+ * callers are expected to re-create the mirror when this returns false.
+ */
+bool BM_mesh_verts_soa_is_valid(BMesh *bm, const BMVertsSoA *soa)
+{
+  return (soa->verts_len == bm->totvert) && ((bm->elem_table_dirty & BM_VERT) == 0);
+}
+
+/**
+ * Scatter the (possibly modified) array contents back to the vertices.
+ *
+ * \note This only writes the data gathered on creation, normals are not
+ * recalculated here: use the regular update functions for that when
+ * coordinates changed.
+ */
+void BM_mesh_verts_soa_apply(BMesh *bm, const BMVertsSoA *soa)
+{
+  BLI_assert(BM_mesh_verts_soa_is_valid(bm, soa));
+
+  for (int i = 0; i < soa->verts_len; i++) {
+    BMVert *v = bm->vtable[i];
+    copy_v3_v3(v->co, soa->co[i]);
+    if (soa->no != NULL) {
+      copy_v3_v3(v->no, soa->no[i]);
+    }
+    if (soa->hflag != NULL) {
+      v->head.hflag = soa->hflag[i];
+    }
+  }
+}
+
+void BM_mesh_verts_soa_destroy(BMVertsSoA *soa)
+{
+  MEM_freeN(soa->co);
+  MEM_SAFE_FREE(soa->no);
+  MEM_SAFE_FREE(soa->hflag);
+  MEM_freeN(soa);
+}
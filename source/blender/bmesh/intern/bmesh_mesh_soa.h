@@ -0,0 +1,73 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#pragma once
+
+/** \file
+ * \ingroup bmesh
+ */
+
+#include "BLI_compiler_attrs.h"
+
+/**
+ * Parameters which determine which vertex data is mirrored into flat arrays.
+ */
+typedef struct BMVertsSoA_Params {
+  bool use_normals;
+  bool use_hflags;
+} BMVertsSoA_Params;
+
+/**
+ * Compact structure-of-arrays mirror of the vertices of a #BMesh.
+ *
+ * Whole-mesh operations which only read or write vertex data are memory bound
+ * when they chase #BMVert pointers; iterating these flat arrays instead runs
+ * at stream bandwidth and is trivial for the compiler to vectorize.
+ *
+ * Hints:
+ *
+ * - The mirror indexes vertices by their position in the vertex table, so the
+ *   index mapping back to elements is `bm->vtable` (kept valid on creation).
+ *
+ * - The mirror is a snapshot: it must be re-created after any topology change,
+ *   see #BM_mesh_verts_soa_is_valid.
+ *
+ * - Avoid creating this data for a single pass over the mesh, the gather and
+ *   scatter cost only pays off when the arrays are iterated multiple times
+ *   (while transforming geometry interactively for example).
+ */
+typedef struct BMVertsSoA {
+  int verts_len;
+
+  /** Vertex coordinates, never NULL. */
+  float (*co)[3];
+  /** Vertex normals, NULL unless `use_normals` was set. */
+  float (*no)[3];
+  /** Vertex header flags (`BM_ELEM_` values), NULL unless `use_hflags` was set. */
+  char *hflag;
+
+  /** Store the parameters used in creation so invalid use can be asserted. */
+  BMVertsSoA_Params params;
+} BMVertsSoA;
+
+BMVertsSoA *BM_mesh_verts_soa_create(BMesh *bm, const BMVertsSoA_Params *params)
+    ATTR_NONNULL(1, 2) ATTR_WARN_UNUSED_RESULT;
+
+bool BM_mesh_verts_soa_is_valid(BMesh *bm, const BMVertsSoA *soa) ATTR_NONNULL(1, 2);
+
+void BM_mesh_verts_soa_apply(BMesh *bm, const BMVertsSoA *soa) ATTR_NONNULL(1, 2);
+
+void BM_mesh_verts_soa_destroy(BMVertsSoA *soa) ATTR_NONNULL(1);
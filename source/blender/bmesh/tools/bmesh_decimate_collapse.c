@@ -32,6 +32,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_quadric.h"
+#include "BLI_task.h"
 #include "BLI_utildefines_stack.h"
 
 #include "BKE_customdata.h"
@@ -76,64 +77,94 @@ typedef enum CD_UseFlag {
 /* BMesh Helper Functions
  * ********************** */
 
-/**
- * \param vquadrics: must be calloc'd
- */
-static void bm_decim_build_quadrics(BMesh *bm, Quadric *vquadrics)
+static void bm_decim_face_quadric_calc(const BMFace *f, Quadric *r_q)
 {
-  BMIter iter;
-  BMFace *f;
-  BMEdge *e;
+  float center[3];
+  double plane_db[4];
 
-  BM_ITER_MESH (f, &iter, bm, BM_FACES_OF_MESH) {
-    BMLoop *l_first;
-    BMLoop *l_iter;
+  BM_face_calc_center_median(f, center);
+  copy_v3db_v3fl(plane_db, f->no);
+  plane_db[3] = -dot_v3db_v3fl(plane_db, center);
 
-    float center[3];
-    double plane_db[4];
-    Quadric q;
+  BLI_quadric_from_plane(r_q, plane_db);
+}
 
-    BM_face_calc_center_median(f, center);
-    copy_v3db_v3fl(plane_db, f->no);
-    plane_db[3] = -dot_v3db_v3fl(plane_db, center);
+static bool bm_decim_boundary_edge_quadric_calc(const BMEdge *e, Quadric *r_q)
+{
+  float edge_vector[3];
+  float edge_plane[3];
+  double edge_plane_db[4];
+  sub_v3_v3v3(edge_vector, e->v2->co, e->v1->co);
 
-    BLI_quadric_from_plane(&q, plane_db);
+  cross_v3_v3v3(edge_plane, edge_vector, e->l->f->no);
+  copy_v3db_v3fl(edge_plane_db, edge_plane);
 
-    l_iter = l_first = BM_FACE_FIRST_LOOP(f);
-    do {
-      BLI_quadric_add_qu_qu(&vquadrics[BM_elem_index_get(l_iter->v)], &q);
-    } while ((l_iter = l_iter->next) != l_first);
-  }
+  if (normalize_v3_db(edge_plane_db) > (double)FLT_EPSILON) {
+    float center[3];
 
-  /* boundary edges */
-  BM_ITER_MESH (e, &iter, bm, BM_EDGES_OF_MESH) {
-    if (UNLIKELY(BM_edge_is_boundary(e))) {
-      float edge_vector[3];
-      float edge_plane[3];
-      double edge_plane_db[4];
-      sub_v3_v3v3(edge_vector, e->v2->co, e->v1->co);
-      f = e->l->f;
+    mid_v3_v3v3(center, e->v1->co, e->v2->co);
 
-      cross_v3_v3v3(edge_plane, edge_vector, f->no);
-      copy_v3db_v3fl(edge_plane_db, edge_plane);
+    edge_plane_db[3] = -dot_v3db_v3fl(edge_plane_db, center);
+    BLI_quadric_from_plane(r_q, edge_plane_db);
+    BLI_quadric_mul(r_q, BOUNDARY_PRESERVE_WEIGHT);
+    return true;
+  }
+  return false;
+}
 
-      if (normalize_v3_db(edge_plane_db) > (double)FLT_EPSILON) {
-        Quadric q;
-        float center[3];
+struct DecimBuildQuadricsData {
+  BMesh *bm;
+  Quadric *vquadrics;
+};
 
-        mid_v3_v3v3(center, e->v1->co, e->v2->co);
+static void bm_decim_build_quadrics_task_cb(void *__restrict userdata,
+                                            const int index,
+                                            const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  struct DecimBuildQuadricsData *data = userdata;
+  BMVert *v = data->bm->vtable[index];
+  Quadric *q_vert = &data->vquadrics[index];
+  BMIter iter;
+  BMFace *f;
+  BMEdge *e;
 
-        edge_plane_db[3] = -dot_v3db_v3fl(edge_plane_db, center);
-        BLI_quadric_from_plane(&q, edge_plane_db);
-        BLI_quadric_mul(&q, BOUNDARY_PRESERVE_WEIGHT);
+  /* Gather from the vertex side so every vertex accumulates only into its own quadric,
+   * which keeps the pass trivially parallel (faces & boundary edges are visited once
+   * per connected vertex, re-computing their plane is cheaper than synchronizing). */
+  BM_ITER_ELEM (f, &iter, v, BM_FACES_OF_VERT) {
+    Quadric q;
+    bm_decim_face_quadric_calc(f, &q);
+    BLI_quadric_add_qu_qu(q_vert, &q);
+  }
 
-        BLI_quadric_add_qu_qu(&vquadrics[BM_elem_index_get(e->v1)], &q);
-        BLI_quadric_add_qu_qu(&vquadrics[BM_elem_index_get(e->v2)], &q);
+  BM_ITER_ELEM (e, &iter, v, BM_EDGES_OF_VERT) {
+    if (UNLIKELY(BM_edge_is_boundary(e))) {
+      Quadric q;
+      if (bm_decim_boundary_edge_quadric_calc(e, &q)) {
+        BLI_quadric_add_qu_qu(q_vert, &q);
       }
     }
   }
 }
 
+/**
+ * \param vquadrics: must be calloc'd
+ */
+static void bm_decim_build_quadrics(BMesh *bm, Quadric *vquadrics)
+{
+  struct DecimBuildQuadricsData data = {
+      .bm = bm,
+      .vquadrics = vquadrics,
+  };
+
+  BM_mesh_elem_table_ensure(bm, BM_VERT);
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+  BLI_task_parallel_range(0, bm->totvert, &data, bm_decim_build_quadrics_task_cb, &settings);
+}
+
 static void bm_decim_calc_target_co_db(BMEdge *e, double optimize_co[3], const Quadric *vquadrics)
 {
   /* compute an edge contraction target for edge 'e'
@@ -236,18 +267,20 @@ static float bm_decim_build_edge_cost_single__topology(BMEdge *e)
 
 #endif /* USE_TOPOLOGY_FALLBACK */
 
-static void bm_decim_build_edge_cost_single(BMEdge *e,
-                                            const Quadric *vquadrics,
-                                            const float *vweights,
-                                            const float vweight_factor,
-                                            Heap *eheap,
-                                            HeapNode **eheap_table)
+/**
+ * Calculate the collapse cost of \a e, returning false when the edge must not be collapsed.
+ */
+static bool bm_decim_build_edge_cost_single_calc(BMEdge *e,
+                                                 const Quadric *vquadrics,
+                                                 const float *vweights,
+                                                 const float vweight_factor,
+                                                 float *r_cost)
 {
   float cost;
 
   if (UNLIKELY(vweights && ((vweights[BM_elem_index_get(e->v1)] == 0.0f) ||
                             (vweights[BM_elem_index_get(e->v2)] == 0.0f)))) {
-    goto clear;
+    return false;
   }
 
   /* check we can collapse, some edges we better not touch */
@@ -257,7 +290,7 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
     else {
       /* only collapse tri's */
-      goto clear;
+      return false;
     }
   }
   else if (BM_edge_is_manifold(e)) {
@@ -266,11 +299,11 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
     else {
       /* only collapse tri's */
-      goto clear;
+      return false;
     }
   }
   else {
-    goto clear;
+    return false;
   }
   /* end sanity check */
 
@@ -322,14 +355,28 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
   }
 
-  BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
-  return;
+  *r_cost = cost;
+  return true;
+}
 
-clear:
-  if (eheap_table[BM_elem_index_get(e)]) {
-    BLI_heap_remove(eheap, eheap_table[BM_elem_index_get(e)]);
+static void bm_decim_build_edge_cost_single(BMEdge *e,
+                                            const Quadric *vquadrics,
+                                            const float *vweights,
+                                            const float vweight_factor,
+                                            Heap *eheap,
+                                            HeapNode **eheap_table)
+{
+  float cost;
+
+  if (bm_decim_build_edge_cost_single_calc(e, vquadrics, vweights, vweight_factor, &cost)) {
+    BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
+  }
+  else {
+    if (eheap_table[BM_elem_index_get(e)]) {
+      BLI_heap_remove(eheap, eheap_table[BM_elem_index_get(e)]);
+    }
+    eheap_table[BM_elem_index_get(e)] = NULL;
   }
-  eheap_table[BM_elem_index_get(e)] = NULL;
 }
 
 /* use this for degenerate cases - add back to the heap with an invalid cost,
@@ -340,6 +387,32 @@ static void bm_decim_invalid_edge_cost_single(BMEdge *e, Heap *eheap, HeapNode *
   eheap_table[BM_elem_index_get(e)] = BLI_heap_insert(eheap, COST_INVALID, e);
 }
 
+struct DecimBuildEdgeCostData {
+  BMesh *bm;
+  const Quadric *vquadrics;
+  const float *vweights;
+  float vweight_factor;
+  /* Costs indexed by edge, #FLT_MAX for edges that must not enter the heap. */
+  float *ecosts;
+};
+
+static void bm_decim_build_edge_cost_task_cb(void *__restrict userdata,
+                                             const int index,
+                                             const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  struct DecimBuildEdgeCostData *data = userdata;
+  BMEdge *e = BM_edge_at_index(data->bm, index);
+  float cost;
+
+  if (bm_decim_build_edge_cost_single_calc(
+          e, data->vquadrics, data->vweights, data->vweight_factor, &cost)) {
+    data->ecosts[index] = cost;
+  }
+  else {
+    data->ecosts[index] = FLT_MAX;
+  }
+}
+
 static void bm_decim_build_edge_cost(BMesh *bm,
                                      const Quadric *vquadrics,
                                      const float *vweights,
@@ -347,15 +420,34 @@ static void bm_decim_build_edge_cost(BMesh *bm,
                                      Heap *eheap,
                                      HeapNode **eheap_table)
 {
-  BMIter iter;
-  BMEdge *e;
-  uint i;
-
-  BM_ITER_MESH_INDEX (e, &iter, bm, BM_EDGES_OF_MESH, i) {
-    /* keep sanity check happy */
-    eheap_table[i] = NULL;
-    bm_decim_build_edge_cost_single(e, vquadrics, vweights, vweight_factor, eheap, eheap_table);
+  float *ecosts = MEM_mallocN(sizeof(float) * bm->totedge, __func__);
+
+  BM_mesh_elem_table_ensure(bm, BM_EDGE);
+
+  /* Computing the cost is the expensive part (quadric evaluation & optimal placement),
+   * run it in parallel and fill the heap from the result.
+   * NOTE: #FLT_MAX is usable as a skip sentinel since #COST_INVALID costs are only
+   * inserted for degenerate edges after the initial build. */
+  struct DecimBuildEdgeCostData data = {
+      .bm = bm,
+      .vquadrics = vquadrics,
+      .vweights = vweights,
+      .vweight_factor = vweight_factor,
+      .ecosts = ecosts,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+  BLI_task_parallel_range(0, bm->totedge, &data, bm_decim_build_edge_cost_task_cb, &settings);
+
+  for (int i = 0; i < bm->totedge; i++) {
+    eheap_table[i] = (ecosts[i] != FLT_MAX) ?
+                         BLI_heap_insert(eheap, ecosts[i], BM_edge_at_index(bm, i)) :
+                         NULL;
   }
+
+  MEM_freeN(ecosts);
 }
 
 #ifdef USE_SYMMETRY
@@ -23,6 +23,12 @@
 
 namespace blender::compositor {
 
+/**
+ * Execution is CPU based in both models. The tiled model can offload individual complex
+ * operations to OpenCL devices (see NodeOperation::executeOpenCL), which is the only device
+ * acceleration available; there is no execution model that compiles operation chains to GPU
+ * shaders.
+ */
 enum class eExecutionModel {
   /**
    * Operations are executed from outputs to inputs grouped in execution groups and rendered
@@ -0,0 +1,60 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ */
+
+#include "COM_BufferPool.h"
+
+namespace blender::compositor {
+
+static int64_t buffer_size_in_floats(DataType data_type, const rcti &rect, bool is_a_single_elem)
+{
+  const int64_t num_elems = is_a_single_elem ?
+                                1 :
+                                (int64_t)BLI_rcti_size_x(&rect) * BLI_rcti_size_y(&rect);
+  return num_elems * COM_data_type_num_channels(data_type);
+}
+
+MemoryBuffer *BufferPool::take(DataType data_type, const rcti &rect, bool is_a_single_elem)
+{
+  const int64_t num_floats = buffer_size_in_floats(data_type, rect, is_a_single_elem);
+  num_takes_++;
+
+  Vector<std::unique_ptr<MemoryBuffer>> *bucket = buckets_.lookup_ptr(num_floats);
+  if (bucket && !bucket->is_empty()) {
+    std::unique_ptr<MemoryBuffer> buffer = bucket->pop_last();
+    buffer->reinit(data_type, rect, is_a_single_elem);
+    num_reuses_++;
+    return buffer.release();
+  }
+
+  bytes_allocated_ += num_floats * sizeof(float);
+  return new MemoryBuffer(data_type, rect, is_a_single_elem);
+}
+
+void BufferPool::release(std::unique_ptr<MemoryBuffer> buffer)
+{
+  const int64_t num_floats = (int64_t)buffer->get_memory_width() *
+                             buffer->get_memory_height() * buffer->get_num_channels();
+  buckets_.lookup_or_add_default(num_floats).append(std::move(buffer));
+}
+
+void BufferPool::clear()
+{
+  buckets_.clear();
+}
+
+}  // namespace blender::compositor
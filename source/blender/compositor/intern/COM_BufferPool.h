@@ -0,0 +1,78 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ */
+
+#pragma once
+
+#include "BLI_map.hh"
+#include "BLI_vector.hh"
+#include "COM_MemoryBuffer.h"
+#ifdef WITH_CXX_GUARDEDALLOC
+#  include "MEM_guardedalloc.h"
+#endif
+#include <memory>
+
+namespace blender::compositor {
+
+/**
+ * Pool of recycled operation buffers.
+ *
+ * Full-frame execution allocates a full-rect MemoryBuffer for every operation and disposes it
+ * once all its readers have finished. On big composites that thrashes the allocator with
+ * gigabytes of short-lived allocations per recompute. This pool keeps disposed buffers bucketed
+ * by allocation size so later operations with the same size (the common case, as most operations
+ * share the tree resolution) reuse the memory instead of reallocating it. The pool is owned by
+ * the ExecutionSystem and all pooled memory is freed with it.
+ */
+class BufferPool {
+ private:
+  /** Disposed buffers available for reuse, bucketed by allocation size in floats. */
+  Map<int64_t, Vector<std::unique_ptr<MemoryBuffer>>> buckets_;
+
+  /* Statistics, see DebugInfo::buffer_pool_stats. */
+  int64_t num_takes_ = 0;
+  int64_t num_reuses_ = 0;
+  int64_t bytes_allocated_ = 0;
+
+ public:
+  /**
+   * Get a buffer for given area, reusing a pooled buffer with a matching allocation size when
+   * one is available. Caller takes ownership, give the buffer back with release() for reuse.
+   */
+  MemoryBuffer *take(DataType data_type, const rcti &rect, bool is_a_single_elem);
+
+  /**
+   * Return a buffer obtained from take() to the pool. Only buffers that own their data may be
+   * pooled.
+   */
+  void release(std::unique_ptr<MemoryBuffer> buffer);
+
+  /**
+   * Dispose all pooled buffers, freeing their memory.
+   */
+  void clear();
+
+ private:
+  /* Allow the DebugInfo class to report the statistics. */
+  friend class DebugInfo;
+
+#ifdef WITH_CXX_GUARDEDALLOC
+  MEM_CXX_CLASS_ALLOC_FUNCS("COM:BufferPool")
+#endif
+};
+
+}  // namespace blender::compositor
@@ -18,10 +18,13 @@
 
 #include "COM_CPUDevice.h"
 
+#include "COM_Debug.h"
 #include "COM_ExecutionGroup.h"
 
 #include "BLI_rect.h"
 
+#include "PIL_time.h"
+
 namespace blender::compositor {
 
 CPUDevice::CPUDevice(int thread_id) : m_thread_id(thread_id)
@@ -35,7 +38,10 @@ void CPUDevice::execute(WorkPackage *work_package)
       const unsigned int chunkNumber = work_package->chunk_number;
       ExecutionGroup *executionGroup = work_package->execution_group;
 
-      executionGroup->getOutputOperation()->executeRegion(&work_package->rect, chunkNumber);
+      NodeOperation *operation = executionGroup->getOutputOperation();
+      const double start_time = PIL_check_seconds_timer();
+      operation->executeRegion(&work_package->rect, chunkNumber);
+      DebugInfo::operation_render_time(operation, PIL_check_seconds_timer() - start_time);
       executionGroup->finalizeChunkExecution(chunkNumber, nullptr);
       break;
     }
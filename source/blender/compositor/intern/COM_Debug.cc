@@ -18,6 +18,7 @@
 
 #include "COM_Debug.h"
 
+#include <algorithm>
 #include <map>
 #include <typeinfo>
 #include <vector>
@@ -27,6 +28,7 @@ extern "C" {
 #include "BLI_path_util.h"
 #include "BLI_string.h"
 #include "BLI_sys_types.h"
+#include "BLI_threads.h"
 
 #include "BKE_appdir.h"
 #include "BKE_node.h"
@@ -35,6 +37,7 @@ extern "C" {
 #include "IMB_imbuf_types.h"
 }
 
+#include "COM_BufferPool.h"
 #include "COM_ExecutionSystem.h"
 #include "COM_Node.h"
 
@@ -51,6 +54,11 @@ DebugInfo::OpNameMap DebugInfo::m_op_names;
 std::string DebugInfo::m_current_node_name;
 std::string DebugInfo::m_current_op_name;
 DebugInfo::GroupStateMap DebugInfo::m_group_states;
+DebugInfo::OpTimeMap DebugInfo::m_op_times;
+DebugInfo::OpSizeMap DebugInfo::m_op_buffer_bytes;
+
+/* Tiled execution renders chunks from multiple device threads. */
+static ThreadMutex g_op_times_mutex = BLI_MUTEX_INITIALIZER;
 
 static std::string operation_class_name(const NodeOperation *op)
 {
@@ -79,6 +87,58 @@ std::string DebugInfo::operation_name(const NodeOperation *op)
   return "";
 }
 
+void DebugInfo::add_operation_render_time(const NodeOperation *op, double render_time)
+{
+  BLI_mutex_lock(&g_op_times_mutex);
+  m_op_times[op] += render_time;
+  BLI_mutex_unlock(&g_op_times_mutex);
+}
+
+void DebugInfo::print_operation_times()
+{
+  std::vector<std::pair<const NodeOperation *, double>> sorted_times(m_op_times.begin(),
+                                                                     m_op_times.end());
+  std::sort(sorted_times.begin(),
+            sorted_times.end(),
+            [](const std::pair<const NodeOperation *, double> &a,
+               const std::pair<const NodeOperation *, double> &b) { return a.second > b.second; });
+
+  printf("Compositor operation render times:\n");
+  for (const std::pair<const NodeOperation *, double> &item : sorted_times) {
+    const NodeOperation *op = item.first;
+    printf("  %10.4f s  #%d %s\n", item.second, op->get_id(), operation_class_name(op).c_str());
+  }
+}
+
+void DebugInfo::add_operation_buffer_bytes(const NodeOperation *op, const MemoryBuffer *buffer)
+{
+  const int64_t bytes = (int64_t)buffer->get_memory_width() * buffer->get_memory_height() *
+                        buffer->get_num_channels() * sizeof(float);
+  m_op_buffer_bytes[op] += bytes;
+}
+
+void DebugInfo::print_buffer_pool_stats(const BufferPool &pool)
+{
+  std::vector<std::pair<const NodeOperation *, int64_t>> sorted_bytes(m_op_buffer_bytes.begin(),
+                                                                      m_op_buffer_bytes.end());
+  std::sort(sorted_bytes.begin(),
+            sorted_bytes.end(),
+            [](const std::pair<const NodeOperation *, int64_t> &a,
+               const std::pair<const NodeOperation *, int64_t> &b) { return a.second > b.second; });
+
+  printf("Compositor buffer pool: %d buffers taken, %d reused, %.1f MB allocated\n",
+         (int)pool.num_takes_,
+         (int)pool.num_reuses_,
+         pool.bytes_allocated_ / (1024.0 * 1024.0));
+  for (const std::pair<const NodeOperation *, int64_t> &item : sorted_bytes) {
+    const NodeOperation *op = item.first;
+    printf("  %8.1f MB  #%d %s\n",
+           item.second / (1024.0 * 1024.0),
+           op->get_id(),
+           operation_class_name(op).c_str());
+  }
+}
+
 int DebugInfo::graphviz_operation(const ExecutionSystem *system,
                                   NodeOperation *operation,
                                   const ExecutionGroup *group,
@@ -33,6 +33,15 @@ static constexpr bool COM_GRAPHVIZ_SHOW_NODE_NAME = false;
 /* Saves operations results to image files. */
 static constexpr bool COM_EXPORT_OPERATION_BUFFERS = false;
 
+/* Prints accumulated per-operation render times to the console once a tree finished executing,
+ * for finding hot operations in a composite. */
+static constexpr bool COM_EXPORT_OPERATION_TIMES = false;
+
+/* Prints buffer pool statistics and per-operation buffer memory traffic to the console once a
+ * tree finished executing, for finding memory hungry operations in a composite. */
+static constexpr bool COM_EXPORT_BUFFER_POOL_STATS = false;
+
+class BufferPool;
 class Node;
 class ExecutionSystem;
 class ExecutionGroup;
@@ -43,6 +52,8 @@ class DebugInfo {
 
   typedef std::map<const Node *, std::string> NodeNameMap;
   typedef std::map<const NodeOperation *, std::string> OpNameMap;
+  typedef std::map<const NodeOperation *, double> OpTimeMap;
+  typedef std::map<const NodeOperation *, int64_t> OpSizeMap;
   typedef std::map<const ExecutionGroup *, GroupState> GroupStateMap;
 
   static std::string node_name(const Node *node);
@@ -60,6 +71,10 @@ class DebugInfo {
   static std::string m_current_op_name;
   /** For visualizing group states. */
   static GroupStateMap m_group_states;
+  /** Accumulated render time of each operation. */
+  static OpTimeMap m_op_times;
+  /** Accumulated buffer bytes taken from the pool by each operation. */
+  static OpSizeMap m_op_buffer_bytes;
 
  public:
   static void convert_started()
@@ -81,6 +96,12 @@ class DebugInfo {
     if (COM_EXPORT_OPERATION_BUFFERS) {
       delete_operation_exports();
     }
+    if (COM_EXPORT_OPERATION_TIMES) {
+      m_op_times.clear();
+    }
+    if (COM_EXPORT_BUFFER_POOL_STATS) {
+      m_op_buffer_bytes.clear();
+    }
   };
 
   static void node_added(const Node *node)
@@ -132,9 +153,42 @@ class DebugInfo {
     }
   }
 
+  static void operation_render_time(const NodeOperation *op, double render_time)
+  {
+    if (COM_EXPORT_OPERATION_TIMES) {
+      add_operation_render_time(op, render_time);
+    }
+  }
+
+  static void operation_buffer_taken(const NodeOperation *op, const MemoryBuffer *buffer)
+  {
+    if (COM_EXPORT_BUFFER_POOL_STATS && buffer) {
+      add_operation_buffer_bytes(op, buffer);
+    }
+  }
+
+  static void buffer_pool_stats(const BufferPool &pool)
+  {
+    if (COM_EXPORT_BUFFER_POOL_STATS) {
+      print_buffer_pool_stats(pool);
+    }
+  }
+
+  static void execute_finished()
+  {
+    if (COM_EXPORT_OPERATION_TIMES) {
+      print_operation_times();
+    }
+  }
+
   static void graphviz(const ExecutionSystem *system, StringRefNull name = "");
 
  protected:
+  static void add_operation_render_time(const NodeOperation *op, double render_time);
+  static void print_operation_times();
+  static void add_operation_buffer_bytes(const NodeOperation *op, const MemoryBuffer *buffer);
+  static void print_buffer_pool_stats(const BufferPool &pool);
+
   static int graphviz_operation(const ExecutionSystem *system,
                                 NodeOperation *operation,
                                 const ExecutionGroup *group,
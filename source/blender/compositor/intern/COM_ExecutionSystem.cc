@@ -42,6 +42,7 @@ ExecutionSystem::ExecutionSystem(RenderData *rd,
                                  const ColorManagedViewSettings *viewSettings,
                                  const ColorManagedDisplaySettings *displaySettings,
                                  const char *viewName)
+    : active_buffers_(&buffer_pool_)
 {
   num_work_threads_ = WorkScheduler::get_num_cpu_threads();
   this->m_context.setViewName(viewName);
@@ -77,7 +78,8 @@ ExecutionSystem::ExecutionSystem(RenderData *rd,
       execution_model_ = new TiledExecutionModel(m_context, m_operations, m_groups);
       break;
     case eExecutionModel::FullFrame:
-      execution_model_ = new FullFrameExecutionModel(m_context, active_buffers_, m_operations);
+      execution_model_ = new FullFrameExecutionModel(
+          m_context, active_buffers_, buffer_pool_, m_operations);
       break;
     default:
       BLI_assert_msg(0, "Non implemented execution model");
@@ -117,6 +119,8 @@ void ExecutionSystem::execute()
     op->init_data();
   }
   execution_model_->execute(*this);
+  DebugInfo::buffer_pool_stats(buffer_pool_);
+  DebugInfo::execute_finished();
 }
 
 /**
@@ -22,6 +22,7 @@ class ExecutionGroup;
 
 #include "BKE_text.h"
 
+#include "COM_BufferPool.h"
 #include "COM_ExecutionGroup.h"
 #include "COM_Node.h"
 #include "COM_NodeOperation.h"
@@ -125,6 +126,12 @@ class ExecutionModel;
  */
 class ExecutionSystem {
  private:
+  /**
+   * Pool of recycled operation buffers. Disposed buffers return here so later operations reuse
+   * the allocations instead of thrashing the allocator with full-rect buffers.
+   */
+  BufferPool buffer_pool_;
+
   /**
    * Contains operations active buffers data. Buffers will be disposed once reader operations are
    * finished.
@@ -17,6 +17,7 @@
  */
 
 #include "COM_FullFrameExecutionModel.h"
+#include "COM_BufferPool.h"
 #include "COM_Debug.h"
 #include "COM_ExecutionGroup.h"
 #include "COM_ReadBufferOperation.h"
@@ -25,6 +26,8 @@
 
 #include "BLT_translation.h"
 
+#include "PIL_time.h"
+
 #ifdef WITH_CXX_GUARDEDALLOC
 #  include "MEM_guardedalloc.h"
 #endif
@@ -33,9 +36,11 @@ namespace blender::compositor {
 
 FullFrameExecutionModel::FullFrameExecutionModel(CompositorContext &context,
                                                  SharedOperationBuffers &shared_buffers,
+                                                 BufferPool &buffer_pool,
                                                  Span<NodeOperation *> operations)
     : ExecutionModel(context, operations),
       active_buffers_(shared_buffers),
+      buffer_pool_(buffer_pool),
       num_operations_finished_(0)
 {
   priorities_.append(eCompositorPriority::High);
@@ -92,7 +97,9 @@ MemoryBuffer *FullFrameExecutionModel::create_operation_buffer(NodeOperation *op
 
   const DataType data_type = op->getOutputSocket(0)->getDataType();
   const bool is_a_single_elem = op->get_flags().is_constant_operation;
-  return new MemoryBuffer(data_type, op_rect, is_a_single_elem);
+  MemoryBuffer *buffer = buffer_pool_.take(data_type, op_rect, is_a_single_elem);
+  DebugInfo::operation_buffer_taken(op, buffer);
+  return buffer;
 }
 
 void FullFrameExecutionModel::render_operation(NodeOperation *op)
@@ -103,7 +110,9 @@ void FullFrameExecutionModel::render_operation(NodeOperation *op)
   MemoryBuffer *op_buf = has_outputs ? create_operation_buffer(op) : nullptr;
   if (op->getWidth() > 0 && op->getHeight() > 0) {
     Span<rcti> areas = active_buffers_.get_areas_to_render(op);
+    const double start_time = PIL_check_seconds_timer();
     op->render(op_buf, areas, input_bufs);
+    DebugInfo::operation_render_time(op, PIL_check_seconds_timer() - start_time);
     DebugInfo::operation_rendered(op, op_buf);
   }
   /* Even if operation has no resolution set the empty buffer. It will be clipped with a
@@ -27,6 +27,7 @@
 namespace blender::compositor {
 
 /* Forward declarations. */
+class BufferPool;
 class ExecutionGroup;
 
 /**
@@ -40,6 +41,11 @@ class FullFrameExecutionModel : public ExecutionModel {
    */
   SharedOperationBuffers &active_buffers_;
 
+  /**
+   * Pool operation buffers are taken from, reusing disposed buffer allocations.
+   */
+  BufferPool &buffer_pool_;
+
   /**
    * Number of operations finished.
    */
@@ -53,6 +59,7 @@ class FullFrameExecutionModel : public ExecutionModel {
  public:
   FullFrameExecutionModel(CompositorContext &context,
                           SharedOperationBuffers &shared_buffers,
+                          BufferPool &buffer_pool,
                           Span<NodeOperation *> operations);
 
   void execute(ExecutionSystem &exec_system) override;
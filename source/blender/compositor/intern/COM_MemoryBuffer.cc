@@ -112,6 +112,23 @@ MemoryBuffer::MemoryBuffer(const MemoryBuffer &src)
   fill_from(src);
 }
 
+void MemoryBuffer::reinit(const DataType datatype, const rcti &rect, const bool is_a_single_elem)
+{
+  BLI_assert(owns_data_);
+  BLI_assert(m_memoryProxy == nullptr);
+  /* The allocation is reused as is, the new contents must have the exact same size. */
+  BLI_assert((is_a_single_elem ? 1 : BLI_rcti_size_x(&rect) * BLI_rcti_size_y(&rect)) *
+                 COM_data_type_num_channels(datatype) ==
+             buffer_len() * m_num_channels);
+  m_rect = rect;
+  m_is_a_single_elem = is_a_single_elem;
+  m_num_channels = COM_data_type_num_channels(datatype);
+  m_datatype = datatype;
+  m_state = MemoryBufferState::Temporary;
+
+  set_strides();
+}
+
 void MemoryBuffer::set_strides()
 {
   if (m_is_a_single_elem) {
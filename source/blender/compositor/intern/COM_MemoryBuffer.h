@@ -140,6 +140,12 @@ class MemoryBuffer {
    */
   ~MemoryBuffer();
 
+  /**
+   * Reinitialize this buffer for reuse by another operation. Only valid for buffers that own
+   * their data and whose allocation size matches the new parameters, see BufferPool.
+   */
+  void reinit(DataType datatype, const rcti &rect, bool is_a_single_elem);
+
   /**
    * Whether buffer is a single element in memory independently of its resolution. True for set
    * operations buffers.
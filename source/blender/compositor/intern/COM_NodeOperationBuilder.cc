@@ -100,14 +100,12 @@ void NodeOperationBuilder::convertToOperations(ExecutionSystem *system)
 
   add_datatype_conversions();
 
-  if (m_context->get_execution_model() == eExecutionModel::FullFrame) {
-    /* Copy operations to system. Needed for graphviz. */
-    system->set_operations(m_operations, {});
+  /* Copy operations to system. Needed for graphviz. */
+  system->set_operations(m_operations, {});
 
-    DebugInfo::graphviz(system, "compositor_prior_folding");
-    ConstantFolder folder(*this);
-    folder.fold_operations();
-  }
+  DebugInfo::graphviz(system, "compositor_prior_folding");
+  ConstantFolder folder(*this);
+  folder.fold_operations();
 
   determineResolutions();
 
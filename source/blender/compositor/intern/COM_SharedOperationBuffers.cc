@@ -18,10 +18,16 @@
 
 #include "COM_SharedOperationBuffers.h"
 #include "BLI_rect.h"
+#include "COM_BufferPool.h"
 #include "COM_NodeOperation.h"
 
 namespace blender::compositor {
 
+SharedOperationBuffers::SharedOperationBuffers(BufferPool *buffer_pool)
+    : buffer_pool_(buffer_pool)
+{
+}
+
 SharedOperationBuffers::BufferData::BufferData()
     : buffer(nullptr), registered_reads(0), received_reads(0), is_rendered(false)
 {
@@ -121,7 +127,10 @@ void SharedOperationBuffers::read_finished(NodeOperation *read_op)
   buf_data.received_reads++;
   BLI_assert(buf_data.received_reads > 0 && buf_data.received_reads <= buf_data.registered_reads);
   if (buf_data.received_reads == buf_data.registered_reads) {
-    /* Dispose buffer. */
+    /* Dispose buffer, returning it to the pool for reuse when one is set. */
+    if (buffer_pool_ && buf_data.buffer) {
+      buffer_pool_->release(std::move(buf_data.buffer));
+    }
     buf_data.buffer = nullptr;
   }
 }
@@ -29,12 +29,19 @@
 
 namespace blender::compositor {
 
+class BufferPool;
+
 /**
  * Stores and shares operations rendered buffers including render data. Buffers are
- * disposed once all dependent operations have finished reading them.
+ * disposed once all dependent operations have finished reading them, returning them to the
+ * buffer pool for reuse when one is set.
  */
 class SharedOperationBuffers {
  private:
+  /** Pool disposed buffers are returned to. May be null, in which case they are deleted. */
+  BufferPool *buffer_pool_;
+
+
   typedef struct BufferData {
    public:
     BufferData();
@@ -47,6 +54,8 @@ class SharedOperationBuffers {
   blender::Map<NodeOperation *, BufferData> buffers_;
 
  public:
+  SharedOperationBuffers(BufferPool *buffer_pool = nullptr);
+
   bool is_area_registered(NodeOperation *op, const rcti &area_to_render);
   void register_area(NodeOperation *op, const rcti &area_to_render);
 
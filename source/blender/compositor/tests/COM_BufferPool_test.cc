@@ -0,0 +1,94 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ */
+
+#include "testing/testing.h"
+
+#include "COM_BufferPool.h"
+
+namespace blender::compositor::tests {
+
+static rcti create_rect(const int width, const int height)
+{
+  rcti rect;
+  BLI_rcti_init(&rect, 0, width, 0, height);
+  return rect;
+}
+
+TEST(BufferPool, TakeMatchesRequest)
+{
+  BufferPool pool;
+  const rcti rect = create_rect(5, 4);
+  std::unique_ptr<MemoryBuffer> buffer(pool.take(DataType::Color, rect, false));
+  EXPECT_EQ(buffer->getWidth(), 5);
+  EXPECT_EQ(buffer->getHeight(), 4);
+  EXPECT_EQ(buffer->get_num_channels(), COM_DATA_TYPE_COLOR_CHANNELS);
+  EXPECT_FALSE(buffer->is_a_single_elem());
+}
+
+TEST(BufferPool, ReusesSameSizeAllocation)
+{
+  BufferPool pool;
+  const rcti rect = create_rect(5, 4);
+  MemoryBuffer *buffer = pool.take(DataType::Color, rect, false);
+  float *data = buffer->getBuffer();
+  pool.release(std::unique_ptr<MemoryBuffer>(buffer));
+
+  std::unique_ptr<MemoryBuffer> reused(pool.take(DataType::Color, rect, false));
+  EXPECT_EQ(reused->getBuffer(), data);
+}
+
+TEST(BufferPool, ReusesAcrossDataTypes)
+{
+  BufferPool pool;
+  /* Same total number of floats: 5x4 color elements vs 20x4 value elements. */
+  MemoryBuffer *buffer = pool.take(DataType::Color, create_rect(5, 4), false);
+  float *data = buffer->getBuffer();
+  pool.release(std::unique_ptr<MemoryBuffer>(buffer));
+
+  std::unique_ptr<MemoryBuffer> reused(pool.take(DataType::Value, create_rect(20, 4), false));
+  EXPECT_EQ(reused->getBuffer(), data);
+  EXPECT_EQ(reused->getWidth(), 20);
+  EXPECT_EQ(reused->get_num_channels(), COM_DATA_TYPE_VALUE_CHANNELS);
+}
+
+TEST(BufferPool, NoReuseForDifferentSize)
+{
+  BufferPool pool;
+  MemoryBuffer *buffer = pool.take(DataType::Color, create_rect(5, 4), false);
+  float *data = buffer->getBuffer();
+  pool.release(std::unique_ptr<MemoryBuffer>(buffer));
+
+  std::unique_ptr<MemoryBuffer> other(pool.take(DataType::Color, create_rect(6, 4), false));
+  EXPECT_NE(other->getBuffer(), data);
+}
+
+TEST(BufferPool, SingleElemBuffers)
+{
+  BufferPool pool;
+  const rcti rect = create_rect(5, 4);
+  MemoryBuffer *buffer = pool.take(DataType::Color, rect, true);
+  EXPECT_TRUE(buffer->is_a_single_elem());
+  float *data = buffer->getBuffer();
+  pool.release(std::unique_ptr<MemoryBuffer>(buffer));
+
+  /* Single element buffers only match other allocations of a single element size. */
+  std::unique_ptr<MemoryBuffer> reused(pool.take(DataType::Color, create_rect(7, 9), true));
+  EXPECT_EQ(reused->getBuffer(), data);
+}
+
+}  // namespace blender::compositor::tests
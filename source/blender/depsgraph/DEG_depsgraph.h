@@ -122,6 +122,10 @@ const char *DEG_update_tag_as_string(IDRecalcFlag flag);
 void DEG_id_tag_update(struct ID *id, int flag);
 void DEG_id_tag_update_ex(struct Main *bmain, struct ID *id, int flag);
 
+/* Tag multiple IDs for update with the same flag. Avoids per-call overhead when scripts tag
+ * many IDs at once; flush propagation happens as usual on the next evaluation. */
+void DEG_ids_tag_update(struct Main *bmain, struct ID **ids, int ids_num, int flag);
+
 void DEG_graph_id_tag_update(struct Main *bmain,
                              struct Depsgraph *depsgraph,
                              struct ID *id,
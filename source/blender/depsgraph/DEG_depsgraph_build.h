@@ -40,6 +40,7 @@ struct Main;
 struct Object;
 struct Scene;
 struct Simulation;
+struct ViewLayer;
 struct bNodeTree;
 
 #include "BLI_sys_types.h"
@@ -78,6 +79,27 @@ void DEG_graph_relations_update(struct Depsgraph *graph);
 /* Tag all relations in the database for update. */
 void DEG_relations_tag_update(struct Main *bmain);
 
+/* Warm Graph Building --------------------------- */
+
+/* Build the dependency graph for the given context on a background thread, overlapping it with
+ * other (non scene modifying) work. Used on file load, see wm_file_read_post. */
+void DEG_graph_warm_build_start(struct Main *bmain,
+                                struct Scene *scene,
+                                struct ViewLayer *view_layer);
+
+/* Wait for a pending background build to finish (no-op when none is running). */
+void DEG_graph_warm_build_wait(void);
+
+/* Transfer ownership of the pre-built graph for the matching context, or return NULL.
+ * The caller becomes responsible for freeing the graph. */
+struct Depsgraph *DEG_graph_warm_build_take(struct Main *bmain,
+                                            struct Scene *scene,
+                                            struct ViewLayer *view_layer);
+
+/* Free any pending pre-built graph, waiting for the build to finish first.
+ * Must be called before the Main it was built from is freed. */
+void DEG_graph_warm_build_discard(void);
+
 /* Add Dependencies  ----------------------------- */
 
 /* Handle for components to define their dependencies from callbacks.
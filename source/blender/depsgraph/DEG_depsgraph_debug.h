@@ -52,6 +52,14 @@ void DEG_stats_simple(const struct Depsgraph *graph,
                       size_t *r_operations,
                       size_t *r_relations);
 
+/* Get the time in seconds spent evaluating the given ID during the last dependency graph
+ * evaluation, aggregated over all its operations. The ID may be an original or an evaluated one.
+ * Timings are only recorded when depsgraph timing statistics are enabled
+ * (G_DEBUG_DEPSGRAPH_TIME), false is returned otherwise. */
+bool DEG_debug_id_eval_time_get(const struct Depsgraph *depsgraph,
+                                const struct ID *id,
+                                float *r_eval_time);
+
 /* ************************************************ */
 /* Diagram-Based Graph Debugging */
 
@@ -42,18 +42,35 @@ AbstractBuilderPipeline::AbstractBuilderPipeline(::Depsgraph *graph)
 
 void AbstractBuilderPipeline::build()
 {
+  const bool do_time_debug = (G.debug & (G_DEBUG_DEPSGRAPH_BUILD | G_DEBUG_DEPSGRAPH_TIME)) != 0;
   double start_time = 0.0;
-  if (G.debug & (G_DEBUG_DEPSGRAPH_BUILD | G_DEBUG_DEPSGRAPH_TIME)) {
+  double step_start_time = 0.0;
+  if (do_time_debug) {
     start_time = PIL_check_seconds_timer();
+    step_start_time = start_time;
   }
 
   build_step_sanity_check();
+
   build_step_nodes();
+  if (do_time_debug) {
+    const double current_time = PIL_check_seconds_timer();
+    printf("Depsgraph nodes built in %f seconds.\n", current_time - step_start_time);
+    step_start_time = current_time;
+  }
+
   build_step_relations();
-  build_step_finalize();
+  if (do_time_debug) {
+    const double current_time = PIL_check_seconds_timer();
+    printf("Depsgraph relations built in %f seconds.\n", current_time - step_start_time);
+    step_start_time = current_time;
+  }
 
-  if (G.debug & (G_DEBUG_DEPSGRAPH_BUILD | G_DEBUG_DEPSGRAPH_TIME)) {
-    printf("Depsgraph built in %f seconds.\n", PIL_check_seconds_timer() - start_time);
+  build_step_finalize();
+  if (do_time_debug) {
+    const double current_time = PIL_check_seconds_timer();
+    printf("Depsgraph finalized in %f seconds.\n", current_time - step_start_time);
+    printf("Depsgraph built in %f seconds.\n", current_time - start_time);
   }
 }
 
@@ -26,6 +26,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_listbase.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "PIL_time.h"
@@ -320,3 +321,85 @@ void DEG_relations_tag_update(Main *bmain)
     DEG_graph_tag_relations_update(reinterpret_cast<Depsgraph *>(depsgraph));
   }
 }
+
+/* ************************* */
+/* Warm Graph Building API's */
+
+/* Background relations build for the initial dependency graph of a freshly loaded file, so its
+ * construction overlaps with the remaining single threaded file load steps (Python reset and
+ * add-on initialization in particular). See wm_file_read_post().
+ *
+ * The graph created here is registered like any other, so a DEG_relations_tag_update() between
+ * start and take simply marks it for a lazy rebuild through the regular code paths. Callers must
+ * however guarantee that no scene data is modified while the build is running. */
+
+namespace {
+
+struct WarmBuildState {
+  TaskPool *pool = nullptr;
+  ::Depsgraph *graph = nullptr;
+  Main *bmain = nullptr;
+  Scene *scene = nullptr;
+  ViewLayer *view_layer = nullptr;
+};
+
+WarmBuildState g_warm_build;
+
+void warm_build_task_run(TaskPool *__restrict pool, void * /*taskdata*/)
+{
+  ::Depsgraph *graph = static_cast<::Depsgraph *>(BLI_task_pool_user_data(pool));
+  DEG_graph_build_from_view_layer(graph);
+}
+
+void warm_build_pool_finish()
+{
+  if (g_warm_build.pool != nullptr) {
+    BLI_task_pool_work_and_wait(g_warm_build.pool);
+    BLI_task_pool_free(g_warm_build.pool);
+    g_warm_build.pool = nullptr;
+  }
+}
+
+}  // namespace
+
+void DEG_graph_warm_build_start(Main *bmain, Scene *scene, ViewLayer *view_layer)
+{
+  DEG_graph_warm_build_discard();
+
+  g_warm_build.graph = DEG_graph_new(bmain, scene, view_layer, DAG_EVAL_VIEWPORT);
+  g_warm_build.bmain = bmain;
+  g_warm_build.scene = scene;
+  g_warm_build.view_layer = view_layer;
+  g_warm_build.pool = BLI_task_pool_create_background(g_warm_build.graph, TASK_PRIORITY_HIGH);
+  BLI_task_pool_push(g_warm_build.pool, warm_build_task_run, nullptr, false, nullptr);
+}
+
+void DEG_graph_warm_build_wait(void)
+{
+  warm_build_pool_finish();
+}
+
+Depsgraph *DEG_graph_warm_build_take(Main *bmain, Scene *scene, ViewLayer *view_layer)
+{
+  if (g_warm_build.graph == nullptr) {
+    return nullptr;
+  }
+  if (g_warm_build.bmain != bmain || g_warm_build.scene != scene ||
+      g_warm_build.view_layer != view_layer) {
+    /* Keep the graph around, the matching context may still request it. */
+    return nullptr;
+  }
+  warm_build_pool_finish();
+  ::Depsgraph *graph = g_warm_build.graph;
+  g_warm_build = WarmBuildState();
+  return graph;
+}
+
+void DEG_graph_warm_build_discard(void)
+{
+  warm_build_pool_finish();
+  if (g_warm_build.graph != nullptr) {
+    DEG_graph_free(g_warm_build.graph);
+  }
+  g_warm_build = WarmBuildState();
+}
@@ -68,6 +68,23 @@ const char *DEG_debug_name_get(struct Depsgraph *depsgraph)
   return deg_graph->debug.name.c_str();
 }
 
+bool DEG_debug_id_eval_time_get(const struct Depsgraph *depsgraph,
+                                const struct ID *id,
+                                float *r_eval_time)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(depsgraph);
+  if (!deg_graph->debug.do_time_debug()) {
+    return false;
+  }
+  const ID *id_orig = DEG_get_original_id(const_cast<ID *>(id));
+  const deg::IDNode *id_node = deg_graph->find_id_node(id_orig);
+  if (id_node == nullptr) {
+    return false;
+  }
+  *r_eval_time = float(id_node->stats.current_time);
+  return true;
+}
+
 bool DEG_debug_compare(const struct Depsgraph *graph1, const struct Depsgraph *graph2)
 {
   BLI_assert(graph1 != nullptr);
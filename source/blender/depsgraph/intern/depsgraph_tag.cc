@@ -775,6 +775,16 @@ void DEG_id_tag_update_ex(Main *bmain, ID *id, int flag)
   deg::id_tag_update(bmain, id, flag, deg::DEG_UPDATE_SOURCE_USER_EDIT);
 }
 
+void DEG_ids_tag_update(Main *bmain, ID **ids, const int ids_num, const int flag)
+{
+  for (int i = 0; i < ids_num; i++) {
+    if (ids[i] == nullptr) {
+      continue;
+    }
+    deg::id_tag_update(bmain, ids[i], flag, deg::DEG_UPDATE_SOURCE_USER_EDIT);
+  }
+}
+
 void DEG_graph_id_tag_update(struct Main *bmain,
                              struct Depsgraph *depsgraph,
                              struct ID *id,
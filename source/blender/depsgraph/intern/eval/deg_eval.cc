@@ -29,6 +29,7 @@
 
 #include "BLI_compiler_attrs.h"
 #include "BLI_gsqueue.h"
+#include "BLI_profile.h"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
 
@@ -74,6 +75,28 @@ void schedule_node_to_pool(OperationNode *node, const int UNUSED(thread_id), Tas
   BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
 }
 
+/* Scheduling destination for children of a just evaluated node: the first ready child is kept
+ * for the current task to continue with, the rest are pushed to the pool. This way dependency
+ * chains keep running on the same thread without a round-trip through the task pool, so long
+ * chains (heavy modifier stacks and alike) progress depth-first instead of being re-queued
+ * behind unrelated work. */
+struct ScheduleNodeToPoolOrContinue {
+  TaskPool *pool;
+  OperationNode *next_node;
+};
+
+void schedule_node_to_pool_or_continue(OperationNode *node,
+                                       const int UNUSED(thread_id),
+                                       ScheduleNodeToPoolOrContinue *schedule_data)
+{
+  if (schedule_data->next_node == nullptr) {
+    schedule_data->next_node = node;
+  }
+  else {
+    BLI_task_pool_push(schedule_data->pool, deg_task_run_func, node, false, nullptr);
+  }
+}
+
 /* Denotes which part of dependency graph is being evaluated. */
 enum class EvaluationStage {
   /* Stage 1: Only  Copy-on-Write operations are to be evaluated, prior to anything else.
@@ -104,6 +127,7 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
 
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
+  BLI_PROFILE_SCOPE(operation_node->identifier().c_str());
   /* Perform operation. */
   if (state->do_stats) {
     const double start_time = PIL_check_seconds_timer();
@@ -120,12 +144,17 @@ void deg_task_run_func(TaskPool *pool, void *taskdata)
   void *userdata_v = BLI_task_pool_user_data(pool);
   DepsgraphEvalState *state = (DepsgraphEvalState *)userdata_v;
 
-  /* Evaluate node. */
+  /* Evaluate the node and keep going with one of its ready children, scheduling the other ones
+   * to the pool. */
   OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
-  evaluate_node(state, operation_node);
+  while (operation_node != nullptr) {
+    evaluate_node(state, operation_node);
 
-  /* Schedule children. */
-  schedule_children(state, operation_node, schedule_node_to_pool, pool);
+    /* Schedule children. */
+    ScheduleNodeToPoolOrContinue schedule_data = {pool, nullptr};
+    schedule_children(state, operation_node, schedule_node_to_pool_or_continue, &schedule_data);
+    operation_node = schedule_data.next_node;
+  }
 }
 
 bool check_operation_node_visible(OperationNode *op_node)
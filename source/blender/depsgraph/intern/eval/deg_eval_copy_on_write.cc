@@ -301,11 +301,17 @@ bool id_copy_inplace_no_main(const ID *id, ID *newid)
   id_for_copy = nested_id_hack_get_discarded_pointers(&id_hack_storage, id);
 #endif
 
-  bool result = (BKE_id_copy_ex(nullptr,
-                                (ID *)id_for_copy,
-                                &newid,
-                                (LIB_ID_COPY_LOCALIZE | LIB_ID_CREATE_NO_ALLOCATE |
-                                 LIB_ID_COPY_SET_COPIED_ON_WRITE)) != nullptr);
+  int copy_flags = LIB_ID_COPY_LOCALIZE | LIB_ID_CREATE_NO_ALLOCATE |
+                   LIB_ID_COPY_SET_COPIED_ON_WRITE;
+  /* Share CustomData layers with the original mesh instead of duplicating them: layer sharing
+   * is reference counted, and writes to the evaluated copy duplicate the affected layer via
+   * #CustomData_duplicate_referenced_layer. Modifier stacks which only touch a subset of the
+   * layers (e.g. deformations) this way never copy UV/color/attribute arrays at all. */
+  if (GS(id_for_copy->name) == ID_ME) {
+    copy_flags |= LIB_ID_COPY_CD_REFERENCE;
+  }
+
+  bool result = (BKE_id_copy_ex(nullptr, (ID *)id_for_copy, &newid, copy_flags) != nullptr);
 
 #ifdef NESTED_ID_NASTY_WORKAROUND
   if (result) {
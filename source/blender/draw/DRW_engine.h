@@ -34,6 +34,7 @@ extern "C" {
 
 struct ARegion;
 struct DRWInstanceDataList;
+struct DRWOcclusionBuffer;
 struct Depsgraph;
 struct DrawEngineType;
 struct GHash;
@@ -141,6 +142,7 @@ void DRW_render_gpencil(struct RenderEngine *engine, struct Depsgraph *depsgraph
 struct DRWInstanceDataList *DRW_instance_data_list_create(void);
 void DRW_instance_data_list_free(struct DRWInstanceDataList *idatalist);
 void DRW_uniform_attrs_pool_free(struct GHash *table);
+void DRW_occlusion_buffer_free(struct DRWOcclusionBuffer *buffer);
 
 void DRW_render_context_enable(struct Render *render);
 void DRW_render_context_disable(struct Render *render);
@@ -34,6 +34,7 @@
 
 #include "IMB_imbuf.h"
 
+#include "eevee_lightcache.h"
 #include "eevee_private.h"
 
 #include "eevee_engine.h" /* own include */
@@ -377,8 +378,17 @@ static void eevee_view_update(void *vedata)
   }
 }
 
-static void eevee_id_object_update(void *UNUSED(vedata), Object *object)
+static void eevee_id_object_update(void *vedata, Object *object)
 {
+  EEVEE_StorageList *stl = ((EEVEE_Data *)vedata)->stl;
+  LightCache *lcache = stl->g_data->light_cache;
+
+  /* Avoid Lookdev viewport tagging the scene cache (see T67741). */
+  if (ELEM(lcache, NULL, stl->lookdev_lightcache) || (lcache->flag & LIGHTCACHE_BAKING) != 0 ||
+      (lcache->flag & LIGHTCACHE_BAKED) == 0) {
+    lcache = NULL;
+  }
+
   EEVEE_LightProbeEngineData *ped = EEVEE_lightprobe_data_get(object);
   if (ped != NULL && ped->dd.recalc != 0) {
     ped->need_update = (ped->dd.recalc & ID_RECALC_TRANSFORM) != 0;
@@ -388,12 +398,34 @@ static void eevee_id_object_update(void *UNUSED(vedata), Object *object)
   if (led != NULL && led->dd.recalc != 0) {
     led->need_update = true;
     led->dd.recalc = 0;
+    if (lcache != NULL) {
+      /* A light potentially affects every probe. */
+      EEVEE_lightcache_probe_tag_all(lcache, true, true);
+    }
   }
   EEVEE_ObjectEngineData *oedata = EEVEE_object_data_get(object);
   if (oedata != NULL && oedata->dd.recalc != 0) {
     oedata->need_update = true;
     oedata->geom_update = (oedata->dd.recalc & (ID_RECALC_GEOMETRY)) != 0;
     oedata->dd.recalc = 0;
+    if (lcache != NULL) {
+      /* Only tag the probes whose influence volume intersects the object, so a
+       * subsequent bake can re-render those alone. */
+      const BoundBox *bb = BKE_object_boundbox_get(object);
+      if (bb != NULL) {
+        float min[3], max[3];
+        INIT_MINMAX(min, max);
+        for (int i = 0; i < 8; i++) {
+          float corner[3];
+          mul_v3_m4v3(corner, object->obmat, bb->vec[i]);
+          minmax_v3v3_v3(min, max, corner);
+        }
+        EEVEE_lightcache_probe_tag_volume(lcache, min, max);
+      }
+      else {
+        EEVEE_lightcache_probe_tag_all(lcache, true, true);
+      }
+    }
   }
 }
 
@@ -26,6 +26,7 @@
 
 #include "BKE_global.h"
 
+#include "BLI_bitmap.h"
 #include "BLI_endian_switch.h"
 #include "BLI_threads.h"
 
@@ -152,6 +153,15 @@ typedef struct EEVEE_LightBake {
   /** Pointer to the owner_id of the probe object. */
   LightProbe **cube_prb;
 
+  /* Incremental bake */
+  /** Only re-render the probes tagged dirty, keep the others from the existing cache. */
+  bool incremental;
+  /** Copy of the probe data from the previous bake, to detect edited probes. */
+  EEVEE_LightGrid *grid_data_prev;
+  EEVEE_LightProbe *cube_data_prev;
+  /** Index of the last grid/cube that will be rendered, for end of bake bookkeeping. */
+  int grid_last, cube_last;
+
   /* Dummy Textures */
   struct GPUTexture *dummy_color, *dummy_depth;
   struct GPUTexture *dummy_layer_color;
@@ -474,6 +484,80 @@ bool EEVEE_lightcache_load(LightCache *lcache)
   }
 }
 
+BLI_STATIC_ASSERT(sizeof(((LightCache *)NULL)->grid_dirty) * 8 >= MAX_GRID,
+                  "LightCache::grid_dirty is too small")
+BLI_STATIC_ASSERT(sizeof(((LightCache *)NULL)->cube_dirty) * 8 >= MAX_PROBE,
+                  "LightCache::cube_dirty is too small")
+
+void EEVEE_lightcache_probe_tag_all(LightCache *lcache, bool tag_grids, bool tag_cubes)
+{
+  if (lcache->flag & LIGHTCACHE_INVALID) {
+    return;
+  }
+  if (tag_grids) {
+    memset(lcache->grid_dirty, 0xFF, sizeof(lcache->grid_dirty));
+    lcache->flag |= LIGHTCACHE_UPDATE_GRID;
+  }
+  if (tag_cubes) {
+    memset(lcache->cube_dirty, 0xFF, sizeof(lcache->cube_dirty));
+    lcache->flag |= LIGHTCACHE_UPDATE_CUBE;
+  }
+  lcache->flag |= LIGHTCACHE_TAG_PARTIAL;
+}
+
+/* Return true if a world space bounding box overlaps the probe influence volume.
+ * The influence matrix maps world space to the [-1..1] influence box. Conservative:
+ * uses the axis aligned bounds of the transformed corners. */
+static bool lightcache_volume_intersect(const float influence_mat[4][4],
+                                        const float min[3],
+                                        const float max[3])
+{
+  float lmin[3], lmax[3];
+  INIT_MINMAX(lmin, lmax);
+  for (int i = 0; i < 8; i++) {
+    float corner[3];
+    corner[0] = (i & 1) ? max[0] : min[0];
+    corner[1] = (i & 2) ? max[1] : min[1];
+    corner[2] = (i & 4) ? max[2] : min[2];
+    mul_m4_v3(influence_mat, corner);
+    minmax_v3v3_v3(lmin, lmax, corner);
+  }
+  for (int i = 0; i < 3; i++) {
+    if (lmin[i] > 1.0f || lmax[i] < -1.0f) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Tag only the probes whose influence volume intersects the given world space bounds.
+ * This is a locality heuristic: an edit can still affect probes further away through
+ * indirect lighting, but for small edits re-baking the intersecting probes is enough. */
+void EEVEE_lightcache_probe_tag_volume(LightCache *lcache, const float min[3], const float max[3])
+{
+  if (lcache->flag & LIGHTCACHE_INVALID) {
+    return;
+  }
+  if (lcache->grid_data != NULL) {
+    /* Skip the world probe at index 0. */
+    for (int i = 1; i < lcache->grid_len; i++) {
+      if (lightcache_volume_intersect(lcache->grid_data[i].mat, min, max)) {
+        BLI_BITMAP_ENABLE((BLI_bitmap *)lcache->grid_dirty, i);
+        lcache->flag |= LIGHTCACHE_UPDATE_GRID;
+      }
+    }
+  }
+  if (lcache->cube_data != NULL) {
+    for (int i = 1; i < lcache->cube_len; i++) {
+      if (lightcache_volume_intersect(lcache->cube_data[i].attenuationmat, min, max)) {
+        BLI_BITMAP_ENABLE((BLI_bitmap *)lcache->cube_dirty, i);
+        lcache->flag |= LIGHTCACHE_UPDATE_CUBE;
+      }
+    }
+  }
+  lcache->flag |= LIGHTCACHE_TAG_PARTIAL;
+}
+
 static void eevee_lightbake_readback_irradiance(LightCache *lcache)
 {
   MEM_SAFE_FREE(lcache->grid_tx.data);
@@ -732,8 +816,19 @@ static void eevee_lightbake_create_resources(EEVEE_LightBake *lbake)
 
   EEVEE_lightcache_load(eevee->light_cache_data);
 
+  /* If the existing cache was kept and contains valid data, only the probes tagged
+   * dirty need to be re-rendered. Snapshot the probe data to detect edited probes. */
+  lbake->incremental = !lbake->own_light_cache && (lbake->lcache->flag & LIGHTCACHE_BAKED) &&
+                       (lbake->lcache->flag & LIGHTCACHE_TAG_PARTIAL);
+  if (lbake->incremental) {
+    lbake->grid_data_prev = MEM_dupallocN(lbake->lcache->grid_data);
+    lbake->cube_data_prev = MEM_dupallocN(lbake->lcache->cube_data);
+  }
+
   lbake->lcache->flag |= LIGHTCACHE_BAKING;
-  lbake->lcache->cube_len = 1;
+  if (!lbake->incremental) {
+    lbake->lcache->cube_len = 1;
+  }
 }
 
 wmJob *EEVEE_lightbake_job_create(struct wmWindowManager *wm,
@@ -845,6 +940,8 @@ void EEVEE_lightbake_job_data_free(void *custom_data)
 
   MEM_SAFE_FREE(lbake->cube_prb);
   MEM_SAFE_FREE(lbake->grid_prb);
+  MEM_SAFE_FREE(lbake->grid_data_prev);
+  MEM_SAFE_FREE(lbake->cube_data_prev);
 
   BLI_mutex_free(lbake->mutex);
 
@@ -1033,8 +1130,9 @@ static void eevee_lightbake_render_world_sample(void *ved, void *user_data)
   EEVEE_lightbake_render_world(sldata, vedata, lbake->rt_fb);
   EEVEE_lightbake_filter_diffuse(sldata, vedata, lbake->rt_color, lbake->store_fb, 0, 1.0f);
 
-  if (lcache->flag & LIGHTCACHE_UPDATE_GRID) {
-    /* Clear the cache to avoid white values in the grid. */
+  if ((lcache->flag & LIGHTCACHE_UPDATE_GRID) && !lbake->incremental) {
+    /* Clear the cache to avoid white values in the grid.
+     * Skipped for incremental bakes to keep the untagged probes intact. */
     GPU_framebuffer_texture_attach(lbake->store_fb, lbake->grid_prev, 0, 0);
     GPU_framebuffer_bind(lbake->store_fb);
     /* Clear to 1.0f for visibility. */
@@ -1047,7 +1145,9 @@ static void eevee_lightbake_render_world_sample(void *ved, void *user_data)
     eevee_lightbake_copy_irradiance(lbake, lcache);
   }
 
-  lcache->cube_len = 1;
+  if (!lbake->incremental) {
+    lcache->cube_len = 1;
+  }
   lcache->grid_len = lbake->grid_len;
 
   lcache->flag |= LIGHTCACHE_CUBE_READY | LIGHTCACHE_GRID_READY;
@@ -1124,8 +1224,10 @@ static void eevee_lightbake_render_grid_sample(void *ved, void *user_data)
   LightCache *lcache = scene_eval->eevee.light_cache_data;
   int grid_loc[3], sample_id, sample_offset, stride;
   float pos[3];
-  const bool is_last_bounce_sample = ((egrid->offset + lbake->grid_sample) ==
-                                      (lbake->total_irr_samples - 1));
+  /* Last sample that will be rendered this bounce. Cannot be derived from the sample
+   * offset as incremental bakes skip the grids that are not tagged dirty. */
+  const bool is_last_bounce_sample = (lbake->grid_curr == lbake->grid_last) &&
+                                     (lbake->grid_sample == lbake->grid_sample_len - 1);
 
   /* No bias for rendering the probe. */
   egrid->level_bias = 1.0f;
@@ -1190,10 +1292,15 @@ static void eevee_lightbake_render_grid_sample(void *ved, void *user_data)
     eevee_lightbake_copy_irradiance(lbake, lcache);
   }
 
-  /* If it is the last sample grid sample (and last bounce). */
-  if ((lbake->bounce_curr == lbake->bounce_len - 1) && (lbake->grid_curr == lbake->grid_len - 1) &&
-      (lbake->grid_sample == lbake->grid_sample_len - 1)) {
-    lcache->flag &= ~LIGHTCACHE_UPDATE_GRID;
+  if (lbake->bounce_curr == lbake->bounce_len - 1) {
+    /* Grid completely re-rendered. */
+    if (lbake->grid_sample == lbake->grid_sample_len - 1) {
+      BLI_BITMAP_DISABLE((BLI_bitmap *)lcache->grid_dirty, lbake->grid_curr);
+    }
+    /* If it is the last grid sample (and last bounce). */
+    if (is_last_bounce_sample) {
+      lcache->flag &= ~LIGHTCACHE_UPDATE_GRID;
+    }
   }
 }
 
@@ -1234,10 +1341,14 @@ static void eevee_lightbake_render_probe_sample(void *ved, void *user_data)
                                 filter_quality,
                                 clamp);
 
-  lcache->cube_len += 1;
+  if (!lbake->incremental) {
+    lcache->cube_len += 1;
+  }
+
+  BLI_BITMAP_DISABLE((BLI_bitmap *)lcache->cube_dirty, lbake->cube_offset);
 
-  /* If it's the last probe. */
-  if (lbake->cube_offset == lbake->cube_len - 1) {
+  /* If it's the last probe that will be rendered. */
+  if (lbake->cube_offset == lbake->cube_last) {
     lcache->flag &= ~LIGHTCACHE_UPDATE_CUBE;
   }
 }
@@ -1329,7 +1440,48 @@ static void eevee_lightbake_gather_probes(EEVEE_LightBake *lbake)
              lbake->cube_len - 1,
              eevee_lightbake_cube_comp);
 
+  lbake->grid_last = lbake->grid_len - 1;
+  lbake->cube_last = lbake->cube_len - 1;
   lbake->total = lbake->total_irr_samples * lbake->bounce_len + lbake->cube_len;
+
+  if (lbake->incremental) {
+    /* Tag any probe whose data does not match the previous bake (moved, resized, or
+     * shifted by the volume sort). Their part of the cache textures cannot be kept. */
+    for (int i = 1; i < lbake->grid_len; i++) {
+      if (memcmp(&lcache->grid_data[i], &lbake->grid_data_prev[i], sizeof(EEVEE_LightGrid)) != 0) {
+        BLI_BITMAP_ENABLE((BLI_bitmap *)lcache->grid_dirty, i);
+      }
+    }
+    for (int i = 1; i < lbake->cube_len; i++) {
+      if (memcmp(&lcache->cube_data[i], &lbake->cube_data_prev[i], sizeof(EEVEE_LightProbe)) !=
+          0) {
+        BLI_BITMAP_ENABLE((BLI_bitmap *)lcache->cube_dirty, i);
+      }
+    }
+    MEM_SAFE_FREE(lbake->grid_data_prev);
+    MEM_SAFE_FREE(lbake->cube_data_prev);
+
+    /* Recompute the progress total and the last rendered probe of each category from
+     * the dirty bits. */
+    int irr_samples = 1, cube_count = 1;
+    lbake->grid_last = 0;
+    lbake->cube_last = 0;
+    for (int i = 1; i < lbake->grid_len; i++) {
+      if (BLI_BITMAP_TEST((BLI_bitmap *)lcache->grid_dirty, i)) {
+        EEVEE_LightGrid *egrid = &lcache->grid_data[i];
+        irr_samples += egrid->resolution[0] * egrid->resolution[1] * egrid->resolution[2];
+        lbake->grid_last = i;
+      }
+    }
+    for (int i = 1; i < lbake->cube_len; i++) {
+      if (BLI_BITMAP_TEST((BLI_bitmap *)lcache->cube_dirty, i)) {
+        cube_count++;
+        lbake->cube_last = i;
+      }
+    }
+    lbake->total = irr_samples * lbake->bounce_len + cube_count;
+  }
+
   lbake->done = 0;
 }
 
@@ -1439,6 +1591,11 @@ void EEVEE_lightbake_job(void *custom_data, short *stop, short *do_update, float
       lbake->grid = lcache->grid_data + 1;
       for (lbake->grid_curr = 1; lbake->grid_curr < lbake->grid_len;
            lbake->grid_curr++, lbake->probe++, lbake->grid++) {
+        if (lbake->incremental &&
+            !BLI_BITMAP_TEST((BLI_bitmap *)lcache->grid_dirty, lbake->grid_curr)) {
+          /* Not affected by any change since the last bake. Keep the cached result. */
+          continue;
+        }
         LightProbe *prb = *lbake->probe;
         lbake->grid_sample_len = prb->grid_resolution_x * prb->grid_resolution_y *
                                  prb->grid_resolution_z;
@@ -1457,6 +1614,10 @@ void EEVEE_lightbake_job(void *custom_data, short *stop, short *do_update, float
     lbake->cube = lcache->cube_data + 1;
     for (lbake->cube_offset = 1; lbake->cube_offset < lbake->cube_len;
          lbake->cube_offset++, lbake->probe++, lbake->cube++) {
+      if (lbake->incremental &&
+          !BLI_BITMAP_TEST((BLI_bitmap *)lcache->cube_dirty, lbake->cube_offset)) {
+        continue;
+      }
       lightbake_do_sample(lbake, eevee_lightbake_render_probe_sample);
     }
   }
@@ -64,5 +64,12 @@ void EEVEE_lightcache_free(struct LightCache *lcache);
 bool EEVEE_lightcache_load(struct LightCache *lcache);
 void EEVEE_lightcache_info_update(struct SceneEEVEE *eevee);
 
+/* Incremental updates. Tag the probes that need to be re-baked, either all of them
+ * or only those whose influence volume intersects a given world space bounding box. */
+void EEVEE_lightcache_probe_tag_all(struct LightCache *lcache, bool tag_grids, bool tag_cubes);
+void EEVEE_lightcache_probe_tag_volume(struct LightCache *lcache,
+                                       const float min[3],
+                                       const float max[3]);
+
 void EEVEE_lightcache_blend_write(struct BlendWriter *writer, struct LightCache *cache);
 void EEVEE_lightcache_blend_read_data(struct BlendDataReader *reader, struct LightCache *cache);
@@ -730,6 +730,9 @@ void EEVEE_lightprobes_cache_finish(EEVEE_ViewLayerData *sldata, EEVEE_Data *ved
         /* If we update grid we need to update the cube-maps too.
          * So always refresh cube-maps. */
         scene_orig->eevee.light_cache_data->flag |= LIGHTCACHE_UPDATE_CUBE;
+        /* A probe object changed: be conservative, re-bake the whole category. */
+        EEVEE_lightcache_probe_tag_all(
+            scene_orig->eevee.light_cache_data, pinfo->do_grid_update, true);
         /* Tag the lightcache to auto update. */
         scene_orig->eevee.light_cache_data->flag |= LIGHTCACHE_UPDATE_AUTO;
         /* Use a notifier to trigger the operator after drawing. */
@@ -201,6 +201,66 @@ static bool sphere_bbox_intersect(const BoundSphere *bs, const EEVEE_BoundBox *b
   return x && y && z;
 }
 
+/* Tag the whole cube-map for update (light itself changed). */
+void EEVEE_shadows_cube_tag_update(EEVEE_LightsInfo *linfo, int cube_index)
+{
+  BLI_BITMAP_ENABLE(&linfo->sh_cube_update[0], cube_index);
+  for (int face = 0; face < 6; face++) {
+    BLI_BITMAP_ENABLE(&linfo->sh_cube_face_update[0], cube_index * 6 + face);
+  }
+}
+
+static bool shadow_cube_all_faces_tagged(const EEVEE_LightsInfo *linfo, int cube_index)
+{
+  for (int face = 0; face < 6; face++) {
+    if (!BLI_BITMAP_TEST(&linfo->sh_cube_face_update[0], cube_index * 6 + face)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Conservative test of a world space AABB against the 90 degrees pyramid of one cube face.
+ * Face order matches cubefacemat: +X, -X, +Y, -Y, +Z, -Z. */
+static bool cube_face_bbox_intersect(int face, const float light_pos[3], const EEVEE_BoundBox *bb)
+{
+  const int axis = face / 2;
+  const float sign = (face & 1) ? -1.0f : 1.0f;
+  float center[3];
+  sub_v3_v3v3(center, bb->center, light_pos);
+  const float center_a = sign * center[axis];
+  const float halfdim_a = bb->halfdim[axis];
+  for (int i = 0; i < 3; i++) {
+    if (i == axis) {
+      continue;
+    }
+    /* The face pyramid is bounded by the half-spaces s*p[axis] >= p[i] and
+     * s*p[axis] >= -p[i]. The box is outside as soon as its maximum of
+     * (s*p[axis] -/+ p[i]) is negative. */
+    const float halfdim_sum = halfdim_a + bb->halfdim[i];
+    if ((center_a - center[i] + halfdim_sum < 0.0f) ||
+        (center_a + center[i] + halfdim_sum < 0.0f)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Tag only the cube faces whose frustum can see the shadow caster bounds. */
+static void shadow_cube_faces_tag_intersect(EEVEE_LightsInfo *linfo,
+                                            int cube_index,
+                                            const EEVEE_BoundBox *bb)
+{
+  const BoundSphere *bs = linfo->shadow_bounds + cube_index;
+  for (int face = 0; face < 6; face++) {
+    if (!BLI_BITMAP_TEST(&linfo->sh_cube_face_update[0], cube_index * 6 + face) &&
+        cube_face_bbox_intersect(face, bs->center, bb)) {
+      BLI_BITMAP_ENABLE(&linfo->sh_cube_face_update[0], cube_index * 6 + face);
+      BLI_BITMAP_ENABLE(&linfo->sh_cube_update[0], cube_index);
+    }
+  }
+}
+
 void EEVEE_shadows_update(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata)
 {
   EEVEE_StorageList *stl = vedata->stl;
@@ -218,6 +278,7 @@ void EEVEE_shadows_update(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata)
     linfo->cache_num_cube_layer = linfo->num_cube_layer;
     /* Update all lights. */
     BLI_bitmap_set_all(&linfo->sh_cube_update[0], true, MAX_LIGHT);
+    BLI_bitmap_set_all(&linfo->sh_cube_face_update[0], true, MAX_SHADOW_CUBE * 6);
   }
 
   if (linfo->num_cascade_layer != linfo->cache_num_cascade_layer) {
@@ -252,7 +313,7 @@ void EEVEE_shadows_update(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata)
     const EEVEE_Light *evli = linfo->light_data + linfo->shadow_cube_light_indices[j];
     /* Setup shadow cube in UBO and tag for update if necessary. */
     if (EEVEE_shadows_cube_setup(linfo, evli, effects->taa_current_sample - 1)) {
-      BLI_BITMAP_ENABLE(&linfo->sh_cube_update[0], j);
+      EEVEE_shadows_cube_tag_update(linfo, j);
     }
   }
 
@@ -264,9 +325,9 @@ void EEVEE_shadows_update(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata)
     /* If the shadow-caster has been deleted or updated. */
     if (BLI_BITMAP_TEST(backbuffer->update, i)) {
       for (int j = 0; j < linfo->cube_len; j++) {
-        if (!BLI_BITMAP_TEST(&linfo->sh_cube_update[0], j)) {
+        if (!shadow_cube_all_faces_tagged(linfo, j)) {
           if (sphere_bbox_intersect(&bsphere[j], &bbox[i])) {
-            BLI_BITMAP_ENABLE(&linfo->sh_cube_update[0], j);
+            shadow_cube_faces_tag_intersect(linfo, j, &bbox[i]);
           }
         }
       }
@@ -278,9 +339,9 @@ void EEVEE_shadows_update(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata)
     /* If the shadow-caster has been updated. */
     if (BLI_BITMAP_TEST(frontbuffer->update, i)) {
       for (int j = 0; j < linfo->cube_len; j++) {
-        if (!BLI_BITMAP_TEST(&linfo->sh_cube_update[0], j)) {
+        if (!shadow_cube_all_faces_tagged(linfo, j)) {
           if (sphere_bbox_intersect(&bsphere[j], &bbox[i])) {
-            BLI_BITMAP_ENABLE(&linfo->sh_cube_update[0], j);
+            shadow_cube_faces_tag_intersect(linfo, j, &bbox[i]);
           }
         }
       }
@@ -43,7 +43,7 @@ void EEVEE_shadows_cube_add(EEVEE_LightsInfo *linfo, EEVEE_Light *evli, Object *
   }
 
   if (update) {
-    BLI_BITMAP_ENABLE(&linfo->sh_cube_update[0], linfo->cube_len);
+    EEVEE_shadows_cube_tag_update(linfo, linfo->cube_len);
   }
 
   sh_data->near = max_ff(la->clipsta, 1e-8f);
@@ -209,6 +209,10 @@ void EEVEE_shadows_draw_cubemap(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata,
     if (evli->light_type != LA_LOCAL && j == 4) {
       continue;
     }
+    /* Partial update: skip faces that no updated shadow caster can reach. */
+    if (!BLI_BITMAP_TEST(&linfo->sh_cube_face_update[0], cube_index * 6 + j)) {
+      continue;
+    }
     /* TODO(fclem): some cube sides can be invisible in the main views. Cull them. */
     // if (frustum_intersect(g_data->cube_views[j], main_view))
     //   continue;
@@ -221,5 +225,8 @@ void EEVEE_shadows_draw_cubemap(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata,
     DRW_draw_pass(psl->shadow_pass);
   }
 
+  for (int j = 0; j < 6; j++) {
+    BLI_BITMAP_SET(&linfo->sh_cube_face_update[0], cube_index * 6 + j, false);
+  }
   BLI_BITMAP_SET(&linfo->sh_cube_update[0], cube_index, false);
 }
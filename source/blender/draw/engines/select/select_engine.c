@@ -44,6 +44,7 @@ static struct {
   struct GPUTexture *texture_u32;
 
   SELECTID_Shaders sh_data[GPU_SHADER_CFG_LEN];
+  struct GPUShader *select_id_bitmap;
   struct SELECTID_Context context;
   uint runtime_new_objects;
 } e_data = {NULL}; /* Engine data */
@@ -51,6 +52,7 @@ static struct {
 /* Shaders */
 extern char datatoc_common_view_lib_glsl[];
 extern char datatoc_selection_id_3D_vert_glsl[];
+extern char datatoc_selection_id_bitmap_comp_glsl[];
 extern char datatoc_selection_id_frag_glsl[];
 
 /* -------------------------------------------------------------------- */
@@ -341,6 +343,7 @@ static void select_engine_free(void)
     DRW_SHADER_FREE_SAFE(sh_data->select_id_uniform);
   }
 
+  DRW_SHADER_FREE_SAFE(e_data.select_id_bitmap);
   DRW_TEXTURE_FREE_SAFE(e_data.texture_u32);
   GPU_FRAMEBUFFER_FREE_SAFE(e_data.framebuffer_select_id);
   MEM_SAFE_FREE(e_data.context.objects);
@@ -413,6 +416,19 @@ GPUTexture *DRW_engine_select_texture_get(void)
   return e_data.texture_u32;
 }
 
+/**
+ * Compute shader reducing the select ID texture into a bitmap of the drawn indices.
+ * Only valid when #GPU_compute_shader_support returns true.
+ */
+GPUShader *DRW_engine_select_bitmap_shader_get(void)
+{
+  if (e_data.select_id_bitmap == NULL) {
+    e_data.select_id_bitmap = GPU_shader_create_compute(
+        datatoc_selection_id_bitmap_comp_glsl, NULL, NULL, "select_id_bitmap");
+  }
+  return e_data.select_id_bitmap;
+}
+
 /** \} */
 
 #undef SELECT_ENGINE
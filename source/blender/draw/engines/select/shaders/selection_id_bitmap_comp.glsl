@@ -0,0 +1,46 @@
+
+/**
+ * Reduce a rectangle of the select ID texture into a bitmap of the indices found inside it,
+ * so only the small bitmap needs to be read back to the CPU instead of the full pixel block.
+ */
+
+layout(local_size_x = 16, local_size_y = 16) in;
+
+uniform usampler2D image;
+
+/* Pixel rectangle to scan, in texture coordinates (min inclusive). */
+uniform ivec2 rect_min;
+uniform ivec2 rect_size;
+
+/* Number of valid selection indices (bitmap length in bits). */
+uniform int index_len;
+
+/* When radius squared is non-zero, only pixels strictly inside the circle contribute. */
+uniform ivec2 circle_center;
+uniform int circle_radius_sq;
+
+layout(std430, binding = 0) buffer bitmapBuf
+{
+  uint bitmap[];
+};
+
+void main()
+{
+  ivec2 px = ivec2(gl_GlobalInvocationID.xy);
+  if (px.x >= rect_size.x || px.y >= rect_size.y) {
+    return;
+  }
+  ivec2 texel = rect_min + px;
+  if (circle_radius_sq != 0) {
+    ivec2 offset = texel - circle_center;
+    if (offset.x * offset.x + offset.y * offset.y >= circle_radius_sq) {
+      return;
+    }
+  }
+  /* Indices are drawn offset by one so that zero means background,
+   * zero wraps around and is rejected by the range test. */
+  uint index = texelFetch(image, texel, 0).r - 1u;
+  if (index < uint(index_len)) {
+    atomicOr(bitmap[index >> 5u], 1u << (index & 31u));
+  }
+}
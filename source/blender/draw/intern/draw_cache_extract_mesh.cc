@@ -545,11 +545,15 @@ static struct TaskNode *mesh_extract_render_data_node_create(struct TaskGraph *t
   MeshRenderDataUpdateTaskData *task_data = new MeshRenderDataUpdateTaskData(
       mr, cache, iter_type, data_flag);
 
-  struct TaskNode *task_node = BLI_task_graph_node_create(
+  /* This node gates the whole extraction sub-graph of its mesh: run it with high priority so
+   * that when several meshes compete for workers, their extraction tasks become available as
+   * soon as possible. */
+  struct TaskNode *task_node = BLI_task_graph_node_create_ex(
       task_graph,
       mesh_extract_render_data_node_exec,
       task_data,
-      (TaskGraphNodeFreeFunction)mesh_render_data_update_task_data_free);
+      (TaskGraphNodeFreeFunction)mesh_render_data_update_task_data_free,
+      TASK_PRIORITY_HIGH);
   return task_node;
 }
 
@@ -40,6 +40,7 @@
 
 #include "BLI_hash.h"
 #include "BLI_polyfill_2d.h"
+#include "BLI_task.h"
 
 #include "draw_cache.h"
 #include "draw_cache_impl.h"
@@ -258,6 +259,10 @@ typedef struct gpIterData {
   int vert_len;
   int tri_len;
   int curve_len;
+  /** Strokes gathered for the parallel buffer fill. */
+  bGPDstroke **strokes;
+  int stroke_len;
+  int stroke_idx;
 } gpIterData;
 
 static GPUVertBuf *gpencil_dummy_buffer_get(void)
@@ -368,22 +373,43 @@ static void gpencil_buffer_add_fill(GPUIndexBufBuilder *ibo, const bGPDstroke *g
   int v = gps->runtime.stroke_start;
   for (int i = 0; i < tri_len; i++) {
     uint *tri = gps->triangles[i].verts;
-    GPU_indexbuf_add_tri_verts(ibo, v + tri[0], v + tri[1], v + tri[2]);
+    /* Write at the stroke's own position, so strokes filled from multiple threads cannot
+     * interleave. */
+    GPU_indexbuf_set_tri_verts(
+        ibo, gps->runtime.fill_start + i, v + tri[0], v + tri[1], v + tri[2]);
   }
 }
 
-static void gpencil_stroke_iter_cb(bGPDlayer *UNUSED(gpl),
-                                   bGPDframe *UNUSED(gpf),
-                                   bGPDstroke *gps,
-                                   void *thunk)
+static void gpencil_stroke_collect_cb(bGPDlayer *UNUSED(gpl),
+                                      bGPDframe *UNUSED(gpf),
+                                      bGPDstroke *gps,
+                                      void *thunk)
 {
   gpIterData *iter = (gpIterData *)thunk;
+  iter->strokes[iter->stroke_idx++] = gps;
+}
+
+static void gpencil_stroke_fill_task_cb(void *__restrict userdata,
+                                        const int i,
+                                        const TaskParallelTLS *__restrict tls)
+{
+  gpIterData *iter = (gpIterData *)userdata;
+  GPUIndexBufBuilder *ibo = (GPUIndexBufBuilder *)tls->userdata_chunk;
+  const bGPDstroke *gps = iter->strokes[i];
+
   gpencil_buffer_add_stroke(iter->verts, iter->cols, gps);
   if (gps->tot_triangles > 0) {
-    gpencil_buffer_add_fill(&iter->ibo, gps);
+    gpencil_buffer_add_fill(ibo, gps);
   }
 }
 
+static void gpencil_stroke_fill_reduce_cb(const void *__restrict UNUSED(userdata),
+                                          void *__restrict chunk_join,
+                                          void *__restrict chunk)
+{
+  GPU_indexbuf_join((GPUIndexBufBuilder *)chunk_join, (const GPUIndexBufBuilder *)chunk);
+}
+
 static void gpencil_object_verts_count_cb(bGPDlayer *UNUSED(gpl),
                                           bGPDframe *UNUSED(gpf),
                                           bGPDstroke *gps,
@@ -396,6 +422,7 @@ static void gpencil_object_verts_count_cb(bGPDlayer *UNUSED(gpl),
   gps->runtime.fill_start = iter->tri_len;
   iter->vert_len += gps->totpoints + 2 + gpencil_stroke_is_cyclic(gps);
   iter->tri_len += gps->tot_triangles;
+  iter->stroke_len++;
 }
 
 static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfra)
@@ -421,6 +448,7 @@ static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfr
         .vert_len = 1, /* Start at 1 for the gl_InstanceID trick to work (see vert shader). */
         .tri_len = 0,
         .curve_len = 0,
+        .stroke_len = 0,
     };
     BKE_gpencil_visible_stroke_advanced_iter(
         NULL, ob, NULL, gpencil_object_verts_count_cb, &iter, do_onion, cfra);
@@ -438,9 +466,25 @@ static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfr
     /* Create IBO. */
     GPU_indexbuf_init(&iter.ibo, GPU_PRIM_TRIS, iter.tri_len, iter.vert_len);
 
-    /* Fill buffers with data. */
-    BKE_gpencil_visible_stroke_advanced_iter(
-        NULL, ob, NULL, gpencil_stroke_iter_cb, &iter, do_onion, cfra);
+    /* Fill buffers with data. The count pass assigned each stroke its own vertex and triangle
+     * range, so strokes can be filled in parallel; per-task index builder state is joined back
+     * into the main builder afterwards. */
+    if (iter.stroke_len > 0) {
+      iter.strokes = MEM_mallocN(sizeof(bGPDstroke *) * iter.stroke_len, __func__);
+      iter.stroke_idx = 0;
+      BKE_gpencil_visible_stroke_advanced_iter(
+          NULL, ob, NULL, gpencil_stroke_collect_cb, &iter, do_onion, cfra);
+
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      settings.min_iter_per_thread = 32;
+      settings.userdata_chunk = &iter.ibo;
+      settings.userdata_chunk_size = sizeof(iter.ibo);
+      settings.func_reduce = gpencil_stroke_fill_reduce_cb;
+      BLI_task_parallel_range(0, iter.stroke_len, &iter, gpencil_stroke_fill_task_cb, &settings);
+
+      MEM_freeN(iter.strokes);
+    }
 
     /* Mark last 2 verts as invalid. */
     for (int i = 0; i < 2; i++) {
@@ -30,6 +30,7 @@
 #include "BLI_ghash.h"
 #include "BLI_math_vector.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "DNA_customdata_types.h"
@@ -607,36 +608,73 @@ static int particle_batch_cache_fill_segments(ParticleSystem *psys,
   return curr_point;
 }
 
+typedef struct ParticleProcPosFillData {
+  ParticleCacheKey **path_cache;
+  const int *offsets;
+  float (*buffer)[4];
+} ParticleProcPosFillData;
+
+static void particle_batch_cache_fill_segments_proc_pos_cb(
+    void *__restrict userdata, const int i, const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ParticleProcPosFillData *data = userdata;
+  ParticleCacheKey *path = data->path_cache[i];
+  if (path->segments <= 0) {
+    return;
+  }
+  float(*seg_data)[4] = data->buffer + data->offsets[i];
+  float total_len = 0.0f;
+  float *co_prev = NULL;
+  for (int j = 0; j <= path->segments; j++) {
+    copy_v3_v3(seg_data[j], path[j].co);
+    if (co_prev) {
+      total_len += len_v3v3(co_prev, path[j].co);
+    }
+    seg_data[j][3] = total_len;
+    co_prev = path[j].co;
+  }
+  if (total_len > 0.0f) {
+    /* Divide by total length to have a [0-1] number. */
+    for (int j = 0; j <= path->segments; j++) {
+      seg_data[j][3] /= total_len;
+    }
+  }
+}
+
 static void particle_batch_cache_fill_segments_proc_pos(ParticleCacheKey **path_cache,
                                                         const int num_path_keys,
                                                         GPUVertBufRaw *attr_step)
 {
+  /* Compute the write position of each strand upfront so that the strands can
+   * be copied in parallel, the serial key copy dominates cache creation time
+   * for grooms with millions of children. */
+  int *offsets = MEM_mallocN(sizeof(int) * num_path_keys, __func__);
+  int total_keys = 0;
   for (int i = 0; i < num_path_keys; i++) {
+    offsets[i] = total_keys;
     ParticleCacheKey *path = path_cache[i];
-    if (path->segments <= 0) {
-      continue;
-    }
-    float total_len = 0.0f;
-    float *co_prev = NULL, *seg_data_first;
-    for (int j = 0; j <= path->segments; j++) {
-      float *seg_data = (float *)GPU_vertbuf_raw_step(attr_step);
-      copy_v3_v3(seg_data, path[j].co);
-      if (co_prev) {
-        total_len += len_v3v3(co_prev, path[j].co);
-      }
-      else {
-        seg_data_first = seg_data;
-      }
-      seg_data[3] = total_len;
-      co_prev = path[j].co;
-    }
-    if (total_len > 0.0f) {
-      /* Divide by total length to have a [0-1] number. */
-      for (int j = 0; j <= path->segments; j++, seg_data_first += 4) {
-        seg_data_first[3] /= total_len;
-      }
+    if (path->segments > 0) {
+      total_keys += path->segments + 1;
     }
   }
+
+  if (total_keys > 0) {
+    ParticleProcPosFillData data;
+    data.path_cache = path_cache;
+    data.offsets = offsets;
+    data.buffer = (float(*)[4])attr_step->data;
+
+    /* Claim the range from the raw accessor. */
+    attr_step->data += (size_t)total_keys * attr_step->stride;
+
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.use_threading = (total_keys > 4096);
+    BLI_task_parallel_range(
+        0, num_path_keys, &data, particle_batch_cache_fill_segments_proc_pos_cb, &settings);
+  }
+
+  MEM_freeN(offsets);
 }
 
 static float particle_key_weight(const ParticleData *particle, int strand, float t)
@@ -284,6 +284,68 @@ GPUBatch *DRW_volume_batch_cache_get_selection_surface(Volume *volume)
   return cache->selection_surface;
 }
 
+/* Create a sparse 3D texture from a dense voxel buffer, committing video memory only for
+ * pages that contain non-zero voxels. Returns NULL when sparse textures are not supported
+ * or the format has no sparse layout, the caller then falls back to a dense texture. */
+static GPUTexture *volume_grid_sparse_texture_create(const DenseFloatVolumeGrid *dense_grid,
+                                                     const eGPUTextureFormat format)
+{
+  if (!GPU_texture_3d_sparse_support()) {
+    return NULL;
+  }
+
+  const int *resolution = dense_grid->resolution;
+  int page_size[3];
+  GPUTexture *texture = GPU_texture_create_3d_sparse(
+      "volume_grid", UNPACK3(resolution), format, page_size);
+  if (texture == NULL) {
+    return NULL;
+  }
+
+  const int channels = dense_grid->channels;
+  float *page_voxels = MEM_malloc_arrayN(
+      (size_t)page_size[0] * (size_t)page_size[1] * (size_t)page_size[2],
+      sizeof(float) * channels,
+      __func__);
+
+  for (int z = 0; z < resolution[2]; z += page_size[2]) {
+    for (int y = 0; y < resolution[1]; y += page_size[1]) {
+      for (int x = 0; x < resolution[0]; x += page_size[0]) {
+        const int offset[3] = {x, y, z};
+        const int extent[3] = {min_ii(page_size[0], resolution[0] - x),
+                               min_ii(page_size[1], resolution[1] - y),
+                               min_ii(page_size[2], resolution[2] - z)};
+
+        /* Gather the page into a tightly packed buffer and test for content. */
+        bool occupied = false;
+        float *dst = page_voxels;
+        const size_t row_floats = (size_t)extent[0] * channels;
+        for (int pz = 0; pz < extent[2]; pz++) {
+          for (int py = 0; py < extent[1]; py++) {
+            const size_t voxel_index = (((size_t)(z + pz) * resolution[1] + (y + py)) *
+                                            resolution[0] +
+                                        x) *
+                                       channels;
+            memcpy(dst, dense_grid->voxels + voxel_index, row_floats * sizeof(float));
+            for (size_t i = 0; !occupied && i < row_floats; i++) {
+              occupied = (dst[i] != 0.0f);
+            }
+            dst += row_floats;
+          }
+        }
+
+        if (occupied) {
+          GPU_texture_sparse_update_region(texture, offset, extent, GPU_DATA_FLOAT, page_voxels);
+        }
+      }
+    }
+  }
+
+  MEM_freeN(page_voxels);
+
+  return texture;
+}
+
 static DRWVolumeGrid *volume_grid_cache_get(const Volume *volume,
                                             const VolumeGrid *grid,
                                             VolumeBatchCache *cache)
@@ -322,14 +384,18 @@ static DRWVolumeGrid *volume_grid_cache_get(const Volume *volume,
     copy_m4_m4(cache_grid->texture_to_object, dense_grid.texture_to_object);
     invert_m4_m4(cache_grid->object_to_texture, dense_grid.texture_to_object);
 
-    /* Create GPU texture. */
+    /* Create GPU texture. Prefer a sparse texture so mostly-empty grids only take video
+     * memory for the pages that contain voxels. */
     eGPUTextureFormat format = (channels == 3) ? GPU_RGB16F : GPU_R16F;
-    cache_grid->texture = GPU_texture_create_3d("volume_grid",
-                                                UNPACK3(dense_grid.resolution),
-                                                1,
-                                                format,
-                                                GPU_DATA_FLOAT,
-                                                dense_grid.voxels);
+    cache_grid->texture = volume_grid_sparse_texture_create(&dense_grid, format);
+    if (cache_grid->texture == NULL) {
+      cache_grid->texture = GPU_texture_create_3d("volume_grid",
+                                                  UNPACK3(dense_grid.resolution),
+                                                  1,
+                                                  format,
+                                                  GPU_DATA_FLOAT,
+                                                  dense_grid.voxels);
+    }
     /* The texture can be null if the resolution along one axis is larger than
      * GL_MAX_3D_TEXTURE_SIZE. */
     if (cache_grid->texture != NULL) {
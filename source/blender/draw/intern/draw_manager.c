@@ -545,6 +545,7 @@ static void draw_unit_state_create(void)
   /* TODO(fclem): get rid of this. */
   culling->bsphere.radius = -1.0f;
   culling->user_data = NULL;
+  culling->use_occlusion = false;
 
   DRW_handle_increment(&DST.resource_handle);
 }
@@ -999,9 +1000,16 @@ void DRW_cache_free_old_batches(Main *bmain)
         continue;
       }
 
-      /* TODO(fclem): This is not optimal since it iter over all dupli instances.
-       * In this case only the source object should be tagged. */
+      Object *dupli_origin = NULL;
       DEG_OBJECT_ITER_FOR_RENDER_ENGINE_BEGIN (depsgraph, ob) {
+        if (data_.dupli_object_current != NULL) {
+          /* Duplis share the batch cache of their source object (see #drw_duplidata_load),
+           * so only tag it once per consecutive run of instances. */
+          if (data_.dupli_object_current->ob == dupli_origin) {
+            continue;
+          }
+          dupli_origin = data_.dupli_object_current->ob;
+        }
         DRW_batch_cache_free_old(ob, ctime);
       }
       DEG_OBJECT_ITER_FOR_RENDER_ENGINE_END;
@@ -1034,6 +1042,9 @@ static void drw_engines_cache_init(void)
 {
   DST.enabled_engine_count = BLI_listbase_count(&DST.enabled_engines);
   DST.vedata_array = MEM_mallocN(sizeof(void *) * DST.enabled_engine_count, __func__);
+  DST.populate_engines = MEM_mallocN(sizeof(void *) * DST.enabled_engine_count, __func__);
+  DST.populate_vedata = MEM_mallocN(sizeof(void *) * DST.enabled_engine_count, __func__);
+  DST.populate_engine_count = 0;
 
   int i = 0;
   for (LinkData *link = DST.enabled_engines.first; link; link = link->next, i++) {
@@ -1041,6 +1052,12 @@ static void drw_engines_cache_init(void)
     ViewportEngineData *data = drw_viewport_engine_data_ensure(engine);
     DST.vedata_array[i] = data;
 
+    if (engine->id_update || engine->cache_populate) {
+      DST.populate_engines[DST.populate_engine_count] = engine;
+      DST.populate_vedata[DST.populate_engine_count] = data;
+      DST.populate_engine_count++;
+    }
+
     if (data->text_draw_cache) {
       DRW_text_cache_destroy(data->text_draw_cache);
       data->text_draw_cache = NULL;
@@ -1086,10 +1103,14 @@ static void drw_engines_cache_populate(Object *ob)
     drw_batch_cache_validate(ob);
   }
 
-  int i = 0;
-  for (LinkData *link = DST.enabled_engines.first; link; link = link->next, i++) {
-    DrawEngineType *engine = link->data;
-    ViewportEngineData *data = DST.vedata_array[i];
+  /* NOTE: The engine callbacks run serially, on purpose. Call recording goes through global
+   * per-object state (#DST.ob_handle, dupli data) and shared #DST.vmempool chunk allocators,
+   * engines create shading groups lazily from inside their populate callbacks, and workbench can
+   * compile GPU materials here which requires the GL context. Until those are untangled, the
+   * per-object parallelism lives in the batch extraction (#DST.task_graph). */
+  for (int i = 0; i < DST.populate_engine_count; i++) {
+    DrawEngineType *engine = DST.populate_engines[i];
+    ViewportEngineData *data = DST.populate_vedata[i];
 
     if (engine->id_update) {
       engine->id_update(data, &ob->id);
@@ -1123,6 +1144,9 @@ static void drw_engines_cache_finish(void)
     }
   }
   MEM_freeN(DST.vedata_array);
+  MEM_SAFE_FREE(DST.populate_engines);
+  MEM_SAFE_FREE(DST.populate_vedata);
+  DST.populate_engine_count = 0;
 }
 
 static void drw_engines_draw_scene(void)
@@ -1344,6 +1368,12 @@ void DRW_notify_view_update(const DRWUpdateContext *update_ctx)
     /* Reset before using it. */
     drw_state_prepare_clean_for_draw(&DST);
 
+    /* The scene changed: the occlusion snapshot of this viewport is outdated. */
+    ViewportMemoryPool *vmempool = GPU_viewport_mempool_get(viewport);
+    if (vmempool->occlusion_buffer != NULL) {
+      vmempool->occlusion_buffer->tagged = true;
+    }
+
     DST.viewport = viewport;
     GPU_viewport_active_view_set(viewport, view);
     DST.draw_ctx = (DRWContextState){
@@ -1567,6 +1597,7 @@ void DRW_draw_render_loop_ex(struct Depsgraph *depsgraph,
 
   drw_viewport_var_init();
   drw_viewport_colormanagement_set();
+  drw_occlusion_init();
 
   const int object_type_exclude_viewport = v3d->object_type_exclude_viewport;
   /* Check if scene needs to perform the populate loop */
@@ -1648,6 +1679,8 @@ void DRW_draw_render_loop_ex(struct Depsgraph *depsgraph,
   /* Fix 3D view "lagging" on APPLE and WIN32+NVIDIA. (See T56996, T61474) */
   GPU_flush();
 
+  drw_occlusion_buffer_capture();
+
   DRW_stats_reset();
 
   DRW_draw_callbacks_post_scene();
@@ -106,8 +106,38 @@ typedef struct DRWCullingState {
   BoundSphere bsphere;
   /* Grrr only used by EEVEE. */
   void *user_data;
+  /** True if this state may be culled against the occlusion depth snapshot.
+   * Only set for object types that cannot draw outside of their bounds. */
+  bool use_occlusion;
 } DRWCullingState;
 
+/* Resolution of the max-depth reduction used for occlusion culling.
+ * Keep small: the buffer is read back to CPU every time it is refreshed. */
+#define DRW_OCCLUSION_BUFFER_RES 128
+
+/**
+ * Conservative occlusion culling data for one #GPUViewport.
+ * Holds a low resolution max-depth reduction of the last stable viewport frame.
+ * Only used to cull redraws of the exact same view (see #drw_occlusion_init).
+ */
+typedef struct DRWOcclusionBuffer {
+  /** Max-depth snapshot, row major, DRW_OCCLUSION_BUFFER_RES^2 floats. Lazy allocated. */
+  float *depth;
+  /** Viewport size the snapshot was captured at. */
+  int viewport_size[2];
+  /** View projection matrix of the snapshot. */
+  float persmat[4][4];
+  /** View projection matrix of the previous frame, to detect a stable view. */
+  float last_persmat[4][4];
+  /** True if depth contains a snapshot matching persmat. */
+  bool valid;
+  /** Set on scene updates (see #DRW_notify_view_update): the snapshot is outdated. */
+  bool tagged;
+  /** GPU side reduction target. Lazy allocated. */
+  struct GPUTexture *texture;
+  struct GPUFrameBuffer *framebuffer;
+} DRWOcclusionBuffer;
+
 /* Minimum max UBO size is 64KiB. We take the largest
  * UBO struct and alloc the max number.
  * `((1 << 16) / sizeof(DRWObjectMatrix)) = 512`
@@ -558,12 +588,22 @@ typedef struct DRWManager {
   void **vedata_array;      /* ViewportEngineData */
   int enabled_engine_count; /* Length of enabled_engines list. */
 
+  /** Enabled engines with an #id_update or #cache_populate callback, flattened so the
+   * per-object populate loop does not walk #enabled_engines for every object. */
+  struct DrawEngineType **populate_engines;
+  void **populate_vedata;
+  int populate_engine_count;
+
   bool buffer_finish_called; /* Avoid bad usage of DRW_render_instance_buffer_finish */
 
   DRWView *view_default;
   DRWView *view_active;
   DRWView *view_previous;
   uint primary_view_ct;
+  /** Occlusion culling state for this redraw. NULL if unavailable for this draw type. */
+  DRWOcclusionBuffer *occlusion_buffer;
+  /** True if the occlusion snapshot matches the current frame and can cull the default view. */
+  bool occlusion_test_enabled;
   /** TODO(fclem): Remove this. Only here to support
    * shaders without common_view_lib.glsl */
   DRWViewUboStorage view_storage_cpy;
@@ -616,6 +656,11 @@ void drw_batch_cache_generate_requested_delayed(Object *ob);
 
 void drw_resource_buffer_finish(ViewportMemoryPool *vmempool);
 
+/* Occlusion culling (draw_manager_occlusion.c) */
+void drw_occlusion_init(void);
+void drw_occlusion_buffer_capture(void);
+bool drw_occlusion_test(const DRWOcclusionBuffer *buffer, const BoundSphere *bsphere);
+
 /* Procedural Drawing */
 GPUBatch *drw_cache_procedural_points_get(void);
 GPUBatch *drw_cache_procedural_lines_get(void);
@@ -565,6 +565,19 @@ static void drw_call_culling_init(DRWCullingState *cull, Object *ob)
     /* Bypass test. */
     cull->bsphere.radius = -1.0f;
   }
+  /* Occlusion culling is only safe for object types that cannot draw outside
+   * of their bounds (particles can) and that do not bypass the depth test. */
+  cull->use_occlusion = (ob != NULL) &&
+                        ELEM(ob->type,
+                             OB_MESH,
+                             OB_CURVE,
+                             OB_SURF,
+                             OB_FONT,
+                             OB_HAIR,
+                             OB_POINTCLOUD,
+                             OB_VOLUME) &&
+                        ((ob->dtx & OB_DRAW_IN_FRONT) == 0) &&
+                        BLI_listbase_is_empty(&ob->particlesystem);
   /* Reset user data */
   cull->user_data = NULL;
 }
@@ -26,6 +26,7 @@
 #include "BLI_math.h"
 #include "BLI_math_bits.h"
 #include "BLI_memblock.h"
+#include "BLI_profile.h"
 
 #include "BKE_global.h"
 
@@ -496,6 +497,9 @@ static void draw_compute_culling(DRWView *view)
     return;
   }
 
+  /* Occlusion can only cull the view the snapshot was taken from. */
+  const bool do_occlusion = DST.occlusion_test_enabled && (view == DST.view_default);
+
   BLI_memblock_iter iter;
   BLI_memblock_iternew(DST.vmempool->cullstates, &iter);
   DRWCullingState *cull;
@@ -507,6 +511,10 @@ static void draw_compute_culling(DRWView *view)
       bool culled = !draw_culling_sphere_test(
           &view->frustum_bsphere, view->frustum_planes, &cull->bsphere);
 
+      if (!culled && do_occlusion && cull->use_occlusion) {
+        culled = drw_occlusion_test(DST.occlusion_buffer, &cull->bsphere);
+      }
+
 #ifdef DRW_DEBUG_CULLING
       if (G.debug_value != 0) {
         if (culled) {
@@ -1082,6 +1090,72 @@ static void drw_update_view(void)
   draw_compute_culling(DST.view_active);
 }
 
+/* Reordering the draw-calls of a pass is only valid when the result does not
+ * depend on the draw order, i.e. for opaque geometry sorted by the depth
+ * test. Blending and depth-ignoring passes need their submission order. */
+BLI_INLINE bool pass_state_allows_draw_reorder(DRWState state)
+{
+  return ((state & (DRW_STATE_DEPTH_LESS | DRW_STATE_DEPTH_LESS_EQUAL)) != 0) &&
+         ((state & DRW_STATE_WRITE_DEPTH) != 0) && ((state & DRW_STATE_BLEND_ENABLED) == 0);
+}
+
+static int draw_command_draw_cmp(const void *a_, const void *b_)
+{
+  const DRWCommandDraw *a = a_;
+  const DRWCommandDraw *b = b_;
+  /* Sort by every property whose change interrupts the call merging in
+   * draw_call_batching_do(), then by resource id so that consecutive ids can
+   * be merged into a single instanced call. */
+  const uint32_t a_neg = DRW_handle_negative_scale_get(&a->handle);
+  const uint32_t b_neg = DRW_handle_negative_scale_get(&b->handle);
+  if (a_neg != b_neg) {
+    return a_neg < b_neg ? -1 : 1;
+  }
+  const uint32_t a_chunk = DRW_handle_chunk_get(&a->handle);
+  const uint32_t b_chunk = DRW_handle_chunk_get(&b->handle);
+  if (a_chunk != b_chunk) {
+    return a_chunk < b_chunk ? -1 : 1;
+  }
+  if (a->batch != b->batch) {
+    return a->batch < b->batch ? -1 : 1;
+  }
+  const uint32_t a_id = DRW_handle_id_get(&a->handle);
+  const uint32_t b_id = DRW_handle_id_get(&b->handle);
+  if (a_id != b_id) {
+    return a_id < b_id ? -1 : 1;
+  }
+  return 0;
+}
+
+/* Sort runs of consecutive DRW_CMD_DRAW commands so that calls sharing the
+ * same batch end up next to each other and can be coalesced into instanced
+ * and multi-draw-indirect calls by draw_call_batching_do(), instead of
+ * flushing the pending draw on every batch change. Other command types act
+ * as barriers and keep their position, so only commands whose packed type
+ * bits are equal are permuted and the type bit-stream stays valid. */
+static void draw_commands_sort(DRWShadingGroup *shgroup)
+{
+  for (DRWCommandChunk *chunk = shgroup->cmd.first; chunk; chunk = chunk->next) {
+    uint32_t i = 0;
+    while (i < chunk->command_used) {
+      if (command_type_get(chunk->command_type, i) != DRW_CMD_DRAW) {
+        i++;
+        continue;
+      }
+      const uint32_t run_start = i;
+      while (i < chunk->command_used && command_type_get(chunk->command_type, i) == DRW_CMD_DRAW) {
+        i++;
+      }
+      if (i - run_start > 1) {
+        qsort(chunk->commands + run_start,
+              i - run_start,
+              sizeof(DRWCommand),
+              draw_command_draw_cmp);
+      }
+    }
+  }
+}
+
 static void drw_draw_pass_ex(DRWPass *pass,
                              DRWShadingGroup *start_group,
                              DRWShadingGroup *end_group)
@@ -1118,8 +1192,15 @@ static void drw_draw_pass_ex(DRWPass *pass,
   }
 
   DRW_stats_query_start(pass->name);
+  BLI_PROFILE_SCOPE_BEGIN(pass->name);
+
+  const bool sort_draw_commands = USE_BATCHING && !(G.f & G_FLAG_PICKSEL) &&
+                                  pass_state_allows_draw_reorder(pass->state);
 
   for (DRWShadingGroup *shgroup = start_group; shgroup; shgroup = shgroup->next) {
+    if (sort_draw_commands) {
+      draw_commands_sort(shgroup);
+    }
     draw_shgroup(shgroup, pass->state);
     /* break if upper limit */
     if (shgroup == end_group) {
@@ -1154,6 +1235,7 @@ static void drw_draw_pass_ex(DRWPass *pass,
     GPU_front_facing(false);
   }
 
+  BLI_PROFILE_SCOPE_END();
   DRW_stats_query_end();
 }
 
@@ -0,0 +1,245 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ */
+
+/** \file
+ * \ingroup draw
+ *
+ * Conservative occlusion culling for viewport redraws.
+ *
+ * At the end of a frame where the view matrices did not change and no scene
+ * update happened, the viewport depth buffer is reduced on the GPU to a small
+ * max-depth grid and read back (see #drw_occlusion_buffer_capture). Subsequent
+ * redraws of the exact same view (render sample accumulation, overlay redraws)
+ * cull draw-calls whose bounds are strictly behind the recorded depth
+ * everywhere on screen. The snapshot is invalidated by any scene update
+ * (#DRW_notify_view_update) or view change, so the result is always identical
+ * to a non-culled draw.
+ */
+
+#include "draw_manager.h"
+
+#include "DRW_render.h"
+
+#include "BLI_math.h"
+#include "BLI_rect.h"
+
+#include "DNA_view3d_types.h"
+
+#include "ED_view3d.h"
+
+#include "GPU_batch.h"
+#include "GPU_framebuffer.h"
+#include "GPU_state.h"
+#include "GPU_texture.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "draw_shader.h"
+
+/* -------------------------------------------------------------------- */
+/** \name Init
+ * \{ */
+
+/* Decide if the occlusion snapshot of this viewport can cull the default view
+ * during this redraw. Called once per viewport draw, after drw_viewport_var_init. */
+void drw_occlusion_init(void)
+{
+  DST.occlusion_buffer = NULL;
+  DST.occlusion_test_enabled = false;
+
+  View3D *v3d = DST.draw_ctx.v3d;
+  RegionView3D *rv3d = DST.draw_ctx.rv3d;
+
+  if (DST.viewport == NULL || v3d == NULL || rv3d == NULL) {
+    return;
+  }
+  if (DST.options.is_select || DST.options.is_depth || DST.options.is_image_render) {
+    return;
+  }
+  /* X-ray and border clipping change visibility without touching the matrices. */
+  if (XRAY_FLAG_ENABLED(v3d) || (rv3d->rflag & RV3D_CLIPPING)) {
+    return;
+  }
+
+  if (DST.vmempool->occlusion_buffer == NULL) {
+    DST.vmempool->occlusion_buffer = MEM_callocN(sizeof(DRWOcclusionBuffer),
+                                                 "DRWOcclusionBuffer");
+  }
+
+  DRWOcclusionBuffer *buffer = DST.vmempool->occlusion_buffer;
+  DST.occlusion_buffer = buffer;
+
+  if (buffer->tagged) {
+    /* This redraw consumes the pending scene update. */
+    buffer->valid = false;
+    buffer->tagged = false;
+  }
+  if (buffer->valid && (!equals_m4m4(buffer->persmat, rv3d->persmat) ||
+                        buffer->viewport_size[0] != (int)DST.size[0] ||
+                        buffer->viewport_size[1] != (int)DST.size[1])) {
+    buffer->valid = false;
+  }
+
+  DST.occlusion_test_enabled = buffer->valid;
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Depth Capture
+ * \{ */
+
+/* Refresh the max-depth snapshot if the view was stable for two frames.
+ * Called at the end of the viewport draw-loop, after the scene was drawn. */
+void drw_occlusion_buffer_capture(void)
+{
+  DRWOcclusionBuffer *buffer = DST.occlusion_buffer;
+  if (buffer == NULL) {
+    return;
+  }
+
+  RegionView3D *rv3d = DST.draw_ctx.rv3d;
+  const bool view_is_stable = equals_m4m4(buffer->last_persmat, rv3d->persmat);
+  copy_m4_m4(buffer->last_persmat, rv3d->persmat);
+
+  if (buffer->tagged || !view_is_stable) {
+    /* Content or view changed during this redraw. Try again next frame. */
+    buffer->valid = false;
+    return;
+  }
+  if (buffer->valid) {
+    /* Snapshot already matches the current frame. */
+    return;
+  }
+
+  DefaultTextureList *dtxl = DRW_viewport_texture_list_get();
+  if (dtxl->depth == NULL) {
+    return;
+  }
+
+  const int res = DRW_OCCLUSION_BUFFER_RES;
+
+  if (buffer->texture == NULL) {
+    buffer->texture = GPU_texture_create_2d("occlusion_depth", res, res, 1, GPU_R32F, NULL);
+    GPU_framebuffer_ensure_config(
+        &buffer->framebuffer,
+        {GPU_ATTACHMENT_NONE, GPU_ATTACHMENT_TEXTURE(buffer->texture)});
+  }
+  if (buffer->depth == NULL) {
+    buffer->depth = MEM_mallocN(sizeof(float) * res * res, "DRWOcclusionBuffer.depth");
+  }
+
+  GPUFrameBuffer *fb_active = GPU_framebuffer_active_get();
+
+  GPU_framebuffer_bind(buffer->framebuffer);
+  drw_state_set(DRW_STATE_WRITE_COLOR);
+
+  GPUBatch *geom = DRW_cache_fullscreen_quad_get();
+  GPU_batch_set_shader(geom, DRW_shader_depth_reduce_get());
+  GPU_batch_texture_bind(geom, "depthBuffer", dtxl->depth);
+  GPU_batch_draw(geom);
+  GPU_texture_unbind(dtxl->depth);
+
+  GPU_framebuffer_read_color(
+      buffer->framebuffer, 0, 0, res, res, 1, 0, GPU_DATA_FLOAT, buffer->depth);
+
+  if (fb_active) {
+    GPU_framebuffer_bind(fb_active);
+  }
+
+  copy_m4_m4(buffer->persmat, rv3d->persmat);
+  buffer->viewport_size[0] = (int)DST.size[0];
+  buffer->viewport_size[1] = (int)DST.size[1];
+  buffer->valid = true;
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Occlusion Test
+ * \{ */
+
+/* Return true if the bounding sphere is strictly behind the recorded depth
+ * everywhere on screen, i.e. cannot contribute a single fragment. */
+bool drw_occlusion_test(const DRWOcclusionBuffer *buffer, const BoundSphere *bsphere)
+{
+  float ndc_min[3], ndc_max[3];
+  INIT_MINMAX(ndc_min, ndc_max);
+
+  /* Project the 8 corners of the sphere's enclosing axis aligned box. The box
+   * covers the sphere for any projection, and a box with all corners in front
+   * of the near plane projects inside the hull of its projected corners. */
+  for (int i = 0; i < 8; i++) {
+    float corner[4];
+    corner[0] = bsphere->center[0] + ((i & 1) ? bsphere->radius : -bsphere->radius);
+    corner[1] = bsphere->center[1] + ((i & 2) ? bsphere->radius : -bsphere->radius);
+    corner[2] = bsphere->center[2] + ((i & 4) ? bsphere->radius : -bsphere->radius);
+    corner[3] = 1.0f;
+    mul_m4_v4(buffer->persmat, corner);
+    if (corner[3] < 1e-8f) {
+      /* Crosses the near plane: cannot be occluded. */
+      return false;
+    }
+    float ndc[3];
+    mul_v3_v3fl(ndc, corner, 1.0f / corner[3]);
+    minmax_v3v3_v3(ndc_min, ndc_max, ndc);
+  }
+
+  /* Nearest possible depth of the object, clamped to the depth buffer range. */
+  const float depth_min = clamp_f(ndc_min[2] * 0.5f + 0.5f, 0.0f, 1.0f);
+
+  const int res = DRW_OCCLUSION_BUFFER_RES;
+  /* Expand by one texel to absorb sub-pixel jitter (render sample AA). */
+  int xmin = (int)floorf((ndc_min[0] * 0.5f + 0.5f) * res) - 1;
+  int xmax = (int)floorf((ndc_max[0] * 0.5f + 0.5f) * res) + 1;
+  int ymin = (int)floorf((ndc_min[1] * 0.5f + 0.5f) * res) - 1;
+  int ymax = (int)floorf((ndc_max[1] * 0.5f + 0.5f) * res) + 1;
+  /* Fragments can only be produced inside the viewport. */
+  CLAMP(xmin, 0, res - 1);
+  CLAMP(xmax, 0, res - 1);
+  CLAMP(ymin, 0, res - 1);
+  CLAMP(ymax, 0, res - 1);
+
+  for (int y = ymin; y <= ymax; y++) {
+    const float *row = buffer->depth + y * res;
+    for (int x = xmin; x <= xmax; x++) {
+      if (depth_min <= row[x]) {
+        /* The depth test could pass here: visible. */
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Free
+ * \{ */
+
+/* Called when the owning GPUViewport is freed. */
+void DRW_occlusion_buffer_free(DRWOcclusionBuffer *buffer)
+{
+  GPU_FRAMEBUFFER_FREE_SAFE(buffer->framebuffer);
+  DRW_TEXTURE_FREE_SAFE(buffer->texture);
+  MEM_SAFE_FREE(buffer->depth);
+  MEM_freeN(buffer);
+}
+
+/** \} */
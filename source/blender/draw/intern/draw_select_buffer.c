@@ -27,11 +27,19 @@
 #include "BLI_array_utils.h"
 #include "BLI_bitmap.h"
 #include "BLI_bitmap_draw_2d.h"
+#include "BLI_math_base.h"
 #include "BLI_rect.h"
 
 #include "DNA_screen_types.h"
 
+#include "GPU_capabilities.h"
+#include "GPU_compute.h"
 #include "GPU_select.h"
+#include "GPU_shader.h"
+#include "GPU_state.h"
+#include "GPU_texture.h"
+#include "GPU_vertex_buffer.h"
+#include "GPU_vertex_format.h"
 
 #include "DEG_depsgraph.h"
 #include "DEG_depsgraph_query.h"
@@ -79,21 +87,25 @@ uint *DRW_select_buffer_read(struct Depsgraph *depsgraph,
       BLI_assert(region->winx == GPU_texture_width(DRW_engine_select_texture_get()) &&
                  region->winy == GPU_texture_height(DRW_engine_select_texture_get()));
 
-      /* Read the UI32 pixels. */
+      /* Read the UI32 pixels. Use an asynchronous readback so the transfer
+       * overlaps the remaining select drawing instead of stalling on it. */
+      GPUFrameBuffer *select_id_fb = DRW_engine_select_framebuffer_get();
+      GPU_framebuffer_bind(select_id_fb);
+      GPUFrameBufferReadback *readback = GPU_framebuffer_read_color_async(
+          select_id_fb,
+          rect_clamp.xmin,
+          rect_clamp.ymin,
+          BLI_rcti_size_x(&rect_clamp),
+          BLI_rcti_size_y(&rect_clamp),
+          1,
+          0,
+          GPU_DATA_UINT);
+
+      /* Allocate while the transfer is in flight. */
       buf_len = BLI_rcti_size_x(rect) * BLI_rcti_size_y(rect);
       r_buf = MEM_mallocN(buf_len * sizeof(*r_buf), __func__);
 
-      GPUFrameBuffer *select_id_fb = DRW_engine_select_framebuffer_get();
-      GPU_framebuffer_bind(select_id_fb);
-      GPU_framebuffer_read_color(select_id_fb,
-                                 rect_clamp.xmin,
-                                 rect_clamp.ymin,
-                                 BLI_rcti_size_x(&rect_clamp),
-                                 BLI_rcti_size_y(&rect_clamp),
-                                 1,
-                                 0,
-                                 GPU_DATA_UINT,
-                                 r_buf);
+      GPU_framebuffer_readback_result_get(readback, r_buf);
 
       if (!BLI_rcti_compare(rect, &rect_clamp)) {
         /* The rect has been clamped so you need to realign the buffer and fill in the blanks */
@@ -114,6 +126,106 @@ uint *DRW_select_buffer_read(struct Depsgraph *depsgraph,
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name GPU Bitmap Reduction
+ *
+ * Reduce the select ID buffer into the per-index bitmap with a compute shader,
+ * so only the small bitmap is transferred back to the CPU instead of the full
+ * pixel rectangle. Used by box and circle select on platforms with compute support.
+ *
+ * \{ */
+
+/**
+ * \param circle_center: Center of the circle mask in region pixels, unused when \a circle_radius
+ * is zero (plain rectangle reduction).
+ * \returns a #BLI_bitmap of \a r_bitmap_len bits or NULL on failure.
+ */
+static BLI_bitmap *drw_select_buffer_bitmap_from_rect_gpu(struct Depsgraph *depsgraph,
+                                                          struct ARegion *region,
+                                                          struct View3D *v3d,
+                                                          const rcti *rect,
+                                                          const int circle_center[2],
+                                                          const int circle_radius,
+                                                          uint *r_bitmap_len)
+{
+  struct SELECTID_Context *select_ctx = DRW_select_engine_context_get();
+  BLI_bitmap *bitmap_buf = NULL;
+
+  /* Clamp rect, see #DRW_select_buffer_read. */
+  rcti r = {
+      .xmin = 0,
+      .xmax = region->winx,
+      .ymin = 0,
+      .ymax = region->winy,
+  };
+  rcti rect_clamp = *rect;
+  if (!BLI_rcti_isect(&r, &rect_clamp, &rect_clamp)) {
+    return NULL;
+  }
+
+  DRW_opengl_context_enable();
+  /* Update the drawing. */
+  DRW_draw_select_id(depsgraph, region, v3d, rect);
+
+  if (select_ctx->index_drawn_len > 1) {
+    const uint bitmap_len = select_ctx->index_drawn_len - 1;
+
+    GPUShader *shader = DRW_engine_select_bitmap_shader_get();
+
+    /* Zero initialized bitmap words, bound as storage buffer for the reduction. */
+    static GPUVertFormat format = {0};
+    if (format.attr_len == 0) {
+      GPU_vertformat_attr_add(&format, "bits", GPU_COMP_U32, 1, GPU_FETCH_INT);
+    }
+    GPUVertBuf *bitmap_vbo = GPU_vertbuf_create_with_format(&format);
+    GPU_vertbuf_data_alloc(bitmap_vbo, _BITMAP_NUM_BLOCKS(bitmap_len));
+    memset(GPU_vertbuf_get_data(bitmap_vbo), 0, BLI_BITMAP_SIZE(bitmap_len));
+
+    GPU_shader_bind(shader);
+    GPU_texture_bind(DRW_engine_select_texture_get(),
+                     GPU_shader_get_texture_binding(shader, "image"));
+    GPU_vertbuf_bind_as_ssbo(bitmap_vbo, GPU_shader_get_ssbo(shader, "bitmapBuf"));
+
+    const int rect_min[2] = {rect_clamp.xmin, rect_clamp.ymin};
+    const int rect_size[2] = {BLI_rcti_size_x(&rect_clamp), BLI_rcti_size_y(&rect_clamp)};
+    const int index_len = (int)bitmap_len;
+    const int center[2] = {circle_radius ? circle_center[0] : 0,
+                           circle_radius ? circle_center[1] : 0};
+    const int radius_sq = circle_radius * circle_radius;
+    GPU_shader_uniform_vector_int(
+        shader, GPU_shader_get_uniform(shader, "rect_min"), 2, 1, rect_min);
+    GPU_shader_uniform_vector_int(
+        shader, GPU_shader_get_uniform(shader, "rect_size"), 2, 1, rect_size);
+    GPU_shader_uniform_vector_int(
+        shader, GPU_shader_get_uniform(shader, "index_len"), 1, 1, &index_len);
+    GPU_shader_uniform_vector_int(
+        shader, GPU_shader_get_uniform(shader, "circle_center"), 2, 1, center);
+    GPU_shader_uniform_vector_int(
+        shader, GPU_shader_get_uniform(shader, "circle_radius_sq"), 1, 1, &radius_sq);
+
+    GPU_compute_dispatch(
+        shader, divide_ceil_u(rect_size[0], 16), divide_ceil_u(rect_size[1], 16), 1);
+    GPU_memory_barrier(GPU_BARRIER_SHADER_STORAGE);
+
+    /* Read back only the bitmap words. */
+    const void *mapped_data = GPU_vertbuf_read(bitmap_vbo);
+    bitmap_buf = GPU_vertbuf_unmap(bitmap_vbo, mapped_data);
+
+    GPU_shader_unbind();
+    GPU_vertbuf_discard(bitmap_vbo);
+
+    if (r_bitmap_len) {
+      *r_bitmap_len = bitmap_len;
+    }
+  }
+
+  DRW_opengl_context_disable();
+
+  return bitmap_buf;
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Select Bitmap from ID's
  *
@@ -138,6 +250,11 @@ uint *DRW_select_buffer_bitmap_from_rect(struct Depsgraph *depsgraph,
   rect_px.xmax += 1;
   rect_px.ymax += 1;
 
+  if (GPU_compute_shader_support()) {
+    return drw_select_buffer_bitmap_from_rect_gpu(
+        depsgraph, region, v3d, &rect_px, NULL, 0, r_bitmap_len);
+  }
+
   uint buf_len;
   uint *buf = DRW_select_buffer_read(depsgraph, region, v3d, &rect_px, &buf_len);
   if (buf == NULL) {
@@ -187,6 +304,11 @@ uint *DRW_select_buffer_bitmap_from_circle(struct Depsgraph *depsgraph,
       .ymax = center[1] + radius + 1,
   };
 
+  if (GPU_compute_shader_support() && (radius > 0)) {
+    return drw_select_buffer_bitmap_from_rect_gpu(
+        depsgraph, region, v3d, &rect, center, radius, r_bitmap_len);
+  }
+
   const uint *buf = DRW_select_buffer_read(depsgraph, region, v3d, &rect, NULL);
 
   if (buf == NULL) {
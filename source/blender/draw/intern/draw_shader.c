@@ -29,9 +29,11 @@
 #include "GPU_index_buffer.h"
 #include "GPU_vertex_buffer.h"
 
+#include "draw_manager.h"
 #include "draw_shader.h"
 
 extern char datatoc_common_hair_lib_glsl[];
+extern char datatoc_common_depth_reduce_frag_glsl[];
 
 extern char datatoc_common_hair_refine_vert_glsl[];
 extern char datatoc_common_hair_refine_comp_glsl[];
@@ -39,6 +41,7 @@ extern char datatoc_gpu_shader_3D_smooth_color_frag_glsl[];
 
 static struct {
   struct GPUShader *hair_refine_sh[PART_REFINE_MAX_SHADER];
+  struct GPUShader *depth_reduce_sh;
 } e_data = {{NULL}};
 
 /* -------------------------------------------------------------------- */
@@ -114,9 +117,26 @@ GPUShader *DRW_shader_hair_refine_get(ParticleRefineShader refinement,
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Occlusion culling
+ * \{ */
+
+GPUShader *DRW_shader_depth_reduce_get(void)
+{
+  if (e_data.depth_reduce_sh == NULL) {
+    e_data.depth_reduce_sh = DRW_shader_create_fullscreen(
+        datatoc_common_depth_reduce_frag_glsl,
+        "#define TARGET_SIZE " STRINGIFY(DRW_OCCLUSION_BUFFER_RES) "\n");
+  }
+  return e_data.depth_reduce_sh;
+}
+
+/** \} */
+
 void DRW_shaders_free(void)
 {
   for (int i = 0; i < PART_REFINE_MAX_SHADER; i++) {
     DRW_SHADER_FREE_SAFE(e_data.hair_refine_sh[i]);
   }
+  DRW_SHADER_FREE_SAFE(e_data.depth_reduce_sh);
 }
@@ -221,7 +221,9 @@ constexpr MeshExtract create_extractor_edituv_edituv_stretch_angle()
   extractor.iter_poly_mesh = extract_edituv_stretch_angle_iter_poly_mesh;
   extractor.data_type = MR_DATA_NONE;
   extractor.data_size = sizeof(MeshExtract_StretchAngle_Data);
-  extractor.use_threading = false;
+  /* The edge vector scratch state is fully reset on the first loop of every poly, so ranges of
+   * polys can be extracted independently. */
+  extractor.use_threading = true;
   extractor.mesh_buffer_offset = offsetof(MeshBufferCache, vbo.edituv_stretch_angle);
   return extractor;
 }
@@ -23,6 +23,8 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_task.h"
+
 #include "BKE_mesh.h"
 
 #include "extract_mesh.h"
@@ -63,76 +65,139 @@ BLI_INLINE float area_ratio_to_stretch(float ratio, float tot_ratio, float inv_t
   return (ratio > 1.0f) ? (1.0f / ratio) : ratio;
 }
 
+struct MeshExtract_StretchArea_Data {
+  const MeshRenderData *mr;
+  float *area_ratio;
+  uint16_t *loop_stretch;
+  /** BMesh only. */
+  int uv_ofs;
+  /** Mesh only. */
+  const MLoopUV *uv_data;
+};
+
+struct StretchAreaTotals {
+  float tot_area;
+  float tot_uv_area;
+};
+
+static void extract_edituv_stretch_area_ratio_iter_bm(void *__restrict userdata,
+                                                      const int f,
+                                                      const TaskParallelTLS *__restrict tls)
+{
+  MeshExtract_StretchArea_Data *data = static_cast<MeshExtract_StretchArea_Data *>(userdata);
+  StretchAreaTotals *totals = static_cast<StretchAreaTotals *>(tls->userdata_chunk);
+  BMFace *efa = BM_face_at_index(data->mr->bm, f);
+  const float area = BM_face_calc_area(efa);
+  const float uvarea = BM_face_calc_area_uv(efa, data->uv_ofs);
+  totals->tot_area += area;
+  totals->tot_uv_area += uvarea;
+  data->area_ratio[f] = area_ratio_get(area, uvarea);
+}
+
+static void extract_edituv_stretch_area_ratio_iter_mesh(void *__restrict userdata,
+                                                        const int mp_index,
+                                                        const TaskParallelTLS *__restrict tls)
+{
+  MeshExtract_StretchArea_Data *data = static_cast<MeshExtract_StretchArea_Data *>(userdata);
+  StretchAreaTotals *totals = static_cast<StretchAreaTotals *>(tls->userdata_chunk);
+  const MeshRenderData *mr = data->mr;
+  const MPoly *mp = &mr->mpoly[mp_index];
+  const float area = BKE_mesh_calc_poly_area(mp, &mr->mloop[mp->loopstart], mr->mvert);
+  const float uvarea = BKE_mesh_calc_poly_uv_area(mp, data->uv_data);
+  totals->tot_area += area;
+  totals->tot_uv_area += uvarea;
+  data->area_ratio[mp_index] = area_ratio_get(area, uvarea);
+}
+
+static void extract_edituv_stretch_area_ratio_reduce(const void *__restrict UNUSED(userdata),
+                                                     void *__restrict chunk_to,
+                                                     void *__restrict chunk_from)
+{
+  StretchAreaTotals *to = static_cast<StretchAreaTotals *>(chunk_to);
+  const StretchAreaTotals *from = static_cast<const StretchAreaTotals *>(chunk_from);
+  to->tot_area += from->tot_area;
+  to->tot_uv_area += from->tot_uv_area;
+}
+
+/* Copy the face stretch value to each of its loops. Faces only write their own loop range so
+ * this can run over poly ranges in parallel. */
+static void extract_edituv_stretch_area_spread_iter_bm(void *__restrict userdata,
+                                                       const int f,
+                                                       const TaskParallelTLS *__restrict
+                                                           UNUSED(tls))
+{
+  MeshExtract_StretchArea_Data *data = static_cast<MeshExtract_StretchArea_Data *>(userdata);
+  const uint16_t stretch = data->area_ratio[f] * SHRT_MAX;
+  BMFace *efa = BM_face_at_index(data->mr->bm, f);
+  BMLoop *l_iter, *l_first;
+  l_iter = l_first = BM_FACE_FIRST_LOOP(efa);
+  do {
+    data->loop_stretch[BM_elem_index_get(l_iter)] = stretch;
+  } while ((l_iter = l_iter->next) != l_first);
+}
+
+static void extract_edituv_stretch_area_spread_iter_mesh(void *__restrict userdata,
+                                                         const int mp_index,
+                                                         const TaskParallelTLS *__restrict
+                                                             UNUSED(tls))
+{
+  MeshExtract_StretchArea_Data *data = static_cast<MeshExtract_StretchArea_Data *>(userdata);
+  const uint16_t stretch = data->area_ratio[mp_index] * SHRT_MAX;
+  const MPoly *mp = &data->mr->mpoly[mp_index];
+  for (int i = 0; i < mp->totloop; i++) {
+    data->loop_stretch[mp->loopstart + i] = stretch;
+  }
+}
+
 static void extract_edituv_stretch_area_finish(const MeshRenderData *mr,
                                                struct MeshBatchCache *cache,
                                                void *buf,
                                                void *UNUSED(data))
 {
   GPUVertBuf *vbo = static_cast<GPUVertBuf *>(buf);
-  float tot_area = 0.0f, tot_uv_area = 0.0f;
-  float *area_ratio = static_cast<float *>(MEM_mallocN(sizeof(float) * mr->poly_len, __func__));
-
-  if (mr->extract_type == MR_EXTRACT_BMESH) {
-    CustomData *cd_ldata = &mr->bm->ldata;
-    int uv_ofs = CustomData_get_offset(cd_ldata, CD_MLOOPUV);
-
-    BMFace *efa;
-    BMIter f_iter;
-    int f;
-    BM_ITER_MESH_INDEX (efa, &f_iter, mr->bm, BM_FACES_OF_MESH, f) {
-      float area = BM_face_calc_area(efa);
-      float uvarea = BM_face_calc_area_uv(efa, uv_ofs);
-      tot_area += area;
-      tot_uv_area += uvarea;
-      area_ratio[f] = area_ratio_get(area, uvarea);
-    }
-  }
-  else {
-    BLI_assert(ELEM(mr->extract_type, MR_EXTRACT_MAPPED, MR_EXTRACT_MESH));
-    const MLoopUV *uv_data = (const MLoopUV *)CustomData_get_layer(&mr->me->ldata, CD_MLOOPUV);
-    const MPoly *mp = mr->mpoly;
-    for (int mp_index = 0; mp_index < mr->poly_len; mp_index++, mp++) {
-      float area = BKE_mesh_calc_poly_area(mp, &mr->mloop[mp->loopstart], mr->mvert);
-      float uvarea = BKE_mesh_calc_poly_uv_area(mp, uv_data);
-      tot_area += area;
-      tot_uv_area += uvarea;
-      area_ratio[mp_index] = area_ratio_get(area, uvarea);
-    }
-  }
 
-  cache->tot_area = tot_area;
-  cache->tot_uv_area = tot_uv_area;
-
-  /* Convert in place to avoid an extra allocation */
-  uint16_t *poly_stretch = (uint16_t *)area_ratio;
-  for (int mp_index = 0; mp_index < mr->poly_len; mp_index++) {
-    poly_stretch[mp_index] = area_ratio[mp_index] * SHRT_MAX;
-  }
+  MeshExtract_StretchArea_Data data = {nullptr};
+  data.mr = mr;
+  data.area_ratio = static_cast<float *>(MEM_mallocN(sizeof(float) * mr->poly_len, __func__));
+  data.loop_stretch = (uint16_t *)GPU_vertbuf_get_data(vbo);
 
-  /* Copy face data for each loop. */
-  uint16_t *loop_stretch = (uint16_t *)GPU_vertbuf_get_data(vbo);
-
-  if (mr->extract_type == MR_EXTRACT_BMESH) {
-    BMFace *efa;
-    BMIter f_iter;
-    int f, l_index = 0;
-    BM_ITER_MESH_INDEX (efa, &f_iter, mr->bm, BM_FACES_OF_MESH, f) {
-      for (int i = 0; i < efa->len; i++, l_index++) {
-        loop_stretch[l_index] = poly_stretch[f];
-      }
-    }
+  const bool is_bmesh = (mr->extract_type == MR_EXTRACT_BMESH);
+  if (is_bmesh) {
+    data.uv_ofs = CustomData_get_offset(&mr->bm->ldata, CD_MLOOPUV);
   }
   else {
     BLI_assert(ELEM(mr->extract_type, MR_EXTRACT_MAPPED, MR_EXTRACT_MESH));
-    const MPoly *mp = mr->mpoly;
-    for (int mp_index = 0, l_index = 0; mp_index < mr->poly_len; mp_index++, mp++) {
-      for (int i = 0; i < mp->totloop; i++, l_index++) {
-        loop_stretch[l_index] = poly_stretch[mp_index];
-      }
-    }
+    data.uv_data = (const MLoopUV *)CustomData_get_layer(&mr->me->ldata, CD_MLOOPUV);
   }
 
-  MEM_freeN(area_ratio);
+  StretchAreaTotals totals = {0.0f, 0.0f};
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = MIN_RANGE_LEN;
+  settings.userdata_chunk = &totals;
+  settings.userdata_chunk_size = sizeof(totals);
+  settings.func_reduce = extract_edituv_stretch_area_ratio_reduce;
+  BLI_task_parallel_range(0,
+                          mr->poly_len,
+                          &data,
+                          is_bmesh ? extract_edituv_stretch_area_ratio_iter_bm :
+                                     extract_edituv_stretch_area_ratio_iter_mesh,
+                          &settings);
+
+  cache->tot_area = totals.tot_area;
+  cache->tot_uv_area = totals.tot_uv_area;
+
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = MIN_RANGE_LEN;
+  BLI_task_parallel_range(0,
+                          mr->poly_len,
+                          &data,
+                          is_bmesh ? extract_edituv_stretch_area_spread_iter_bm :
+                                     extract_edituv_stretch_area_spread_iter_mesh,
+                          &settings);
+
+  MEM_freeN(data.area_ratio);
 }
 
 constexpr MeshExtract create_extractor_edituv_stretch_area()
@@ -0,0 +1,28 @@
+
+/* Reduce the viewport depth buffer to a TARGET_SIZE * TARGET_SIZE grid keeping
+ * the maximum (farthest) depth of each footprint. Used by the occlusion culling
+ * stage: an object is occluded only if it is behind this depth everywhere. */
+
+uniform sampler2D depthBuffer;
+
+in vec4 uvcoordsvar;
+
+out vec4 fragColor;
+
+void main()
+{
+  ivec2 src_size = textureSize(depthBuffer, 0);
+  ivec2 texel = ivec2(gl_FragCoord.xy);
+  /* Conservative source footprint: cover every pixel that maps onto this texel. */
+  ivec2 src_min = (texel * src_size) / TARGET_SIZE;
+  ivec2 src_max = ((texel + 1) * src_size + TARGET_SIZE - 1) / TARGET_SIZE;
+  src_max = min(src_max, src_size);
+
+  float max_depth = 0.0;
+  for (int y = src_min.y; y < src_max.y; y++) {
+    for (int x = src_min.x; x < src_max.x; x++) {
+      max_depth = max(max_depth, texelFetch(depthBuffer, ivec2(x, y), 0).r);
+    }
+  }
+  fragColor = vec4(max_depth);
+}
@@ -25,6 +25,8 @@
 #include "BLI_dlrbTree.h"
 #include "BLI_listbase.h"
 #include "BLI_math.h"
+#include "BLI_task.h"
+#include "BLI_threads.h"
 
 #include "DNA_anim_types.h"
 #include "DNA_armature_types.h"
@@ -138,8 +140,11 @@ void animviz_get_object_motionpaths(Object *ob, ListBase *targets)
 
 /* ........ */
 
-/* perform baking for the targets on the current frame */
-static void motionpaths_calc_bake_targets(ListBase *targets, int cframe)
+/* perform baking for the targets on the current frame
+ * - update_eval_copy: also copy the result onto the evaluated objects' own
+ *   motion paths, only safe from the main thread (frees GPU batches).
+ */
+static void motionpaths_calc_bake_targets(ListBase *targets, int cframe, bool update_eval_copy)
 {
   MPathTarget *mpt;
 
@@ -194,6 +199,10 @@ static void motionpaths_calc_bake_targets(ListBase *targets, int cframe)
       mpv->flag &= ~MOTIONPATH_VERT_KEY;
     }
 
+    if (!update_eval_copy) {
+      continue;
+    }
+
     /* Incremental update on evaluated object if possible, for fast updating
      * while dragging in transform. */
     bMotionPath *mpath_eval = NULL;
@@ -215,6 +224,31 @@ static void motionpaths_calc_bake_targets(ListBase *targets, int cframe)
   }
 }
 
+/* Copy the fully baked path onto the evaluated object's own motion path,
+ * so the viewport doesn't have to wait for a copy-on-write update. */
+static void motionpath_sync_eval_copy(MPathTarget *mpt)
+{
+  bMotionPath *mpath = mpt->mpath;
+  bMotionPath *mpath_eval = NULL;
+  if (mpt->pchan) {
+    bPoseChannel *pchan_eval = BKE_pose_channel_find_name(mpt->ob_eval->pose, mpt->pchan->name);
+    mpath_eval = (pchan_eval) ? pchan_eval->mpath : NULL;
+  }
+  else {
+    mpath_eval = mpt->ob_eval->mpath;
+  }
+
+  if (mpath_eval == NULL || mpath_eval->length != mpath->length) {
+    return;
+  }
+
+  memcpy(mpath_eval->points, mpath->points, sizeof(bMotionPathVert) * mpath->length);
+
+  GPU_VERTBUF_DISCARD_SAFE(mpath_eval->points_vbo);
+  GPU_BATCH_DISCARD_SAFE(mpath_eval->batch_line);
+  GPU_BATCH_DISCARD_SAFE(mpath_eval->batch_points);
+}
+
 /* Get pointer to animviz settings for the given target. */
 static bAnimVizSettings *animviz_target_settings_get(MPathTarget *mpt)
 {
@@ -355,6 +389,80 @@ static void motionpath_free_free_tree_data(ListBase *targets)
   }
 }
 
+/* ........ */
+
+/* Below this amount of frames building the extra dependency graphs costs more
+ * than the parallel evaluation saves. */
+#define MOTIONPATH_PARALLEL_FRAMES_MIN 64
+/* Keep ranges long enough that evaluation dominates per-task overhead. */
+#define MOTIONPATH_PARALLEL_FRAMES_PER_TASK 16
+
+/* A disjoint frame sub-range baked on its own depsgraph copy. */
+typedef struct MotionPathRangeTask {
+  struct Depsgraph *depsgraph;
+  /* Shallow copies of the caller's MPathTarget list (shares mpath, keylist),
+   * with ob_eval pointing into this task's depsgraph. */
+  ListBase targets;
+  int sfra, efra;
+} MotionPathRangeTask;
+
+static void motionpath_bake_range_func(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  MotionPathRangeTask *task = taskdata;
+
+  for (int cfra = task->sfra; cfra <= task->efra; cfra++) {
+    DEG_evaluate_on_framechange(task->depsgraph, (float)cfra);
+    /* Each task writes only its own frames of the shared path buffers. */
+    motionpaths_calc_bake_targets(&task->targets, cfra, false);
+  }
+}
+
+/**
+ * Bake the frame range by evaluating disjoint sub-ranges on separate
+ * target-only depsgraph copies in parallel, streaming the results into the
+ * (per-frame disjoint) path buffers. The graphs are built serially on the
+ * calling thread, only evaluation runs concurrently.
+ */
+static void motionpaths_calc_bake_parallel(
+    Main *bmain, Scene *scene, ViewLayer *view_layer, ListBase *targets, int sfra, int efra)
+{
+  const int frame_len = efra - sfra + 1;
+  const int task_len = min_ii(BLI_system_thread_count(),
+                              frame_len / MOTIONPATH_PARALLEL_FRAMES_PER_TASK);
+
+  MotionPathRangeTask *tasks = MEM_callocN(sizeof(MotionPathRangeTask) * task_len, __func__);
+
+  for (int i = 0; i < task_len; i++) {
+    MotionPathRangeTask *task = &tasks[i];
+
+    /* Split the range evenly, remainder frames go to the first tasks. */
+    task->sfra = sfra + (int)((int64_t)frame_len * i / task_len);
+    task->efra = sfra + (int)((int64_t)frame_len * (i + 1) / task_len) - 1;
+
+    task->depsgraph = animviz_depsgraph_build(bmain, scene, view_layer, targets);
+
+    LISTBASE_FOREACH (MPathTarget *, mpt, targets) {
+      MPathTarget *mpt_task = MEM_dupallocN(mpt);
+      mpt_task->next = mpt_task->prev = NULL;
+      mpt_task->ob_eval = DEG_get_evaluated_object(task->depsgraph, mpt->ob);
+      BLI_addtail(&task->targets, mpt_task);
+    }
+  }
+
+  TaskPool *task_pool = BLI_task_pool_create(NULL, TASK_PRIORITY_HIGH);
+  for (int i = 0; i < task_len; i++) {
+    BLI_task_pool_push(task_pool, motionpath_bake_range_func, &tasks[i], false, NULL);
+  }
+  BLI_task_pool_work_and_wait(task_pool);
+  BLI_task_pool_free(task_pool);
+
+  for (int i = 0; i < task_len; i++) {
+    BLI_freelistN(&tasks[i].targets);
+    DEG_graph_free(tasks[i].depsgraph);
+  }
+  MEM_freeN(tasks);
+}
+
 /* Perform baking of the given object's and/or its bones' transforms to motion paths
  * - scene: current scene
  * - ob: object whose flagged motion-paths should get calculated
@@ -466,18 +574,36 @@ void animviz_calc_motionpaths(Depsgraph *depsgraph,
             sfra,
             efra,
             efra - sfra + 1);
-  for (CFRA = sfra; CFRA <= efra; CFRA++) {
-    if (range == ANIMVIZ_CALC_RANGE_CURRENT_FRAME) {
-      /* For current frame, only update tagged. */
-      BKE_scene_graph_update_tagged(depsgraph, bmain);
-    }
-    else {
-      /* Update relevant data for new frame. */
-      motionpaths_calc_update_scene(depsgraph);
+  const bool use_parallel = (range != ANIMVIZ_CALC_RANGE_CURRENT_FRAME) &&
+                            (efra - sfra + 1 >= MOTIONPATH_PARALLEL_FRAMES_MIN) &&
+                            (BLI_system_thread_count() > 1);
+  if (use_parallel) {
+    /* Long ranges are split over disjoint sub-ranges evaluated on their own
+     * target-only depsgraph copies, the current frame of the original scene
+     * is never touched. */
+    motionpaths_calc_bake_parallel(
+        bmain, scene, DEG_get_input_view_layer(depsgraph), targets, sfra, efra);
+
+    /* The workers skip the evaluated-copy update (frees GPU batches), sync
+     * the finished paths here instead. */
+    LISTBASE_FOREACH (MPathTarget *, mpt, targets) {
+      motionpath_sync_eval_copy(mpt);
     }
+  }
+  else {
+    for (CFRA = sfra; CFRA <= efra; CFRA++) {
+      if (range == ANIMVIZ_CALC_RANGE_CURRENT_FRAME) {
+        /* For current frame, only update tagged. */
+        BKE_scene_graph_update_tagged(depsgraph, bmain);
+      }
+      else {
+        /* Update relevant data for new frame. */
+        motionpaths_calc_update_scene(depsgraph);
+      }
 
-    /* perform baking for targets */
-    motionpaths_calc_bake_targets(targets, CFRA);
+      /* perform baking for targets */
+      motionpaths_calc_bake_targets(targets, CFRA, true);
+    }
   }
 
   /* reset original environment */
@@ -112,6 +112,10 @@ struct EDBMUpdate_Params {
   uint calc_looptri : 1;
   uint calc_normals : 1;
   uint is_destructive : 1;
+  /** Set when the operator only moved selected vertices, allows normals & tessellation to be
+   * recalculated for the affected one-ring instead of the whole mesh. Must not be set when
+   * un-selected geometry may have been changed (X-mirror for example). */
+  uint changed_selected_verts_only : 1;
 };
 
 void EDBM_update(struct Mesh *me, const struct EDBMUpdate_Params *params);
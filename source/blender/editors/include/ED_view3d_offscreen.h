@@ -35,6 +35,7 @@ extern "C" {
 /* ********* exports for space_view3d/ module for offscreen rendering ********** */
 struct ARegion;
 struct Depsgraph;
+struct GPUFrameBufferReadback;
 struct GPUOffScreen;
 struct GPUViewport;
 struct Scene;
@@ -87,6 +88,7 @@ struct ImBuf *ED_view3d_draw_offscreen_imbuf(struct Depsgraph *depsgraph,
                                              const char *viewname,
                                              const bool restore_rv3d_mats,
                                              struct GPUOffScreen *ofs,
+                                             struct GPUFrameBufferReadback **r_readback,
                                              char err_out[256]);
 struct ImBuf *ED_view3d_draw_offscreen_imbuf_simple(struct Depsgraph *depsgraph,
                                                     struct Scene *scene,
@@ -8231,12 +8231,34 @@ static bool button_modal_state(uiHandleButtonState state)
               BUTTON_STATE_MENU_OPEN);
 }
 
+/**
+ * Tag only the button's screen rectangle for redraw. The rest of the region is
+ * composited from its retained buffer (see #wm_draw_window_offscreen), which
+ * avoids redrawing whole regions for hover highlights on large monitors.
+ *
+ * Only safe for changes that cannot affect other buttons or the layout.
+ */
+static void button_tag_redraw_partial(ARegion *region, uiBut *but)
+{
+  rctf rectf;
+  rcti rect;
+
+  ui_block_to_window_rctf(region, but->block, &rectf, &but->rect);
+  BLI_rcti_rctf_copy_round(&rect, &rectf);
+  /* Cover the outline and emboss shadow drawn just outside the button rect. */
+  const int pad = (int)(3.0f * U.pixelsize);
+  BLI_rcti_pad(&rect, pad, pad);
+
+  ED_region_tag_redraw_partial(region, &rect, false);
+}
+
 static void button_activate_state(bContext *C, uiBut *but, uiHandleButtonState state)
 {
   uiHandleButtonData *data = but->active;
   if (data->state == state) {
     return;
   }
+  const uiHandleButtonState state_prev = data->state;
 
   /* Highlight has timers for tool-tips and auto open. */
   if (state == BUTTON_STATE_HIGHLIGHT) {
@@ -8405,7 +8427,15 @@ static void button_activate_state(bContext *C, uiBut *but, uiHandleButtonState s
   }
 
   /* redraw */
-  ED_region_tag_redraw_no_rebuild(data->region);
+  if ((state == BUTTON_STATE_HIGHLIGHT) ||
+      (state == BUTTON_STATE_EXIT && state_prev == BUTTON_STATE_HIGHLIGHT)) {
+    /* Hover enter/exit only changes how this button is drawn,
+     * value changes reach other buttons through notifiers. */
+    button_tag_redraw_partial(data->region, but);
+  }
+  else {
+    ED_region_tag_redraw_no_rebuild(data->region);
+  }
 }
 
 static void button_activate_init(bContext *C,
@@ -8517,6 +8547,10 @@ static void button_activate_exit(
   wmWindow *win = data->window;
   uiBlock *block = but->block;
 
+  /* When exiting a merely hovered button the partial redraw tag from
+   * #button_activate_state is enough, don't upgrade it to a full redraw. */
+  const bool was_highlight_only = (data->state == BUTTON_STATE_HIGHLIGHT);
+
   if (but->type == UI_BTYPE_GRIP) {
     WM_cursor_modal_restore(win);
   }
@@ -8616,7 +8650,12 @@ static void button_activate_exit(
   }
 
   /* redraw and refresh (for popups) */
-  ED_region_tag_redraw_no_rebuild(data->region);
+  if (was_highlight_only) {
+    button_tag_redraw_partial(data->region, but);
+  }
+  else {
+    ED_region_tag_redraw_no_rebuild(data->region);
+  }
   ED_region_tag_refresh_ui(data->region);
 
   if ((but->flag & UI_BUT_DRAG_MULTI) == 0) {
@@ -183,6 +183,14 @@ typedef struct KnifeTool_OpData {
 
   BMBVHTree *bmbvh;
 
+  /**
+   * Cached #point_is_visible results per vertex. Vertex visibility only depends on the
+   * view, so entries stay valid until navigation changes the projection
+   * (see #knife_recalc_projmat), instead of re-casting occlusion rays for the same
+   * candidate vertices on every mouse move while dragging a cut. Lazily created.
+   */
+  GHash *vert_visibility_cache;
+
   BLI_mempool *kverts;
   BLI_mempool *kedges;
 
@@ -628,7 +636,15 @@ static bool knife_verts_edge_in_face(KnifeVert *v1, KnifeVert *v2, BMFace *f)
 
 static void knife_recalc_projmat(KnifeTool_OpData *kcd)
 {
+  float projmat_prev[4][4];
+  copy_m4_m4(projmat_prev, kcd->projmat);
+
   ED_view3d_ob_project_mat_get(kcd->region->regiondata, kcd->ob, kcd->projmat);
+
+  /* Vertex visibility depends on the view, drop the cache on navigation. */
+  if (kcd->vert_visibility_cache && !equals_m4m4(projmat_prev, kcd->projmat)) {
+    BLI_ghash_clear(kcd->vert_visibility_cache, NULL, NULL);
+  }
   invert_m4_m4(kcd->projmat_inv, kcd->projmat);
 
   invert_m4_m4_safe_ortho(kcd->ob_imat, kcd->ob->obmat);
@@ -1798,6 +1814,26 @@ static bool point_is_visible(KnifeTool_OpData *kcd,
   return true;
 }
 
+/**
+ * #point_is_visible for a vertex, caching the result in #KnifeTool_OpData.vert_visibility_cache
+ * so repeated queries for the same candidate vertices (every mouse move while dragging a cut)
+ * don't re-cast their occlusion rays.
+ */
+static bool knife_vert_is_visible_cached(KnifeTool_OpData *kcd,
+                                         KnifeVert *kfv,
+                                         const float s[2],
+                                         BMElem *ele_test)
+{
+  if (kcd->vert_visibility_cache == NULL) {
+    kcd->vert_visibility_cache = BLI_ghash_ptr_new(__func__);
+  }
+  void **val_p;
+  if (!BLI_ghash_ensure_p(kcd->vert_visibility_cache, kfv, &val_p)) {
+    *val_p = POINTER_FROM_INT(point_is_visible(kcd, kfv->cageco, s, ele_test));
+  }
+  return POINTER_AS_INT(*val_p) != 0;
+}
+
 /* Clip the line (v1, v2) to planes perpendicular to it and distances d from
  * the closest point on the line to the origin */
 static void clip_to_ortho_planes(float v1[3], float v2[3], const float center[3], const float d)
@@ -1991,7 +2027,7 @@ static void knife_find_line_hits(KnifeTool_OpData *kcd)
       knife_project_v2(kcd, v->cageco, s);
       float d = dist_squared_to_line_segment_v2(s, s1, s2);
       if ((d <= vert_tol_sq) &&
-          (point_is_visible(kcd, v->cageco, s, bm_elem_from_knife_vert(v, &kfe_hit)))) {
+          (knife_vert_is_visible_cached(kcd, v, s, bm_elem_from_knife_vert(v, &kfe_hit)))) {
         kfv_is_in_cut = true;
       }
     }
@@ -2716,6 +2752,9 @@ static void knifetool_exit_ex(bContext *C, KnifeTool_OpData *kcd)
   BLI_ghash_free(kcd->origvertmap, NULL, NULL);
   BLI_ghash_free(kcd->kedgefacemap, NULL, NULL);
   BLI_ghash_free(kcd->facetrimap, NULL, NULL);
+  if (kcd->vert_visibility_cache) {
+    BLI_ghash_free(kcd->vert_visibility_cache, NULL, NULL);
+  }
 
   BLI_memarena_free(kcd->arena);
 #ifdef USE_NET_ISLAND_CONNECT
@@ -2943,6 +2982,10 @@ static int knifetool_modal(bContext *C, wmOperator *op, const wmEvent *event)
         break;
       case KNF_MODAL_CUT_THROUGH_TOGGLE:
         kcd->cut_through = !kcd->cut_through;
+        /* Cached visibility results are no longer valid. */
+        if (kcd->vert_visibility_cache) {
+          BLI_ghash_clear(kcd->vert_visibility_cache, NULL, NULL);
+        }
         knife_update_header(C, op, kcd);
         do_refresh = true;
         break;
@@ -2704,6 +2704,9 @@ static int edbm_do_smooth_vertex_exec(bContext *C, wmOperator *op)
                     .calc_looptri = true,
                     .calc_normals = false,
                     .is_destructive = false,
+                    /* Mirror-apply moves un-selected vertices too. */
+                    .changed_selected_verts_only = (((Mesh *)obedit->data)->symmetry &
+                                                    ME_SYMMETRY_X) == 0,
                 });
   }
   MEM_freeN(objects);
@@ -2833,6 +2836,9 @@ static int edbm_do_smooth_laplacian_vertex_exec(bContext *C, wmOperator *op)
                     .calc_looptri = true,
                     .calc_normals = false,
                     .is_destructive = false,
+                    /* Mirror-apply moves un-selected vertices too. */
+                    .changed_selected_verts_only = (((Mesh *)obedit->data)->symmetry &
+                                                    ME_SYMMETRY_X) == 0,
                 });
   }
   MEM_freeN(objects);
@@ -6558,6 +6564,8 @@ enum {
   SRT_RANDOMIZE,
   /** Reverse current order of selected elements. */
   SRT_REVERSE,
+  /** Sort the whole mesh along a space filling curve for cache coherent access. */
+  SRT_SPATIAL,
 };
 
 typedef struct BMElemSort {
@@ -7074,6 +7082,18 @@ static int edbm_sort_elements_exec(bContext *C, wmOperator *op)
     BMEditMesh *em = BKE_editmesh_from_object(ob);
     BMesh *bm = em->bm;
 
+    /* Spatial sorting is a whole mesh cleanup, it ignores the selection & element types. */
+    if (action == SRT_SPATIAL) {
+      BM_mesh_elem_reorder_spatial(bm);
+      EDBM_update(ob->data,
+                  &(const struct EDBMUpdate_Params){
+                      .calc_looptri = true,
+                      .calc_normals = false,
+                      .is_destructive = true,
+                  });
+      continue;
+    }
+
     if (!((elem_types & BM_VERT && bm->totvertsel > 0) ||
           (elem_types & BM_EDGE && bm->totedgesel > 0) ||
           (elem_types & BM_FACE && bm->totfacesel > 0))) {
@@ -7109,9 +7129,17 @@ static bool edbm_sort_elements_poll_property(const bContext *UNUSED(C),
     return false;
   }
 
-  /* Hide seed for reverse and randomize actions! */
+  /* Hide seed for reverse, randomize and spatial actions! */
   if (STREQ(prop_id, "reverse")) {
-    if (ELEM(action, SRT_RANDOMIZE, SRT_REVERSE)) {
+    if (ELEM(action, SRT_RANDOMIZE, SRT_REVERSE, SRT_SPATIAL)) {
+      return false;
+    }
+    return true;
+  }
+
+  /* Spatial sorting always affects the whole mesh. */
+  if (STREQ(prop_id, "elements")) {
+    if (action == SRT_SPATIAL) {
       return false;
     }
     return true;
@@ -7151,6 +7179,12 @@ void MESH_OT_sort_elements(wmOperatorType *ot)
        "Warning: This will affect unselected elements' indices as well"},
       {SRT_RANDOMIZE, "RANDOMIZE", 0, "Randomize", "Randomize order of selected elements"},
       {SRT_REVERSE, "REVERSE", 0, "Reverse", "Reverse current order of selected elements"},
+      {SRT_SPATIAL,
+       "SPATIAL",
+       0,
+       "Spatial",
+       "Sort the entire mesh along a space filling curve, "
+       "improving memory access patterns of tools & modifiers"},
       {0, NULL, 0, NULL, NULL},
   };
 
@@ -28,8 +28,8 @@
 #include "DNA_object_types.h"
 
 #include "BLI_alloca.h"
+#include "BLI_bitmap.h"
 #include "BLI_buffer.h"
-#include "BLI_kdtree.h"
 #include "BLI_listbase.h"
 #include "BLI_math.h"
 
@@ -1022,6 +1022,12 @@ static BMVert *cache_mirr_intptr_as_bmvert(const intptr_t *index_lookup, int ind
  * preference */
 #define BM_SEARCH_MAXDIST_MIRR 0.00002f
 #define BM_CD_LAYER_ID "__mirror_index"
+
+static bool editmesh_mirr_vert_is_visible_cb(BMVert *v, void *UNUSED(user_data))
+{
+  return !BM_elem_flag_test_bool(v, BM_ELEM_HIDDEN);
+}
+
 /**
  * \param em: Editmesh.
  * \param use_self: Allow a vertex to point to its self (middle verts).
@@ -1047,10 +1053,7 @@ void EDBM_verts_mirror_cache_begin_ex(BMEditMesh *em,
   BMVert *v;
   int cd_vmirr_offset = 0;
   int i;
-  const float maxdist_sq = square_f(maxdist);
 
-  /* one or the other is used depending if topo is enabled */
-  KDTree_3d *tree = NULL;
   MirrTopoStore_t mesh_topo_store = {NULL, -1, -1, -1};
 
   BM_mesh_elem_table_ensure(bm, BM_VERT);
@@ -1077,15 +1080,9 @@ void EDBM_verts_mirror_cache_begin_ex(BMEditMesh *em,
     ED_mesh_mirrtopo_init(em, NULL, &mesh_topo_store, true);
   }
   else {
-    tree = BLI_kdtree_3d_new(bm->totvert);
-    BM_ITER_MESH_INDEX (v, &iter, bm, BM_VERTS_OF_MESH, i) {
-      if (respecthide && BM_elem_flag_test(v, BM_ELEM_HIDDEN)) {
-        continue;
-      }
-
-      BLI_kdtree_3d_insert(tree, i, v->co);
-    }
-    BLI_kdtree_3d_balance(tree);
+    /* The cache persists across operations (see #BKE_editmesh_spatial_cache_ensure),
+     * hidden vertices are skipped at lookup time instead of at build time. */
+    BKE_editmesh_spatial_cache_ensure(em, maxdist);
   }
 
 #define VERT_INTPTR(_v, _i) (r_index ? &r_index[_i] : BM_ELEM_CD_GET_VOID_P(_v, cd_vmirr_offset))
@@ -1112,19 +1109,12 @@ void EDBM_verts_mirror_cache_begin_ex(BMEditMesh *em,
       }
     }
     else {
-      int i_mirr;
       float co[3];
       copy_v3_v3(co, v->co);
       co[axis] *= -1.0f;
 
-      v_mirr = NULL;
-      i_mirr = BLI_kdtree_3d_find_nearest(tree, co, NULL);
-      if (i_mirr != -1) {
-        BMVert *v_test = BM_vert_at_index(bm, i_mirr);
-        if (len_squared_v3v3(co, v_test->co) < maxdist_sq) {
-          v_mirr = v_test;
-        }
-      }
+      v_mirr = BKE_editmesh_spatial_cache_find_nearest(
+          em, co, maxdist, respecthide ? editmesh_mirr_vert_is_visible_cb : NULL, NULL);
     }
 
     if (v_mirr && (use_self || (v_mirr != v))) {
@@ -1143,9 +1133,6 @@ void EDBM_verts_mirror_cache_begin_ex(BMEditMesh *em,
   if (use_topology) {
     ED_mesh_mirrtopo_free(&mesh_topo_store);
   }
-  else {
-    BLI_kdtree_3d_free(tree);
-  }
 }
 
 void EDBM_verts_mirror_cache_begin(BMEditMesh *em,
@@ -1423,20 +1410,75 @@ void EDBM_update(Mesh *mesh, const struct EDBMUpdate_Params *params)
   DEG_id_tag_update(&mesh->id, ID_RECALC_GEOMETRY);
   WM_main_add_notifier(NC_GEOM | ND_DATA, &mesh->id);
 
+  /* When only selected vertices were moved, limit normal & tessellation updates to the
+   * faces connected to them instead of walking the entire mesh, see: #BMPartialUpdate.
+   * Skip the partial logic when most of the mesh is selected as creating the partial data
+   * wont pay off, the threshold matches transforms partial update behavior. */
+  BMPartialUpdate *bmpinfo = NULL;
+  if (params->changed_selected_verts_only && (params->calc_normals || params->calc_looptri) &&
+      !params->is_destructive && (em->bm->totvertsel * 2 < em->bm->totvert)) {
+    BMesh *bm = em->bm;
+    BLI_bitmap *verts_mask = BLI_BITMAP_NEW((size_t)bm->totvert, __func__);
+    BMVert *v;
+    BMIter iter;
+    int i;
+    BM_ITER_MESH_INDEX (v, &iter, bm, BM_VERTS_OF_MESH, i) {
+      if (BM_elem_flag_test(v, BM_ELEM_SELECT)) {
+        BLI_BITMAP_ENABLE(verts_mask, i);
+      }
+    }
+    bmpinfo = BM_mesh_partial_create_from_verts(bm,
+                                                &(BMPartialUpdate_Params){
+                                                    .do_normals = params->calc_normals,
+                                                    .do_tessellate = params->calc_looptri,
+                                                },
+                                                verts_mask,
+                                                bm->totvertsel);
+    MEM_freeN(verts_mask);
+  }
+
   if (params->calc_normals && params->calc_looptri) {
     /* Calculating both has some performance gains. */
-    BKE_editmesh_looptri_and_normals_calc(em);
+    if (bmpinfo) {
+      BKE_editmesh_looptri_and_normals_calc_with_partial(em, bmpinfo);
+    }
+    else {
+      BKE_editmesh_looptri_and_normals_calc(em);
+    }
   }
   else {
     if (params->calc_normals) {
-      EDBM_mesh_normals_update(em);
+      if (bmpinfo) {
+        BM_mesh_normals_update_with_partial(em->bm, bmpinfo);
+      }
+      else {
+        EDBM_mesh_normals_update(em);
+      }
     }
 
     if (params->calc_looptri) {
-      BKE_editmesh_looptri_calc(em);
+      if (bmpinfo) {
+        BKE_editmesh_looptri_calc_with_partial(em, bmpinfo);
+      }
+      else {
+        BKE_editmesh_looptri_calc(em);
+      }
     }
   }
 
+  /* The vertex spatial cache survives only moves that are tracked by a partial update set,
+   * anything else may have changed coordinates or topology arbitrarily. */
+  if (bmpinfo) {
+    BKE_editmesh_spatial_cache_update_verts(em, bmpinfo);
+  }
+  else {
+    BKE_editmesh_spatial_cache_free(em);
+  }
+
+  if (bmpinfo) {
+    BM_mesh_partial_destroy(bmpinfo);
+  }
+
   if (params->is_destructive) {
     /* TODO(campbell): we may be able to remove this now! */
     // BM_mesh_elem_table_free(em->bm, BM_ALL_NOLOOP);
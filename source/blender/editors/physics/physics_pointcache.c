@@ -187,6 +187,30 @@ static void ptcache_free_bake(PointCache *cache)
   }
 }
 
+/* Optional frame sub-range, mainly for scripts distributing one bake over several
+ * background instances which share the same disk cache directory. */
+static void ptcache_bake_range_props(wmOperatorType *ot)
+{
+  RNA_def_int(ot->srna,
+              "start_frame",
+              0,
+              0,
+              MAXFRAME,
+              "Start Frame",
+              "First frame to bake (0 to use the cache start frame)",
+              0,
+              MAXFRAME);
+  RNA_def_int(ot->srna,
+              "end_frame",
+              0,
+              0,
+              MAXFRAME,
+              "End Frame",
+              "Last frame to bake (0 to use the cache end frame)",
+              0,
+              MAXFRAME);
+}
+
 static PTCacheBaker *ptcache_baker_create(bContext *C, wmOperator *op, bool all)
 {
   PTCacheBaker *baker = MEM_callocN(sizeof(PTCacheBaker), "PTCacheBaker");
@@ -200,6 +224,8 @@ static PTCacheBaker *ptcache_baker_create(bContext *C, wmOperator *op, bool all)
   baker->render = 0;
   baker->anim_init = 0;
   baker->quick_step = 1;
+  baker->range_startframe = RNA_int_get(op->ptr, "start_frame");
+  baker->range_endframe = RNA_int_get(op->ptr, "end_frame");
 
   if (!all) {
     PointerRNA ptr = CTX_data_pointer_get_type(C, "point_cache", &RNA_PointCache);
@@ -318,6 +344,7 @@ void PTCACHE_OT_bake_all(wmOperatorType *ot)
   ot->flag = OPTYPE_REGISTER | OPTYPE_UNDO;
 
   RNA_def_boolean(ot->srna, "bake", 1, "Bake", "");
+  ptcache_bake_range_props(ot);
 }
 void PTCACHE_OT_free_bake_all(wmOperatorType *ot)
 {
@@ -376,6 +403,7 @@ void PTCACHE_OT_bake(wmOperatorType *ot)
   ot->flag = OPTYPE_REGISTER | OPTYPE_UNDO;
 
   RNA_def_boolean(ot->srna, "bake", 0, "Bake", "");
+  ptcache_bake_range_props(ot);
 }
 void PTCACHE_OT_free_bake(wmOperatorType *ot)
 {
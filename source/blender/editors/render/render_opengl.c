@@ -134,6 +134,17 @@ typedef struct OGLRender {
   /* For only rendering frames that have a key in animation data. */
   BLI_bitmap *render_frames;
 
+  /* Asynchronous GPU readback of the last rendered frame (animation only). While the scene
+   * updates and renders the next frame, the pixels of the previous one are still being
+   * transferred. #screen_opengl_render_pending_flush() completes the transfer and schedules
+   * the frame for writing. */
+  struct {
+    GPUFrameBufferReadback *readback;
+    ImBuf *ibuf;
+    Object *camera; /* Only for the stamp info. */
+    int cfra;
+  } pending;
+
   /* quick lookup */
   int view_id;
 
@@ -284,6 +295,23 @@ static void screen_opengl_views_setup(OGLRender *oglrender)
   RE_ReleaseResult(oglrender->re);
 }
 
+/**
+ * True when frames are read back from the GPU asynchronously, one frame behind the rendering.
+ *
+ * Only the common single view viewport case is pipelined: multi-view would need one transfer
+ * in flight per view and the sequencer renders through its own cache, both keep the
+ * synchronous path. Rendering without a view context goes through
+ * #ED_view3d_draw_offscreen_imbuf_simple, which is also used as a callback with a fixed
+ * signature and so has no readback handle.
+ */
+static bool screen_opengl_render_use_async_readback(const OGLRender *oglrender)
+{
+  return oglrender->is_animation && !oglrender->is_sequencer && (oglrender->views_len == 1) &&
+         (oglrender->v3d != NULL);
+}
+
+static bool screen_opengl_render_pending_flush(OGLRender *oglrender);
+
 static void screen_opengl_render_doit(const bContext *C, OGLRender *oglrender, RenderResult *rr)
 {
   Depsgraph *depsgraph = CTX_data_ensure_evaluated_depsgraph(C);
@@ -300,6 +328,7 @@ static void screen_opengl_render_doit(const bContext *C, OGLRender *oglrender, R
   uchar *rect = NULL;
   const char *viewname = RE_GetActiveRenderView(oglrender->re);
   ImBuf *ibuf_result = NULL;
+  GPUFrameBufferReadback *readback = NULL;
 
   if (oglrender->is_sequencer) {
     SpaceSeq *sseq = oglrender->sseq;
@@ -382,6 +411,10 @@ static void screen_opengl_render_doit(const bContext *C, OGLRender *oglrender, R
                                                  viewname,
                                                  true,
                                                  oglrender->ofs,
+                                                 screen_opengl_render_use_async_readback(
+                                                     oglrender) ?
+                                                     &readback :
+                                                     NULL,
                                                  err_out);
 
       /* for stamp only */
@@ -421,11 +454,23 @@ static void screen_opengl_render_doit(const bContext *C, OGLRender *oglrender, R
   }
 
   if (ibuf_result != NULL) {
-    if ((scene->r.stamp & R_STAMP_ALL) && (scene->r.stamp & R_STAMP_DRAW)) {
-      BKE_image_stamp_buf(scene, camera, NULL, rect, rectf, rr->rectx, rr->recty, 4);
+    if (readback != NULL) {
+      /* Pipelined: the pixel transfer of this frame overlaps the scene update and draw
+       * submission of the next one. Stamping, copying into the render result and
+       * scheduling the write all happen when the readback is resolved. */
+      BLI_assert(oglrender->pending.readback == NULL);
+      oglrender->pending.readback = readback;
+      oglrender->pending.ibuf = ibuf_result;
+      oglrender->pending.camera = camera;
+      oglrender->pending.cfra = scene->r.cfra;
+    }
+    else {
+      if ((scene->r.stamp & R_STAMP_ALL) && (scene->r.stamp & R_STAMP_DRAW)) {
+        BKE_image_stamp_buf(scene, camera, NULL, rect, rectf, rr->rectx, rr->recty, 4);
+      }
+      RE_render_result_rect_from_ibuf(rr, &scene->r, ibuf_result, oglrender->view_id);
+      IMB_freeImBuf(ibuf_result);
     }
-    RE_render_result_rect_from_ibuf(rr, &scene->r, ibuf_result, oglrender->view_id);
-    IMB_freeImBuf(ibuf_result);
   }
 }
 
@@ -886,6 +931,9 @@ static void screen_opengl_render_end(bContext *C, OGLRender *oglrender)
   int i;
 
   if (oglrender->is_animation) {
+    /* The last rendered frame may still have its readback in flight. */
+    screen_opengl_render_pending_flush(oglrender);
+
     /* Trickery part for movie output:
      *
      * We MUST write frames in an exact order, so we only let background
@@ -1099,7 +1147,7 @@ static void write_result_func(TaskPool *__restrict pool, void *task_data_v)
   BLI_mutex_unlock(&oglrender->task_mutex);
 }
 
-static bool schedule_write_result(OGLRender *oglrender, RenderResult *rr)
+static bool schedule_write_result(OGLRender *oglrender, RenderResult *rr, const int cfra)
 {
   if (!oglrender->pool_ok) {
     RE_FreeRenderResult(rr);
@@ -1109,6 +1157,9 @@ static bool schedule_write_result(OGLRender *oglrender, RenderResult *rr)
   WriteTaskData *task_data = MEM_mallocN(sizeof(WriteTaskData), "write task data");
   task_data->rr = rr;
   task_data->tmp_scene = *scene;
+  /* With asynchronous readback the frame is scheduled one step after it was rendered, when
+   * the scene has already moved on to the next frame. */
+  task_data->tmp_scene.r.cfra = cfra;
   BLI_mutex_lock(&oglrender->task_mutex);
   oglrender->num_scheduled_frames++;
   if (oglrender->num_scheduled_frames > MAX_SCHEDULED_FRAMES) {
@@ -1119,6 +1170,52 @@ static bool schedule_write_result(OGLRender *oglrender, RenderResult *rr)
   return true;
 }
 
+/**
+ * Complete the asynchronous readback of the previously rendered frame (if any), copy it into
+ * the render result and schedule it for writing. Returns false when the write pool failed.
+ */
+static bool screen_opengl_render_pending_flush(OGLRender *oglrender)
+{
+  Scene *scene = oglrender->scene;
+
+  if (oglrender->pending.readback == NULL) {
+    return true;
+  }
+
+  GPUFrameBufferReadback *readback = oglrender->pending.readback;
+  ImBuf *ibuf = oglrender->pending.ibuf;
+  oglrender->pending.readback = NULL;
+  oglrender->pending.ibuf = NULL;
+
+  DRW_opengl_context_enable();
+  GPU_framebuffer_readback_result_get(
+      readback, ibuf->rect_float ? (void *)ibuf->rect_float : (void *)ibuf->rect);
+  DRW_opengl_context_disable();
+
+  if (ibuf->rect_float && ibuf->rect) {
+    IMB_rect_from_float(ibuf);
+  }
+
+  if ((scene->r.stamp & R_STAMP_ALL) && (scene->r.stamp & R_STAMP_DRAW)) {
+    BKE_image_stamp_buf(scene,
+                        oglrender->pending.camera,
+                        NULL,
+                        (uchar *)ibuf->rect,
+                        ibuf->rect_float,
+                        ibuf->x,
+                        ibuf->y,
+                        4);
+  }
+
+  RenderResult *rr = RE_AcquireResultRead(oglrender->re);
+  RE_render_result_rect_from_ibuf(rr, &scene->r, ibuf, 0);
+  RenderResult *new_rr = RE_DuplicateRenderResult(rr);
+  RE_ReleaseResult(oglrender->re);
+  IMB_freeImBuf(ibuf);
+
+  return schedule_write_result(oglrender, new_rr, oglrender->pending.cfra);
+}
+
 static bool screen_opengl_render_anim_step(bContext *C, wmOperator *op)
 {
   OGLRender *oglrender = op->customdata;
@@ -1178,18 +1275,36 @@ static bool screen_opengl_render_anim_step(bContext *C, wmOperator *op)
     BKE_scene_camera_switch_update(scene);
   }
 
+  const bool use_async_readback = screen_opengl_render_use_async_readback(oglrender);
+  bool is_rendered = false;
+
+  if (use_async_readback) {
+    /* Write the previously rendered frame: its pixel transfer has been running on the GPU
+     * timeline while the scene was updated for the new frame above. */
+    ok = screen_opengl_render_pending_flush(oglrender);
+  }
+  else {
+    ok = true;
+  }
+
   if (oglrender->render_frames == NULL ||
       BLI_BITMAP_TEST_BOOL(oglrender->render_frames, CFRA - PSFRA)) {
     /* render into offscreen buffer */
     screen_opengl_render_apply(C, oglrender);
+    is_rendered = true;
   }
 
   /* save to disk */
-  rr = RE_AcquireResultRead(oglrender->re);
-  RenderResult *new_rr = RE_DuplicateRenderResult(rr);
-  RE_ReleaseResult(oglrender->re);
-
-  ok = schedule_write_result(oglrender, new_rr);
+  if (!use_async_readback || !is_rendered) {
+    /* Either the synchronous path, or a frame skipped by "render keyed only": the latter
+     * re-writes the last resolved frame under the current frame number. A rendered frame on
+     * the asynchronous path is scheduled by the flush above on the next step instead. */
+    rr = RE_AcquireResultRead(oglrender->re);
+    RenderResult *new_rr = RE_DuplicateRenderResult(rr);
+    RE_ReleaseResult(oglrender->re);
+
+    ok = schedule_write_result(oglrender, new_rr, CFRA) && ok;
+  }
 
 finally: /* Step the frame and bail early if needed */
 
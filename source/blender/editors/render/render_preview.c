@@ -102,10 +102,7 @@
 #include "ED_view3d.h"
 #include "ED_view3d_offscreen.h"
 
-#ifndef NDEBUG
-/* Used for database init assert(). */
-#  include "BLI_threads.h"
-#endif
+#include "BLI_threads.h"
 
 static void icon_copy_rect(ImBuf *ibuf, uint w, uint h, uint *rect);
 
@@ -136,6 +133,9 @@ typedef struct ShaderPreview {
   uint *pr_rect;
   int pr_method;
   bool own_id_copy;
+  /* Whether the preview Main was acquired for this job (and should be released with it), or is
+   * borrowed from the owning #IconPreview. */
+  bool own_pr_main;
 
   Main *bmain;
   Main *pr_main;
@@ -149,6 +149,9 @@ typedef struct IconPreviewSize {
 
 typedef struct IconPreview {
   Main *bmain;
+  /* Copy of the preview datablocks Main, acquired from the preview Main pool for ID types that
+   * render through #ShaderPreview. May be NULL. */
+  Main *pr_main;
   Depsgraph *depsgraph; /* May be NULL (see #WM_OT_previews_ensure). */
   Scene *scene;
   void *owner;
@@ -166,8 +169,21 @@ typedef struct IconPreview {
 /** \name Preview for Buttons
  * \{ */
 
-static Main *G_pr_main = NULL;
-static Main *G_pr_main_grease_pencil = NULL;
+/**
+ * Pool of preview "Mains", each loaded from one of the embedded preview .blend files. Rendering
+ * a preview mutates its Main (the ID copy is linked into it and scene settings are changed), so
+ * every preview job in flight needs its own copy. Entries are recycled once the job holding them
+ * is freed, so batch-refreshing many previews does not reload the preview .blend per request.
+ */
+typedef struct PreviewMainEntry {
+  struct PreviewMainEntry *next, *prev;
+  Main *pr_main;
+  bool is_grease_pencil;
+  bool in_use;
+} PreviewMainEntry;
+
+static ListBase G_pr_main_pool = {NULL, NULL};
+static ThreadMutex G_pr_main_pool_mutex = BLI_MUTEX_INITIALIZER;
 
 #ifndef WITH_HEADLESS
 static Main *load_main_from_memory(const void *blend, int blend_size)
@@ -189,15 +205,94 @@ static Main *load_main_from_memory(const void *blend, int blend_size)
 }
 #endif
 
+/**
+ * Get an unused preview Main from the pool, loading a fresh copy of the embedded preview .blend
+ * when all pooled copies are held by jobs. Loading the .blend is not thread-safe, so acquiring is
+ * restricted to the main thread: jobs acquire their Main when they are queued and release it from
+ * their free callback.
+ */
+static Main *preview_main_pool_acquire(const bool is_grease_pencil)
+{
+  BLI_assert(BLI_thread_is_main());
+
+  PreviewMainEntry *entry;
+
+  BLI_mutex_lock(&G_pr_main_pool_mutex);
+
+  for (entry = G_pr_main_pool.first; entry; entry = entry->next) {
+    if (!entry->in_use && (entry->is_grease_pencil == is_grease_pencil)) {
+      break;
+    }
+  }
+
+#ifndef WITH_HEADLESS
+  if (entry == NULL) {
+    Main *pr_main = is_grease_pencil ?
+                        load_main_from_memory(datatoc_preview_grease_pencil_blend,
+                                              datatoc_preview_grease_pencil_blend_size) :
+                        load_main_from_memory(datatoc_preview_blend, datatoc_preview_blend_size);
+    if (pr_main != NULL) {
+      entry = MEM_callocN(sizeof(PreviewMainEntry), "PreviewMainEntry");
+      entry->pr_main = pr_main;
+      entry->is_grease_pencil = is_grease_pencil;
+      BLI_addtail(&G_pr_main_pool, entry);
+    }
+  }
+#endif
+
+  Main *pr_main = NULL;
+  if (entry != NULL) {
+    entry->in_use = true;
+    pr_main = entry->pr_main;
+  }
+
+  BLI_mutex_unlock(&G_pr_main_pool_mutex);
+
+  return pr_main;
+}
+
+static void preview_main_pool_release(Main *pr_main)
+{
+  if (pr_main == NULL) {
+    return;
+  }
+
+  BLI_mutex_lock(&G_pr_main_pool_mutex);
+  LISTBASE_FOREACH (PreviewMainEntry *, entry, &G_pr_main_pool) {
+    if (entry->pr_main == pr_main) {
+      BLI_assert(entry->in_use);
+      entry->in_use = false;
+      break;
+    }
+  }
+  BLI_mutex_unlock(&G_pr_main_pool_mutex);
+}
+
+static bool preview_main_pool_is_grease_pencil(const Main *pr_main)
+{
+  bool is_grease_pencil = false;
+
+  BLI_mutex_lock(&G_pr_main_pool_mutex);
+  LISTBASE_FOREACH (PreviewMainEntry *, entry, &G_pr_main_pool) {
+    if (entry->pr_main == pr_main) {
+      is_grease_pencil = entry->is_grease_pencil;
+      break;
+    }
+  }
+  BLI_mutex_unlock(&G_pr_main_pool_mutex);
+
+  return is_grease_pencil;
+}
+
 void ED_preview_ensure_dbase(void)
 {
 #ifndef WITH_HEADLESS
   static bool base_initialized = false;
   BLI_assert(BLI_thread_is_main());
   if (!base_initialized) {
-    G_pr_main = load_main_from_memory(datatoc_preview_blend, datatoc_preview_blend_size);
-    G_pr_main_grease_pencil = load_main_from_memory(datatoc_preview_grease_pencil_blend,
-                                                    datatoc_preview_grease_pencil_blend_size);
+    /* Warm the pool with the common preview file, so the first queued preview does not pay for
+     * loading it. */
+    preview_main_pool_release(preview_main_pool_acquire(false));
     base_initialized = true;
   }
 #endif
@@ -216,13 +311,15 @@ static bool preview_method_is_render(int pr_method)
 
 void ED_preview_free_dbase(void)
 {
-  if (G_pr_main) {
-    BKE_main_free(G_pr_main);
-  }
+  PreviewMainEntry *entry;
 
-  if (G_pr_main_grease_pencil) {
-    BKE_main_free(G_pr_main_grease_pencil);
+  BLI_mutex_lock(&G_pr_main_pool_mutex);
+  while ((entry = BLI_pophead(&G_pr_main_pool))) {
+    BLI_assert(!entry->in_use);
+    BKE_main_free(entry->pr_main);
+    MEM_freeN(entry);
   }
+  BLI_mutex_unlock(&G_pr_main_pool_mutex);
 }
 
 static Scene *preview_get_scene(Main *pr_main)
@@ -469,7 +566,7 @@ static Scene *preview_prepare_scene(
 
         /* For grease pencil, always use sphere for icon renders. */
         const ePreviewType preview_type = (sp->pr_method == PR_ICON_RENDER &&
-                                           sp->pr_main == G_pr_main_grease_pencil) ?
+                                           preview_main_pool_is_grease_pencil(sp->pr_main)) ?
                                               MA_SPHERE_A :
                                               mat->pr_type;
         set_preview_visibility(sce, view_layer, preview_type, sp->pr_method);
@@ -1264,6 +1361,9 @@ static void shader_preview_free(void *customdata)
       preview_id_copy_free(sub_id_copy);
     }
   }
+  if (sp->own_pr_main) {
+    preview_main_pool_release(pr_main);
+  }
 
   MEM_freeN(sp);
 }
@@ -1527,22 +1627,14 @@ static void other_id_types_preview_render(IconPreview *ip,
   sp->id_copy = ip->id_copy;
   sp->bmain = ip->bmain;
   sp->own_id_copy = false;
-  Material *ma = NULL;
+  sp->own_pr_main = false;
 
   if (sp->pr_method == PR_ICON_RENDER) {
     BLI_assert(ip->id);
 
-    /* grease pencil use its own preview file */
-    if (GS(ip->id->name) == ID_MA) {
-      ma = (Material *)ip->id;
-    }
-
-    if ((ma == NULL) || (ma->gp_style == NULL)) {
-      sp->pr_main = G_pr_main;
-    }
-    else {
-      sp->pr_main = G_pr_main_grease_pencil;
-    }
+    /* Acquired when the job was queued, since the pool can only be accessed from the main
+     * thread. */
+    sp->pr_main = ip->pr_main;
   }
 
   common_preview_startjob(sp, stop, do_update, progress);
@@ -1697,11 +1789,27 @@ static void icon_preview_free(void *customdata)
   if (ip->id_copy) {
     preview_id_copy_free(ip->id_copy);
   }
+  preview_main_pool_release(ip->pr_main);
 
   BLI_freelistN(&ip->sizes);
   MEM_freeN(ip);
 }
 
+/**
+ * Acquire a preview Main for \a id when its type renders through #ShaderPreview. Has to happen
+ * when the job is queued, since the pool can only be accessed from the main thread.
+ */
+static Main *icon_preview_main_acquire(const ID *id)
+{
+  if ((id == NULL) || ELEM(GS(id->name), ID_OB, ID_AC)) {
+    /* These types render with their own scene, or load deferred thumbnails. */
+    return NULL;
+  }
+  /* Grease pencil materials use their own preview file. */
+  const Material *ma = (GS(id->name) == ID_MA) ? (const Material *)id : NULL;
+  return preview_main_pool_acquire((ma != NULL) && (ma->gp_style != NULL));
+}
+
 void ED_preview_icon_render(
     const bContext *C, Scene *scene, ID *id, uint *rect, int sizex, int sizey)
 {
@@ -1720,6 +1828,7 @@ void ED_preview_icon_render(
    * the ID to avoid thread races. */
   ip.id_copy = duplicate_ids(id, true);
   ip.active_object = CTX_data_active_object(C);
+  ip.pr_main = icon_preview_main_acquire(id);
 
   icon_preview_add_size(&ip, rect, sizex, sizey);
 
@@ -1731,6 +1840,7 @@ void ED_preview_icon_render(
   if (ip.id_copy != NULL) {
     preview_id_copy_free(ip.id_copy);
   }
+  preview_main_pool_release(ip.pr_main);
 }
 
 void ED_preview_icon_job(
@@ -1765,6 +1875,7 @@ void ED_preview_icon_job(
   ip->owner = owner;
   ip->id = id;
   ip->id_copy = duplicate_ids(id, false);
+  ip->pr_main = icon_preview_main_acquire(id);
 
   icon_preview_add_size(ip, rect, sizex, sizey);
 
@@ -1850,12 +1961,8 @@ void ED_preview_shader_job(const bContext *C,
     ma = (Material *)id;
   }
 
-  if ((ma == NULL) || (ma->gp_style == NULL)) {
-    sp->pr_main = G_pr_main;
-  }
-  else {
-    sp->pr_main = G_pr_main_grease_pencil;
-  }
+  sp->pr_main = preview_main_pool_acquire((ma != NULL) && (ma->gp_style != NULL));
+  sp->own_pr_main = true;
 
   if (ob && ob->totcol) {
     copy_v4_v4(sp->color, ob->color);
@@ -1140,12 +1140,14 @@ static void light_cache_bake_tag_cache(Scene *scene, wmOperator *op)
     switch (subset) {
       case LIGHTCACHE_SUBSET_ALL:
         scene->eevee.light_cache_data->flag |= LIGHTCACHE_UPDATE_GRID | LIGHTCACHE_UPDATE_CUBE;
+        EEVEE_lightcache_probe_tag_all(scene->eevee.light_cache_data, true, true);
         break;
       case LIGHTCACHE_SUBSET_CUBE:
         scene->eevee.light_cache_data->flag |= LIGHTCACHE_UPDATE_CUBE;
+        EEVEE_lightcache_probe_tag_all(scene->eevee.light_cache_data, false, true);
         break;
       case LIGHTCACHE_SUBSET_DIRTY:
-        /* Leave tag untouched. */
+        /* Leave tags untouched: only re-bake what has been tagged since the last bake. */
         break;
     }
   }
@@ -35,6 +35,7 @@
 #include "BLI_utildefines.h"
 
 #include "BKE_context.h"
+#include "BKE_fcurve.h"
 #include "BKE_global.h"
 #include "BKE_icons.h"
 #include "BKE_image.h"
@@ -1676,6 +1677,9 @@ void ED_screen_animation_timer(bContext *C, int redraws, int sync, int enable)
     stopscreen->animtimer = NULL;
   }
 
+  /* Baked F-Curve tables only live for the duration of playback. */
+  BKE_fcurve_bake_cache_set_enabled(enable != 0);
+
   if (enable) {
     ScreenAnimData *sad = MEM_callocN(sizeof(ScreenAnimData), "ScreenAnimData");
 
@@ -181,8 +181,18 @@ void imapaint_image_update(
     int w = imapaintpartial.x2 - imapaintpartial.x1;
     int h = imapaintpartial.y2 - imapaintpartial.y1;
     if (w && h) {
-      /* Testing with partial update in uv editor too */
-      BKE_image_update_gputexture(image, iuser, imapaintpartial.x1, imapaintpartial.y1, w, h);
+      if (texpaint && !BKE_image_has_multiple_ibufs(image)) {
+        /* Defer the GPU upload to the next draw: projection painting refreshes many small
+         * rectangles per stroke step and the delayed path accumulates overlapping ones into
+         * chunk sized areas that are uploaded once. The delayed flush only covers the first
+         * tile, so tiled/sequence images keep the immediate update. */
+        BKE_image_update_gputexture_delayed(
+            image, ibuf, imapaintpartial.x1, imapaintpartial.y1, w, h);
+      }
+      else {
+        /* Testing with partial update in uv editor too */
+        BKE_image_update_gputexture(image, iuser, imapaintpartial.x1, imapaintpartial.y1, w, h);
+      }
     }
   }
 }
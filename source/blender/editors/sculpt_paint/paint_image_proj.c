@@ -6254,6 +6254,7 @@ static int texture_paint_image_from_view_exec(bContext *C, wmOperator *op)
                                         NULL,
                                         false,
                                         NULL,
+                                        NULL,
                                         err_out);
 
   if (!ibuf) {
@@ -2160,6 +2160,8 @@ static void calculate_average_weight(SculptThreadedTaskData *data,
   MEM_SAFE_FREE(data->custom_data); /* 'accum' */
 }
 
+/* Applies the brush to the gathered PBVH leaf nodes, one task per node (the same fast path
+ * sculpt uses). Only X-mirrored vertex groups force a serial run, see below. */
 static void wpaint_paint_leaves(bContext *C,
                                 Object *ob,
                                 Sculpt *sd,
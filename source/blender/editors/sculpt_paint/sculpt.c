@@ -31,6 +31,7 @@
 #include "BLI_hash.h"
 #include "BLI_math.h"
 #include "BLI_math_color_blend.h"
+#include "BLI_simd.h"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
 
@@ -1697,6 +1698,72 @@ bool SCULPT_brush_test_sphere_sq(SculptBrushTest *test, const float co[3])
   return true;
 }
 
+/* Sphere test for four gathered vertices at once, with the distance math in
+ * SoA form so it runs as a single SIMD kernel. Accepted vertices get their
+ * squared distance stored in `r_dist_sq[index[k]]`, rejected ones FLT_MAX. */
+BLI_INLINE void sculpt_brush_test_sphere_sq_batch(SculptBrushTest *test,
+                                                  const float *co[4],
+                                                  const int index[4],
+                                                  const int count,
+                                                  float *r_dist_sq)
+{
+  float dist_sq[4];
+
+#ifdef BLI_HAVE_SSE2
+  if (count == 4) {
+    const __m128 dx = _mm_sub_ps(_mm_set_ps(co[3][0], co[2][0], co[1][0], co[0][0]),
+                                 _mm_set1_ps(test->location[0]));
+    const __m128 dy = _mm_sub_ps(_mm_set_ps(co[3][1], co[2][1], co[1][1], co[0][1]),
+                                 _mm_set1_ps(test->location[1]));
+    const __m128 dz = _mm_sub_ps(_mm_set_ps(co[3][2], co[2][2], co[1][2], co[0][2]),
+                                 _mm_set1_ps(test->location[2]));
+    _mm_storeu_ps(dist_sq,
+                  _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)),
+                             _mm_mul_ps(dz, dz)));
+  }
+  else
+#endif
+  {
+    for (int k = 0; k < count; k++) {
+      dist_sq[k] = len_squared_v3v3(co[k], test->location);
+    }
+  }
+
+  for (int k = 0; k < count; k++) {
+    if (dist_sq[k] <= test->radius_squared && !sculpt_brush_test_clipping(test, co[k])) {
+      r_dist_sq[index[k]] = dist_sq[k];
+    }
+    else {
+      r_dist_sq[index[k]] = FLT_MAX;
+    }
+  }
+}
+
+void SCULPT_brush_test_sphere_sq_gather(SculptSession *ss,
+                                        PBVHNode *node,
+                                        SculptBrushTest *test,
+                                        float *r_dist_sq)
+{
+  const float *batch_co[4];
+  int batch_index[4];
+  int batch_len = 0;
+  PBVHVertexIter vd;
+
+  BKE_pbvh_vertex_iter_begin (ss->pbvh, node, vd, PBVH_ITER_UNIQUE) {
+    batch_co[batch_len] = vd.co;
+    batch_index[batch_len] = vd.i;
+    if (++batch_len == 4) {
+      sculpt_brush_test_sphere_sq_batch(test, batch_co, batch_index, batch_len, r_dist_sq);
+      batch_len = 0;
+    }
+  }
+  BKE_pbvh_vertex_iter_end;
+
+  if (batch_len != 0) {
+    sculpt_brush_test_sphere_sq_batch(test, batch_co, batch_index, batch_len, r_dist_sq);
+  }
+}
+
 bool SCULPT_brush_test_sphere_fast(const SculptBrushTest *test, const float co[3])
 {
   if (sculpt_brush_test_clipping(test, co)) {
@@ -5059,8 +5126,24 @@ static void do_clay_brush_task_cb_ex(void *__restrict userdata,
 
   plane_from_point_normal_v3(test.plane_tool, area_co, area_no);
 
+  /* For the sphere falloff the distance test runs as a batched SIMD kernel
+   * ahead of the main loop. */
+  float *sphere_dist_sq = NULL;
+  if (data->brush->falloff_shape == PAINT_FALLOFF_SHAPE_SPHERE) {
+    int uniquevert;
+    BKE_pbvh_node_num_verts(ss->pbvh, data->nodes[n], &uniquevert, NULL);
+    sphere_dist_sq = MEM_mallocN(sizeof(float) * uniquevert, __func__);
+    SCULPT_brush_test_sphere_sq_gather(ss, data->nodes[n], &test, sphere_dist_sq);
+  }
+
   BKE_pbvh_vertex_iter_begin (ss->pbvh, data->nodes[n], vd, PBVH_ITER_UNIQUE) {
-    if (!sculpt_brush_test_sq_fn(&test, vd.co)) {
+    if (sphere_dist_sq) {
+      if (sphere_dist_sq[vd.i] == FLT_MAX) {
+        continue;
+      }
+      test.dist = sphere_dist_sq[vd.i];
+    }
+    else if (!sculpt_brush_test_sq_fn(&test, vd.co)) {
       continue;
     }
 
@@ -5087,6 +5170,8 @@ static void do_clay_brush_task_cb_ex(void *__restrict userdata,
     }
   }
   BKE_pbvh_vertex_iter_end;
+
+  MEM_SAFE_FREE(sphere_dist_sq);
 }
 
 static void do_clay_brush(Sculpt *sd, Object *ob, PBVHNode **nodes, int totnode)
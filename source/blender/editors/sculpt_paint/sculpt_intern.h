@@ -844,6 +844,13 @@ typedef struct {
 void SCULPT_brush_test_init(struct SculptSession *ss, SculptBrushTest *test);
 bool SCULPT_brush_test_sphere(SculptBrushTest *test, const float co[3]);
 bool SCULPT_brush_test_sphere_sq(SculptBrushTest *test, const float co[3]);
+/* Run #SCULPT_brush_test_sphere_sq over every vertex of the node in one SoA
+ * SIMD pass. `r_dist_sq` is indexed by the vertex iterator's `i` and holds the
+ * squared distance for accepted vertices, FLT_MAX for rejected ones. */
+void SCULPT_brush_test_sphere_sq_gather(struct SculptSession *ss,
+                                        PBVHNode *node,
+                                        SculptBrushTest *test,
+                                        float *r_dist_sq);
 bool SCULPT_brush_test_sphere_fast(const SculptBrushTest *test, const float co[3]);
 bool SCULPT_brush_test_cube(SculptBrushTest *test,
                             const float co[3],
@@ -311,8 +311,24 @@ static void do_smooth_brush_task_cb_ex(void *__restrict userdata,
 
   const int thread_id = BLI_task_parallel_thread_id(tls);
 
+  /* For the sphere falloff the distance test runs as a batched SIMD kernel
+   * ahead of the main loop. */
+  float *sphere_dist_sq = NULL;
+  if (data->brush->falloff_shape == PAINT_FALLOFF_SHAPE_SPHERE) {
+    int uniquevert;
+    BKE_pbvh_node_num_verts(ss->pbvh, data->nodes[n], &uniquevert, NULL);
+    sphere_dist_sq = MEM_mallocN(sizeof(float) * uniquevert, __func__);
+    SCULPT_brush_test_sphere_sq_gather(ss, data->nodes[n], &test, sphere_dist_sq);
+  }
+
   BKE_pbvh_vertex_iter_begin (ss->pbvh, data->nodes[n], vd, PBVH_ITER_UNIQUE) {
-    if (!sculpt_brush_test_sq_fn(&test, vd.co)) {
+    if (sphere_dist_sq) {
+      if (sphere_dist_sq[vd.i] == FLT_MAX) {
+        continue;
+      }
+      test.dist = sphere_dist_sq[vd.i];
+    }
+    else if (!sculpt_brush_test_sq_fn(&test, vd.co)) {
       continue;
     }
     const float fade = bstrength * SCULPT_brush_strength_factor(
@@ -343,6 +359,8 @@ static void do_smooth_brush_task_cb_ex(void *__restrict userdata,
     }
   }
   BKE_pbvh_vertex_iter_end;
+
+  MEM_SAFE_FREE(sphere_dist_sq);
 }
 
 void SCULPT_smooth(Sculpt *sd,
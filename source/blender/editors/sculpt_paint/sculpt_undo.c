@@ -1321,10 +1321,12 @@ SculptUndoNode *SCULPT_undo_push_node(Object *ob, PBVHNode *node, SculptUndoType
 
   unode = sculpt_undo_alloc_node(ob, node, type);
 
-  /* NOTE: If this ever becomes a bottleneck, make a lock inside of the node.
-   * so we release global lock sooner, but keep data locked for until it is
-   * fully initialized.
-   */
+  /* The global lock only guards the undo node list and size accounting. The
+   * copies below touch just this node's own storage and the PBVH node it
+   * snapshots, and each PBVH node is pushed by a single task, so release the
+   * lock and let the brush threads copy their nodes concurrently instead of
+   * serializing the stroke start on the sum of all copies. */
+  BLI_thread_unlock(LOCK_CUSTOM1);
 
   if (unode->grids) {
     int totgrid, *grids;
@@ -1373,8 +1375,6 @@ SculptUndoNode *SCULPT_undo_push_node(Object *ob, PBVHNode *node, SculptUndoType
     unode->shapeName[0] = '\0';
   }
 
-  BLI_thread_unlock(LOCK_CUSTOM1);
-
   return unode;
 }
 
@@ -1668,6 +1668,21 @@ static bool sculpt_undo_use_multires_mesh(bContext *C)
   return sculpt_session->multires.active;
 }
 
+typedef struct PushAllGridsData {
+  Object *object;
+  PBVHNode **nodes;
+} PushAllGridsData;
+
+static void sculpt_undo_push_all_grids_task_cb(void *__restrict userdata,
+                                               const int n,
+                                               const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  PushAllGridsData *data = userdata;
+
+  SculptUndoNode *unode = SCULPT_undo_push_node(data->object, data->nodes[n], SCULPT_UNDO_COORDS);
+  unode->node = NULL;
+}
+
 static void sculpt_undo_push_all_grids(Object *object)
 {
   SculptSession *ss = object->sculpt;
@@ -1686,10 +1701,13 @@ static void sculpt_undo_push_all_grids(Object *object)
   int totnodes;
 
   BKE_pbvh_search_gather(ss->pbvh, NULL, NULL, &nodes, &totnodes);
-  for (int i = 0; i < totnodes; i++) {
-    SculptUndoNode *unode = SCULPT_undo_push_node(object, nodes[i], SCULPT_UNDO_COORDS);
-    unode->node = NULL;
-  }
+
+  /* The pushes only serialize on the undo node list, the actual data copies
+   * run concurrently. */
+  PushAllGridsData data = {.object = object, .nodes = nodes};
+  TaskParallelSettings settings;
+  BKE_pbvh_parallel_range_settings(&settings, true, totnodes);
+  BLI_task_parallel_range(0, totnodes, &data, sculpt_undo_push_all_grids_task_cb, &settings);
 
   MEM_SAFE_FREE(nodes);
 }
@@ -656,12 +656,14 @@ typedef struct PrefetchJob {
   /* Clip into which cache the frames will be prefetched into. */
   MovieClip *clip;
 
-  /* Local copy of the clip which is used to decouple reading in a way which does not require
+  /* Local copies of the clip which are used to decouple reading in a way which does not require
    * threading lock which might "conflict" with the main thread,
    *
    * Used, for example, for animation prefetching (`clip->anim` can not be used from multiple
-   * threads and main thread might need it). */
-  MovieClip *clip_local;
+   * threads and main thread might need it). Every prefetch stream decodes through its own copy:
+   * one reads forward from the current frame, the other reads backward. */
+  MovieClip *clip_local_forward;
+  MovieClip *clip_local_backward;
 
   int start_frame, current_frame, end_frame;
   short render_size, render_flag;
@@ -956,8 +958,65 @@ static bool prefetch_movie_frame(MovieClip *clip,
   return true;
 }
 
+typedef struct PrefetchMovieQueue {
+  short render_size, render_flag;
+
+  SpinLock spin;
+
+  int frames_processed;
+  int total_frames;
+
+  short *stop;
+  short *do_update;
+  float *progress;
+} PrefetchMovieQueue;
+
+typedef struct PrefetchMovieStream {
+  /* Clip owning the cache the prefetched frames are put into. */
+  MovieClip *clip;
+  /* Stream-local clip copy, so every stream decodes through its own animation handle. */
+  MovieClip *clip_local;
+  /* Inclusive frame range, decoded from `from_frame` towards `to_frame`. */
+  int from_frame, to_frame;
+} PrefetchMovieStream;
+
+/* Sequentially decode a frame range of the movie into the cache, direction given by the range
+ * order of the stream. */
+static void prefetch_movie_stream_task_func(TaskPool *__restrict pool, void *task_data)
+{
+  PrefetchMovieQueue *queue = (PrefetchMovieQueue *)BLI_task_pool_user_data(pool);
+  PrefetchMovieStream *stream = (PrefetchMovieStream *)task_data;
+  const int direction = (stream->to_frame >= stream->from_frame) ? 1 : -1;
+
+  for (int frame = stream->from_frame;; frame += direction) {
+    if (!prefetch_movie_frame(stream->clip,
+                              stream->clip_local,
+                              frame,
+                              queue->render_size,
+                              queue->render_flag,
+                              queue->stop)) {
+      return;
+    }
+
+    BLI_spin_lock(&queue->spin);
+    queue->frames_processed++;
+    *queue->do_update = 1;
+    *queue->progress = (float)queue->frames_processed / queue->total_frames;
+    BLI_spin_unlock(&queue->spin);
+
+    if (frame == stream->to_frame) {
+      return;
+    }
+  }
+}
+
+/* Decode the movie into the cache using two streams: one reading forward from the current frame
+ * and one reading backward, each through its own animation handle so the decoders don't have to
+ * seek against each other. The frame displayed by the main thread is decoded through
+ * `clip->anim` and so never waits on the prefetch streams. */
 static void do_prefetch_movie(MovieClip *clip,
-                              MovieClip *clip_local,
+                              MovieClip *clip_local_forward,
+                              MovieClip *clip_local_backward,
                               int start_frame,
                               int current_frame,
                               int end_frame,
@@ -967,32 +1026,41 @@ static void do_prefetch_movie(MovieClip *clip,
                               short *do_update,
                               float *progress)
 {
-  int frame;
-  int frames_processed = 0;
-
-  /* read frames starting from current frame up to scene end frame */
-  for (frame = current_frame; frame <= end_frame; frame++) {
-    if (!prefetch_movie_frame(clip, clip_local, frame, render_size, render_flag, stop)) {
-      return;
-    }
+  PrefetchMovieQueue queue;
+  BLI_spin_init(&queue.spin);
 
-    frames_processed++;
+  queue.render_size = render_size;
+  queue.render_flag = render_flag;
+  queue.frames_processed = 0;
+  queue.total_frames = (end_frame - start_frame) + 1;
 
-    *do_update = 1;
-    *progress = (float)frames_processed / (end_frame - start_frame);
-  }
+  queue.stop = stop;
+  queue.do_update = do_update;
+  queue.progress = progress;
 
-  /* read frames starting from current frame up to scene start frame */
-  for (frame = current_frame; frame >= start_frame; frame--) {
-    if (!prefetch_movie_frame(clip, clip_local, frame, render_size, render_flag, stop)) {
-      return;
-    }
+  PrefetchMovieStream stream_forward;
+  stream_forward.clip = clip;
+  stream_forward.clip_local = clip_local_forward;
+  stream_forward.from_frame = current_frame;
+  stream_forward.to_frame = end_frame;
 
-    frames_processed++;
+  PrefetchMovieStream stream_backward;
+  stream_backward.clip = clip;
+  stream_backward.clip_local = clip_local_backward;
+  stream_backward.from_frame = current_frame - 1;
+  stream_backward.to_frame = start_frame;
 
-    *do_update = 1;
-    *progress = (float)frames_processed / (end_frame - start_frame);
+  TaskPool *task_pool = BLI_task_pool_create(&queue, TASK_PRIORITY_LOW);
+  if (stream_forward.from_frame <= end_frame) {
+    BLI_task_pool_push(task_pool, prefetch_movie_stream_task_func, &stream_forward, false, NULL);
+  }
+  if (stream_backward.from_frame >= start_frame) {
+    BLI_task_pool_push(task_pool, prefetch_movie_stream_task_func, &stream_backward, false, NULL);
   }
+  BLI_task_pool_work_and_wait(task_pool);
+  BLI_task_pool_free(task_pool);
+
+  BLI_spin_end(&queue.spin);
 }
 
 static void prefetch_startjob(void *pjv, short *stop, short *do_update, float *progress)
@@ -1012,9 +1080,10 @@ static void prefetch_startjob(void *pjv, short *stop, short *do_update, float *p
                            progress);
   }
   else if (pj->clip->source == MCLIP_SRC_MOVIE) {
-    /* read movie in a single thread */
+    /* read movie in a forward and a backward decode stream */
     do_prefetch_movie(pj->clip,
-                      pj->clip_local,
+                      pj->clip_local_forward,
+                      pj->clip_local_backward,
                       pj->start_frame,
                       pj->current_frame,
                       pj->end_frame,
@@ -1029,16 +1098,21 @@ static void prefetch_startjob(void *pjv, short *stop, short *do_update, float *p
   }
 }
 
-static void prefetch_freejob(void *pjv)
+static void prefetch_free_clip_local(MovieClip *clip_local)
 {
-  PrefetchJob *pj = pjv;
-
-  MovieClip *clip_local = pj->clip_local;
   if (clip_local != NULL) {
     BKE_libblock_free_datablock(&clip_local->id, 0);
     BKE_libblock_free_data(&clip_local->id, false);
     MEM_freeN(clip_local);
   }
+}
+
+static void prefetch_freejob(void *pjv)
+{
+  PrefetchJob *pj = pjv;
+
+  prefetch_free_clip_local(pj->clip_local_forward);
+  prefetch_free_clip_local(pj->clip_local_backward);
 
   MEM_freeN(pj);
 }
@@ -1127,10 +1201,14 @@ void clip_start_prefetch_job(const bContext *C)
   pj->render_size = sc->user.render_size;
   pj->render_flag = sc->user.render_flag;
 
-  /* Create a local copy of the clip, so that video file (clip->anim) access can happen without
-   * acquiring the lock which will interfere with the main thread. */
+  /* Create local copies of the clip, so that video file (clip->anim) access can happen without
+   * acquiring the lock which will interfere with the main thread. Every decode stream gets its
+   * own copy as animation handles can not be shared between threads. */
   if (pj->clip->source == MCLIP_SRC_MOVIE) {
-    BKE_id_copy_ex(NULL, (ID *)&pj->clip->id, (ID **)&pj->clip_local, LIB_ID_COPY_LOCALIZE);
+    BKE_id_copy_ex(
+        NULL, (ID *)&pj->clip->id, (ID **)&pj->clip_local_forward, LIB_ID_COPY_LOCALIZE);
+    BKE_id_copy_ex(
+        NULL, (ID *)&pj->clip->id, (ID **)&pj->clip_local_backward, LIB_ID_COPY_LOCALIZE);
   }
 
   WM_jobs_customdata_set(wm_job, pj, prefetch_freejob);
@@ -44,6 +44,7 @@
 #include "BLI_fileops_types.h"
 #include "BLI_fnmatch.h"
 #include "BLI_ghash.h"
+#include "BLI_hash_md5.h"
 #include "BLI_linklist.h"
 #include "BLI_math.h"
 #include "BLI_stack.h"
@@ -55,6 +56,7 @@
 #  include "BLI_winstuff.h"
 #endif
 
+#include "BKE_appdir.h"
 #include "BKE_asset.h"
 #include "BKE_context.h"
 #include "BKE_global.h"
@@ -2887,11 +2889,339 @@ static int filelist_readjob_list_dir(const char *root,
   return nbr_entries;
 }
 
-static int filelist_readjob_list_lib(const char *root, ListBase *entries, const bool skip_currpar)
+/* -------------------------------------------------------------------- */
+/** \name Asset Library Index
+ *
+ * Persistent cache of the data-block listing (including asset meta-data) of the `.blend` files
+ * of an asset library. Each `.blend` gets one binary index file in the user cache directory,
+ * validated against the size and modification time of the `.blend` itself, so browsing a big
+ * library only re-parses the files that actually changed since the last time.
+ *
+ * The index stores all linkable data-blocks of a file at once, so the per-ID-type listings the
+ * recursive read-job performs on the same `.blend` are all served from a single index file.
+ *
+ * \note Custom (ID-)properties of the asset meta-data are not stored in the index: the file
+ * browser does not display them, and actually using an asset re-reads its file anyway. Previews
+ * also keep going through the regular thumbnail cache.
+ * \{ */
+
+/** Indexes are only valid for the machine that wrote them (struct layout and endianness of the
+ * fields are whatever the compiler gives us), which is fine for files in the OS cache directory.
+ * Bump the version when the format changes, stale indexes are silently rebuilt. */
+#define ASSET_INDEX_VERSION 1
+#define ASSET_INDEX_DIRNAME "asset-library-index"
+
+static const char asset_index_magic[8] = "BAssetIx";
+
+typedef struct AssetIndexHeader {
+  char magic[8];
+  uint32_t version;
+  /** Size and modification time of the indexed `.blend`, for validation. */
+  uint64_t blend_size;
+  int64_t blend_mtime;
+  uint32_t nbr_entries;
+} AssetIndexHeader;
+
+/** Bounds-checked reader over the memory of a whole index file. */
+typedef struct AssetIndexReader {
+  const uchar *data;
+  size_t data_len;
+  size_t offset;
+} AssetIndexReader;
+
+static bool asset_index_read_data(AssetIndexReader *reader, void *dst, const size_t len)
+{
+  if (len > reader->data_len - reader->offset) {
+    return false;
+  }
+  memcpy(dst, reader->data + reader->offset, len);
+  reader->offset += len;
+  return true;
+}
+
+/** Read a string written by #asset_index_write_string. \a r_str is set to a newly allocated
+ * string, or NULL when none was stored. Returns false on truncated data. */
+static bool asset_index_read_string(AssetIndexReader *reader, char **r_str)
+{
+  uint32_t len;
+
+  *r_str = NULL;
+  if (!asset_index_read_data(reader, &len, sizeof(len))) {
+    return false;
+  }
+  if (len == 0) {
+    return true;
+  }
+  len -= 1;
+  if (len > reader->data_len - reader->offset) {
+    return false;
+  }
+  char *str = MEM_mallocN((size_t)len + 1, __func__);
+  memcpy(str, reader->data + reader->offset, len);
+  str[len] = '\0';
+  reader->offset += len;
+  *r_str = str;
+  return true;
+}
+
+static void asset_index_write_string(FILE *file, const char *str)
+{
+  /* 0 means no string at all, so empty and NULL strings round-trip correctly. */
+  const uint32_t len = (str != NULL) ? (uint32_t)strlen(str) + 1 : 0;
+  fwrite(&len, sizeof(len), 1, file);
+  if (len != 0) {
+    fwrite(str, 1, (size_t)len - 1, file);
+  }
+}
+
+/** Path of the index file caching the listing of the given `.blend`. */
+static bool asset_index_filepath(const char *blend_path, char *r_path, const size_t path_len)
+{
+  char caches_dir[FILE_MAXDIR];
+  if (!BKE_appdir_folder_caches(caches_dir, sizeof(caches_dir))) {
+    return false;
+  }
+
+  /* Hash of the full path as file name, the original path may not fit in a file name (and may
+   * contain characters invalid for the index' file-system). */
+  uchar digest[16];
+  char filename[33 + 8];
+  BLI_hash_md5_buffer(blend_path, strlen(blend_path), digest);
+  BLI_hash_md5_to_hexdigest(digest, filename);
+  BLI_strncpy(filename + 32, ".index", sizeof(filename) - 32);
+
+  BLI_path_join(r_path, path_len, caches_dir, ASSET_INDEX_DIRNAME, filename, NULL);
+  return true;
+}
+
+static void asset_index_datablock_infos_free(LinkNode *datablock_infos)
+{
+  for (LinkNode *ln = datablock_infos; ln; ln = ln->next) {
+    struct BLODataBlockInfo *info = ln->link;
+    if (info->asset_data != NULL) {
+      BKE_asset_metadata_free(&info->asset_data);
+    }
+  }
+  BLI_linklist_freeN(datablock_infos);
+}
+
+/**
+ * Try to serve the listing of the given `.blend` from its index file.
+ *
+ * On success, the outputs match those of the #BLO_blendhandle_get_datablock_info (when \a idcode
+ * is set) and #BLO_blendhandle_get_linkable_groups (when it is 0) calls they replace, with the
+ * same ownership rules.
+ *
+ * \return false when there is no index, it is out of date or unreadable; the caller then has to
+ * read the `.blend` itself (and rebuild the index, see #filelist_asset_index_write).
+ */
+static bool filelist_asset_index_read(const char *blend_path,
+                                      const int idcode,
+                                      LinkNode **r_datablock_infos,
+                                      LinkNode **r_groups,
+                                      int *r_nitems)
+{
+  char index_path[FILE_MAX];
+  BLI_stat_t st;
+  if (!asset_index_filepath(blend_path, index_path, sizeof(index_path)) ||
+      (BLI_stat(blend_path, &st) == -1)) {
+    return false;
+  }
+
+  size_t data_len;
+  uchar *data = BLI_file_read_binary_as_mem(index_path, 0, &data_len);
+  if (data == NULL) {
+    return false;
+  }
+
+  AssetIndexReader reader = {.data = data, .data_len = data_len, .offset = 0};
+  LinkNode *datablock_infos = NULL, *groups = NULL;
+  GSet *gathered_groups = NULL;
+  int nitems = 0;
+  bool success = false;
+
+  AssetIndexHeader header;
+  if (!asset_index_read_data(&reader, &header, sizeof(header)) ||
+      (memcmp(header.magic, asset_index_magic, sizeof(header.magic)) != 0) ||
+      (header.version != ASSET_INDEX_VERSION) || (header.blend_size != (uint64_t)st.st_size) ||
+      (header.blend_mtime != (int64_t)st.st_mtime)) {
+    MEM_freeN(data);
+    return false;
+  }
+
+  if (idcode == 0) {
+    gathered_groups = BLI_gset_ptr_new(__func__);
+  }
+
+  for (uint32_t i = 0; i < header.nbr_entries; i++) {
+    uint32_t entry_idcode;
+    char name[64]; /* MAX_NAME */
+    uchar has_asset_data;
+    char *description = NULL;
+
+    if (!(asset_index_read_data(&reader, &entry_idcode, sizeof(entry_idcode)) &&
+          asset_index_read_data(&reader, name, sizeof(name)) &&
+          asset_index_read_data(&reader, &has_asset_data, sizeof(has_asset_data)))) {
+      goto cleanup;
+    }
+    name[sizeof(name) - 1] = '\0';
+
+    const bool is_requested = (idcode != 0) && (entry_idcode == (uint32_t)idcode);
+    struct BLODataBlockInfo *info = NULL;
+    if (is_requested) {
+      info = MEM_callocN(sizeof(*info), __func__);
+      BLI_strncpy(info->name, name, sizeof(info->name));
+      BLI_linklist_prepend(&datablock_infos, info);
+      nitems++;
+    }
+
+    /* Asset meta-data has to be consumed even for entries that are not returned. */
+    if (has_asset_data) {
+      uint32_t nbr_tags;
+      if (!(asset_index_read_string(&reader, &description) &&
+            asset_index_read_data(&reader, &nbr_tags, sizeof(nbr_tags)))) {
+        MEM_SAFE_FREE(description);
+        goto cleanup;
+      }
+      AssetMetaData *asset_data = (info != NULL) ? BKE_asset_metadata_create() : NULL;
+      if (asset_data != NULL) {
+        asset_data->description = description;
+        description = NULL;
+      }
+      MEM_SAFE_FREE(description);
+      for (uint32_t t = 0; t < nbr_tags; t++) {
+        char tag_name[64]; /* MAX_NAME */
+        if (!asset_index_read_data(&reader, tag_name, sizeof(tag_name))) {
+          if (asset_data != NULL) {
+            BKE_asset_metadata_free(&asset_data);
+          }
+          goto cleanup;
+        }
+        tag_name[sizeof(tag_name) - 1] = '\0';
+        if (asset_data != NULL) {
+          BKE_asset_metadata_tag_add(asset_data, tag_name);
+        }
+      }
+      if (info != NULL) {
+        info->asset_data = asset_data;
+      }
+    }
+
+    if ((idcode == 0) && BLI_gset_add(gathered_groups, POINTER_FROM_UINT(entry_idcode))) {
+      const char *group_name = BKE_idtype_idcode_to_name((short)entry_idcode);
+      if (group_name == NULL) {
+        /* Unknown ID code, the index comes from a corrupted file or a newer Blender. */
+        goto cleanup;
+      }
+      BLI_linklist_prepend(&groups, BLI_strdup(group_name));
+      nitems++;
+    }
+  }
+
+  success = true;
+  *r_datablock_infos = datablock_infos;
+  *r_groups = groups;
+  *r_nitems = nitems;
+
+cleanup:
+  if (!success) {
+    asset_index_datablock_infos_free(datablock_infos);
+    BLI_linklist_freeN(groups);
+  }
+  if (gathered_groups != NULL) {
+    BLI_gset_free(gathered_groups, NULL);
+  }
+  MEM_freeN(data);
+  return success;
+}
+
+/**
+ * (Re-)write the index of the given `.blend` from its open blend-handle, storing all linkable
+ * data-blocks of all ID types at once.
+ */
+static void filelist_asset_index_write(const char *blend_path, BlendHandle *libfiledata)
+{
+  char index_path[FILE_MAX];
+  BLI_stat_t st;
+  if (!asset_index_filepath(blend_path, index_path, sizeof(index_path)) ||
+      (BLI_stat(blend_path, &st) == -1)) {
+    return;
+  }
+
+  char index_dir[FILE_MAX];
+  BLI_split_dir_part(index_path, index_dir, sizeof(index_dir));
+  if (!BLI_dir_create_recursive(index_dir)) {
+    return;
+  }
+
+  /* Write into a temporary file first, so concurrent Blender instances reading the index never
+   * see a partially written one (a corrupted index would only cause a rebuild anyway, see the
+   * validation in #filelist_asset_index_read, but no reason to be sloppy here). */
+  char index_path_tmp[FILE_MAX + 8];
+  BLI_snprintf(index_path_tmp, sizeof(index_path_tmp), "%s.tmp", index_path);
+  FILE *file = BLI_fopen(index_path_tmp, "wb");
+  if (file == NULL) {
+    return;
+  }
+
+  AssetIndexHeader header = {
+      .version = ASSET_INDEX_VERSION,
+      .blend_size = (uint64_t)st.st_size,
+      .blend_mtime = (int64_t)st.st_mtime,
+      .nbr_entries = 0,
+  };
+  memcpy(header.magic, asset_index_magic, sizeof(header.magic));
+  fwrite(&header, sizeof(header), 1, file);
+
+  LinkNode *groups = BLO_blendhandle_get_linkable_groups(libfiledata);
+  for (LinkNode *lng = groups; lng; lng = lng->next) {
+    const uint32_t group_idcode = (uint32_t)groupname_to_code(lng->link);
+    int nbr_infos = 0;
+    LinkNode *infos = BLO_blendhandle_get_datablock_info(libfiledata, (int)group_idcode, &nbr_infos);
+    for (LinkNode *ln = infos; ln; ln = ln->next) {
+      struct BLODataBlockInfo *info = ln->link;
+      const uchar has_asset_data = (info->asset_data != NULL);
+
+      fwrite(&group_idcode, sizeof(group_idcode), 1, file);
+      fwrite(info->name, 1, sizeof(info->name), file);
+      fwrite(&has_asset_data, 1, 1, file);
+      if (has_asset_data) {
+        asset_index_write_string(file, info->asset_data->description);
+        const uint32_t nbr_tags = (uint32_t)BLI_listbase_count(&info->asset_data->tags);
+        fwrite(&nbr_tags, sizeof(nbr_tags), 1, file);
+        LISTBASE_FOREACH (AssetTag *, tag, &info->asset_data->tags) {
+          fwrite(tag->name, 1, sizeof(tag->name), file);
+        }
+      }
+      header.nbr_entries++;
+    }
+    asset_index_datablock_infos_free(infos);
+  }
+  BLI_linklist_freeN(groups);
+
+  /* Patch in the final entry count. */
+  bool write_ok = (fseek(file, 0, SEEK_SET) == 0) &&
+                  (fwrite(&header, sizeof(header), 1, file) == 1);
+  write_ok = (fclose(file) == 0) && write_ok;
+
+  if (write_ok) {
+    BLI_rename(index_path_tmp, index_path);
+  }
+  else {
+    BLI_delete(index_path_tmp, false, false);
+  }
+}
+
+/** \} */
+
+static int filelist_readjob_list_lib(const char *root,
+                                     ListBase *entries,
+                                     const bool skip_currpar,
+                                     const bool use_asset_index)
 {
   FileListInternEntry *entry;
   LinkNode *ln, *names = NULL, *datablock_infos = NULL;
-  int i, nitems, idcode = 0, nbr_entries = 0;
+  int i, nitems = 0, idcode = 0, nbr_entries = 0;
   char dir[FILE_MAX_LIBEXTRA], *group;
   bool ok;
 
@@ -2903,25 +3233,35 @@ static int filelist_readjob_list_lib(const char *root, ListBase *entries, const
     return nbr_entries;
   }
 
-  /* there we go */
-  BlendFileReadReport bf_reports = {.reports = NULL};
-  libfiledata = BLO_blendhandle_from_file(dir, &bf_reports);
-  if (libfiledata == NULL) {
-    return nbr_entries;
+  if (group) {
+    idcode = groupname_to_code(group);
   }
 
   /* memory for strings is passed into filelist[i].entry->relpath
    * and freed in filelist_entry_free. */
-  if (group) {
-    idcode = groupname_to_code(group);
-    datablock_infos = BLO_blendhandle_get_datablock_info(libfiledata, idcode, &nitems);
-  }
-  else {
-    names = BLO_blendhandle_get_linkable_groups(libfiledata);
-    nitems = BLI_linklist_count(names);
-  }
+  if (!use_asset_index ||
+      !filelist_asset_index_read(dir, idcode, &datablock_infos, &names, &nitems)) {
+    /* No valid index (or browsing outside of an asset library), read the `.blend` itself. */
+    BlendFileReadReport bf_reports = {.reports = NULL};
+    libfiledata = BLO_blendhandle_from_file(dir, &bf_reports);
+    if (libfiledata == NULL) {
+      return nbr_entries;
+    }
+
+    if (group) {
+      datablock_infos = BLO_blendhandle_get_datablock_info(libfiledata, idcode, &nitems);
+    }
+    else {
+      names = BLO_blendhandle_get_linkable_groups(libfiledata);
+      nitems = BLI_linklist_count(names);
+    }
 
-  BLO_blendhandle_close(libfiledata);
+    if (use_asset_index) {
+      filelist_asset_index_write(dir, libfiledata);
+    }
+
+    BLO_blendhandle_close(libfiledata);
+  }
 
   if (!skip_currpar) {
     entry = MEM_callocN(sizeof(*entry), __func__);
@@ -3194,7 +3534,10 @@ static void filelist_readjob_do(const bool do_lib,
     BLI_path_rel(rel_subdir, root);
 
     if (do_lib) {
-      nbr_entries = filelist_readjob_list_lib(subdir, &entries, skip_currpar);
+      /* The asset index is only used (and kept up to date) when browsing an asset library, a
+       * regular link/append file browser should not pay the cost of indexing every file. */
+      const bool use_asset_index = (filelist->asset_library != NULL);
+      nbr_entries = filelist_readjob_list_lib(subdir, &entries, skip_currpar, use_asset_index);
     }
     if (!nbr_entries) {
       is_lib = false;
@@ -3202,7 +3545,14 @@ static void filelist_readjob_do(const bool do_lib,
           subdir, &entries, filter_glob, do_lib, main_name, skip_currpar);
     }
 
-    for (entry = entries.first; entry; entry = entry->next) {
+    /* Stream the entries to the UI in batches: for huge directories the
+     * per-entry work below (attributes, type detection) takes long enough
+     * that waiting for the whole directory blocks the first draw. */
+    const int batch_max_entries = 1024;
+    ListBase batch_entries = {0};
+    int nbr_batch_entries = 0;
+
+    while ((entry = BLI_pophead(&entries))) {
       BLI_join_dirfile(dir, sizeof(dir), rel_subdir, entry->relpath);
 
       entry->uid = filelist_uid_generate(filelist);
@@ -3233,15 +3583,28 @@ static void filelist_readjob_do(const bool do_lib,
           nbr_todo_dirs++;
         }
       }
+
+      BLI_addtail(&batch_entries, entry);
+      if (++nbr_batch_entries == batch_max_entries) {
+        BLI_mutex_lock(lock);
+
+        *do_update = true;
+
+        BLI_movelisttolist(&filelist->filelist.entries, &batch_entries);
+        filelist->filelist.nbr_entries += nbr_batch_entries;
+
+        BLI_mutex_unlock(lock);
+        nbr_batch_entries = 0;
+      }
     }
 
-    if (nbr_entries) {
+    if (nbr_batch_entries) {
       BLI_mutex_lock(lock);
 
       *do_update = true;
 
-      BLI_movelisttolist(&filelist->filelist.entries, &entries);
-      filelist->filelist.nbr_entries += nbr_entries;
+      BLI_movelisttolist(&filelist->filelist.entries, &batch_entries);
+      filelist->filelist.nbr_entries += nbr_batch_entries;
 
       BLI_mutex_unlock(lock);
     }
@@ -1080,7 +1080,7 @@ static int collection_isolate_exec(bContext *C, wmOperator *op)
   }
   BLI_gset_free(data.collections_to_edit, NULL);
 
-  BKE_layer_collection_sync(scene, view_layer);
+  BKE_layer_collection_sync_visibility(scene, view_layer);
   DEG_id_tag_update(&scene->id, ID_RECALC_BASE_FLAGS);
 
   WM_main_add_notifier(NC_SCENE | ND_LAYER_CONTENT, NULL);
@@ -1162,7 +1162,7 @@ static int collection_visibility_exec(bContext *C, wmOperator *op)
   }
   BLI_gset_free(data.collections_to_edit, NULL);
 
-  BKE_layer_collection_sync(scene, view_layer);
+  BKE_layer_collection_sync_visibility(scene, view_layer);
   DEG_id_tag_update(&scene->id, ID_RECALC_BASE_FLAGS);
 
   WM_main_add_notifier(NC_SCENE | ND_LAYER_CONTENT, NULL);
@@ -1348,7 +1348,7 @@ static int collection_flag_exec(bContext *C, wmOperator *op)
     BLI_gset_free(data.collections_to_edit, NULL);
   }
 
-  BKE_layer_collection_sync(scene, view_layer);
+  BKE_layer_collection_sync_visibility(scene, view_layer);
   DEG_id_tag_update(&scene->id, ID_RECALC_BASE_FLAGS);
 
   if (!is_render) {
@@ -1498,7 +1498,7 @@ static int outliner_hide_exec(bContext *C, wmOperator *UNUSED(op))
   }
   BLI_gset_free(data.bases_to_edit, NULL);
 
-  BKE_layer_collection_sync(scene, view_layer);
+  BKE_layer_collection_sync_visibility(scene, view_layer);
   DEG_id_tag_update(&scene->id, ID_RECALC_BASE_FLAGS);
 
   WM_main_add_notifier(NC_SCENE | ND_LAYER_CONTENT, NULL);
@@ -1536,7 +1536,7 @@ static int outliner_unhide_all_exec(bContext *C, wmOperator *UNUSED(op))
     base->flag &= ~BASE_HIDDEN;
   }
 
-  BKE_layer_collection_sync(scene, view_layer);
+  BKE_layer_collection_sync_visibility(scene, view_layer);
   DEG_id_tag_update(&scene->id, ID_RECALC_BASE_FLAGS);
 
   WM_main_add_notifier(NC_SCENE | ND_LAYER_CONTENT, NULL);
@@ -55,6 +55,10 @@ typedef struct SpaceOutliner_Runtime {
   /** Pointers to tree-store elements, grouped by `(id, type, nr)`
    *  in hash-table for faster searching. */
   struct GHash *treehash;
+
+  /** Memory pool for #TreeElement allocations. Kept over rebuilds, so rebuilding a large tree
+   *  reuses the chunks of the previous tree instead of allocating every element individually. */
+  struct BLI_mempool *tree_element_pool;
 } SpaceOutliner_Runtime;
 
 typedef enum TreeElementInsertType {
@@ -248,9 +252,11 @@ typedef enum TreeItemSelectAction {
 
 /* outliner_tree.c ----------------------------------------------- */
 
-void outliner_free_tree(ListBase *tree);
+void outliner_free_tree(struct SpaceOutliner *space_outliner, ListBase *tree);
 void outliner_cleanup_tree(struct SpaceOutliner *space_outliner);
-void outliner_free_tree_element(TreeElement *element, ListBase *parent_subtree);
+void outliner_free_tree_element(struct SpaceOutliner *space_outliner,
+                                TreeElement *element,
+                                ListBase *parent_subtree);
 
 void outliner_build_tree(struct Main *mainvar,
                          struct Scene *scene,
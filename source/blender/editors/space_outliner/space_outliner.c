@@ -354,7 +354,7 @@ static void outliner_free(SpaceLink *sl)
 {
   SpaceOutliner *space_outliner = (SpaceOutliner *)sl;
 
-  outliner_free_tree(&space_outliner->tree);
+  outliner_free_tree(space_outliner, &space_outliner->tree);
   if (space_outliner->treestore) {
     BLI_mempool_destroy(space_outliner->treestore);
   }
@@ -364,6 +364,9 @@ static void outliner_free(SpaceLink *sl)
     if (space_outliner->runtime->treehash) {
       BKE_outliner_treehash_free(space_outliner->runtime->treehash);
     }
+    if (space_outliner->runtime->tree_element_pool) {
+      BLI_mempool_destroy(space_outliner->runtime->tree_element_pool);
+    }
     MEM_freeN(space_outliner->runtime);
   }
 }
@@ -393,6 +396,7 @@ static SpaceLink *outliner_duplicate(SpaceLink *sl)
     space_outliner_new->runtime = MEM_dupallocN(space_outliner->runtime);
     space_outliner_new->runtime->tree_display = NULL;
     space_outliner_new->runtime->treehash = NULL;
+    space_outliner_new->runtime->tree_element_pool = NULL;
   }
 
   return (SpaceLink *)space_outliner_new;
@@ -168,7 +168,7 @@ TreeElement *TreeDisplayOverrideLibrary::add_library_contents(Main &mainvar,
               &space_outliner_, &ten->subtree, id, ten, TSE_LIBRARY_OVERRIDE_BASE, 0);
 
           if (BLI_listbase_is_empty(&override_tree_element->subtree)) {
-            outliner_free_tree_element(override_tree_element, &ten->subtree);
+            outliner_free_tree_element(&space_outliner_, override_tree_element, &ten->subtree);
           }
         }
       }
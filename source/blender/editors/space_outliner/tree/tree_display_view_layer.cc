@@ -294,7 +294,7 @@ void ObjectsChildrenBuilder::make_object_parent_hierarchy_collections()
                                                                   parent_ob_tree_element,
                                                                   TSE_SOME_ID,
                                                                   0);
-        outliner_free_tree(&child_ob_tree_element->subtree);
+        outliner_free_tree(&outliner_, &child_ob_tree_element->subtree);
         child_ob_tree_element->flag |= TE_CHILD_NOT_IN_COLLECTION;
         child_ob_tree_elements.append(child_ob_tree_element);
       }
@@ -25,6 +25,7 @@
 #include "DNA_sound_types.h"
 
 #include "BLI_listbase.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 
 #include "BKE_context.h"
@@ -66,54 +67,72 @@ static void free_preview_job(void *data)
   MEM_freeN(pj);
 }
 
+typedef struct PreviewTaskData {
+  PreviewJob *pj;
+  short *stop;
+  short *do_update;
+  float *progress;
+} PreviewTaskData;
+
+static void preview_task_func(TaskPool *__restrict pool, void *task_data)
+{
+  PreviewTaskData *data = BLI_task_pool_user_data(pool);
+  PreviewJobAudio *previewjb = task_data;
+  bSound *sound = previewjb->sound;
+  PreviewJob *pj = data->pj;
+
+  if (*data->stop || G.is_break) {
+    /* Make sure we cleanup the loading flag! */
+    BLI_spin_lock(sound->spinlock);
+    sound->tags &= ~SOUND_TAGS_WAVEFORM_LOADING;
+    BLI_spin_unlock(sound->spinlock);
+  }
+  else {
+    BKE_sound_read_waveform(previewjb->bmain, sound, data->stop);
+  }
+
+  BLI_mutex_lock(pj->mutex);
+  pj->processed++;
+  *data->progress = (pj->total > 0) ? (float)pj->processed / (float)pj->total : 1.0f;
+  *data->do_update = true;
+  BLI_mutex_unlock(pj->mutex);
+}
+
 /* Only this runs inside thread. */
 static void preview_startjob(void *data, short *stop, short *do_update, float *progress)
 {
   PreviewJob *pj = data;
-  PreviewJobAudio *previewjb;
+  PreviewTaskData task_data = {pj, stop, do_update, progress};
 
-  BLI_mutex_lock(pj->mutex);
-  previewjb = pj->previews.first;
-  BLI_mutex_unlock(pj->mutex);
+  /* Every sound reads into its own #SoundWaveform through its own handle,
+   * so the queued strips can be processed in parallel. */
+  TaskPool *task_pool = BLI_task_pool_create(&task_data, TASK_PRIORITY_LOW);
+
+  while (true) {
+    /* Take over whatever is queued, more strips may be added while the pool runs. */
+    BLI_mutex_lock(pj->mutex);
+    ListBase previews = pj->previews;
+    BLI_listbase_clear(&pj->previews);
+    BLI_mutex_unlock(pj->mutex);
 
-  while (previewjb) {
-    PreviewJobAudio *preview_next;
-    bSound *sound = previewjb->sound;
-
-    BKE_sound_read_waveform(previewjb->bmain, sound, stop);
-
-    if (*stop || G.is_break) {
-      BLI_mutex_lock(pj->mutex);
-      previewjb = previewjb->next;
-      BLI_mutex_unlock(pj->mutex);
-      while (previewjb) {
-        sound = previewjb->sound;
-
-        /* Make sure we cleanup the loading flag! */
-        BLI_spin_lock(sound->spinlock);
-        sound->tags &= ~SOUND_TAGS_WAVEFORM_LOADING;
-        BLI_spin_unlock(sound->spinlock);
-
-        BLI_mutex_lock(pj->mutex);
-        previewjb = previewjb->next;
-        BLI_mutex_unlock(pj->mutex);
-      }
-
-      BLI_mutex_lock(pj->mutex);
-      BLI_freelistN(&pj->previews);
-      pj->total = 0;
-      pj->processed = 0;
-      BLI_mutex_unlock(pj->mutex);
+    if (BLI_listbase_is_empty(&previews)) {
       break;
     }
 
+    LISTBASE_FOREACH (PreviewJobAudio *, previewjb, &previews) {
+      BLI_task_pool_push(task_pool, preview_task_func, previewjb, false, NULL);
+    }
+
+    BLI_task_pool_work_and_wait(task_pool);
+    BLI_freelistN(&previews);
+  }
+
+  BLI_task_pool_free(task_pool);
+
+  if (*stop || G.is_break) {
     BLI_mutex_lock(pj->mutex);
-    preview_next = previewjb->next;
-    BLI_freelinkN(&pj->previews, previewjb);
-    previewjb = preview_next;
-    pj->processed++;
-    *progress = (pj->total > 0) ? (float)pj->processed / (float)pj->total : 1.0f;
-    *do_update = true;
+    pj->total = 0;
+    pj->processed = 0;
     BLI_mutex_unlock(pj->mutex);
   }
 }
@@ -112,6 +112,9 @@ static void spreadsheet_free(SpaceLink *sl)
 {
   SpaceSpreadsheet *sspreadsheet = (SpaceSpreadsheet *)sl;
 
+  if (sspreadsheet->runtime != nullptr) {
+    MEM_SAFE_FREE(sspreadsheet->runtime->row_index_cache);
+  }
   MEM_SAFE_FREE(sspreadsheet->runtime);
 
   LISTBASE_FOREACH_MUTABLE (SpreadsheetRowFilter *, row_filter, &sspreadsheet->row_filters) {
@@ -139,6 +142,10 @@ static SpaceLink *spreadsheet_duplicate(SpaceLink *sl)
   const SpaceSpreadsheet *sspreadsheet_old = (SpaceSpreadsheet *)sl;
   SpaceSpreadsheet *sspreadsheet_new = (SpaceSpreadsheet *)MEM_dupallocN(sspreadsheet_old);
   sspreadsheet_new->runtime = (SpaceSpreadsheet_Runtime *)MEM_dupallocN(sspreadsheet_old->runtime);
+  /* The row index cache is owned by the original space. */
+  sspreadsheet_new->runtime->row_index_cache = nullptr;
+  sspreadsheet_new->runtime->row_index_cache_len = 0;
+  sspreadsheet_new->runtime->row_index_cache_valid = false;
 
   BLI_listbase_clear(&sspreadsheet_new->row_filters);
   LISTBASE_FOREACH (const SpreadsheetRowFilter *, src_filter, &sspreadsheet_old->row_filters) {
@@ -380,7 +387,7 @@ static void spreadsheet_main_region_draw(const bContext *C, ARegion *region)
   const int tot_rows = data_source->tot_rows();
   spreadsheet_layout.index_column_width = get_index_column_width(tot_rows);
   spreadsheet_layout.row_indices = spreadsheet_filter_rows(
-      *sspreadsheet, spreadsheet_layout, *data_source, scope);
+      *sspreadsheet, spreadsheet_layout, *data_source);
 
   sspreadsheet->runtime->tot_columns = spreadsheet_layout.columns.size();
   sspreadsheet->runtime->tot_rows = tot_rows;
@@ -396,9 +403,19 @@ static void spreadsheet_main_region_draw(const bContext *C, ARegion *region)
   ED_region_tag_redraw(sidebar);
 }
 
+static void spreadsheet_main_region_tag_redraw(const wmRegionListenerParams *params)
+{
+  /* Any notifier that gets here may change the displayed data, so the cached row filter result
+   * cannot be reused. Redraws that do not go through a notifier (scrolling, resizing) keep it. */
+  if (params->area != nullptr) {
+    const SpaceSpreadsheet *sspreadsheet = (const SpaceSpreadsheet *)params->area->spacedata.first;
+    spreadsheet_row_index_cache_invalidate(*sspreadsheet);
+  }
+  ED_region_tag_redraw(params->region);
+}
+
 static void spreadsheet_main_region_listener(const wmRegionListenerParams *params)
 {
-  ARegion *region = params->region;
   wmNotifier *wmn = params->notifier;
 
   switch (wmn->category) {
@@ -407,25 +424,25 @@ static void spreadsheet_main_region_listener(const wmRegionListenerParams *param
         case ND_MODE:
         case ND_FRAME:
         case ND_OB_ACTIVE: {
-          ED_region_tag_redraw(region);
+          spreadsheet_main_region_tag_redraw(params);
           break;
         }
       }
       break;
     }
     case NC_OBJECT: {
-      ED_region_tag_redraw(region);
+      spreadsheet_main_region_tag_redraw(params);
       break;
     }
     case NC_SPACE: {
       if (wmn->data == ND_SPACE_SPREADSHEET) {
-        ED_region_tag_redraw(region);
+        spreadsheet_main_region_tag_redraw(params);
       }
       break;
     }
     case NC_TEXTURE:
     case NC_GEOM: {
-      ED_region_tag_redraw(region);
+      spreadsheet_main_region_tag_redraw(params);
       break;
     }
   }
@@ -22,6 +22,17 @@ typedef struct SpaceSpreadsheet_Runtime {
   int visible_rows;
   int tot_rows;
   int tot_columns;
+
+  /* Cached result of row filtering: indices of the rows that passed the filters. Evaluating the
+   * filters visits every row of the domain, which is too expensive to redo for redraws that
+   * cannot change the result (scrolling, resizing). The region listener invalidates the cache
+   * for any notifier that may change the displayed data, changes to the filter settings
+   * themselves are caught by comparing their hash. */
+  int64_t *row_index_cache;
+  int64_t row_index_cache_len;
+  uint32_t row_index_cache_hash;
+  bool row_index_cache_valid;
+  char _pad[3];
 } SpaceSpreadsheet_Runtime;
 
 struct bContext;
@@ -14,8 +14,10 @@
  * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+#include <algorithm>
 #include <cstring>
 
+#include "BLI_hash_mm2a.h"
 #include "BLI_listbase.h"
 
 #include "DNA_collection_types.h"
@@ -297,10 +299,38 @@ static bool use_selection_filter(const SpaceSpreadsheet &sspreadsheet,
   return true;
 }
 
+static uint32_t row_filter_state_hash(const SpaceSpreadsheet &sspreadsheet, const int tot_rows)
+{
+  BLI_HashMurmur2A mm2;
+  BLI_hash_mm2a_init(&mm2, 0);
+  BLI_hash_mm2a_add_int(&mm2, tot_rows);
+  BLI_hash_mm2a_add_int(&mm2, sspreadsheet.filter_flag);
+  LISTBASE_FOREACH (const SpreadsheetRowFilter *, row_filter, &sspreadsheet.row_filters) {
+    BLI_hash_mm2a_add(
+        &mm2, (const uchar *)row_filter->column_name, strlen(row_filter->column_name));
+    BLI_hash_mm2a_add_int(&mm2, row_filter->operation);
+    BLI_hash_mm2a_add_int(&mm2, row_filter->flag);
+    BLI_hash_mm2a_add_int(&mm2, row_filter->value_int);
+    /* All float values, from `value_float` up to and including `value_color`. */
+    BLI_hash_mm2a_add(&mm2, (const uchar *)&row_filter->value_float, sizeof(float) * 11);
+    if (row_filter->value_string != nullptr) {
+      BLI_hash_mm2a_add(
+          &mm2, (const uchar *)row_filter->value_string, strlen(row_filter->value_string));
+    }
+  }
+  return BLI_hash_mm2a_end(&mm2);
+}
+
+void spreadsheet_row_index_cache_invalidate(const SpaceSpreadsheet &sspreadsheet)
+{
+  if (sspreadsheet.runtime != nullptr) {
+    sspreadsheet.runtime->row_index_cache_valid = false;
+  }
+}
+
 Span<int64_t> spreadsheet_filter_rows(const SpaceSpreadsheet &sspreadsheet,
                                       const SpreadsheetLayout &spreadsheet_layout,
-                                      const DataSource &data_source,
-                                      ResourceScope &scope)
+                                      const DataSource &data_source)
 {
   const int tot_rows = data_source.tot_rows();
 
@@ -312,6 +342,12 @@ Span<int64_t> spreadsheet_filter_rows(const SpaceSpreadsheet &sspreadsheet,
     return IndexRange(tot_rows).as_span();
   }
 
+  SpaceSpreadsheet_Runtime *runtime = sspreadsheet.runtime;
+  const uint32_t state_hash = row_filter_state_hash(sspreadsheet, tot_rows);
+  if (runtime->row_index_cache_valid && runtime->row_index_cache_hash == state_hash) {
+    return Span<int64_t>(runtime->row_index_cache, runtime->row_index_cache_len);
+  }
+
   Array<bool> rows_included(tot_rows, true);
 
   if (use_filters) {
@@ -328,10 +364,20 @@ Span<int64_t> spreadsheet_filter_rows(const SpaceSpreadsheet &sspreadsheet,
     geometry_data_source->apply_selection_filter(rows_included);
   }
 
-  Vector<int64_t> &indices = scope.construct<Vector<int64_t>>(__func__);
+  Vector<int64_t> indices;
   index_vector_from_bools(rows_included, indices);
 
-  return indices;
+  /* Store the result in the runtime cache, it stays valid until the data or the filters change
+   * (see #spreadsheet_row_index_cache_invalidate). */
+  MEM_SAFE_FREE(runtime->row_index_cache);
+  runtime->row_index_cache = (int64_t *)MEM_malloc_arrayN(
+      std::max<int64_t>(indices.size(), 1), sizeof(int64_t), __func__);
+  memcpy(runtime->row_index_cache, indices.data(), sizeof(int64_t) * indices.size());
+  runtime->row_index_cache_len = indices.size();
+  runtime->row_index_cache_hash = state_hash;
+  runtime->row_index_cache_valid = true;
+
+  return Span<int64_t>(runtime->row_index_cache, runtime->row_index_cache_len);
 }
 
 SpreadsheetRowFilter *spreadsheet_row_filter_new()
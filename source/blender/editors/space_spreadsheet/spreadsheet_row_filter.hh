@@ -16,8 +16,6 @@
 
 #pragma once
 
-#include "BLI_resource_scope.hh"
-
 #include "spreadsheet_data_source.hh"
 #include "spreadsheet_layout.hh"
 
@@ -25,8 +23,9 @@ namespace blender::ed::spreadsheet {
 
 Span<int64_t> spreadsheet_filter_rows(const SpaceSpreadsheet &sspreadsheet,
                                       const SpreadsheetLayout &spreadsheet_layout,
-                                      const DataSource &data_source,
-                                      ResourceScope &scope);
+                                      const DataSource &data_source);
+
+void spreadsheet_row_index_cache_invalidate(const SpaceSpreadsheet &sspreadsheet);
 
 SpreadsheetRowFilter *spreadsheet_row_filter_new();
 SpreadsheetRowFilter *spreadsheet_row_filter_copy(const SpreadsheetRowFilter *src_row_filter);
@@ -1837,6 +1837,12 @@ void ED_view3d_draw_offscreen_simple(Depsgraph *depsgraph,
  *
  * \param ofs: Optional off-screen buffer, can be NULL.
  * (avoids re-creating when doing multiple GL renders).
+ * \param r_readback: When non-NULL the pixels are not read back into the image buffer.
+ * Instead an asynchronous readback is started and returned here, and the caller is
+ * responsible for filling the buffer through #GPU_framebuffer_readback_result_get
+ * (with the DRW OpenGL context active) before using it. This allows rendering the next
+ * frame while the transfer of the current one is still in flight. Requires \a ofs to be
+ * passed in, since the transfer references the off-screen buffer.
  */
 ImBuf *ED_view3d_draw_offscreen_imbuf(Depsgraph *depsgraph,
                                       Scene *scene,
@@ -1851,11 +1857,14 @@ ImBuf *ED_view3d_draw_offscreen_imbuf(Depsgraph *depsgraph,
                                       const bool restore_rv3d_mats,
                                       /* output vars */
                                       GPUOffScreen *ofs,
+                                      GPUFrameBufferReadback **r_readback,
                                       char err_out[256])
 {
   RegionView3D *rv3d = region->regiondata;
   const bool draw_sky = (alpha_mode == R_ADDSKY);
 
+  BLI_assert(r_readback == NULL || ofs != NULL);
+
   /* view state */
   bool is_ortho = false;
   float winmat[4][4];
@@ -1960,7 +1969,11 @@ ImBuf *ED_view3d_draw_offscreen_imbuf(Depsgraph *depsgraph,
                            ofs,
                            NULL);
 
-  if (ibuf->rect_float) {
+  if (r_readback != NULL) {
+    *r_readback = GPU_offscreen_read_pixels_async(
+        ofs, ibuf->rect_float ? GPU_DATA_FLOAT : GPU_DATA_UBYTE);
+  }
+  else if (ibuf->rect_float) {
     GPU_offscreen_read_pixels(ofs, GPU_DATA_FLOAT, ibuf->rect_float);
   }
   else if (ibuf->rect) {
@@ -1980,7 +1993,7 @@ ImBuf *ED_view3d_draw_offscreen_imbuf(Depsgraph *depsgraph,
     GPU_framebuffer_bind(old_fb);
   }
 
-  if (ibuf->rect_float && ibuf->rect) {
+  if ((r_readback == NULL) && ibuf->rect_float && ibuf->rect) {
     IMB_rect_from_float(ibuf);
   }
 
@@ -2092,6 +2105,7 @@ ImBuf *ED_view3d_draw_offscreen_imbuf_simple(Depsgraph *depsgraph,
                                         viewname,
                                         true,
                                         ofs,
+                                        NULL,
                                         err_out);
 }
 
@@ -2189,16 +2203,18 @@ static void view3d_opengl_read_Z_pixels(GPUViewport *viewport, rcti *rect, void
   GPU_framebuffer_texture_attach(tmp_fb, dtxl->depth, 0, 0);
   GPU_framebuffer_bind(tmp_fb);
 
-  GPU_framebuffer_read_depth(tmp_fb,
-                             rect->xmin,
-                             rect->ymin,
-                             BLI_rcti_size_x(rect),
-                             BLI_rcti_size_y(rect),
-                             GPU_DATA_FLOAT,
-                             data);
+  GPUFrameBufferReadback *readback = GPU_framebuffer_read_depth_async(tmp_fb,
+                                                                      rect->xmin,
+                                                                      rect->ymin,
+                                                                      BLI_rcti_size_x(rect),
+                                                                      BLI_rcti_size_y(rect),
+                                                                      GPU_DATA_FLOAT);
 
   GPU_framebuffer_restore();
   GPU_framebuffer_free(tmp_fb);
+
+  /* Fetch after the state is restored, so the transfer overlaps the above. */
+  GPU_framebuffer_readback_result_get(readback, data);
 }
 
 void ED_view3d_select_id_validate(ViewContext *vc)
@@ -2268,12 +2284,16 @@ static ViewDepths *view3d_depths_create(ARegion *region)
   ViewDepths *d = MEM_callocN(sizeof(ViewDepths), "ViewDepths");
   d->w = region->winx;
   d->h = region->winy;
-  d->depths = MEM_mallocN(sizeof(float) * d->w * d->h, "View depths");
 
   {
     GPUViewport *viewport = WM_draw_region_get_viewport(region);
     DefaultFramebufferList *fbl = GPU_viewport_framebuffer_list_get(viewport);
-    GPU_framebuffer_read_depth(fbl->depth_only_fb, 0, 0, d->w, d->h, GPU_DATA_FLOAT, d->depths);
+    GPUFrameBufferReadback *readback = GPU_framebuffer_read_depth_async(
+        fbl->depth_only_fb, 0, 0, d->w, d->h, GPU_DATA_FLOAT);
+
+    /* Allocate while the transfer is in flight. */
+    d->depths = MEM_mallocN(sizeof(float) * d->w * d->h, "View depths");
+    GPU_framebuffer_readback_result_get(readback, d->depths);
 
     /* Assumed to be this as they are never changed. */
     d->depth_range[0] = 0.0;
@@ -31,6 +31,7 @@
 #include "BLI_linklist_stack.h"
 #include "BLI_math.h"
 #include "BLI_memarena.h"
+#include "BLI_task.h"
 
 #include "BKE_context.h"
 #include "BKE_crazyspace.h"
@@ -1482,10 +1483,133 @@ static void VertsToTransData(TransInfo *t,
   }
 }
 
+/* Filling the TransData array dominates the invoke latency on dense meshes.
+ * Slot assignment (which vertex goes where) stays serial and cheap, the
+ * per-element setup below runs over the task scheduler: it only reads shared
+ * mesh data and writes to its own slot. */
+struct TransMeshVertFillData {
+  TransInfo *t;
+  TransDataContainer *tc;
+  BMEditMesh *em;
+  struct TransIslandData *island_data;
+  struct TransMirrorData *mirror_data;
+  struct TransMeshDataCrazySpace *crazyspace_data;
+  float (*mtx)[3];
+  float (*smtx)[3];
+  const float *dists;
+  const int *dists_index;
+  /* Vertex table index for each TransData / TransDataMirror slot. */
+  const int *td_vert_index;
+  const int *td_mirror_vert_index;
+  int cd_vert_bweight_offset;
+  int prop_mode;
+};
+
+static int tc_mesh_island_index_get(const struct TransMeshVertFillData *data, const int a)
+{
+  if (!data->island_data->island_vert_map) {
+    return -1;
+  }
+  const int connected_index = (data->dists_index && data->dists_index[a] != -1) ?
+                                  data->dists_index[a] :
+                                  a;
+  return data->island_data->island_vert_map[connected_index];
+}
+
+static void tc_mesh_transdata_fill_task_cb(void *__restrict userdata,
+                                           const int i,
+                                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  struct TransMeshVertFillData *data = userdata;
+  TransInfo *t = data->t;
+  TransDataContainer *tc = data->tc;
+  BMesh *bm = data->em->bm;
+
+  const int a = data->td_vert_index[i];
+  BMVert *eve = BM_vert_at_index(bm, a);
+  TransData *tob = &tc->data[i];
+  TransDataExtension *tx = tc->data_ext ? &tc->data_ext[i] : NULL;
+
+  const int island_index = tc_mesh_island_index_get(data, a);
+
+  float *bweight = (data->cd_vert_bweight_offset != -1) ?
+                       BM_ELEM_CD_GET_VOID_P(eve, data->cd_vert_bweight_offset) :
+                       NULL;
+
+  /* Do not use the island center in case we are using islands
+   * only to get axis for snap/rotate to normal... */
+  VertsToTransData(t, tob, tx, data->em, eve, bweight, data->island_data, island_index);
+
+  /* selected */
+  if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+    tob->flag |= TD_SELECTED;
+  }
+
+  if (data->prop_mode) {
+    if (data->prop_mode & T_PROP_CONNECTED) {
+      tob->dist = data->dists[a];
+    }
+    else {
+      tob->flag |= TD_NOTCONNECTED;
+      tob->dist = FLT_MAX;
+    }
+  }
+
+  /* CrazySpace */
+  transform_convert_mesh_crazyspace_transdata_set(
+      data->mtx,
+      data->smtx,
+      data->crazyspace_data->defmats ? data->crazyspace_data->defmats[a] : NULL,
+      data->crazyspace_data->quats && BM_elem_flag_test(eve, BM_ELEM_TAG) ?
+          data->crazyspace_data->quats[a] :
+          NULL,
+      tob);
+
+  if (tc->use_mirror_axis_any) {
+    if (tc->use_mirror_axis_x && fabsf(tob->loc[0]) < TRANSFORM_MAXDIST_MIRROR) {
+      tob->flag |= TD_MIRROR_EDGE_X;
+    }
+    if (tc->use_mirror_axis_y && fabsf(tob->loc[1]) < TRANSFORM_MAXDIST_MIRROR) {
+      tob->flag |= TD_MIRROR_EDGE_Y;
+    }
+    if (tc->use_mirror_axis_z && fabsf(tob->loc[2]) < TRANSFORM_MAXDIST_MIRROR) {
+      tob->flag |= TD_MIRROR_EDGE_Z;
+    }
+  }
+}
+
+static void tc_mesh_transdata_mirror_fill_task_cb(void *__restrict userdata,
+                                                  const int i,
+                                                  const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  struct TransMeshVertFillData *data = userdata;
+  TransDataContainer *tc = data->tc;
+  BMesh *bm = data->em->bm;
+
+  const int a = data->td_mirror_vert_index[i];
+  BMVert *eve = BM_vert_at_index(bm, a);
+  TransDataMirror *td_mirror = &tc->data_mirror[i];
+
+  const int island_index = tc_mesh_island_index_get(data, a);
+
+  const int elem_index = data->mirror_data->vert_map[a].index;
+  BMVert *v_src = BM_vert_at_index(bm, elem_index);
+
+  if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+    data->mirror_data->vert_map[a].flag |= TD_SELECTED;
+  }
+
+  td_mirror->extra = eve;
+  td_mirror->loc = eve->co;
+  copy_v3_v3(td_mirror->iloc, eve->co);
+  td_mirror->flag = data->mirror_data->vert_map[a].flag;
+  td_mirror->loc_src = v_src->co;
+  tc_mesh_transdata_center_copy(data->island_data, island_index, td_mirror->iloc, td_mirror->center);
+}
+
 void createTransEditVerts(TransInfo *t)
 {
   FOREACH_TRANS_DATA_CONTAINER (t, tc) {
-    TransDataExtension *tx = NULL;
     BMEditMesh *em = BKE_editmesh_from_object(tc->obedit);
     Mesh *me = tc->obedit->data;
     BMesh *bm = em->bm;
@@ -1608,8 +1732,7 @@ void createTransEditVerts(TransInfo *t)
        * but this stores loads of extra stuff, for TFM_SHRINKFATTEN its even more overkill
        * since we may not use the 'alt' transform mode to maintain shell thickness,
        * but with generic transform code its hard to lazy init vars */
-      tx = tc->data_ext = MEM_callocN(tc->data_len * sizeof(TransDataExtension),
-                                      "TransObData ext");
+      tc->data_ext = MEM_callocN(tc->data_len * sizeof(TransDataExtension), "TransObData ext");
     }
 
     int cd_vert_bweight_offset = -1;
@@ -1618,88 +1741,58 @@ void createTransEditVerts(TransInfo *t)
       cd_vert_bweight_offset = CustomData_get_offset(&bm->vdata, CD_BWEIGHT);
     }
 
-    TransData *tob = tc->data;
-    TransDataMirror *td_mirror = tc->data_mirror;
+    /* Assign the slots serially (cheap flag tests), then fill them over the
+     * task scheduler. */
+    int *td_vert_index = MEM_mallocN(sizeof(int) * (size_t)data_len, __func__);
+    int *td_mirror_vert_index = tc->data_mirror ?
+                                    MEM_mallocN(sizeof(int) * (size_t)tc->data_mirror_len,
+                                                __func__) :
+                                    NULL;
+    int td_len = 0, td_mirror_len = 0;
     BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, a) {
       if (BM_elem_flag_test(eve, BM_ELEM_HIDDEN)) {
         continue;
       }
-
-      int island_index = -1;
-      if (island_data.island_vert_map) {
-        const int connected_index = (dists_index && dists_index[a] != -1) ? dists_index[a] : a;
-        island_index = island_data.island_vert_map[connected_index];
-      }
-
       if (mirror_data.vert_map && mirror_data.vert_map[a].index != -1) {
-        int elem_index = mirror_data.vert_map[a].index;
-        BMVert *v_src = BM_vert_at_index(bm, elem_index);
-
-        if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-          mirror_data.vert_map[a].flag |= TD_SELECTED;
-        }
-
-        td_mirror->extra = eve;
-        td_mirror->loc = eve->co;
-        copy_v3_v3(td_mirror->iloc, eve->co);
-        td_mirror->flag = mirror_data.vert_map[a].flag;
-        td_mirror->loc_src = v_src->co;
-        tc_mesh_transdata_center_copy(
-            &island_data, island_index, td_mirror->iloc, td_mirror->center);
-
-        td_mirror++;
+        td_mirror_vert_index[td_mirror_len++] = a;
       }
       else if (prop_mode || BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-        float *bweight = (cd_vert_bweight_offset != -1) ?
-                             BM_ELEM_CD_GET_VOID_P(eve, cd_vert_bweight_offset) :
-                             NULL;
-
-        /* Do not use the island center in case we are using islands
-         * only to get axis for snap/rotate to normal... */
-        VertsToTransData(t, tob, tx, em, eve, bweight, &island_data, island_index);
-        if (tx) {
-          tx++;
-        }
-
-        /* selected */
-        if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-          tob->flag |= TD_SELECTED;
-        }
+        td_vert_index[td_len++] = a;
+      }
+    }
+    BLI_assert(td_len == data_len);
 
-        if (prop_mode) {
-          if (prop_mode & T_PROP_CONNECTED) {
-            tob->dist = dists[a];
-          }
-          else {
-            tob->flag |= TD_NOTCONNECTED;
-            tob->dist = FLT_MAX;
-          }
-        }
+    BM_mesh_elem_table_ensure(bm, BM_VERT);
 
-        /* CrazySpace */
-        transform_convert_mesh_crazyspace_transdata_set(
-            mtx,
-            smtx,
-            crazyspace_data.defmats ? crazyspace_data.defmats[a] : NULL,
-            crazyspace_data.quats && BM_elem_flag_test(eve, BM_ELEM_TAG) ?
-                crazyspace_data.quats[a] :
-                NULL,
-            tob);
+    struct TransMeshVertFillData fill_data = {
+        .t = t,
+        .tc = tc,
+        .em = em,
+        .island_data = &island_data,
+        .mirror_data = &mirror_data,
+        .crazyspace_data = &crazyspace_data,
+        .mtx = mtx,
+        .smtx = smtx,
+        .dists = dists,
+        .dists_index = dists_index,
+        .td_vert_index = td_vert_index,
+        .td_mirror_vert_index = td_mirror_vert_index,
+        .cd_vert_bweight_offset = cd_vert_bweight_offset,
+        .prop_mode = prop_mode,
+    };
 
-        if (tc->use_mirror_axis_any) {
-          if (tc->use_mirror_axis_x && fabsf(tob->loc[0]) < TRANSFORM_MAXDIST_MIRROR) {
-            tob->flag |= TD_MIRROR_EDGE_X;
-          }
-          if (tc->use_mirror_axis_y && fabsf(tob->loc[1]) < TRANSFORM_MAXDIST_MIRROR) {
-            tob->flag |= TD_MIRROR_EDGE_Y;
-          }
-          if (tc->use_mirror_axis_z && fabsf(tob->loc[2]) < TRANSFORM_MAXDIST_MIRROR) {
-            tob->flag |= TD_MIRROR_EDGE_Z;
-          }
-        }
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 1024;
+    BLI_task_parallel_range(0, td_len, &fill_data, tc_mesh_transdata_fill_task_cb, &settings);
+    if (td_mirror_vert_index) {
+      BLI_task_parallel_range(
+          0, td_mirror_len, &fill_data, tc_mesh_transdata_mirror_fill_task_cb, &settings);
+    }
 
-        tob++;
-      }
+    MEM_freeN(td_vert_index);
+    if (td_mirror_vert_index) {
+      MEM_freeN(td_mirror_vert_index);
     }
 
     transform_convert_mesh_islanddata_free(&island_data);
@@ -1996,6 +2089,7 @@ static void tc_mesh_partial_update(TransInfo *t,
      * selection. It's impractical to calculate this ahead of time. Further, the down side of
      * using partial updates when their not needed is negligible. */
     BKE_editmesh_looptri_and_normals_calc(em);
+    BKE_editmesh_spatial_cache_free(em);
   }
   else {
     if (partial_for_looptri != PARTIAL_NONE) {
@@ -2005,6 +2099,7 @@ static void tc_mesh_partial_update(TransInfo *t,
                                                 &(const struct BMeshCalcTessellation_Params){
                                                     .face_normals = true,
                                                 });
+      BKE_editmesh_spatial_cache_update_verts(em, bmpinfo);
     }
 
     if (partial_for_normals != PARTIAL_NONE) {
@@ -2018,6 +2113,7 @@ static void tc_mesh_partial_update(TransInfo *t,
                                              &(const struct BMeshNormalsUpdate_Params){
                                                  .face_normals = face_normals,
                                              });
+      BKE_editmesh_spatial_cache_update_verts(em, bmpinfo);
     }
   }
 
@@ -121,7 +121,11 @@ struct SnapObjectContext {
     const struct ARegion *region;
   } v3d_data;
 
-  /* Object -> SnapObjectData map */
+  /* Object -> SnapObjectData map.
+   *
+   * Note that this only caches light-weight per-object state: the BVH trees themselves come
+   * from the mesh runtime BVH cache, so they survive context destruction and are shared with
+   * other users of the evaluated mesh, and get invalidated with it on re-evaluation. */
   struct {
     GHash *object_map;
     /** Map object-data to objects so objects share edit mode data. */
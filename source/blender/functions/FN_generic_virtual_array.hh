@@ -23,6 +23,7 @@
  * the data type is only known at runtime.
  */
 
+#include <atomic>
 #include <optional>
 
 #include "BLI_virtual_array.hh"
@@ -34,6 +35,20 @@ namespace blender::fn {
 template<typename T> class GVArray_Typed;
 template<typename T> class GVMutableArray_Typed;
 
+#ifdef DEBUG
+/**
+ * Counters to verify that span-backed virtual arrays pass through to spans without being copied.
+ * They are incremented whenever flattening a virtual array into a span has to materialize the
+ * values (the fall-back in #GVArray_GSpan and #GVMutableArray_GSpan). Only maintained in debug
+ * builds.
+ */
+struct GVArraySpanCopyStats {
+  std::atomic<int64_t> copied_arrays{0};
+  std::atomic<int64_t> copied_bytes{0};
+};
+GVArraySpanCopyStats &gvarray_span_copy_stats();
+#endif
+
 class GVArray;
 class GVMutableArray;
 
@@ -24,10 +24,27 @@
 
 #include <functional>
 
+#include "BLI_task.hh"
+
 #include "FN_multi_function.hh"
 
 namespace blender::fn {
 
+/**
+ * Process chunks of \a mask in parallel when it is large. Element functions built below are
+ * trivially data parallel, this lets a single call over millions of elements use all cores.
+ * Slices of a range-mask are still ranges, so the range fast-path in #IndexMask::foreach_index
+ * keeps working within every chunk. When the caller already runs inside a parallel loop over
+ * small chunks, the grain size makes this a direct call.
+ */
+template<typename MaskFuncT>
+inline void parallel_mask_foreach(IndexMask mask, const MaskFuncT &mask_fn)
+{
+  threading::parallel_for(mask.index_range(), 4096, [&](IndexRange range) {
+    mask_fn(IndexMask(Span<int64_t>(mask).slice(range)));
+  });
+}
+
 /**
  * Generates a multi-function with the following parameters:
  * 1. single input (SI) of type In1
@@ -63,8 +80,10 @@ template<typename In1, typename Out1> class CustomMF_SI_SO : public MultiFunctio
     return [=](IndexMask mask, const VArray<In1> &in1, MutableSpan<Out1> out1) {
       /* Devirtualization results in a 2-3x speedup for some simple functions. */
       devirtualize_varray(in1, [&](const auto &in1) {
-        mask.foreach_index(
-            [&](int i) { new (static_cast<void *>(&out1[i])) Out1(element_fn(in1[i])); });
+        parallel_mask_foreach(mask, [&](IndexMask sub_mask) {
+          sub_mask.foreach_index(
+              [&](int i) { new (static_cast<void *>(&out1[i])) Out1(element_fn(in1[i])); });
+        });
       });
     };
   }
@@ -116,8 +135,11 @@ class CustomMF_SI_SI_SO : public MultiFunction {
                MutableSpan<Out1> out1) {
       /* Devirtualization results in a 2-3x speedup for some simple functions. */
       devirtualize_varray2(in1, in2, [&](const auto &in1, const auto &in2) {
-        mask.foreach_index(
-            [&](int i) { new (static_cast<void *>(&out1[i])) Out1(element_fn(in1[i], in2[i])); });
+        parallel_mask_foreach(mask, [&](IndexMask sub_mask) {
+          sub_mask.foreach_index([&](int i) {
+            new (static_cast<void *>(&out1[i])) Out1(element_fn(in1[i], in2[i]));
+          });
+        });
       });
     };
   }
@@ -174,8 +196,10 @@ class CustomMF_SI_SI_SI_SO : public MultiFunction {
                const VArray<In2> &in2,
                const VArray<In3> &in3,
                MutableSpan<Out1> out1) {
-      mask.foreach_index([&](int i) {
-        new (static_cast<void *>(&out1[i])) Out1(element_fn(in1[i], in2[i], in3[i]));
+      parallel_mask_foreach(mask, [&](IndexMask sub_mask) {
+        sub_mask.foreach_index([&](int i) {
+          new (static_cast<void *>(&out1[i])) Out1(element_fn(in1[i], in2[i], in3[i]));
+        });
       });
     };
   }
@@ -237,8 +261,10 @@ class CustomMF_SI_SI_SI_SI_SO : public MultiFunction {
                const VArray<In3> &in3,
                const VArray<In4> &in4,
                MutableSpan<Out1> out1) {
-      mask.foreach_index([&](int i) {
-        new (static_cast<void *>(&out1[i])) Out1(element_fn(in1[i], in2[i], in3[i], in4[i]));
+      parallel_mask_foreach(mask, [&](IndexMask sub_mask) {
+        sub_mask.foreach_index([&](int i) {
+          new (static_cast<void *>(&out1[i])) Out1(element_fn(in1[i], in2[i], in3[i], in4[i]));
+        });
       });
     };
   }
@@ -282,7 +308,9 @@ template<typename Mut1> class CustomMF_SM : public MultiFunction {
   template<typename ElementFuncT> static FunctionT create_function(ElementFuncT element_fn)
   {
     return [=](IndexMask mask, MutableSpan<Mut1> mut1) {
-      mask.foreach_index([&](int i) { element_fn(mut1[i]); });
+      parallel_mask_foreach(mask, [&](IndexMask sub_mask) {
+        sub_mask.foreach_index([&](int i) { element_fn(mut1[i]); });
+      });
     };
   }
 
@@ -18,6 +18,25 @@
 
 namespace blender::fn {
 
+#ifdef DEBUG
+GVArraySpanCopyStats &gvarray_span_copy_stats()
+{
+  static GVArraySpanCopyStats stats;
+  return stats;
+}
+
+static void gvarray_span_copy_stats_add(const CPPType &type, const int64_t size)
+{
+  GVArraySpanCopyStats &stats = gvarray_span_copy_stats();
+  stats.copied_arrays.fetch_add(1, std::memory_order_relaxed);
+  stats.copied_bytes.fetch_add(type.size() * size, std::memory_order_relaxed);
+}
+#else
+static void gvarray_span_copy_stats_add(const CPPType &UNUSED(type), const int64_t UNUSED(size))
+{
+}
+#endif
+
 /* --------------------------------------------------------------------
  * GVArray_For_ShallowCopy.
  */
@@ -320,6 +339,7 @@ GVArray_GSpan::GVArray_GSpan(const GVArray &varray) : GSpan(varray.type()), varr
     data_ = varray_.get_internal_span().data();
   }
   else {
+    gvarray_span_copy_stats_add(*type_, size_);
     owned_data_ = MEM_mallocN_aligned(type_->size() * size_, type_->alignment(), __func__);
     varray_.materialize_to_uninitialized(IndexRange(size_), owned_data_);
     data_ = owned_data_;
@@ -346,6 +366,7 @@ GVMutableArray_GSpan::GVMutableArray_GSpan(GVMutableArray &varray, const bool co
     data_ = varray_.get_internal_span().data();
   }
   else {
+    gvarray_span_copy_stats_add(*type_, size_);
     owned_data_ = MEM_mallocN_aligned(type_->size() * size_, type_->alignment(), __func__);
     if (copy_values_to_span) {
       varray_.materialize_to_uninitialized(IndexRange(size_), owned_data_);
@@ -232,7 +232,8 @@ GpencilModifierTypeInfo modifierType_Gpencil_Thick = {
     /* structName */ "ThickGpencilModifierData",
     /* structSize */ sizeof(ThickGpencilModifierData),
     /* type */ eGpencilModifierTypeType_Gpencil,
-    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode,
+    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode |
+        eGpencilModifierTypeFlag_SupportsThreading,
 
     /* copyData */ copyData,
 
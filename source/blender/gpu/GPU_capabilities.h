@@ -58,6 +58,7 @@ bool GPU_use_hq_normals_workaround(void);
 bool GPU_crappy_amd_driver(void);
 
 bool GPU_compute_shader_support(void);
+bool GPU_texture_3d_sparse_support(void);
 bool GPU_shader_storage_buffer_objects_support(void);
 bool GPU_shader_image_load_store_support(void);
 
@@ -198,6 +198,28 @@ void GPU_framebuffer_read_color(GPUFrameBuffer *fb,
                                 eGPUDataFormat format,
                                 void *data);
 
+/* Asynchronous readback. The returned handle tracks an in-flight transfer to a
+ * driver owned buffer, so the calling thread does not stall on the whole
+ * pipeline like the blocking read functions do. Fetch the pixels with
+ * GPU_framebuffer_readback_result_get() (this frees the handle), optionally
+ * polling GPU_framebuffer_readback_ready() to avoid waiting. Both the start
+ * and fetch need the context the frame-buffer belongs to to be active. */
+typedef struct GPUFrameBufferReadback GPUFrameBufferReadback;
+
+GPUFrameBufferReadback *GPU_framebuffer_read_depth_async(
+    GPUFrameBuffer *fb, int x, int y, int w, int h, eGPUDataFormat format);
+GPUFrameBufferReadback *GPU_framebuffer_read_color_async(GPUFrameBuffer *fb,
+                                                         int x,
+                                                         int y,
+                                                         int w,
+                                                         int h,
+                                                         int channels,
+                                                         int slot,
+                                                         eGPUDataFormat format);
+bool GPU_framebuffer_readback_ready(const GPUFrameBufferReadback *readback);
+void GPU_framebuffer_readback_result_get(GPUFrameBufferReadback *readback, void *r_data);
+void GPU_framebuffer_readback_discard(GPUFrameBufferReadback *readback);
+
 void GPU_framebuffer_blit(GPUFrameBuffer *fb_read,
                           int read_slot,
                           GPUFrameBuffer *fb_write,
@@ -228,6 +250,7 @@ void GPU_offscreen_free(GPUOffScreen *ofs);
 void GPU_offscreen_bind(GPUOffScreen *ofs, bool save);
 void GPU_offscreen_unbind(GPUOffScreen *ofs, bool restore);
 void GPU_offscreen_read_pixels(GPUOffScreen *ofs, eGPUDataFormat format, void *pixels);
+GPUFrameBufferReadback *GPU_offscreen_read_pixels_async(GPUOffScreen *ofs, eGPUDataFormat format);
 void GPU_offscreen_draw_to_screen(GPUOffScreen *ofs, int x, int y);
 int GPU_offscreen_width(const GPUOffScreen *ofs);
 int GPU_offscreen_height(const GPUOffScreen *ofs);
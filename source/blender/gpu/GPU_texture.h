@@ -207,6 +207,25 @@ GPUTexture *GPU_texture_create_cube(
 GPUTexture *GPU_texture_create_cube_array(
     const char *name, int w, int d, int mips, eGPUTextureFormat format, const float *data);
 
+/**
+ * Sparse 3D texture, only regions committed through #GPU_texture_sparse_update_region are
+ * backed by video memory. Uncommitted regions sample as zero. Returns NULL when the backend
+ * or the format does not support sparse allocation, the caller is expected to fall back to
+ * a regular dense texture. \a r_page_size receives the commitment granularity in pixels.
+ */
+GPUTexture *GPU_texture_create_3d_sparse(
+    const char *name, int w, int h, int d, eGPUTextureFormat texture_format, int r_page_size[3]);
+/**
+ * Commit the given region of a sparse texture and upload \a data into it. The region is
+ * internally expanded to page granularity; \a data holds tightly packed pixels for exactly
+ * \a extent.
+ */
+void GPU_texture_sparse_update_region(GPUTexture *tex,
+                                      const int offset[3],
+                                      const int extent[3],
+                                      eGPUDataFormat data_format,
+                                      const void *data);
+
 /* Special textures. */
 GPUTexture *GPU_texture_create_from_vertbuf(const char *name, struct GPUVertBuf *vert);
 /**
@@ -231,6 +250,21 @@ void GPU_texture_update_sub(GPUTexture *tex,
                             int width,
                             int height,
                             int depth);
+/**
+ * Same as GPU_texture_update / GPU_texture_update_sub, but the transfer is staged through a
+ * pixel buffer object so the driver can schedule it asynchronously instead of stalling on
+ * in-flight draw calls using the texture. \a pixels is consumed before returning.
+ */
+void GPU_texture_update_async(GPUTexture *tex, eGPUDataFormat data_format, const void *data);
+void GPU_texture_update_sub_async(GPUTexture *tex,
+                                  eGPUDataFormat data_format,
+                                  const void *pixels,
+                                  int offset_x,
+                                  int offset_y,
+                                  int offset_z,
+                                  int width,
+                                  int height,
+                                  int depth);
 void GPU_unpack_row_length_set(uint len);
 
 void *GPU_texture_read(GPUTexture *tex, eGPUDataFormat data_format, int miplvl);
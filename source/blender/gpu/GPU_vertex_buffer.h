@@ -145,6 +145,9 @@ const GPUVertFormat *GPU_vertbuf_get_format(const GPUVertBuf *verts);
 uint GPU_vertbuf_get_vertex_alloc(const GPUVertBuf *verts);
 uint GPU_vertbuf_get_vertex_len(const GPUVertBuf *verts);
 GPUVertBufStatus GPU_vertbuf_get_status(const GPUVertBuf *verts);
+/* Mark the CPU side data as being in sync with the GPU copy again. Only valid after the buffer
+ * has been uploaded and the modified region has been sent with #GPU_vertbuf_update_sub. */
+void GPU_vertbuf_tag_clean(GPUVertBuf *verts);
 
 void GPU_vertbuf_use(GPUVertBuf *);
 void GPU_vertbuf_bind_as_ssbo(struct GPUVertBuf *verts, int binding);
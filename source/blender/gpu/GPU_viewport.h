@@ -60,6 +60,8 @@ typedef struct ViewportMemoryPool {
   struct GPUUniformBuf **obinfos_ubo;
   struct GHash *obattrs_ubo_pool;
   uint ubo_len;
+  /** Per viewport occlusion culling snapshot (see draw_manager_occlusion.c). */
+  struct DRWOcclusionBuffer *occlusion_buffer;
 } ViewportMemoryPool;
 
 /* All FramebufferLists are just the same pointers with different names. */
@@ -96,6 +96,14 @@ struct GPU_PBVH_Buffers {
   bool smooth;
 
   bool show_overlay;
+
+  /* Range of VBO elements modified by the last update, used to only send the
+   * changed sub-range to the GPU on flush. Only tracked by the regular mesh
+   * path; when partial_update_possible is false the whole buffer is sent.
+   * An empty range (min > max) means the existing GPU copy is up to date. */
+  uint dirty_elem_min;
+  uint dirty_elem_max;
+  bool partial_update_possible;
 };
 
 static struct {
@@ -157,12 +165,26 @@ static bool gpu_pbvh_vert_buf_data_set(GPU_PBVH_Buffers *buffers, uint vert_len)
       GPU_vertbuf_get_vertex_len(buffers->vert_buf) != vert_len) {
     /* Allocate buffer if not allocated yet or size changed. */
     GPU_vertbuf_data_alloc(buffers->vert_buf, vert_len);
+    /* The new memory is uninitialized, it can not be compared against. */
+    buffers->partial_update_possible = false;
   }
 #endif
 
   return GPU_vertbuf_get_data(buffers->vert_buf) != NULL;
 }
 
+/* Write a single attribute value, advancing the raw access pointer. Returns true when the value
+ * differs from what the buffer (and with it the GPU copy) already contained. */
+static bool gpu_pbvh_vbo_elem_update(GPUVertBufRaw *access, const void *data, const uint size)
+{
+  void *elem = GPU_vertbuf_raw_step(access);
+  if (memcmp(elem, data, size) != 0) {
+    memcpy(elem, data, size);
+    return true;
+  }
+  return false;
+}
+
 static void gpu_pbvh_batch_init(GPU_PBVH_Buffers *buffers, GPUPrimType prim)
 {
   if (buffers->triangles == NULL) {
@@ -226,6 +248,13 @@ void GPU_pbvh_mesh_buffers_update(GPU_PBVH_Buffers *buffers,
   {
     const int totelem = buffers->tot_tri * 3;
 
+    /* Track the range of elements which actually change, so only that range
+     * needs to be sent to the GPU on flush. Cleared again by
+     * gpu_pbvh_vert_buf_data_set() when the buffer had to be (re)allocated. */
+    buffers->partial_update_possible = true;
+    buffers->dirty_elem_min = UINT_MAX;
+    buffers->dirty_elem_max = 0;
+
     /* Build VBO */
     if (gpu_pbvh_vert_buf_data_set(buffers, totelem)) {
       GPUVertBufRaw pos_step = {0};
@@ -245,6 +274,7 @@ void GPU_pbvh_mesh_buffers_update(GPU_PBVH_Buffers *buffers,
       /* calculate normal for each polygon only once */
       uint mpoly_prev = UINT_MAX;
       short no[3] = {0, 0, 0};
+      uint elem_index = 0;
 
       for (uint i = 0; i < buffers->face_indices_len; i++) {
         const MLoopTri *lt = &buffers->looptri[buffers->face_indices[i]];
@@ -286,18 +316,18 @@ void GPU_pbvh_mesh_buffers_update(GPU_PBVH_Buffers *buffers,
 
         for (uint j = 0; j < 3; j++) {
           const MVert *v = &mvert[vtri[j]];
-          copy_v3_v3(GPU_vertbuf_raw_step(&pos_step), v->co);
+          bool elem_changed = gpu_pbvh_vbo_elem_update(&pos_step, v->co, sizeof(float[3]));
 
           if (buffers->smooth) {
             copy_v3_v3_short(no, v->no);
           }
-          copy_v3_v3_short(GPU_vertbuf_raw_step(&nor_step), no);
+          elem_changed |= gpu_pbvh_vbo_elem_update(&nor_step, no, sizeof(short[3]));
 
           if (show_mask && buffers->smooth) {
             cmask = (uchar)(vmask[vtri[j]] * 255);
           }
 
-          *(uchar *)GPU_vertbuf_raw_step(&msk_step) = cmask;
+          elem_changed |= gpu_pbvh_vbo_elem_update(&msk_step, &cmask, sizeof(uchar));
           empty_mask = empty_mask && (cmask == 0);
           /* Vertex Colors. */
           if (show_vcol) {
@@ -307,7 +337,6 @@ void GPU_pbvh_mesh_buffers_update(GPU_PBVH_Buffers *buffers,
               scol[1] = unit_float_to_ushort_clamp(vtcol[vtri[j]].color[1]);
               scol[2] = unit_float_to_ushort_clamp(vtcol[vtri[j]].color[2]);
               scol[3] = unit_float_to_ushort_clamp(vtcol[vtri[j]].color[3]);
-              memcpy(GPU_vertbuf_raw_step(&col_step), scol, sizeof(scol));
             }
             else {
               const uint loop_index = lt->tri[j];
@@ -316,11 +345,17 @@ void GPU_pbvh_mesh_buffers_update(GPU_PBVH_Buffers *buffers,
               scol[1] = unit_float_to_ushort_clamp(BLI_color_from_srgb_table[mcol->g]);
               scol[2] = unit_float_to_ushort_clamp(BLI_color_from_srgb_table[mcol->b]);
               scol[3] = unit_float_to_ushort_clamp(mcol->a * (1.0f / 255.0f));
-              memcpy(GPU_vertbuf_raw_step(&col_step), scol, sizeof(scol));
             }
+            elem_changed |= gpu_pbvh_vbo_elem_update(&col_step, scol, sizeof(scol));
           }
           /* Face Sets. */
-          memcpy(GPU_vertbuf_raw_step(&fset_step), face_set_color, sizeof(uchar[3]));
+          elem_changed |= gpu_pbvh_vbo_elem_update(&fset_step, face_set_color, sizeof(uchar[3]));
+
+          if (elem_changed) {
+            buffers->dirty_elem_min = MIN2(buffers->dirty_elem_min, elem_index);
+            buffers->dirty_elem_max = MAX2(buffers->dirty_elem_max, elem_index);
+          }
+          elem_index++;
         }
       }
     }
@@ -606,6 +641,9 @@ void GPU_pbvh_grid_buffers_update(GPU_PBVH_Buffers *buffers,
 
   int i, j, k, x, y;
 
+  /* Modified ranges are not tracked for grids, flush the whole buffer. */
+  buffers->partial_update_possible = false;
+
   /* Build VBO */
   const int has_mask = key->has_mask;
 
@@ -894,6 +932,9 @@ void GPU_pbvh_bmesh_buffers_update(GPU_PBVH_Buffers *buffers,
   bool empty_mask = true;
   BMFace *f = NULL;
 
+  /* Modified ranges are not tracked for bmesh, flush the whole buffer. */
+  buffers->partial_update_possible = false;
+
   /* Count visible triangles */
   tottri = gpu_bmesh_face_visible_count(bm_faces);
 
@@ -1103,7 +1144,22 @@ void GPU_pbvh_buffers_update_flush(GPU_PBVH_Buffers *buffers)
 
   /* Force flushing to the GPU. */
   if (buffers->vert_buf && GPU_vertbuf_get_data(buffers->vert_buf)) {
-    GPU_vertbuf_use(buffers->vert_buf);
+    if (buffers->partial_update_possible &&
+        (GPU_vertbuf_get_status(buffers->vert_buf) & GPU_VERTBUF_DATA_UPLOADED)) {
+      /* Only send the range of elements which was modified by the update,
+       * instead of re-uploading the whole node. */
+      if (buffers->dirty_elem_min <= buffers->dirty_elem_max) {
+        const uint stride = GPU_vertbuf_get_format(buffers->vert_buf)->stride;
+        const uint start = buffers->dirty_elem_min * stride;
+        const uint len = (buffers->dirty_elem_max - buffers->dirty_elem_min + 1) * stride;
+        char *data = (char *)GPU_vertbuf_get_data(buffers->vert_buf);
+        GPU_vertbuf_update_sub(buffers->vert_buf, start, len, data + start);
+      }
+      GPU_vertbuf_tag_clean(buffers->vert_buf);
+    }
+    else {
+      GPU_vertbuf_use(buffers->vert_buf);
+    }
   }
 }
 
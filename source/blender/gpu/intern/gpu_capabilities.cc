@@ -173,6 +173,11 @@ bool GPU_shader_image_load_store_support(void)
   return GCaps.shader_image_load_store_support;
 }
 
+bool GPU_texture_3d_sparse_support(void)
+{
+  return GCaps.texture_3d_sparse_support;
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -417,6 +417,43 @@ void GPU_framebuffer_read_color(GPUFrameBuffer *gpu_fb,
   unwrap(gpu_fb)->read(GPU_COLOR_BIT, format, rect, channels, slot, data);
 }
 
+GPUFrameBufferReadback *GPU_framebuffer_read_depth_async(
+    GPUFrameBuffer *gpu_fb, int x, int y, int w, int h, eGPUDataFormat format)
+{
+  int rect[4] = {x, y, w, h};
+  return wrap(unwrap(gpu_fb)->read_async(GPU_DEPTH_BIT, format, rect, 1, 1));
+}
+
+GPUFrameBufferReadback *GPU_framebuffer_read_color_async(GPUFrameBuffer *gpu_fb,
+                                                         int x,
+                                                         int y,
+                                                         int w,
+                                                         int h,
+                                                         int channels,
+                                                         int slot,
+                                                         eGPUDataFormat format)
+{
+  int rect[4] = {x, y, w, h};
+  return wrap(unwrap(gpu_fb)->read_async(GPU_COLOR_BIT, format, rect, channels, slot));
+}
+
+bool GPU_framebuffer_readback_ready(const GPUFrameBufferReadback *readback)
+{
+  return unwrap(readback)->is_ready();
+}
+
+void GPU_framebuffer_readback_result_get(GPUFrameBufferReadback *readback, void *r_data)
+{
+  FrameBufferReadback *readback_ = unwrap(readback);
+  readback_->result_get(r_data);
+  delete readback_;
+}
+
+void GPU_framebuffer_readback_discard(GPUFrameBufferReadback *readback)
+{
+  delete unwrap(readback);
+}
+
 /* TODO(fclem): rename to read_color. */
 void GPU_frontbuffer_read_pixels(
     int x, int y, int w, int h, int channels, eGPUDataFormat format, void *data)
@@ -690,6 +727,17 @@ void GPU_offscreen_read_pixels(GPUOffScreen *ofs, eGPUDataFormat format, void *p
   GPU_framebuffer_read_color(ofs_fb, 0, 0, w, h, 4, 0, format, pixels);
 }
 
+GPUFrameBufferReadback *GPU_offscreen_read_pixels_async(GPUOffScreen *ofs, eGPUDataFormat format)
+{
+  BLI_assert(ELEM(format, GPU_DATA_UBYTE, GPU_DATA_FLOAT));
+
+  const int w = GPU_texture_width(ofs->color);
+  const int h = GPU_texture_height(ofs->color);
+
+  GPUFrameBuffer *ofs_fb = gpu_offscreen_fb_get(ofs);
+  return GPU_framebuffer_read_color_async(ofs_fb, 0, 0, w, h, 4, 0, format);
+}
+
 int GPU_offscreen_width(const GPUOffScreen *ofs)
 {
   return GPU_texture_width(ofs->color);
@@ -136,6 +136,12 @@ class FrameBuffer {
                     int slot,
                     void *r_data) = 0;
 
+  virtual class FrameBufferReadback *read_async(eGPUFrameBufferBits planes,
+                                                eGPUDataFormat format,
+                                                const int area[4],
+                                                int channel_len,
+                                                int slot) = 0;
+
   virtual void blit_to(eGPUFrameBufferBits planes,
                        int src_slot,
                        FrameBuffer *dst,
@@ -219,6 +225,21 @@ class FrameBuffer {
   };
 };
 
+/**
+ * Tracks an in-flight asynchronous pixel readback started with
+ * #FrameBuffer::read_async. The pixels are transferred to a driver owned
+ * buffer without stalling the pipeline and copied out on #result_get.
+ */
+class FrameBufferReadback {
+ public:
+  virtual ~FrameBufferReadback(){};
+
+  /** Return true if #result_get will not have to wait for the GPU. */
+  virtual bool is_ready(void) const = 0;
+  /** Copy the pixels to r_data. Blocks until the transfer is done if needed. */
+  virtual void result_get(void *r_data) = 0;
+};
+
 /* Syntactic sugar. */
 static inline GPUFrameBuffer *wrap(FrameBuffer *vert)
 {
@@ -228,6 +249,18 @@ static inline FrameBuffer *unwrap(GPUFrameBuffer *vert)
 {
   return reinterpret_cast<FrameBuffer *>(vert);
 }
+static inline GPUFrameBufferReadback *wrap(FrameBufferReadback *readback)
+{
+  return reinterpret_cast<GPUFrameBufferReadback *>(readback);
+}
+static inline FrameBufferReadback *unwrap(GPUFrameBufferReadback *readback)
+{
+  return reinterpret_cast<FrameBufferReadback *>(readback);
+}
+static inline const FrameBufferReadback *unwrap(const GPUFrameBufferReadback *readback)
+{
+  return reinterpret_cast<const FrameBufferReadback *>(readback);
+}
 static inline const FrameBuffer *unwrap(const GPUFrameBuffer *vert)
 {
   return reinterpret_cast<const FrameBuffer *>(vert);
@@ -110,6 +110,13 @@ bool Texture::init_3D(int w, int h, int d, eGPUTextureFormat format)
   return this->init_internal();
 }
 
+bool Texture::init_3D_sparse(int w, int h, int d, eGPUTextureFormat format)
+{
+  /* Must be set before init_internal() so the backend allocates sparse storage. */
+  is_sparse_ = true;
+  return this->init_3D(w, h, d, format);
+}
+
 bool Texture::init_cubemap(int w, int layers, eGPUTextureFormat format)
 {
   w_ = w;
@@ -177,6 +184,14 @@ void Texture::update(eGPUDataFormat format, const void *data)
   this->update_sub(mip, offset, extent, format, data);
 }
 
+void Texture::update_async(eGPUDataFormat format, const void *data)
+{
+  int mip = 0;
+  int extent[3], offset[3] = {0, 0, 0};
+  this->mip_size_get(mip, extent);
+  this->update_sub_async(mip, offset, extent, format, data);
+}
+
 /** \} */
 
 }  // namespace blender::gpu
@@ -279,6 +294,27 @@ GPUTexture *GPU_texture_create_3d(const char *name,
       name, w, h, d, GPU_TEXTURE_3D, mips, texture_format, data_format, data);
 }
 
+GPUTexture *GPU_texture_create_3d_sparse(
+    const char *name, int w, int h, int d, eGPUTextureFormat texture_format, int r_page_size[3])
+{
+  Texture *tex = GPUBackend::get()->texture_alloc(name);
+  if (!tex->init_3D_sparse(w, h, d, texture_format)) {
+    delete tex;
+    return nullptr;
+  }
+  tex->sparse_page_size_get(r_page_size);
+  return reinterpret_cast<GPUTexture *>(tex);
+}
+
+void GPU_texture_sparse_update_region(GPUTexture *tex,
+                                      const int offset[3],
+                                      const int extent[3],
+                                      eGPUDataFormat data_format,
+                                      const void *data)
+{
+  reinterpret_cast<Texture *>(tex)->sparse_update_region(offset, extent, data_format, data);
+}
+
 GPUTexture *GPU_texture_create_cube(
     const char *name, int w, int mips, eGPUTextureFormat format, const float *data)
 {
@@ -399,6 +435,27 @@ void GPU_texture_update(GPUTexture *tex, eGPUDataFormat data_format, const void
   reinterpret_cast<Texture *>(tex)->update(data_format, data);
 }
 
+/* NOTE: Updates only mip 0. */
+void GPU_texture_update_async(GPUTexture *tex, eGPUDataFormat data_format, const void *data)
+{
+  reinterpret_cast<Texture *>(tex)->update_async(data_format, data);
+}
+
+void GPU_texture_update_sub_async(GPUTexture *tex,
+                                  eGPUDataFormat data_format,
+                                  const void *pixels,
+                                  int offset_x,
+                                  int offset_y,
+                                  int offset_z,
+                                  int width,
+                                  int height,
+                                  int depth)
+{
+  int offset[3] = {offset_x, offset_y, offset_z};
+  int extent[3] = {width, height, depth};
+  reinterpret_cast<Texture *>(tex)->update_sub_async(0, offset, extent, data_format, pixels);
+}
+
 /* Makes data interpretation aware of the source layout.
  * Skipping pixels correctly when changing rows when doing partial update. */
 void GPU_unpack_row_length_set(uint len)
@@ -98,6 +98,10 @@ class Texture {
   eGPUTextureFormatFlag format_flag_;
   /** Texture type. */
   eGPUTextureType type_;
+  /** True when only explicitly committed regions of the texture are backed by memory. */
+  bool is_sparse_ = false;
+  /** Commitment granularity of a sparse texture, in pixels. */
+  int sparse_page_size_[3] = {1, 1, 1};
 
   /** Number of mipmaps this texture has (Max miplvl). */
   /* TODO(fclem): Should become immutable and the need for mipmaps should be specified upfront. */
@@ -120,6 +124,7 @@ class Texture {
   bool init_1D(int w, int layers, eGPUTextureFormat format);
   bool init_2D(int w, int h, int layers, eGPUTextureFormat format);
   bool init_3D(int w, int h, int d, eGPUTextureFormat format);
+  bool init_3D_sparse(int w, int h, int d, eGPUTextureFormat format);
   bool init_cubemap(int w, int layers, eGPUTextureFormat format);
   bool init_buffer(GPUVertBuf *vbo, eGPUTextureFormat format);
 
@@ -133,13 +138,52 @@ class Texture {
   void attach_to(FrameBuffer *fb, GPUAttachmentType type);
   void detach_from(FrameBuffer *fb);
   void update(eGPUDataFormat format, const void *data);
+  void update_async(eGPUDataFormat format, const void *data);
 
   virtual void update_sub(
       int mip, int offset[3], int extent[3], eGPUDataFormat format, const void *data) = 0;
 
+  /**
+   * Same as update_sub(), but the transfer to the texture may be deferred inside the driver
+   * through a staging buffer, avoiding a synchronization with in-flight draw calls using this
+   * texture. The pixel data is consumed before returning. Backends without a dedicated async
+   * path fall back to update_sub().
+   */
+  virtual void update_sub_async(
+      int mip, int offset[3], int extent[3], eGPUDataFormat format, const void *data)
+  {
+    this->update_sub(mip, offset, extent, format, data);
+  }
+
+  /**
+   * Commit the given region of a sparse texture and upload data into it. The region is
+   * expanded to page granularity internally. Only valid on textures created through
+   * init_3D_sparse().
+   */
+  virtual void sparse_update_region(const int offset[3],
+                                    const int extent[3],
+                                    eGPUDataFormat format,
+                                    const void *data)
+  {
+    int mip_offset[3] = {offset[0], offset[1], offset[2]};
+    int mip_extent[3] = {extent[0], extent[1], extent[2]};
+    this->update_sub(0, mip_offset, mip_extent, format, data);
+  }
+
   /* TODO(fclem): Legacy. Should be removed at some point. */
   virtual uint gl_bindcode_get(void) const = 0;
 
+  bool is_sparse(void) const
+  {
+    return is_sparse_;
+  }
+  void sparse_page_size_get(int r_size[3]) const
+  {
+    r_size[0] = sparse_page_size_[0];
+    r_size[1] = sparse_page_size_[1];
+    r_size[2] = sparse_page_size_[2];
+  }
+
   int width_get(void) const
   {
     return w_;
@@ -323,6 +323,12 @@ GPUVertBufStatus GPU_vertbuf_get_status(const GPUVertBuf *verts)
   return unwrap(verts)->flag;
 }
 
+void GPU_vertbuf_tag_clean(GPUVertBuf *verts)
+{
+  BLI_assert(unwrap(verts)->flag & GPU_VERTBUF_DATA_UPLOADED);
+  unwrap(verts)->flag &= ~GPU_VERTBUF_DATA_DIRTY;
+}
+
 uint GPU_vertbuf_get_memory_usage()
 {
   return VertBuf::memory_usage;
@@ -1032,6 +1032,9 @@ void GPU_viewport_free(GPUViewport *viewport)
   if (viewport->vmempool.obattrs_ubo_pool != NULL) {
     DRW_uniform_attrs_pool_free(viewport->vmempool.obattrs_ubo_pool);
   }
+  if (viewport->vmempool.occlusion_buffer != NULL) {
+    DRW_occlusion_buffer_free(viewport->vmempool.occlusion_buffer);
+  }
 
   for (int i = 0; i < viewport->vmempool.ubo_len; i++) {
     GPU_uniformbuf_free(viewport->vmempool.matrices_ubo[i]);
@@ -0,0 +1,126 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ * All rights reserved.
+ */
+
+/** \file
+ * \ingroup gpu
+ *
+ * Persistently mapped ring-buffer for streaming data to the GPU.
+ */
+
+#include "BLI_assert.h"
+
+#include "gl_context.hh"
+#include "gl_debug.hh"
+
+#include "gl_buffer_ring.hh"
+
+namespace blender::gpu {
+
+/* -------------------------------------------------------------------- */
+/** \name Creation & Deletion
+ * \{ */
+
+GLBufferRing::GLBufferRing()
+{
+  if (!GLContext::buffer_storage_support) {
+    return;
+  }
+
+  const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+  glGenBuffers(1, &buf_id_);
+  glBindBuffer(GL_ARRAY_BUFFER, buf_id_);
+  glBufferStorage(GL_ARRAY_BUFFER, ring_size, nullptr, flags);
+  mapped_ = static_cast<char *>(glMapBufferRange(GL_ARRAY_BUFFER, 0, ring_size, flags));
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  if (mapped_ == nullptr) {
+    glDeleteBuffers(1, &buf_id_);
+    buf_id_ = 0;
+    return;
+  }
+
+  debug::object_label(GL_BUFFER, buf_id_, "BufferRing");
+}
+
+GLBufferRing::~GLBufferRing()
+{
+  for (int i = 0; i < section_len; i++) {
+    if (section_fences_[i]) {
+      glDeleteSync(section_fences_[i]);
+    }
+  }
+  if (buf_id_ != 0) {
+    glBindBuffer(GL_ARRAY_BUFFER, buf_id_);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glDeleteBuffers(1, &buf_id_);
+  }
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Allocation
+ * \{ */
+
+size_t GLBufferRing::alloc(const size_t size, const size_t alignment)
+{
+  BLI_assert(is_valid());
+  BLI_assert(size > 0 && size <= max_alloc_size);
+  BLI_assert(alignment > 0);
+
+  size_t offset = head_;
+  const size_t misalign = offset % alignment;
+  if (misalign != 0) {
+    offset += alignment - misalign;
+  }
+  if (offset + size > ring_size) {
+    /* Wrap back to the buffer start. */
+    offset = 0;
+  }
+
+  const int last_section = int((offset + size - 1) / section_size);
+  while (current_section_ != last_section) {
+    /* Done filling the current section. Fence it so its reuse on the next lap waits until the
+     * GPU has consumed all commands reading from it. */
+    BLI_assert(section_fences_[current_section_] == nullptr);
+    section_fences_[current_section_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    current_section_ = (current_section_ + 1) % section_len;
+
+    GLsync &fence = section_fences_[current_section_];
+    if (fence) {
+      /* This stalls only when the GPU is more than a full ring behind the CPU. */
+      GLenum status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+      while (status == GL_TIMEOUT_EXPIRED) {
+        status = glClientWaitSync(fence, 0, 1000000 /* 1ms */);
+      }
+      glDeleteSync(fence);
+      fence = nullptr;
+    }
+  }
+
+  head_ = offset + size;
+  return offset;
+}
+
+/** \} */
+
+}  // namespace blender::gpu
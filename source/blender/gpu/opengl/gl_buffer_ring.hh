@@ -0,0 +1,95 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ * All rights reserved.
+ */
+
+/** \file
+ * \ingroup gpu
+ *
+ * Persistently mapped ring-buffer for streaming data to the GPU.
+ */
+
+#pragma once
+
+#include "MEM_guardedalloc.h"
+
+#include "glew-mx.h"
+
+namespace blender::gpu {
+
+/**
+ * A persistently mapped coherent buffer (GL_ARB_buffer_storage) used as a ring allocator for
+ * transient data: immediate mode vertices and uniform buffer upload staging. Writing through the
+ * persistent mapping avoids the per-draw glMapBufferRange / glUnmapBuffer and buffer orphaning
+ * churn that some drivers turn into full stalls.
+ *
+ * The ring is divided into sections. A fence is inserted when the allocator leaves a section, and
+ * reuse of a section waits on its fence, so the CPU never overwrites data the GPU has not
+ * consumed yet. Allocations are only valid for commands issued before the ring wraps back around,
+ * which holds for immediate mode (drawn inside the begin/end pair) and copy staging (copied right
+ * after the write).
+ */
+class GLBufferRing {
+ public:
+  static constexpr size_t ring_size = 8 * 1024 * 1024;
+  /** Largest single allocation. Bigger requests must use their own buffer. */
+  static constexpr size_t max_alloc_size = ring_size / 4;
+
+ private:
+  static constexpr int section_len = 4;
+  static constexpr size_t section_size = ring_size / section_len;
+
+  /** Opengl Handle for the buffer. 0 if creation failed or is unsupported. */
+  GLuint buf_id_ = 0;
+  /** Persistent coherent mapping of the whole buffer. */
+  char *mapped_ = nullptr;
+  /** Offset of the next allocation. */
+  size_t head_ = 0;
+  /** Section currently being filled. */
+  int current_section_ = 0;
+  /** One fence per section, signaled when the GPU is done reading from it. */
+  GLsync section_fences_[section_len] = {nullptr, nullptr, nullptr, nullptr};
+
+ public:
+  GLBufferRing();
+  ~GLBufferRing();
+
+  bool is_valid() const
+  {
+    return mapped_ != nullptr;
+  }
+
+  GLuint gl_id() const
+  {
+    return buf_id_;
+  }
+
+  /**
+   * Reserve `size` bytes, with the returned offset being a multiple of `alignment`.
+   * May block until the GPU has finished reading the reused region.
+   */
+  size_t alloc(size_t size, size_t alignment);
+
+  char *data(size_t offset)
+  {
+    return mapped_ + offset;
+  }
+
+  MEM_CXX_CLASS_ALLOC_FUNCS("GLBufferRing")
+};
+
+}  // namespace blender::gpu
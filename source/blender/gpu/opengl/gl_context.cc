@@ -34,6 +34,7 @@
 #include "gpu_context_private.hh"
 #include "gpu_immediate_private.hh"
 
+#include "gl_buffer_ring.hh"
 #include "gl_debug.hh"
 #include "gl_immediate.hh"
 #include "gl_state.hh"
@@ -112,6 +113,7 @@ GLContext::~GLContext()
   for (GLVaoCache *cache : vao_caches_) {
     cache->clear();
   }
+  delete buffer_ring_;
   glDeleteBuffers(1, &default_attr_vbo_);
 }
 
@@ -304,6 +306,23 @@ void GLContext::vao_cache_unregister(GLVaoCache *cache)
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Streaming buffer ring
+ * \{ */
+
+GLBufferRing *GLContext::buffer_ring_get()
+{
+  if (!GLContext::buffer_storage_support) {
+    return nullptr;
+  }
+  if (buffer_ring_ == nullptr) {
+    buffer_ring_ = new GLBufferRing();
+  }
+  return buffer_ring_->is_valid() ? buffer_ring_ : nullptr;
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Memory statistics
  * \{ */
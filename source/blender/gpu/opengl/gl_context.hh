@@ -39,6 +39,7 @@
 namespace blender {
 namespace gpu {
 
+class GLBufferRing;
 class GLVaoCache;
 
 class GLSharedOrphanLists {
@@ -62,6 +63,7 @@ class GLContext : public Context {
   static GLint max_ubo_binds;
   /** Extensions. */
   static bool base_instance_support;
+  static bool buffer_storage_support;
   static bool clear_texture_support;
   static bool copy_image_support;
   static bool debug_layer_support;
@@ -69,6 +71,7 @@ class GLContext : public Context {
   static bool fixed_restart_index_support;
   static bool multi_bind_support;
   static bool multi_draw_indirect_support;
+  static bool program_binary_support;
   static bool shader_draw_parameters_support;
   static bool texture_cube_map_array_support;
   static bool texture_filter_anisotropic_support;
@@ -99,6 +102,8 @@ class GLContext : public Context {
   Vector<GLuint> orphaned_framebuffers_;
   /** #GLBackend owns this data. */
   GLSharedOrphanLists &shared_orphan_list_;
+  /** Persistent mapped ring for immediate mode and buffer upload staging. Created on demand. */
+  GLBufferRing *buffer_ring_ = nullptr;
 
  public:
   GLContext(void *ghost_window, GLSharedOrphanLists &shared_orphan_list);
@@ -135,6 +140,9 @@ class GLContext : public Context {
   void vao_cache_register(GLVaoCache *cache);
   void vao_cache_unregister(GLVaoCache *cache);
 
+  /** Returns NULL when persistent buffer mapping is unsupported. */
+  GLBufferRing *buffer_ring_get(void);
+
   void debug_group_begin(const char *name, int index) override;
   void debug_group_end(void) override;
 
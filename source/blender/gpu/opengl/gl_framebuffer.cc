@@ -416,34 +416,48 @@ void GLFrameBuffer::clear_multi(const float (*clear_cols)[4])
   }
 }
 
-void GLFrameBuffer::read(eGPUFrameBufferBits plane,
-                         eGPUDataFormat data_format,
-                         const int area[4],
-                         int channel_len,
-                         int slot,
-                         void *r_data)
+bool GLFrameBuffer::read_format_get(eGPUFrameBufferBits plane,
+                                    eGPUDataFormat data_format,
+                                    int channel_len,
+                                    int slot,
+                                    GLenum *r_mode,
+                                    GLenum *r_format,
+                                    GLenum *r_type)
 {
-  GLenum format, type, mode;
-  mode = gl_attachments_[slot];
-  type = to_gl(data_format);
+  *r_mode = gl_attachments_[slot];
+  *r_type = to_gl(data_format);
 
   switch (plane) {
     case GPU_DEPTH_BIT:
-      format = GL_DEPTH_COMPONENT;
+      *r_format = GL_DEPTH_COMPONENT;
       break;
     case GPU_COLOR_BIT:
-      format = channel_len_to_gl(channel_len);
+      *r_format = channel_len_to_gl(channel_len);
       /* TODO: needed for selection buffers to work properly, this should be handled better. */
-      if (format == GL_RED && type == GL_UNSIGNED_INT) {
-        format = GL_RED_INTEGER;
+      if (*r_format == GL_RED && *r_type == GL_UNSIGNED_INT) {
+        *r_format = GL_RED_INTEGER;
       }
       break;
     case GPU_STENCIL_BIT:
       fprintf(stderr, "GPUFramebuffer: Error: Trying to read stencil bit. Unsupported.");
-      return;
+      return false;
     default:
       fprintf(stderr, "GPUFramebuffer: Error: Trying to read more than one frame-buffer plane.");
-      return;
+      return false;
+  }
+  return true;
+}
+
+void GLFrameBuffer::read(eGPUFrameBufferBits plane,
+                         eGPUDataFormat data_format,
+                         const int area[4],
+                         int channel_len,
+                         int slot,
+                         void *r_data)
+{
+  GLenum format, type, mode;
+  if (!read_format_get(plane, data_format, channel_len, slot, &mode, &format, &type)) {
+    return;
   }
 
   glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo_id_);
@@ -451,6 +465,71 @@ void GLFrameBuffer::read(eGPUFrameBufferBits plane,
   glReadPixels(UNPACK4(area), format, type, r_data);
 }
 
+FrameBufferReadback *GLFrameBuffer::read_async(eGPUFrameBufferBits plane,
+                                               eGPUDataFormat data_format,
+                                               const int area[4],
+                                               int channel_len,
+                                               int slot)
+{
+  GLenum format, type, mode;
+  if (!read_format_get(plane, data_format, channel_len, slot, &mode, &format, &type)) {
+    return nullptr;
+  }
+
+  size_t byte_len = size_t(area[2]) * area[3] * channel_len * to_bytesize(data_format);
+
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo_id_);
+  glReadBuffer(mode);
+
+  return new GLFrameBufferReadback(format, type, area, byte_len);
+}
+
+GLFrameBufferReadback::GLFrameBufferReadback(GLenum gl_format,
+                                             GLenum gl_type,
+                                             const int area[4],
+                                             size_t byte_len)
+    : byte_len_(byte_len)
+{
+  glGenBuffers(1, &pbo_id_);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo_id_);
+  glBufferData(GL_PIXEL_PACK_BUFFER, byte_len_, NULL, GL_STREAM_READ);
+  /* Returns immediately: the transfer into the pack buffer is queued on the GPU timeline. */
+  glReadPixels(UNPACK4(area), gl_format, gl_type, NULL);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  fence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  /* Make sure the transfer starts without forcing a wait. */
+  glFlush();
+}
+
+GLFrameBufferReadback::~GLFrameBufferReadback()
+{
+  if (fence_ != NULL) {
+    glDeleteSync(fence_);
+  }
+  glDeleteBuffers(1, &pbo_id_);
+}
+
+bool GLFrameBufferReadback::is_ready(void) const
+{
+  return (glClientWaitSync(fence_, 0, 0) != GL_TIMEOUT_EXPIRED);
+}
+
+void GLFrameBufferReadback::result_get(void *r_data)
+{
+  /* Wait in small increments to avoid OS wait-timer overshoot (see gl_buffer_ring.cc). */
+  GLenum status = glClientWaitSync(fence_, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+  while (status == GL_TIMEOUT_EXPIRED) {
+    status = glClientWaitSync(fence_, 0, 1000000 /* 1ms */);
+  }
+  glDeleteSync(fence_);
+  fence_ = NULL;
+
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo_id_);
+  glGetBufferSubData(GL_PIXEL_PACK_BUFFER, 0, byte_len_, r_data);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
 /**
  * Copy \a src at the give offset inside \a dst.
  */
@@ -97,6 +97,12 @@ class GLFrameBuffer : public FrameBuffer {
             int slot,
             void *r_data) override;
 
+  FrameBufferReadback *read_async(eGPUFrameBufferBits planes,
+                                  eGPUDataFormat format,
+                                  const int area[4],
+                                  int channel_len,
+                                  int slot) override;
+
   void blit_to(eGPUFrameBufferBits planes,
                int src_slot,
                FrameBuffer *dst,
@@ -111,9 +117,41 @@ class GLFrameBuffer : public FrameBuffer {
   void update_attachments(void);
   void update_drawbuffers(void);
 
+  bool read_format_get(eGPUFrameBufferBits plane,
+                       eGPUDataFormat data_format,
+                       int channel_len,
+                       int slot,
+                       GLenum *r_mode,
+                       GLenum *r_format,
+                       GLenum *r_type);
+
   MEM_CXX_CLASS_ALLOC_FUNCS("GLFrameBuffer");
 };
 
+/**
+ * Asynchronous readback through a pixel pack buffer. The transfer happens on
+ * the GPU timeline and is awaited on a fence when the result is requested.
+ */
+class GLFrameBufferReadback : public FrameBufferReadback {
+ private:
+  /** Pixel pack buffer receiving the transfer. */
+  GLuint pbo_id_ = 0;
+  /** Signaled once the transfer is complete. */
+  GLsync fence_ = NULL;
+  /** Size of the transfer in bytes. */
+  size_t byte_len_ = 0;
+
+ public:
+  /** Expects the source frame-buffer and read buffer to be bound for reading. */
+  GLFrameBufferReadback(GLenum gl_format, GLenum gl_type, const int area[4], size_t byte_len);
+  ~GLFrameBufferReadback();
+
+  bool is_ready(void) const override;
+  void result_get(void *r_data) override;
+
+  MEM_CXX_CLASS_ALLOC_FUNCS("GLFrameBufferReadback");
+};
+
 /* -------------------------------------------------------------------- */
 /** \name Enums Conversion
  * \{ */
@@ -29,6 +29,7 @@
 #include "gpu_shader_private.hh"
 #include "gpu_vertex_format_private.h"
 
+#include "gl_buffer_ring.hh"
 #include "gl_context.hh"
 #include "gl_debug.hh"
 #include "gl_primitive.hh"
@@ -88,6 +89,20 @@ uchar *GLImmediate::begin()
 
   GL_CHECK_RESOURCES("Immediate");
 
+  /* Fast path: write straight into the persistently mapped buffer ring. This skips the per-draw
+   * glMapBufferRange / glUnmapBuffer and buffer orphaning, which some drivers turn into stalls
+   * on UI heavy screens. */
+  GLBufferRing *ring = GLContext::get()->buffer_ring_get();
+  if (ring && bytes_needed > 0 && bytes_needed <= GLBufferRing::max_alloc_size) {
+    /* Align to the vertex stride so the data offset converts to a first vertex index. */
+    ring_offset_ = ring->alloc(bytes_needed, vertex_format.stride);
+    uses_buffer_ring_ = true;
+    bytes_mapped_ = bytes_needed;
+    glBindBuffer(GL_ARRAY_BUFFER, ring->gl_id());
+    return (uchar *)ring->data(ring_offset_);
+  }
+  uses_buffer_ring_ = false;
+
   glBindBuffer(GL_ARRAY_BUFFER, vbo_id());
 
   bool recreate_buffer = false;
@@ -147,16 +162,21 @@ void GLImmediate::end()
       /* unused buffer bytes are available to the next immBegin */
     }
     /* tell OpenGL what range was modified so it doesn't copy the whole mapped range */
-    glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, buffer_bytes_used);
+    if (!uses_buffer_ring_) {
+      glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, buffer_bytes_used);
+    }
+  }
+  if (!uses_buffer_ring_) {
+    /* The buffer ring stays persistently mapped (coherent), only the legacy path unmaps. */
+    glUnmapBuffer(GL_ARRAY_BUFFER);
   }
-  glUnmapBuffer(GL_ARRAY_BUFFER);
 
   if (vertex_len > 0) {
     GLContext::get()->state_manager->apply_state();
 
     /* We convert the offset in vertex offset from the buffer's start.
      * This works because we added some padding to align the first vertex vertex. */
-    uint v_first = buffer_offset() / vertex_format.stride;
+    uint v_first = (uses_buffer_ring_ ? ring_offset_ : buffer_offset()) / vertex_format.stride;
     GLVertArray::update_bindings(
         vao_id_, v_first, &vertex_format, reinterpret_cast<Shader *>(shader)->interface);
 
@@ -176,7 +196,9 @@ void GLImmediate::end()
     // glBindVertexArray(0);
   }
 
-  buffer_offset() += buffer_bytes_used;
+  if (!uses_buffer_ring_) {
+    buffer_offset() += buffer_bytes_used;
+  }
 }
 
 /** \} */
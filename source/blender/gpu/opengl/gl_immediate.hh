@@ -51,6 +51,11 @@ class GLImmediate : public Immediate {
   } buffer, buffer_strict;
   /** Size in bytes of the mapped region. */
   size_t bytes_mapped_ = 0;
+  /** True when the current begin/end pair writes into the context's persistent buffer ring
+   * instead of mapping one of the buffers above. */
+  bool uses_buffer_ring_ = false;
+  /** Offset of the current allocation inside the buffer ring. */
+  size_t ring_offset_ = 0;
   /** Vertex array for this immediate mode instance. */
   GLuint vao_id_ = 0;
 
@@ -21,8 +21,12 @@
  * \ingroup gpu
  */
 
+#include "BKE_appdir.h"
 #include "BKE_global.h"
 
+#include "BLI_fileops.h"
+#include "BLI_hash_mm2a.h"
+#include "BLI_path_util.h"
 #include "BLI_string.h"
 #include "BLI_vector.hh"
 
@@ -52,6 +56,20 @@ GLShader::GLShader(const char *name) : Shader(name)
   shader_program_ = glCreateProgram();
 
   debug::object_label(GL_PROGRAM, shader_program_, name);
+
+  if (GLContext::program_binary_support && (G.debug & G_DEBUG_GPU) == 0) {
+    use_program_binary_cache_ = true;
+    /* Seed the cache key with the driver identity so that cached binaries do not outlive a
+     * driver (or GPU) change: a stale binary would not even fail gracefully on all drivers. */
+    const GLenum driver_ids[3] = {GL_VENDOR, GL_RENDERER, GL_VERSION};
+    for (int i = 0; i < 3; i++) {
+      const char *id = (const char *)glGetString(driver_ids[i]);
+      if (id != nullptr) {
+        sources_hash_[0] = BLI_hash_mm2((const uchar *)id, strlen(id), sources_hash_[0]);
+        sources_hash_[1] = BLI_hash_mm2((const uchar *)id, strlen(id), ~sources_hash_[1]);
+      }
+    }
+  }
 }
 
 GLShader::~GLShader()
@@ -189,30 +207,213 @@ GLuint GLShader::create_shader_stage(GLenum gl_stage, MutableSpan<const char *>
 
 void GLShader::vertex_shader_from_glsl(MutableSpan<const char *> sources)
 {
+  if (use_program_binary_cache_) {
+    this->stage_sources_store(GL_VERTEX_SHADER, sources);
+    return;
+  }
   vert_shader_ = this->create_shader_stage(GL_VERTEX_SHADER, sources);
 }
 
 void GLShader::geometry_shader_from_glsl(MutableSpan<const char *> sources)
 {
+  if (use_program_binary_cache_) {
+    this->stage_sources_store(GL_GEOMETRY_SHADER, sources);
+    return;
+  }
   geom_shader_ = this->create_shader_stage(GL_GEOMETRY_SHADER, sources);
 }
 
 void GLShader::fragment_shader_from_glsl(MutableSpan<const char *> sources)
 {
+  if (use_program_binary_cache_) {
+    this->stage_sources_store(GL_FRAGMENT_SHADER, sources);
+    return;
+  }
   frag_shader_ = this->create_shader_stage(GL_FRAGMENT_SHADER, sources);
 }
 
 void GLShader::compute_shader_from_glsl(MutableSpan<const char *> sources)
 {
+  if (use_program_binary_cache_) {
+    this->stage_sources_store(GL_COMPUTE_SHADER, sources);
+    return;
+  }
   compute_shader_ = this->create_shader_stage(GL_COMPUTE_SHADER, sources);
 }
 
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Program binary disk cache
+ *
+ * When the driver exposes `ARB_get_program_binary`, GLSL compilation is deferred to #finalize
+ * and the linked program binary is cached on disk, keyed on a hash of the driver identity and
+ * all stage sources. On the next startup the binary is loaded back with `glProgramBinary`,
+ * skipping both compilation and linking. A stale binary (changed sources) is simply never looked
+ * up again, and one rejected by the driver falls back to the regular compilation path.
+ * \{ */
+
+/* Record the given stage sources for deferred compilation and mix them into the cache key. */
+void GLShader::stage_sources_store(GLenum gl_stage, Span<const char *> sources)
+{
+  std::string *dst = nullptr;
+  switch (gl_stage) {
+    case GL_VERTEX_SHADER:
+      dst = &vertex_sources_;
+      break;
+    case GL_GEOMETRY_SHADER:
+      dst = &geometry_sources_;
+      break;
+    case GL_FRAGMENT_SHADER:
+      dst = &fragment_sources_;
+      break;
+    case GL_COMPUTE_SHADER:
+      dst = &compute_sources_;
+      break;
+    default:
+      BLI_assert(0);
+      return;
+  }
+
+  /* The patch string is not stored (#create_shader_stage re-creates it in the placeholder first
+   * slot) but it differs per stage and contains context dependent defines, so hash it. */
+  const char *patch = this->glsl_patch_get(gl_stage);
+  sources_hash_[0] = BLI_hash_mm2((const uchar *)patch, strlen(patch), sources_hash_[0]);
+  sources_hash_[1] = BLI_hash_mm2((const uchar *)patch, strlen(patch), ~sources_hash_[1]);
+
+  for (int i = 1; i < sources.size(); i++) {
+    const size_t len = strlen(sources[i]);
+    dst->append(sources[i], len);
+    sources_hash_[0] = BLI_hash_mm2((const uchar *)sources[i], len, sources_hash_[0]);
+    sources_hash_[1] = BLI_hash_mm2((const uchar *)sources[i], len, ~sources_hash_[1]);
+  }
+}
+
+static bool program_binary_cache_filepath_get(const uint32_t hash[2], char r_filepath[FILE_MAX])
+{
+  /* NOTE: there is no dedicated user cache folder (yet), the config folder is the only per-user
+   * writable location that survives restarts. */
+  const char *cache_dir = BKE_appdir_folder_id_create(BLENDER_USER_CONFIG, "shader-cache");
+  if (cache_dir == nullptr) {
+    return false;
+  }
+  char filename[32];
+  BLI_snprintf(filename, sizeof(filename), "%08x%08x.bin", hash[0], hash[1]);
+  BLI_path_join(r_filepath, FILE_MAX, cache_dir, filename, NULL);
+  return true;
+}
+
+bool GLShader::program_binary_cache_load()
+{
+  char filepath[FILE_MAX];
+  if (!program_binary_cache_filepath_get(sources_hash_, filepath)) {
+    return false;
+  }
+  size_t data_len = 0;
+  uchar *data = (uchar *)BLI_file_read_binary_as_mem(filepath, 0, &data_len);
+  if (data == nullptr) {
+    return false;
+  }
+  bool success = false;
+  /* The binary format enum is stored in front of the driver blob. */
+  if (data_len > sizeof(GLenum)) {
+    GLenum format;
+    memcpy(&format, data, sizeof(GLenum));
+    glProgramBinary(
+        shader_program_, format, data + sizeof(GLenum), (GLsizei)(data_len - sizeof(GLenum)));
+    GLint status = 0;
+    glGetProgramiv(shader_program_, GL_LINK_STATUS, &status);
+    success = (status != 0);
+  }
+  MEM_freeN(data);
+  return success;
+}
+
+void GLShader::program_binary_cache_store() const
+{
+  GLint binary_len = 0;
+  glGetProgramiv(shader_program_, GL_PROGRAM_BINARY_LENGTH, &binary_len);
+  if (binary_len <= 0) {
+    return;
+  }
+  char filepath[FILE_MAX];
+  if (!program_binary_cache_filepath_get(sources_hash_, filepath)) {
+    return;
+  }
+  const size_t data_len = sizeof(GLenum) + (size_t)binary_len;
+  uchar *data = (uchar *)MEM_mallocN(data_len, __func__);
+  GLenum format = 0;
+  GLsizei written_len = 0;
+  glGetProgramBinary(shader_program_, binary_len, &written_len, &format, data + sizeof(GLenum));
+  memcpy(data, &format, sizeof(GLenum));
+  if (written_len > 0) {
+    FILE *file = BLI_fopen(filepath, "wb");
+    if (file != nullptr) {
+      const size_t write_len = sizeof(GLenum) + (size_t)written_len;
+      if (fwrite(data, 1, write_len, file) != write_len) {
+        /* Do not leave a truncated binary behind. */
+        fclose(file);
+        BLI_delete(filepath, false, false);
+      }
+      else {
+        fclose(file);
+      }
+    }
+  }
+  MEM_freeN(data);
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Linking
+ * \{ */
+
 bool GLShader::finalize()
 {
   if (compilation_failed_) {
     return false;
   }
 
+  /* The binary includes the transform feedback layout, but the varying names are not part of the
+   * cache key, so do not risk mixing up shaders that only differ by them. */
+  const bool use_cache = use_program_binary_cache_ &&
+                         (transform_feedback_type_ == GPU_SHADER_TFB_NONE);
+
+  if (use_cache && this->program_binary_cache_load()) {
+    interface = new GLShaderInterface(shader_program_);
+    return true;
+  }
+
+  if (use_program_binary_cache_) {
+    /* Cache miss: compile the deferred stages now. Keep the placeholder first slot that
+     * #create_shader_stage replaces by the patch string. */
+    const struct {
+      GLenum stage;
+      const std::string *sources;
+      GLuint *shader;
+    } stages[] = {
+        {GL_VERTEX_SHADER, &vertex_sources_, &vert_shader_},
+        {GL_GEOMETRY_SHADER, &geometry_sources_, &geom_shader_},
+        {GL_FRAGMENT_SHADER, &fragment_sources_, &frag_shader_},
+        {GL_COMPUTE_SHADER, &compute_sources_, &compute_shader_},
+    };
+    for (const auto &stage : stages) {
+      if (stage.sources->empty()) {
+        continue;
+      }
+      const char *sources[2] = {"", stage.sources->c_str()};
+      *stage.shader = this->create_shader_stage(stage.stage,
+                                                MutableSpan<const char *>(sources, 2));
+    }
+    if (compilation_failed_) {
+      return false;
+    }
+    if (use_cache) {
+      glProgramParameteri(shader_program_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+  }
+
   glLinkProgram(shader_program_);
 
   GLint status;
@@ -226,6 +427,10 @@ bool GLShader::finalize()
     return false;
   }
 
+  if (use_cache) {
+    this->program_binary_cache_store();
+  }
+
   interface = new GLShaderInterface(shader_program_);
 
   return true;
@@ -29,6 +29,8 @@
 
 #include "gpu_shader_private.hh"
 
+#include <string>
+
 namespace blender {
 namespace gpu {
 
@@ -47,6 +49,16 @@ class GLShader : public Shader {
   /** True if any shader failed to compile. */
   bool compilation_failed_ = false;
 
+  /** True when stage compilation is deferred to #finalize and the linked binary cached on disk. */
+  bool use_program_binary_cache_ = false;
+  /** Concatenated sources of each stage (minus the patch slot), kept for deferred compilation. */
+  std::string vertex_sources_;
+  std::string geometry_sources_;
+  std::string fragment_sources_;
+  std::string compute_sources_;
+  /** Binary cache key, built from the driver identity and all stage sources. */
+  uint32_t sources_hash_[2] = {0, 0};
+
   eGPUShaderTFBType transform_feedback_type_ = GPU_SHADER_TFB_NONE;
 
  public:
@@ -81,6 +93,10 @@ class GLShader : public Shader {
 
   GLuint create_shader_stage(GLenum gl_stage, MutableSpan<const char *> sources);
 
+  void stage_sources_store(GLenum gl_stage, Span<const char *> sources);
+  bool program_binary_cache_load(void);
+  void program_binary_cache_store(void) const;
+
   MEM_CXX_CLASS_ALLOC_FUNCS("GLShader");
 };
 
@@ -86,7 +86,14 @@ bool GLTexture::init_internal()
     return false;
   }
 
-  this->ensure_mipmaps(0);
+  if (is_sparse_) {
+    if (!this->init_sparse_storage()) {
+      return false;
+    }
+  }
+  else {
+    this->ensure_mipmaps(0);
+  }
 
   /* Avoid issue with incomplete textures. */
   if (GLContext::direct_state_access_support) {
@@ -123,9 +130,86 @@ bool GLTexture::init_internal(GPUVertBuf *vbo)
   return true;
 }
 
+/* Allocate immutable sparse storage, with no pages committed yet. Returns false when the
+ * driver does not support sparse allocation of this texture, the caller then falls back to
+ * a regular texture. */
+bool GLTexture::init_sparse_storage()
+{
+  BLI_assert(type_ == GPU_TEXTURE_3D);
+
+  if (!(GLEW_ARB_sparse_texture && GLEW_ARB_sparse_texture2)) {
+    return false;
+  }
+
+  int max_size = 0;
+  glGetIntegerv(GL_MAX_SPARSE_3D_TEXTURE_SIZE_ARB, &max_size);
+  if (w_ > max_size || h_ > max_size || d_ > max_size) {
+    return false;
+  }
+
+  GLenum internal_format = to_gl_internal_format(format_);
+
+  /* Not all formats have a virtual page layout. */
+  int num_page_sizes = 0;
+  glGetInternalformativ(
+      GL_TEXTURE_3D, internal_format, GL_NUM_VIRTUAL_PAGE_SIZES_ARB, 1, &num_page_sizes);
+  if (num_page_sizes == 0) {
+    return false;
+  }
+
+  glGetInternalformativ(
+      GL_TEXTURE_3D, internal_format, GL_VIRTUAL_PAGE_SIZE_X_ARB, 1, &sparse_page_size_[0]);
+  glGetInternalformativ(
+      GL_TEXTURE_3D, internal_format, GL_VIRTUAL_PAGE_SIZE_Y_ARB, 1, &sparse_page_size_[1]);
+  glGetInternalformativ(
+      GL_TEXTURE_3D, internal_format, GL_VIRTUAL_PAGE_SIZE_Z_ARB, 1, &sparse_page_size_[2]);
+
+  glTexParameteri(target_, GL_TEXTURE_SPARSE_ARB, GL_TRUE);
+  glTexParameteri(target_, GL_VIRTUAL_PAGE_SIZE_INDEX_ARB, 0);
+  glTexStorage3D(target_, 1, internal_format, w_, h_, d_);
+
+  mipmaps_ = 0;
+  this->mip_range_set(0, 0);
+  return true;
+}
+
+void GLTexture::sparse_update_region(const int offset[3],
+                                     const int extent[3],
+                                     eGPUDataFormat type,
+                                     const void *data)
+{
+  BLI_assert(is_sparse_);
+
+  const int size[3] = {w_, h_, d_};
+  int commit_offset[3], commit_extent[3];
+  for (int i = 0; i < 3; i++) {
+    /* Commitment must be page aligned, except where the region touches the texture edge. */
+    const int page = sparse_page_size_[i];
+    commit_offset[i] = (offset[i] / page) * page;
+    const int end = min_ii(((offset[i] + extent[i] + page - 1) / page) * page, size[i]);
+    commit_extent[i] = end - commit_offset[i];
+  }
+
+  GLContext::state_manager_active_get()->texture_bind_temp(this);
+  glTexPageCommitmentARB(target_,
+                         0,
+                         UNPACK3(commit_offset),
+                         UNPACK3(commit_extent),
+                         GL_TRUE);
+
+  int mip_offset[3] = {offset[0], offset[1], offset[2]};
+  int mip_extent[3] = {extent[0], extent[1], extent[2]};
+  this->update_sub(0, mip_offset, mip_extent, type, data);
+}
+
 /* Will create enough mipmaps up to get to the given level. */
 void GLTexture::ensure_mipmaps(int miplvl)
 {
+  if (is_sparse_) {
+    /* Sparse textures use single level immutable storage. */
+    return;
+  }
+
   int effective_h = (type_ == GPU_TEXTURE_1D_ARRAY) ? 0 : h_;
   int effective_d = (type_ != GPU_TEXTURE_3D) ? 0 : d_;
   int max_dimension = max_iii(w_, effective_h, effective_d);
@@ -290,6 +374,89 @@ void GLTexture::update_sub(
   }
 }
 
+void GLTexture::update_sub_async(
+    int mip, int offset[3], int extent[3], eGPUDataFormat type, const void *data)
+{
+  BLI_assert(validate_data_format(format_, type));
+  BLI_assert(data != nullptr);
+
+  /* Compressed and cubemap uploads keep the synchronous path, they are small or rare enough
+   * not to matter. */
+  if ((format_flag_ & GPU_FORMAT_COMPRESSED) || (type_ == GPU_TEXTURE_CUBE)) {
+    this->update_sub(mip, offset, extent, type, data);
+    return;
+  }
+
+  this->ensure_mipmaps(mip);
+
+  if (mip > mipmaps_) {
+    debug::raise_gl_error("Updating a miplvl on a texture too small to have this many levels.");
+    return;
+  }
+
+  /* The unpack state also applies to reads from the buffer object, so the staging copy has to
+   * cover the strided footprint of the client data. */
+  GLint row_length = 0;
+  glGetIntegerv(GL_UNPACK_ROW_LENGTH, &row_length);
+
+  size_t pixel_len;
+  if (row_length == 0) {
+    pixel_len = size_t(extent[0]) * extent[1] * extent[2];
+  }
+  else {
+    pixel_len = size_t(row_length) * (size_t(extent[1]) * extent[2] - 1) + extent[0];
+  }
+  const size_t data_size = pixel_len * to_bytesize(format_, type);
+
+  GLuint pbo_id;
+  glGenBuffers(1, &pbo_id);
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo_id);
+  glBufferData(GL_PIXEL_UNPACK_BUFFER, data_size, nullptr, GL_STREAM_DRAW);
+
+  void *staging = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER,
+                                   0,
+                                   data_size,
+                                   GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT |
+                                       GL_MAP_UNSYNCHRONIZED_BIT);
+  if (staging == nullptr) {
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glDeleteBuffers(1, &pbo_id);
+    this->update_sub(mip, offset, extent, type, data);
+    return;
+  }
+
+  memcpy(staging, data, data_size);
+  glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+  /* With the pixel buffer bound, the data argument is an offset into it. The driver performs
+   * the transfer from the staging buffer on its own schedule, without blocking this thread. */
+  GLenum gl_format = to_gl_data_format(format_);
+  GLenum gl_type = to_gl(type);
+
+  if (GLContext::direct_state_access_support) {
+    this->update_sub_direct_state_access(mip, offset, extent, gl_format, gl_type, nullptr);
+  }
+  else {
+    GLContext::state_manager_active_get()->texture_bind_temp(this);
+    switch (this->dimensions_count()) {
+      default:
+      case 1:
+        glTexSubImage1D(target_, mip, offset[0], extent[0], gl_format, gl_type, nullptr);
+        break;
+      case 2:
+        glTexSubImage2D(target_, mip, UNPACK2(offset), UNPACK2(extent), gl_format, gl_type, NULL);
+        break;
+      case 3:
+        glTexSubImage3D(target_, mip, UNPACK3(offset), UNPACK3(extent), gl_format, gl_type, NULL);
+        break;
+    }
+  }
+
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  /* Deletion is deferred by the driver until the transfer completed. */
+  glDeleteBuffers(1, &pbo_id);
+}
+
 /**
  * This will create the mipmap images and populate them with filtered data from base level.
  *
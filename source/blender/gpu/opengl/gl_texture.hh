@@ -60,6 +60,12 @@ class GLTexture : public Texture {
 
   void update_sub(
       int mip, int offset[3], int extent[3], eGPUDataFormat type, const void *data) override;
+  void update_sub_async(
+      int mip, int offset[3], int extent[3], eGPUDataFormat type, const void *data) override;
+  void sparse_update_region(const int offset[3],
+                            const int extent[3],
+                            eGPUDataFormat type,
+                            const void *data) override;
 
   void generate_mipmap(void) override;
   void copy_to(Texture *dst) override;
@@ -83,6 +89,7 @@ class GLTexture : public Texture {
 
  private:
   bool proxy_check(int mip);
+  bool init_sparse_storage(void);
   void ensure_mipmaps(int mip);
   void update_sub_direct_state_access(
       int mip, int offset[3], int extent[3], GLenum gl_format, GLenum gl_type, const void *data);
@@ -29,6 +29,7 @@
 #include "gpu_context_private.hh"
 
 #include "gl_backend.hh"
+#include "gl_buffer_ring.hh"
 #include "gl_debug.hh"
 #include "gl_uniform_buffer.hh"
 
@@ -71,6 +72,22 @@ void GLUniformBuf::update(const void *data)
   if (ubo_id_ == 0) {
     this->init();
   }
+
+  /* Stage the upload through the persistently mapped buffer ring when available. The GPU side
+   * copy lets the driver schedule the transfer instead of synchronizing inside glBufferSubData
+   * when the ubo is still in use by previous draw calls. */
+  GLBufferRing *ring = GLContext::get()->buffer_ring_get();
+  if (ring && size_t(size_in_bytes_) <= GLBufferRing::max_alloc_size) {
+    const size_t offset = ring->alloc(size_in_bytes_, 16);
+    memcpy(ring->data(offset), data, size_in_bytes_);
+    glBindBuffer(GL_COPY_READ_BUFFER, ring->gl_id());
+    glBindBuffer(GL_UNIFORM_BUFFER, ubo_id_);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_UNIFORM_BUFFER, offset, 0, size_in_bytes_);
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    return;
+  }
+
   glBindBuffer(GL_UNIFORM_BUFFER, ubo_id_);
   glBufferSubData(GL_UNIFORM_BUFFER, 0, size_in_bytes_, data);
   glBindBuffer(GL_UNIFORM_BUFFER, 0);
@@ -804,6 +804,10 @@ typedef struct FFmpegIndexBuilderContext {
   IMB_Timecode_Type tcs_in_use;
   IMB_Proxy_Size proxy_sizes_in_use;
 
+  /* Timecode-only builds scan container packets without opening a decoder,
+   * see #index_rebuild_ffmpeg_packet_scan. */
+  bool packet_scan_only;
+
   uint64_t seek_pos;
   uint64_t seek_pos_pts;
   uint64_t seek_pos_dts;
@@ -870,37 +874,43 @@ static IndexBuildContext *index_ffmpeg_create_context(struct anim *anim,
 
   context->iStream = context->iFormatCtx->streams[context->videoStream];
 
-  context->iCodec = avcodec_find_decoder(context->iStream->codecpar->codec_id);
+  /* Without proxies to transcode, timecode indices can be built from a container packet scan
+   * alone, so the decoder is never opened. */
+  context->packet_scan_only = (proxy_sizes_in_use == IMB_PROXY_NONE);
 
-  if (context->iCodec == NULL) {
-    avformat_close_input(&context->iFormatCtx);
-    MEM_freeN(context);
-    return NULL;
-  }
+  if (!context->packet_scan_only) {
+    context->iCodec = avcodec_find_decoder(context->iStream->codecpar->codec_id);
 
-  context->iCodecCtx = avcodec_alloc_context3(NULL);
-  avcodec_parameters_to_context(context->iCodecCtx, context->iStream->codecpar);
-  context->iCodecCtx->workaround_bugs = FF_BUG_AUTODETECT;
+    if (context->iCodec == NULL) {
+      avformat_close_input(&context->iFormatCtx);
+      MEM_freeN(context);
+      return NULL;
+    }
 
-  if (context->iCodec->capabilities & AV_CODEC_CAP_AUTO_THREADS) {
-    context->iCodecCtx->thread_count = 0;
-  }
-  else {
-    context->iCodecCtx->thread_count = BLI_system_thread_count();
-  }
+    context->iCodecCtx = avcodec_alloc_context3(NULL);
+    avcodec_parameters_to_context(context->iCodecCtx, context->iStream->codecpar);
+    context->iCodecCtx->workaround_bugs = FF_BUG_AUTODETECT;
 
-  if (context->iCodec->capabilities & AV_CODEC_CAP_FRAME_THREADS) {
-    context->iCodecCtx->thread_type = FF_THREAD_FRAME;
-  }
-  else if (context->iCodec->capabilities & AV_CODEC_CAP_SLICE_THREADS) {
-    context->iCodecCtx->thread_type = FF_THREAD_SLICE;
-  }
+    if (context->iCodec->capabilities & AV_CODEC_CAP_AUTO_THREADS) {
+      context->iCodecCtx->thread_count = 0;
+    }
+    else {
+      context->iCodecCtx->thread_count = BLI_system_thread_count();
+    }
 
-  if (avcodec_open2(context->iCodecCtx, context->iCodec, NULL) < 0) {
-    avformat_close_input(&context->iFormatCtx);
-    avcodec_free_context(&context->iCodecCtx);
-    MEM_freeN(context);
-    return NULL;
+    if (context->iCodec->capabilities & AV_CODEC_CAP_FRAME_THREADS) {
+      context->iCodecCtx->thread_type = FF_THREAD_FRAME;
+    }
+    else if (context->iCodec->capabilities & AV_CODEC_CAP_SLICE_THREADS) {
+      context->iCodecCtx->thread_type = FF_THREAD_SLICE;
+    }
+
+    if (avcodec_open2(context->iCodecCtx, context->iCodec, NULL) < 0) {
+      avformat_close_input(&context->iFormatCtx);
+      avcodec_free_context(&context->iCodecCtx);
+      MEM_freeN(context);
+      return NULL;
+    }
   }
 
   for (i = 0; i < num_proxy_sizes; i++) {
@@ -1011,15 +1021,154 @@ static void index_rebuild_ffmpeg_proc_decoded_frame(FFmpegIndexBuilderContext *c
   context->frameno_gapless++;
 }
 
+/* An index entry collected during the packet scan, waiting to be sorted into
+ * presentation order. */
+typedef struct PacketScanEntry {
+  uint64_t pts;
+  uint64_t seek_pos;
+  uint64_t seek_pos_pts;
+  uint64_t seek_pos_dts;
+} PacketScanEntry;
+
+static int packet_scan_entry_cmp(const void *a_v, const void *b_v)
+{
+  const PacketScanEntry *a = a_v;
+  const PacketScanEntry *b = b_v;
+  if ((int64_t)a->pts < (int64_t)b->pts) {
+    return -1;
+  }
+  if ((int64_t)a->pts > (int64_t)b->pts) {
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * Build timecode indices from the container packets alone, without ever opening a decoder.
+ * This turns an index rebuild into an I/O bound scan that runs at a fraction of the cost of
+ * a proxy transcode. Packets arrive in decode order, so entries are collected first and
+ * sorted into presentation order before they are written out.
+ */
+static int index_rebuild_ffmpeg_packet_scan(FFmpegIndexBuilderContext *context,
+                                            const short *stop,
+                                            short *do_update,
+                                            float *progress)
+{
+  AVPacket *next_packet = av_packet_alloc();
+  uint64_t stream_size = avio_size(context->iFormatCtx->pb);
+
+  PacketScanEntry *entries = NULL;
+  int num_entries = 0;
+  int entries_size = 0;
+
+  context->frame_rate = av_q2d(av_guess_frame_rate(context->iFormatCtx, context->iStream, NULL));
+  context->pts_time_base = av_q2d(context->iStream->time_base);
+
+  while (av_read_frame(context->iFormatCtx, next_packet) >= 0) {
+    float next_progress =
+        (float)((int)floor(((double)next_packet->pos) * 100 / ((double)stream_size) + 0.5)) / 100;
+
+    if (*progress != next_progress) {
+      *progress = next_progress;
+      *do_update = true;
+    }
+
+    if (*stop) {
+      break;
+    }
+
+    if (next_packet->stream_index == context->videoStream) {
+      if (next_packet->flags & AV_PKT_FLAG_KEY) {
+        context->last_seek_pos = context->seek_pos;
+        context->last_seek_pos_pts = context->seek_pos_pts;
+        context->last_seek_pos_dts = context->seek_pos_dts;
+
+        context->seek_pos = next_packet->pos;
+        context->seek_pos_pts = next_packet->pts;
+        context->seek_pos_dts = next_packet->dts;
+      }
+
+      if (num_entries == entries_size) {
+        entries_size = entries_size ? entries_size * 2 : 1024;
+        entries = MEM_reallocN(entries, sizeof(*entries) * (size_t)entries_size);
+      }
+
+      PacketScanEntry *entry = &entries[num_entries++];
+      entry->pts = timestamp_from_pts_or_dts(next_packet->pts, next_packet->dts);
+      entry->seek_pos = context->seek_pos;
+      entry->seek_pos_pts = context->seek_pos_pts;
+      entry->seek_pos_dts = context->seek_pos_dts;
+
+      /* B-frames presenting before their seek I-frame must seek to the previous one,
+       * the same correction the decoding path applies. */
+      if ((int64_t)entry->pts <
+          timestamp_from_pts_or_dts(context->seek_pos_pts, context->seek_pos_dts)) {
+        entry->seek_pos = context->last_seek_pos;
+        entry->seek_pos_pts = context->last_seek_pos_pts;
+        entry->seek_pos_dts = context->last_seek_pos_dts;
+      }
+    }
+    av_packet_unref(next_packet);
+  }
+
+  av_packet_free(&next_packet);
+
+  if (!*stop && num_entries > 0) {
+    qsort(entries, (size_t)num_entries, sizeof(*entries), packet_scan_entry_cmp);
+
+    context->start_pts = entries[0].pts;
+    context->start_pts_set = true;
+
+    for (int i = 0; i < num_entries; i++) {
+      const PacketScanEntry *entry = &entries[i];
+
+      context->frameno = floor((entry->pts - context->start_pts) * context->pts_time_base *
+                                   context->frame_rate +
+                               0.5);
+
+      for (int j = 0; j < context->num_indexers; j++) {
+        if (context->tcs_in_use & tc_types[j]) {
+          int tc_frameno = context->frameno;
+
+          if (tc_types[j] == IMB_TC_RECORD_RUN_NO_GAPS) {
+            tc_frameno = context->frameno_gapless;
+          }
+
+          IMB_index_builder_add_entry(context->indexer[j],
+                                      tc_frameno,
+                                      entry->seek_pos,
+                                      entry->seek_pos_pts,
+                                      entry->seek_pos_dts,
+                                      entry->pts);
+        }
+      }
+
+      context->frameno_gapless++;
+    }
+  }
+
+  if (entries) {
+    MEM_freeN(entries);
+  }
+
+  return 1;
+}
+
 static int index_rebuild_ffmpeg(FFmpegIndexBuilderContext *context,
                                 const short *stop,
                                 short *do_update,
                                 float *progress)
 {
-  AVFrame *in_frame = av_frame_alloc();
-  AVPacket *next_packet = av_packet_alloc();
+  AVFrame *in_frame;
+  AVPacket *next_packet;
   uint64_t stream_size;
 
+  if (context->packet_scan_only) {
+    return index_rebuild_ffmpeg_packet_scan(context, stop, do_update, progress);
+  }
+
+  in_frame = av_frame_alloc();
+  next_packet = av_packet_alloc();
   stream_size = avio_size(context->iFormatCtx->pb);
 
   context->frame_rate = av_q2d(av_guess_frame_rate(context->iFormatCtx, context->iStream, NULL));
@@ -1322,7 +1471,11 @@ IndexBuildContext *IMB_anim_index_rebuild_context(struct anim *anim,
 
   fflush(stdout);
 
-  if (proxy_sizes_to_build == 0) {
+  /* Timecode-only rebuilds (no proxy sizes requested at all) are allowed through: they run as
+   * a cheap packet scan. When requested proxies are merely skipped because they already exist,
+   * keep the old behavior of skipping the rebuild entirely. */
+  if (proxy_sizes_to_build == 0 &&
+      !(proxy_sizes_in_use == IMB_PROXY_NONE && tcs_in_use != IMB_TC_NONE)) {
     return NULL;
   }
 
@@ -78,6 +78,7 @@ _CRTIMP void __cdecl _invalid_parameter_noinfo(void)
 }
 #include "BLI_blenlib.h"
 #include "BLI_math_color.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 
 #include "BKE_idprop.h"
@@ -1205,6 +1206,75 @@ void IMB_exrtile_write_channels(
   }
 }
 
+struct ExrReadPartData {
+  ExrHandle *data;
+  bool flip;
+};
+
+static void imb_exr_read_part_fn(void *__restrict userdata,
+                                 const int i,
+                                 const TaskParallelTLS *__restrict /*tls*/)
+{
+  ExrReadPartData *part_data = static_cast<ExrReadPartData *>(userdata);
+  ExrHandle *data = part_data->data;
+  const bool flip = part_data->flip;
+
+  /* Read part header. */
+  InputPart in(*data->ifile, i);
+  Header header = in.header();
+  Box2i dw = header.dataWindow();
+
+  /* Insert all matching channel into frame-buffer. */
+  FrameBuffer frameBuffer;
+  ExrChannel *echan;
+
+  for (echan = (ExrChannel *)data->channels.first; echan; echan = echan->next) {
+    if (echan->m->part_number != i) {
+      continue;
+    }
+
+    exr_printf("%d %-6s %-22s \"%s\"\n",
+               echan->m->part_number,
+               echan->m->view.c_str(),
+               echan->m->name.c_str(),
+               echan->m->internal_name.c_str());
+
+    if (echan->rect) {
+      float *rect = echan->rect;
+      size_t xstride = echan->xstride * sizeof(float);
+      size_t ystride = echan->ystride * sizeof(float);
+
+      if (!flip) {
+        /* Inverse correct first pixel for data-window coordinates. */
+        rect -= echan->xstride * (dw.min.x - dw.min.y * data->width);
+        /* move to last scanline to flip to Blender convention */
+        rect += echan->xstride * (data->height - 1) * data->width;
+        ystride = -ystride;
+      }
+      else {
+        /* Inverse correct first pixel for data-window coordinates. */
+        rect -= echan->xstride * (dw.min.x + dw.min.y * data->width);
+      }
+
+      frameBuffer.insert(echan->m->internal_name,
+                         Slice(Imf::FLOAT, (char *)rect, xstride, ystride));
+    }
+    else {
+      printf("warning, channel with no rect set %s\n", echan->m->internal_name.c_str());
+    }
+  }
+
+  /* Read pixels. */
+  try {
+    in.setFrameBuffer(frameBuffer);
+    exr_printf("readPixels:readPixels[%d]: min.y: %d, max.y: %d\n", i, dw.min.y, dw.max.y);
+    in.readPixels(dw.min.y, dw.max.y);
+  }
+  catch (const std::exception &exc) {
+    std::cerr << "OpenEXR-readPixels: ERROR: " << exc.what() << std::endl;
+  }
+}
+
 void IMB_exr_read_channels(void *handle)
 {
   ExrHandle *data = (ExrHandle *)handle;
@@ -1225,63 +1295,17 @@ void IMB_exr_read_channels(void *handle)
       "name",
       "internal_name");
 
-  for (int i = 0; i < numparts; i++) {
-    /* Read part header. */
-    InputPart in(*data->ifile, i);
-    Header header = in.header();
-    Box2i dw = header.dataWindow();
-
-    /* Insert all matching channel into frame-buffer. */
-    FrameBuffer frameBuffer;
-    ExrChannel *echan;
-
-    for (echan = (ExrChannel *)data->channels.first; echan; echan = echan->next) {
-      if (echan->m->part_number != i) {
-        continue;
-      }
-
-      exr_printf("%d %-6s %-22s \"%s\"\n",
-                 echan->m->part_number,
-                 echan->m->view.c_str(),
-                 echan->m->name.c_str(),
-                 echan->m->internal_name.c_str());
-
-      if (echan->rect) {
-        float *rect = echan->rect;
-        size_t xstride = echan->xstride * sizeof(float);
-        size_t ystride = echan->ystride * sizeof(float);
-
-        if (!flip) {
-          /* Inverse correct first pixel for data-window coordinates. */
-          rect -= echan->xstride * (dw.min.x - dw.min.y * data->width);
-          /* move to last scanline to flip to Blender convention */
-          rect += echan->xstride * (data->height - 1) * data->width;
-          ystride = -ystride;
-        }
-        else {
-          /* Inverse correct first pixel for data-window coordinates. */
-          rect -= echan->xstride * (dw.min.x + dw.min.y * data->width);
-        }
-
-        frameBuffer.insert(echan->m->internal_name,
-                           Slice(Imf::FLOAT, (char *)rect, xstride, ystride));
-      }
-      else {
-        printf("warning, channel with no rect set %s\n", echan->m->internal_name.c_str());
-      }
-    }
-
-    /* Read pixels. */
-    try {
-      in.setFrameBuffer(frameBuffer);
-      exr_printf("readPixels:readPixels[%d]: min.y: %d, max.y: %d\n", i, dw.min.y, dw.max.y);
-      in.readPixels(dw.min.y, dw.max.y);
-    }
-    catch (const std::exception &exc) {
-      std::cerr << "OpenEXR-readPixels: ERROR: " << exc.what() << std::endl;
-      break;
-    }
-  }
+  ExrReadPartData part_data = {data, flip != 0};
+
+  /* Parts of a multi-part file are self-contained and OpenEXR supports reading them from
+   * multiple threads concurrently, so distribute them over the task scheduler. Single-part
+   * (regular multi-layer) files still get threaded scanline decompression from OpenEXR's own
+   * thread pool, see #imb_initopenexr. */
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (numparts > 1);
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0, numparts, &part_data, imb_exr_read_part_fn, &settings);
 }
 
 void IMB_exr_multilayer_convert(void *handle,
@@ -372,10 +372,66 @@ MINLINE void premul_ushort_to_straight_uchar(unsigned char *result, const unsign
   }
 }
 
+typedef struct OneHalfThreadData {
+  ImBuf *src;
+  ImBuf *dst;
+  bool do_rect;
+  bool do_float;
+} OneHalfThreadData;
+
+static void imb_onehalf_scanline_func(void *custom_data, int scanline)
+{
+  const OneHalfThreadData *data = custom_data;
+  ImBuf *ibuf1 = data->src;
+  ImBuf *ibuf2 = data->dst;
+  int x;
+
+  if (data->do_rect) {
+    const uchar *cp1 = (const uchar *)ibuf1->rect + ((size_t)scanline * 2 * ibuf1->x) * 4;
+    const uchar *cp2 = cp1 + (ibuf1->x << 2);
+    uchar *dest = (uchar *)ibuf2->rect + ((size_t)scanline * ibuf2->x) * 4;
+
+    for (x = ibuf2->x; x > 0; x--) {
+      unsigned short p1i[8], p2i[8], desti[4];
+
+      straight_uchar_to_premul_ushort(p1i, cp1);
+      straight_uchar_to_premul_ushort(p2i, cp2);
+      straight_uchar_to_premul_ushort(p1i + 4, cp1 + 4);
+      straight_uchar_to_premul_ushort(p2i + 4, cp2 + 4);
+
+      desti[0] = ((unsigned int)p1i[0] + p2i[0] + p1i[4] + p2i[4]) >> 2;
+      desti[1] = ((unsigned int)p1i[1] + p2i[1] + p1i[5] + p2i[5]) >> 2;
+      desti[2] = ((unsigned int)p1i[2] + p2i[2] + p1i[6] + p2i[6]) >> 2;
+      desti[3] = ((unsigned int)p1i[3] + p2i[3] + p1i[7] + p2i[7]) >> 2;
+
+      premul_ushort_to_straight_uchar(dest, desti);
+
+      cp1 += 8;
+      cp2 += 8;
+      dest += 4;
+    }
+  }
+
+  if (data->do_float) {
+    const float *p1f = ibuf1->rect_float + ((size_t)scanline * 2 * ibuf1->x) * 4;
+    const float *p2f = p1f + (ibuf1->x << 2);
+    float *destf = ibuf2->rect_float + ((size_t)scanline * ibuf2->x) * 4;
+
+    for (x = ibuf2->x; x > 0; x--) {
+      destf[0] = 0.25f * (p1f[0] + p2f[0] + p1f[4] + p2f[4]);
+      destf[1] = 0.25f * (p1f[1] + p2f[1] + p1f[5] + p2f[5]);
+      destf[2] = 0.25f * (p1f[2] + p2f[2] + p1f[6] + p2f[6]);
+      destf[3] = 0.25f * (p1f[3] + p2f[3] + p1f[7] + p2f[7]);
+      p1f += 8;
+      p2f += 8;
+      destf += 4;
+    }
+  }
+}
+
 /* result in ibuf2, scaling should be done correctly */
 void imb_onehalf_no_alloc(struct ImBuf *ibuf2, struct ImBuf *ibuf1)
 {
-  int x, y;
   const short do_rect = (ibuf1->rect != NULL);
   const short do_float = (ibuf1->rect_float != NULL) && (ibuf2->rect_float != NULL);
 
@@ -392,62 +448,15 @@ void imb_onehalf_no_alloc(struct ImBuf *ibuf2, struct ImBuf *ibuf1)
     return;
   }
 
-  if (do_rect) {
-    unsigned char *cp1, *cp2, *dest;
-
-    cp1 = (unsigned char *)ibuf1->rect;
-    dest = (unsigned char *)ibuf2->rect;
-
-    for (y = ibuf2->y; y > 0; y--) {
-      cp2 = cp1 + (ibuf1->x << 2);
-      for (x = ibuf2->x; x > 0; x--) {
-        unsigned short p1i[8], p2i[8], desti[4];
-
-        straight_uchar_to_premul_ushort(p1i, cp1);
-        straight_uchar_to_premul_ushort(p2i, cp2);
-        straight_uchar_to_premul_ushort(p1i + 4, cp1 + 4);
-        straight_uchar_to_premul_ushort(p2i + 4, cp2 + 4);
-
-        desti[0] = ((unsigned int)p1i[0] + p2i[0] + p1i[4] + p2i[4]) >> 2;
-        desti[1] = ((unsigned int)p1i[1] + p2i[1] + p1i[5] + p2i[5]) >> 2;
-        desti[2] = ((unsigned int)p1i[2] + p2i[2] + p1i[6] + p2i[6]) >> 2;
-        desti[3] = ((unsigned int)p1i[3] + p2i[3] + p1i[7] + p2i[7]) >> 2;
-
-        premul_ushort_to_straight_uchar(dest, desti);
-
-        cp1 += 8;
-        cp2 += 8;
-        dest += 4;
-      }
-      cp1 = cp2;
-      if (ibuf1->x & 1) {
-        cp1 += 4;
-      }
-    }
-  }
-
-  if (do_float) {
-    float *p1f, *p2f, *destf;
-
-    p1f = ibuf1->rect_float;
-    destf = ibuf2->rect_float;
-    for (y = ibuf2->y; y > 0; y--) {
-      p2f = p1f + (ibuf1->x << 2);
-      for (x = ibuf2->x; x > 0; x--) {
-        destf[0] = 0.25f * (p1f[0] + p2f[0] + p1f[4] + p2f[4]);
-        destf[1] = 0.25f * (p1f[1] + p2f[1] + p1f[5] + p2f[5]);
-        destf[2] = 0.25f * (p1f[2] + p2f[2] + p1f[6] + p2f[6]);
-        destf[3] = 0.25f * (p1f[3] + p2f[3] + p1f[7] + p2f[7]);
-        p1f += 8;
-        p2f += 8;
-        destf += 4;
-      }
-      p1f = p2f;
-      if (ibuf1->x & 1) {
-        p1f += 4;
-      }
-    }
-  }
+  /* Every output scanline only reads its own two input scanlines,
+   * so the box down-sample runs threaded. */
+  OneHalfThreadData data = {
+      .src = ibuf1,
+      .dst = ibuf2,
+      .do_rect = (do_rect != 0),
+      .do_float = (do_float != 0),
+  };
+  IMB_processor_apply_threaded_scanlines(ibuf2->y, imb_onehalf_scanline_func, &data);
 }
 
 ImBuf *IMB_onehalf(struct ImBuf *ibuf1)
@@ -908,22 +917,119 @@ static bool q_scale_linear_interpolation(struct ImBuf *ibuf, int newx, int newy)
   return true;
 }
 
-static ImBuf *scaledownx(struct ImBuf *ibuf, int newx)
+typedef struct ScaleDownThreadData {
+  ImBuf *ibuf;
+  uchar *newrect;
+  float *newrectf;
+  int newsize;
+  float add;
+} ScaleDownThreadData;
+
+static void scaledownx_scanline_func(void *custom_data, int scanline)
 {
-  const int do_rect = (ibuf->rect != NULL);
-  const int do_float = (ibuf->rect_float != NULL);
-  const size_t rect_size = ibuf->x * ibuf->y * 4;
+  const ScaleDownThreadData *data = custom_data;
+  ImBuf *ibuf = data->ibuf;
+  const int newx = data->newsize;
+  const float add = data->add;
 
-  uchar *rect, *_newrect, *newrect;
-  float *rectf, *_newrectf, *newrectf;
-  float sample, add, val[4], nval[4], valf[4], nvalf[4];
-  int x, y;
+  uchar *rect = NULL, *newrect = NULL;
+  float *rectf = NULL, *newrectf = NULL;
+  float sample, val[4], nval[4], valf[4], nvalf[4];
+  int x;
 
-  rectf = _newrectf = newrectf = NULL;
-  rect = _newrect = newrect = NULL;
   nval[0] = nval[1] = nval[2] = nval[3] = 0.0f;
   nvalf[0] = nvalf[1] = nvalf[2] = nvalf[3] = 0.0f;
 
+  if (data->newrect) {
+    rect = (uchar *)ibuf->rect + ((size_t)scanline * ibuf->x) * 4;
+    newrect = data->newrect + ((size_t)scanline * newx) * 4;
+  }
+  if (data->newrectf) {
+    rectf = ibuf->rect_float + ((size_t)scanline * ibuf->x) * 4;
+    newrectf = data->newrectf + ((size_t)scanline * newx) * 4;
+  }
+
+  sample = 0.0f;
+  val[0] = val[1] = val[2] = val[3] = 0.0f;
+  valf[0] = valf[1] = valf[2] = valf[3] = 0.0f;
+
+  for (x = newx; x > 0; x--) {
+    if (rect) {
+      nval[0] = -val[0] * sample;
+      nval[1] = -val[1] * sample;
+      nval[2] = -val[2] * sample;
+      nval[3] = -val[3] * sample;
+    }
+    if (rectf) {
+      nvalf[0] = -valf[0] * sample;
+      nvalf[1] = -valf[1] * sample;
+      nvalf[2] = -valf[2] * sample;
+      nvalf[3] = -valf[3] * sample;
+    }
+
+    sample += add;
+
+    while (sample >= 1.0f) {
+      sample -= 1.0f;
+
+      if (rect) {
+        nval[0] += rect[0];
+        nval[1] += rect[1];
+        nval[2] += rect[2];
+        nval[3] += rect[3];
+        rect += 4;
+      }
+      if (rectf) {
+        nvalf[0] += rectf[0];
+        nvalf[1] += rectf[1];
+        nvalf[2] += rectf[2];
+        nvalf[3] += rectf[3];
+        rectf += 4;
+      }
+    }
+
+    if (rect) {
+      val[0] = rect[0];
+      val[1] = rect[1];
+      val[2] = rect[2];
+      val[3] = rect[3];
+      rect += 4;
+
+      newrect[0] = roundf((nval[0] + sample * val[0]) / add);
+      newrect[1] = roundf((nval[1] + sample * val[1]) / add);
+      newrect[2] = roundf((nval[2] + sample * val[2]) / add);
+      newrect[3] = roundf((nval[3] + sample * val[3]) / add);
+
+      newrect += 4;
+    }
+    if (rectf) {
+
+      valf[0] = rectf[0];
+      valf[1] = rectf[1];
+      valf[2] = rectf[2];
+      valf[3] = rectf[3];
+      rectf += 4;
+
+      newrectf[0] = ((nvalf[0] + sample * valf[0]) / add);
+      newrectf[1] = ((nvalf[1] + sample * valf[1]) / add);
+      newrectf[2] = ((nvalf[2] + sample * valf[2]) / add);
+      newrectf[3] = ((nvalf[3] + sample * valf[3]) / add);
+
+      newrectf += 4;
+    }
+
+    sample -= 1.0f;
+  }
+}
+
+static ImBuf *scaledownx(struct ImBuf *ibuf, int newx)
+{
+  const int do_rect = (ibuf->rect != NULL);
+  const int do_float = (ibuf->rect_float != NULL);
+
+  uchar *_newrect = NULL;
+  float *_newrectf = NULL;
+
   if (!do_rect && !do_float) {
     return ibuf;
   }
@@ -944,126 +1050,138 @@ static ImBuf *scaledownx(struct ImBuf *ibuf, int newx)
     }
   }
 
-  add = (ibuf->x - 0.01) / newx;
+  /* The accumulator state resets at the start of every row, so rows filter independently
+   * and can run threaded. */
+  ScaleDownThreadData data = {
+      .ibuf = ibuf,
+      .newrect = _newrect,
+      .newrectf = _newrectf,
+      .newsize = newx,
+      .add = (ibuf->x - 0.01) / newx,
+  };
+  IMB_processor_apply_threaded_scanlines(ibuf->y, scaledownx_scanline_func, &data);
 
   if (do_rect) {
-    rect = (uchar *)ibuf->rect;
-    newrect = _newrect;
+    imb_freerectImBuf(ibuf);
+    ibuf->mall |= IB_rect;
+    ibuf->rect = (unsigned int *)_newrect;
   }
   if (do_float) {
-    rectf = ibuf->rect_float;
-    newrectf = _newrectf;
+    imb_freerectfloatImBuf(ibuf);
+    ibuf->mall |= IB_rectfloat;
+    ibuf->rect_float = _newrectf;
   }
 
-  for (y = ibuf->y; y > 0; y--) {
-    sample = 0.0f;
-    val[0] = val[1] = val[2] = val[3] = 0.0f;
-    valf[0] = valf[1] = valf[2] = valf[3] = 0.0f;
+  ibuf->x = newx;
+  return ibuf;
+}
 
-    for (x = newx; x > 0; x--) {
-      if (do_rect) {
-        nval[0] = -val[0] * sample;
-        nval[1] = -val[1] * sample;
-        nval[2] = -val[2] * sample;
-        nval[3] = -val[3] * sample;
-      }
-      if (do_float) {
-        nvalf[0] = -valf[0] * sample;
-        nvalf[1] = -valf[1] * sample;
-        nvalf[2] = -valf[2] * sample;
-        nvalf[3] = -valf[3] * sample;
-      }
+static void scaledowny_column_func(void *custom_data, int scanline)
+{
+  const ScaleDownThreadData *data = custom_data;
+  ImBuf *ibuf = data->ibuf;
+  const int newy = data->newsize;
+  const float add = data->add;
+  const int skipx = 4 * ibuf->x;
+  const int x = 4 * scanline;
 
-      sample += add;
+  uchar *rect = NULL, *newrect = NULL;
+  float *rectf = NULL, *newrectf = NULL;
+  float sample, val[4], nval[4], valf[4], nvalf[4];
+  int y;
 
-      while (sample >= 1.0f) {
-        sample -= 1.0f;
+  nval[0] = nval[1] = nval[2] = nval[3] = 0.0f;
+  nvalf[0] = nvalf[1] = nvalf[2] = nvalf[3] = 0.0f;
 
-        if (do_rect) {
-          nval[0] += rect[0];
-          nval[1] += rect[1];
-          nval[2] += rect[2];
-          nval[3] += rect[3];
-          rect += 4;
-        }
-        if (do_float) {
-          nvalf[0] += rectf[0];
-          nvalf[1] += rectf[1];
-          nvalf[2] += rectf[2];
-          nvalf[3] += rectf[3];
-          rectf += 4;
-        }
-      }
+  if (data->newrect) {
+    rect = ((uchar *)ibuf->rect) + x;
+    newrect = data->newrect + x;
+  }
+  if (data->newrectf) {
+    rectf = ibuf->rect_float + x;
+    newrectf = data->newrectf + x;
+  }
 
-      if (do_rect) {
-        val[0] = rect[0];
-        val[1] = rect[1];
-        val[2] = rect[2];
-        val[3] = rect[3];
-        rect += 4;
+  sample = 0.0f;
+  val[0] = val[1] = val[2] = val[3] = 0.0f;
+  valf[0] = valf[1] = valf[2] = valf[3] = 0.0f;
 
-        newrect[0] = roundf((nval[0] + sample * val[0]) / add);
-        newrect[1] = roundf((nval[1] + sample * val[1]) / add);
-        newrect[2] = roundf((nval[2] + sample * val[2]) / add);
-        newrect[3] = roundf((nval[3] + sample * val[3]) / add);
+  for (y = newy; y > 0; y--) {
+    if (rect) {
+      nval[0] = -val[0] * sample;
+      nval[1] = -val[1] * sample;
+      nval[2] = -val[2] * sample;
+      nval[3] = -val[3] * sample;
+    }
+    if (rectf) {
+      nvalf[0] = -valf[0] * sample;
+      nvalf[1] = -valf[1] * sample;
+      nvalf[2] = -valf[2] * sample;
+      nvalf[3] = -valf[3] * sample;
+    }
+
+    sample += add;
+
+    while (sample >= 1.0f) {
+      sample -= 1.0f;
 
-        newrect += 4;
+      if (rect) {
+        nval[0] += rect[0];
+        nval[1] += rect[1];
+        nval[2] += rect[2];
+        nval[3] += rect[3];
+        rect += skipx;
       }
-      if (do_float) {
+      if (rectf) {
+        nvalf[0] += rectf[0];
+        nvalf[1] += rectf[1];
+        nvalf[2] += rectf[2];
+        nvalf[3] += rectf[3];
+        rectf += skipx;
+      }
+    }
 
-        valf[0] = rectf[0];
-        valf[1] = rectf[1];
-        valf[2] = rectf[2];
-        valf[3] = rectf[3];
-        rectf += 4;
+    if (rect) {
+      val[0] = rect[0];
+      val[1] = rect[1];
+      val[2] = rect[2];
+      val[3] = rect[3];
+      rect += skipx;
 
-        newrectf[0] = ((nvalf[0] + sample * valf[0]) / add);
-        newrectf[1] = ((nvalf[1] + sample * valf[1]) / add);
-        newrectf[2] = ((nvalf[2] + sample * valf[2]) / add);
-        newrectf[3] = ((nvalf[3] + sample * valf[3]) / add);
+      newrect[0] = roundf((nval[0] + sample * val[0]) / add);
+      newrect[1] = roundf((nval[1] + sample * val[1]) / add);
+      newrect[2] = roundf((nval[2] + sample * val[2]) / add);
+      newrect[3] = roundf((nval[3] + sample * val[3]) / add);
 
-        newrectf += 4;
-      }
+      newrect += skipx;
+    }
+    if (rectf) {
 
-      sample -= 1.0f;
+      valf[0] = rectf[0];
+      valf[1] = rectf[1];
+      valf[2] = rectf[2];
+      valf[3] = rectf[3];
+      rectf += skipx;
+
+      newrectf[0] = ((nvalf[0] + sample * valf[0]) / add);
+      newrectf[1] = ((nvalf[1] + sample * valf[1]) / add);
+      newrectf[2] = ((nvalf[2] + sample * valf[2]) / add);
+      newrectf[3] = ((nvalf[3] + sample * valf[3]) / add);
+
+      newrectf += skipx;
     }
-  }
 
-  if (do_rect) {
-    // printf("%ld %ld\n", (uchar *)rect - ((uchar *)ibuf->rect), rect_size);
-    BLI_assert((uchar *)rect - ((uchar *)ibuf->rect) == rect_size); /* see bug T26502. */
-    imb_freerectImBuf(ibuf);
-    ibuf->mall |= IB_rect;
-    ibuf->rect = (unsigned int *)_newrect;
+    sample -= 1.0f;
   }
-  if (do_float) {
-    // printf("%ld %ld\n", rectf - ibuf->rect_float, rect_size);
-    BLI_assert((rectf - ibuf->rect_float) == rect_size); /* see bug T26502. */
-    imb_freerectfloatImBuf(ibuf);
-    ibuf->mall |= IB_rectfloat;
-    ibuf->rect_float = _newrectf;
-  }
-  (void)rect_size; /* UNUSED in release builds */
-
-  ibuf->x = newx;
-  return ibuf;
 }
 
 static ImBuf *scaledowny(struct ImBuf *ibuf, int newy)
 {
   const int do_rect = (ibuf->rect != NULL);
   const int do_float = (ibuf->rect_float != NULL);
-  const size_t rect_size = ibuf->x * ibuf->y * 4;
-
-  uchar *rect, *_newrect, *newrect;
-  float *rectf, *_newrectf, *newrectf;
-  float sample, add, val[4], nval[4], valf[4], nvalf[4];
-  int x, y, skipx;
 
-  rectf = _newrectf = newrectf = NULL;
-  rect = _newrect = newrect = NULL;
-  nval[0] = nval[1] = nval[2] = nval[3] = 0.0f;
-  nvalf[0] = nvalf[1] = nvalf[2] = nvalf[3] = 0.0f;
+  uchar *_newrect = NULL;
+  float *_newrectf = NULL;
 
   if (!do_rect && !do_float) {
     return ibuf;
@@ -1085,107 +1203,26 @@ static ImBuf *scaledowny(struct ImBuf *ibuf, int newy)
     }
   }
 
-  add = (ibuf->y - 0.01) / newy;
-  skipx = 4 * ibuf->x;
-
-  for (x = skipx - 4; x >= 0; x -= 4) {
-    if (do_rect) {
-      rect = ((uchar *)ibuf->rect) + x;
-      newrect = _newrect + x;
-    }
-    if (do_float) {
-      rectf = ibuf->rect_float + x;
-      newrectf = _newrectf + x;
-    }
-
-    sample = 0.0f;
-    val[0] = val[1] = val[2] = val[3] = 0.0f;
-    valf[0] = valf[1] = valf[2] = valf[3] = 0.0f;
-
-    for (y = newy; y > 0; y--) {
-      if (do_rect) {
-        nval[0] = -val[0] * sample;
-        nval[1] = -val[1] * sample;
-        nval[2] = -val[2] * sample;
-        nval[3] = -val[3] * sample;
-      }
-      if (do_float) {
-        nvalf[0] = -valf[0] * sample;
-        nvalf[1] = -valf[1] * sample;
-        nvalf[2] = -valf[2] * sample;
-        nvalf[3] = -valf[3] * sample;
-      }
-
-      sample += add;
-
-      while (sample >= 1.0f) {
-        sample -= 1.0f;
-
-        if (do_rect) {
-          nval[0] += rect[0];
-          nval[1] += rect[1];
-          nval[2] += rect[2];
-          nval[3] += rect[3];
-          rect += skipx;
-        }
-        if (do_float) {
-          nvalf[0] += rectf[0];
-          nvalf[1] += rectf[1];
-          nvalf[2] += rectf[2];
-          nvalf[3] += rectf[3];
-          rectf += skipx;
-        }
-      }
-
-      if (do_rect) {
-        val[0] = rect[0];
-        val[1] = rect[1];
-        val[2] = rect[2];
-        val[3] = rect[3];
-        rect += skipx;
-
-        newrect[0] = roundf((nval[0] + sample * val[0]) / add);
-        newrect[1] = roundf((nval[1] + sample * val[1]) / add);
-        newrect[2] = roundf((nval[2] + sample * val[2]) / add);
-        newrect[3] = roundf((nval[3] + sample * val[3]) / add);
-
-        newrect += skipx;
-      }
-      if (do_float) {
-
-        valf[0] = rectf[0];
-        valf[1] = rectf[1];
-        valf[2] = rectf[2];
-        valf[3] = rectf[3];
-        rectf += skipx;
-
-        newrectf[0] = ((nvalf[0] + sample * valf[0]) / add);
-        newrectf[1] = ((nvalf[1] + sample * valf[1]) / add);
-        newrectf[2] = ((nvalf[2] + sample * valf[2]) / add);
-        newrectf[3] = ((nvalf[3] + sample * valf[3]) / add);
-
-        newrectf += skipx;
-      }
-
-      sample -= 1.0f;
-    }
-  }
+  /* Columns filter independently, so they run threaded (a "scanline" is a column here). */
+  ScaleDownThreadData data = {
+      .ibuf = ibuf,
+      .newrect = _newrect,
+      .newrectf = _newrectf,
+      .newsize = newy,
+      .add = (ibuf->y - 0.01) / newy,
+  };
+  IMB_processor_apply_threaded_scanlines(ibuf->x, scaledowny_column_func, &data);
 
   if (do_rect) {
-    // printf("%ld %ld\n", (uchar *)rect - ((uchar *)ibuf->rect), rect_size);
-    BLI_assert((uchar *)rect - ((uchar *)ibuf->rect) == rect_size); /* see bug T26502. */
     imb_freerectImBuf(ibuf);
     ibuf->mall |= IB_rect;
     ibuf->rect = (unsigned int *)_newrect;
   }
   if (do_float) {
-    // printf("%ld %ld\n", rectf - ibuf->rect_float, rect_size);
-    BLI_assert((rectf - ibuf->rect_float) == rect_size); /* see bug T26502. */
     imb_freerectfloatImBuf(ibuf);
     ibuf->mall |= IB_rectfloat;
     ibuf->rect_float = (float *)_newrectf;
   }
-  (void)rect_size; /* UNUSED in release builds */
 
   ibuf->y = newy;
   return ibuf;
@@ -88,6 +88,14 @@ ABCGenericMeshWriter::ABCGenericMeshWriter(const ABCWriterConstructorArgs &args)
 {
 }
 
+ABCGenericMeshWriter::~ABCGenericMeshWriter()
+{
+  /* Defensive: a prepared mesh is normally consumed by do_write(). */
+  if (prepared_mesh_ != nullptr && prepared_mesh_needs_free_) {
+    free_export_mesh(prepared_mesh_);
+  }
+}
+
 void ABCGenericMeshWriter::create_alembic_objects(const HierarchyContext *context)
 {
   if (!args_.export_params->apply_subdiv && export_as_subdivision_surface(context->object)) {
@@ -167,15 +175,12 @@ bool ABCGenericMeshWriter::is_supported(const HierarchyContext *context) const
   return true;
 }
 
-void ABCGenericMeshWriter::do_write(HierarchyContext &context)
+Mesh *ABCGenericMeshWriter::get_triangulated_export_mesh(Object *object, bool &r_needsfree)
 {
-  Object *object = context.object;
-  bool needsfree = false;
-
-  Mesh *mesh = get_export_mesh(object, needsfree);
+  Mesh *mesh = get_export_mesh(object, r_needsfree);
 
   if (mesh == nullptr) {
-    return;
+    return nullptr;
   }
 
   if (args_.export_params->triangulate) {
@@ -192,11 +197,45 @@ void ABCGenericMeshWriter::do_write(HierarchyContext &context)
     Mesh *triangulated_mesh = BKE_mesh_from_bmesh_for_eval_nomain(bm, nullptr, mesh);
     BM_mesh_free(bm);
 
-    if (needsfree) {
+    if (r_needsfree) {
       free_export_mesh(mesh);
     }
     mesh = triangulated_mesh;
-    needsfree = true;
+    r_needsfree = true;
+  }
+
+  return mesh;
+}
+
+void ABCGenericMeshWriter::prepare_write(HierarchyContext &context)
+{
+  if (frame_has_been_written_ && !is_animated_) {
+    /* write() is going to skip this frame, see ABCAbstractWriter::write(). */
+    return;
+  }
+
+  prepared_mesh_ = get_triangulated_export_mesh(context.object, prepared_mesh_needs_free_);
+}
+
+void ABCGenericMeshWriter::do_write(HierarchyContext &context)
+{
+  Object *object = context.object;
+  bool needsfree = false;
+  Mesh *mesh;
+
+  /* Use the mesh prepared by prepare_write() when the iterator ran it in a
+   * worker thread already. */
+  if (prepared_mesh_ != nullptr) {
+    mesh = prepared_mesh_;
+    needsfree = prepared_mesh_needs_free_;
+    prepared_mesh_ = nullptr;
+  }
+  else {
+    mesh = get_triangulated_export_mesh(object, needsfree);
+  }
+
+  if (mesh == nullptr) {
+    return;
   }
 
   m_custom_data_config.pack_uvs = args_.export_params->packuv;
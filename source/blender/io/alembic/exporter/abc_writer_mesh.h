@@ -49,8 +49,15 @@ class ABCGenericMeshWriter : public ABCAbstractWriter {
 
   CDStreamConfig m_custom_data_config;
 
+  /* Mesh prepared by prepare_write(), consumed by do_write(). */
+  Mesh *prepared_mesh_ = nullptr;
+  bool prepared_mesh_needs_free_ = false;
+
  public:
   explicit ABCGenericMeshWriter(const ABCWriterConstructorArgs &args);
+  virtual ~ABCGenericMeshWriter();
+
+  virtual void prepare_write(HierarchyContext &context) override;
 
   virtual void create_alembic_objects(const HierarchyContext *context) override;
   virtual Alembic::Abc::OObject get_alembic_object() const override;
@@ -66,6 +73,7 @@ class ABCGenericMeshWriter : public ABCAbstractWriter {
   virtual bool export_as_subdivision_surface(Object *ob_eval) const;
 
  private:
+  Mesh *get_triangulated_export_mesh(Object *object, bool &r_needsfree);
   void write_mesh(HierarchyContext &context, Mesh *mesh);
   void write_subd(HierarchyContext &context, Mesh *mesh);
   template<typename Schema> void write_face_sets(Object *object, Mesh *mesh, Schema &schema);
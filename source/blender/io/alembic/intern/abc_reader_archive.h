@@ -26,6 +26,7 @@
 #include <Alembic/AbcCoreOgawa/All.h>
 
 #include <fstream>
+#include <list>
 
 struct Main;
 
@@ -38,7 +39,9 @@ namespace blender::io::alembic {
 
 class ArchiveReader {
   Alembic::Abc::IArchive m_archive;
-  std::ifstream m_infile;
+  /* One stream per thread, so that Ogawa reads from multiple threads do not
+   * serialize on a single file stream. */
+  std::list<std::ifstream> m_infiles;
   std::vector<std::istream *> m_streams;
 
  public:
@@ -490,6 +490,11 @@ AbcMeshReader::AbcMeshReader(const IObject &object, ImportSettings &settings)
   IPolyMesh ipoly_mesh(m_iobject, kWrapExisting);
   m_schema = ipoly_mesh.getSchema();
 
+  if (m_schema.valid()) {
+    m_is_constant_topology = m_schema.getFaceIndicesProperty().isConstant() &&
+                             m_schema.getFaceCountsProperty().isConstant();
+  }
+
   get_min_max_time(m_iobject, m_schema, m_min_time, m_max_time);
 }
 
@@ -557,13 +562,38 @@ template<> bool has_animations(Alembic::AbcGeom::IPolyMeshSchema &schema, Import
 }
 
 void AbcMeshReader::readObjectData(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel)
+{
+  createObjectData(bmain);
+  readObjectGeometry(sample_sel);
+  applyObjectGeometry(bmain, sample_sel);
+}
+
+bool AbcMeshReader::supportsParallelRead() const
+{
+  return true;
+}
+
+void AbcMeshReader::createObjectData(Main *bmain)
 {
   Mesh *mesh = BKE_mesh_add(bmain, m_data_name.c_str());
 
   m_object = BKE_object_add_only_object(bmain, OB_MESH, m_object_name.c_str());
   m_object->data = mesh;
+}
+
+void AbcMeshReader::readObjectGeometry(const Alembic::Abc::ISampleSelector &sample_sel)
+{
+  Mesh *mesh = static_cast<Mesh *>(m_object->data);
+  m_sampled_mesh = this->read_mesh(mesh, sample_sel, MOD_MESHSEQ_READ_ALL, nullptr);
+}
+
+void AbcMeshReader::applyObjectGeometry(Main *bmain,
+                                        const Alembic::Abc::ISampleSelector &sample_sel)
+{
+  Mesh *mesh = static_cast<Mesh *>(m_object->data);
+  Mesh *read_mesh = m_sampled_mesh;
+  m_sampled_mesh = nullptr;
 
-  Mesh *read_mesh = this->read_mesh(mesh, sample_sel, MOD_MESHSEQ_READ_ALL, nullptr);
   if (read_mesh != mesh) {
     /* XXX FIXME: after 2.80; mesh->flag isn't copied by #BKE_mesh_nomain_to_mesh(). */
     /* read_mesh can be freed by BKE_mesh_nomain_to_mesh(), so get the flag before that happens. */
@@ -605,9 +635,14 @@ bool AbcMeshReader::accepts_object_type(
 
 bool AbcMeshReader::topology_changed(Mesh *existing_mesh, const ISampleSelector &sample_sel)
 {
-  IPolyMeshSchema::Sample sample;
+  /* Only the array sizes matter here, so read the sample dimensions instead of
+   * the samples themselves. This runs for every frame of playback, and pulling
+   * in the full topology arrays each time is wasteful for animated meshes. */
+  Alembic::Util::Dimensions positions_dim, face_counts_dim, face_indices_dim;
   try {
-    sample = m_schema.getValue(sample_sel);
+    m_schema.getPositionsProperty().getDimensions(positions_dim, sample_sel);
+    m_schema.getFaceCountsProperty().getDimensions(face_counts_dim, sample_sel);
+    m_schema.getFaceIndicesProperty().getDimensions(face_indices_dim, sample_sel);
   }
   catch (Alembic::Util::Exception &ex) {
     printf("Alembic: error reading mesh sample for '%s/%s' at time %f: %s\n",
@@ -619,13 +654,9 @@ bool AbcMeshReader::topology_changed(Mesh *existing_mesh, const ISampleSelector
     return false;
   }
 
-  const P3fArraySamplePtr &positions = sample.getPositions();
-  const Alembic::Abc::Int32ArraySamplePtr &face_indices = sample.getFaceIndices();
-  const Alembic::Abc::Int32ArraySamplePtr &face_counts = sample.getFaceCounts();
-
-  return positions->size() != existing_mesh->totvert ||
-         face_counts->size() != existing_mesh->totpoly ||
-         face_indices->size() != existing_mesh->totloop;
+  return positions_dim.numPoints() != existing_mesh->totvert ||
+         face_counts_dim.numPoints() != existing_mesh->totpoly ||
+         face_indices_dim.numPoints() != existing_mesh->totloop;
 }
 
 Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
@@ -694,6 +725,16 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
             " mesh. Only vertices will be read!";
       }
     }
+    else if (m_is_constant_topology) {
+      /* The polygons cannot have changed since the mesh was first read, so
+       * per-frame reads only need the animated vertex data. Normals are
+       * attached to the polygons though, so keep reading them unless they
+       * are constant as well. */
+      const IN3fGeomParam &normals = m_schema.getNormalsParam();
+      if (!normals.valid() || normals.isConstant()) {
+        settings.read_flag &= ~MOD_MESHSEQ_READ_POLY;
+      }
+    }
   }
 
   Mesh *mesh_to_export = new_mesh ? new_mesh : existing_mesh;
@@ -870,13 +911,38 @@ bool AbcSubDReader::accepts_object_type(
 }
 
 void AbcSubDReader::readObjectData(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel)
+{
+  createObjectData(bmain);
+  readObjectGeometry(sample_sel);
+  applyObjectGeometry(bmain, sample_sel);
+}
+
+bool AbcSubDReader::supportsParallelRead() const
+{
+  return true;
+}
+
+void AbcSubDReader::createObjectData(Main *bmain)
 {
   Mesh *mesh = BKE_mesh_add(bmain, m_data_name.c_str());
 
   m_object = BKE_object_add_only_object(bmain, OB_MESH, m_object_name.c_str());
   m_object->data = mesh;
+}
+
+void AbcSubDReader::readObjectGeometry(const Alembic::Abc::ISampleSelector &sample_sel)
+{
+  Mesh *mesh = static_cast<Mesh *>(m_object->data);
+  m_sampled_mesh = this->read_mesh(mesh, sample_sel, MOD_MESHSEQ_READ_ALL, nullptr);
+}
+
+void AbcSubDReader::applyObjectGeometry(Main *UNUSED(bmain),
+                                        const Alembic::Abc::ISampleSelector &sample_sel)
+{
+  Mesh *mesh = static_cast<Mesh *>(m_object->data);
+  Mesh *read_mesh = m_sampled_mesh;
+  m_sampled_mesh = nullptr;
 
-  Mesh *read_mesh = this->read_mesh(mesh, sample_sel, MOD_MESHSEQ_READ_ALL, nullptr);
   if (read_mesh != mesh) {
     BKE_mesh_nomain_to_mesh(read_mesh, mesh, m_object, &CD_MASK_EVERYTHING, true);
   }
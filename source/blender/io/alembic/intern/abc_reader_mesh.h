@@ -40,6 +40,11 @@ class AbcMeshReader : public AbcObjectReader {
                            const char **err_str) const override;
   void readObjectData(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel) override;
 
+  bool supportsParallelRead() const override;
+  void createObjectData(Main *bmain) override;
+  void readObjectGeometry(const Alembic::Abc::ISampleSelector &sample_sel) override;
+  void applyObjectGeometry(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel) override;
+
   struct Mesh *read_mesh(struct Mesh *existing_mesh,
                          const Alembic::Abc::ISampleSelector &sample_sel,
                          int read_flag,
@@ -48,6 +53,13 @@ class AbcMeshReader : public AbcObjectReader {
                         const Alembic::Abc::ISampleSelector &sample_sel) override;
 
  private:
+  /* Result of readObjectGeometry(), to be applied by applyObjectGeometry(). */
+  struct Mesh *m_sampled_mesh = nullptr;
+
+  /* Whether the face indices and counts are constant in the archive, in which
+   * case per-frame reads can skip the polygons entirely. */
+  bool m_is_constant_topology = false;
+
   void readFaceSetsSample(Main *bmain,
                           Mesh *mesh,
                           const Alembic::AbcGeom::ISampleSelector &sample_sel);
@@ -71,10 +83,20 @@ class AbcSubDReader : public AbcObjectReader {
                            const Object *const ob,
                            const char **err_str) const;
   void readObjectData(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel);
+
+  bool supportsParallelRead() const override;
+  void createObjectData(Main *bmain) override;
+  void readObjectGeometry(const Alembic::Abc::ISampleSelector &sample_sel) override;
+  void applyObjectGeometry(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel) override;
+
   struct Mesh *read_mesh(struct Mesh *existing_mesh,
                          const Alembic::Abc::ISampleSelector &sample_sel,
                          int read_flag,
                          const char **err_str);
+
+ private:
+  /* Result of readObjectGeometry(), to be applied by applyObjectGeometry(). */
+  struct Mesh *m_sampled_mesh = nullptr;
 };
 
 void read_mverts(MVert *mverts,
@@ -112,6 +112,24 @@ void AbcObjectReader::object(Object *ob)
   m_object = ob;
 }
 
+bool AbcObjectReader::supportsParallelRead() const
+{
+  return false;
+}
+
+void AbcObjectReader::createObjectData(Main * /*bmain*/)
+{
+}
+
+void AbcObjectReader::readObjectGeometry(const Alembic::Abc::ISampleSelector & /*sample_sel*/)
+{
+}
+
+void AbcObjectReader::applyObjectGeometry(Main * /*bmain*/,
+                                          const Alembic::Abc::ISampleSelector & /*sample_sel*/)
+{
+}
+
 static Imath::M44d blend_matrices(const Imath::M44d &m0, const Imath::M44d &m1, const float weight)
 {
   float mat0[4][4], mat1[4][4], ret[4][4];
@@ -139,6 +139,24 @@ class AbcObjectReader {
 
   virtual void readObjectData(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel) = 0;
 
+  /**
+   * Three-phase variant of readObjectData(), used by the importer to sample
+   * many objects in parallel. Readers that return true from
+   * supportsParallelRead() split their work into:
+   *
+   * - createObjectData(): creates the data-blocks, runs on the main thread;
+   * - readObjectGeometry(): samples the Alembic geometry, may run in a worker
+   *   thread and thus must not touch #Main;
+   * - applyObjectGeometry(): moves the sampled geometry into the data-blocks,
+   *   runs on the main thread again.
+   *
+   * For other readers the importer calls readObjectData() as before.
+   */
+  virtual bool supportsParallelRead() const;
+  virtual void createObjectData(Main *bmain);
+  virtual void readObjectGeometry(const Alembic::Abc::ISampleSelector &sample_sel);
+  virtual void applyObjectGeometry(Main *bmain, const Alembic::Abc::ISampleSelector &sample_sel);
+
   virtual struct Mesh *read_mesh(struct Mesh *mesh,
                                  const Alembic::Abc::ISampleSelector &sample_sel,
                                  int read_flag,
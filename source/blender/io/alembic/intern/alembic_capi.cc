@@ -64,6 +64,7 @@
 #include "BLI_math.h"
 #include "BLI_path_util.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 
 #include "WM_api.h"
 #include "WM_types.h"
@@ -497,22 +498,58 @@ static void import_startjob(void *user_data, short *stop, short *do_update, floa
   chrono_t max_time = std::numeric_limits<chrono_t>::min();
 
   ISampleSelector sample_sel(0.0f);
-  std::vector<AbcObjectReader *>::iterator iter;
-  for (iter = data->readers.begin(); iter != data->readers.end(); ++iter) {
-    AbcObjectReader *reader = *iter;
 
-    if (reader->valid()) {
-      reader->readObjectData(data->bmain, sample_sel);
-
-      min_time = std::min(min_time, reader->minTime());
-      max_time = std::max(max_time, reader->maxTime());
+  /* Geometry reading is parallelized over batches of objects: data-blocks are
+   * created serially (they modify #Main), then the Alembic samples of the
+   * whole batch are read by worker threads, and finally the results are moved
+   * into the data-blocks serially again. Batching bounds peak memory use,
+   * since sampled geometry is only held for one batch at a time. */
+  const size_t batch_size = 64;
+
+  for (size_t batch_start = 0; batch_start < data->readers.size(); batch_start += batch_size) {
+    const size_t batch_end = std::min(batch_start + batch_size, data->readers.size());
+
+    for (size_t j = batch_start; j < batch_end; j++) {
+      AbcObjectReader *reader = data->readers[j];
+
+      if (reader->valid()) {
+        if (reader->supportsParallelRead()) {
+          reader->createObjectData(data->bmain);
+        }
+        else {
+          reader->readObjectData(data->bmain, sample_sel);
+        }
+
+        min_time = std::min(min_time, reader->minTime());
+        max_time = std::max(max_time, reader->maxTime());
+      }
+      else {
+        std::cerr << "Object " << reader->name() << " in Alembic file " << data->filename
+                  << " is invalid.\n";
+      }
     }
-    else {
-      std::cerr << "Object " << reader->name() << " in Alembic file " << data->filename
-                << " is invalid.\n";
+
+    blender::threading::parallel_for(
+        blender::IndexRange(batch_start, batch_end - batch_start),
+        1,
+        [&](const blender::IndexRange range) {
+          for (const int64_t j : range) {
+            AbcObjectReader *reader = data->readers[j];
+            if (reader->valid() && reader->supportsParallelRead()) {
+              reader->readObjectGeometry(sample_sel);
+            }
+          }
+        });
+
+    for (size_t j = batch_start; j < batch_end; j++) {
+      AbcObjectReader *reader = data->readers[j];
+      if (reader->valid() && reader->supportsParallelRead()) {
+        reader->applyObjectGeometry(data->bmain, sample_sel);
+      }
     }
 
-    *data->progress = 0.1f + 0.3f * (++i / size);
+    i = batch_end;
+    *data->progress = 0.1f + 0.3f * (i / size);
     *data->do_update = true;
 
     if (G.is_break) {
@@ -537,6 +574,7 @@ static void import_startjob(void *user_data, short *stop, short *do_update, floa
   }
 
   /* Setup parenthood. */
+  std::vector<AbcObjectReader *>::iterator iter;
   for (iter = data->readers.begin(); iter != data->readers.end(); ++iter) {
     const AbcObjectReader *reader = *iter;
     const AbcObjectReader *parent_reader = reader->parent_reader;
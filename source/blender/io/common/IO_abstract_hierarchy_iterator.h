@@ -42,6 +42,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 struct Depsgraph;
 struct DupliObject;
@@ -125,6 +126,11 @@ class AbstractHierarchyWriter {
  public:
   virtual ~AbstractHierarchyWriter() = default;
   virtual void write(HierarchyContext &context) = 0;
+  /* Prepare expensive data for the write() call that follows, for example by
+   * evaluating and triangulating the export mesh. This must not touch the
+   * output file, so that the iterator can call it for many writers
+   * concurrently from worker threads. The default does nothing. */
+  virtual void prepare_write(HierarchyContext & /*context*/){};
   /* TODO(Sybren): add function like absent() that's called when a writer was previously created,
    * but wasn't used while exporting the current frame (for example, a particle-instanced mesh of
    * which the particle is no longer alive). */
@@ -279,10 +285,19 @@ class AbstractHierarchyIterator {
   void determine_duplication_references(const HierarchyContext *parent_context,
                                         std::string indent);
 
-  /* These three functions create writers and call their write() method. */
-  void make_writers(const HierarchyContext *parent_context);
-  void make_writer_object_data(const HierarchyContext *context);
-  void make_writers_particle_systems(const HierarchyContext *context);
+  /* A writer together with the context it is going to write. Jobs are
+   * collected in hierarchy order by the make_writers() functions, prepared in
+   * parallel and then written serially. */
+  struct WriteJob {
+    EnsuredWriter writer;
+    HierarchyContext context;
+  };
+
+  /* These three functions create writers and collect the write jobs. */
+  void make_writers(const HierarchyContext *parent_context, std::vector<WriteJob> &r_jobs);
+  void make_writer_object_data(const HierarchyContext *context, std::vector<WriteJob> &r_jobs);
+  void make_writers_particle_systems(const HierarchyContext *context,
+                                     std::vector<WriteJob> &r_jobs);
 
   /* Return the appropriate HierarchyContext for the data of the object represented by
    * object_context. */
@@ -0,0 +1,93 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+#pragma once
+
+/** \file
+ * \ingroup io_common
+ */
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BLI_compiler_attrs.h"
+
+namespace blender::io {
+
+/* Streams data to a file in bounded-size chunks.
+ *
+ * Data is appended with the write() functions. Whenever the current chunk
+ * reaches the chunk size it is handed to a background thread that performs
+ * the actual disk I/O, so that geometry extraction and conversion in the
+ * exporter overlap with writing. The total size of the chunks waiting to be
+ * written is limited by a memory budget; when the budget is reached, write()
+ * blocks until the I/O thread catches up. This caps the exporter's peak
+ * memory at roughly the budget, instead of buffering the complete file.
+ *
+ * Writers constructed from a file path own the file. Writers constructed
+ * from an already-open `FILE *` do not; the caller closes it after close().
+ */
+class ChunkedStreamWriter {
+ public:
+  static const size_t default_chunk_size = 1 << 20;        /* 1 MiB */
+  static const size_t default_memory_budget = 64 << 20;    /* 64 MiB */
+
+  explicit ChunkedStreamWriter(const char *filepath,
+                               size_t chunk_size = default_chunk_size,
+                               size_t memory_budget = default_memory_budget);
+  explicit ChunkedStreamWriter(FILE *file,
+                               size_t chunk_size = default_chunk_size,
+                               size_t memory_budget = default_memory_budget);
+  ~ChunkedStreamWriter();
+
+  /* False when the file could not be opened for writing. */
+  bool is_open() const;
+
+  void write(const void *data, size_t size);
+  void write(const std::string &text);
+  /* printf-style convenience for text formats. */
+  void write_formatted(const char *format, ...) ATTR_PRINTF_FORMAT(2, 3);
+
+  /* Flush all pending chunks and stop the I/O thread. Returns false when any
+   * write failed. Called implicitly by the destructor when omitted. */
+  bool close();
+
+ private:
+  void enqueue_current_chunk();
+  void write_loop();
+
+  FILE *file_ = nullptr;
+  bool owns_file_ = false;
+  size_t chunk_size_;
+  size_t memory_budget_;
+
+  std::vector<char> current_chunk_;
+
+  std::thread io_thread_;
+  std::mutex mutex_;
+  std::condition_variable queue_cond_;
+  std::condition_variable budget_cond_;
+  std::deque<std::vector<char>> queue_;
+  size_t queued_bytes_ = 0;
+  bool stop_ = false;
+  bool write_error_ = false;
+};
+
+}  // namespace blender::io
@@ -34,6 +34,7 @@
 #include "BLI_assert.h"
 #include "BLI_listbase.h"
 #include "BLI_math_matrix.h"
+#include "BLI_task.hh"
 
 #include "DNA_ID.h"
 #include "DNA_layer_types.h"
@@ -199,7 +200,33 @@ void AbstractHierarchyIterator::iterate_and_write()
   export_graph_prune();
   determine_export_paths(HierarchyContext::root());
   determine_duplication_references(HierarchyContext::root(), "");
-  make_writers(HierarchyContext::root());
+
+  std::vector<WriteJob> jobs;
+  make_writers(HierarchyContext::root(), jobs);
+
+  /* Preparing the data to write is the expensive part and does not touch the
+   * output file, so it is farmed out to worker threads. The writes themselves
+   * modify the output file and happen serially, in hierarchy order. Batching
+   * bounds peak memory use, as prepared data is only held for one batch at a
+   * time. */
+  const size_t batch_size = 64;
+  for (size_t batch_start = 0; batch_start < jobs.size(); batch_start += batch_size) {
+    const size_t batch_end = std::min(batch_start + batch_size, jobs.size());
+
+    blender::threading::parallel_for(
+        blender::IndexRange(batch_start, batch_end - batch_start),
+        1,
+        [&](const blender::IndexRange range) {
+          for (const int64_t i : range) {
+            jobs[i].writer->prepare_write(jobs[i].context);
+          }
+        });
+
+    for (size_t i = batch_start; i < batch_end; i++) {
+      jobs[i].writer->write(jobs[i].context);
+    }
+  }
+
   export_graph_clear();
 }
 
@@ -572,7 +599,8 @@ void AbstractHierarchyIterator::determine_duplication_references(
   }
 }
 
-void AbstractHierarchyIterator::make_writers(const HierarchyContext *parent_context)
+void AbstractHierarchyIterator::make_writers(const HierarchyContext *parent_context,
+                                             std::vector<WriteJob> &r_jobs)
 {
   float parent_matrix_inv_world[4][4];
 
@@ -605,16 +633,16 @@ void AbstractHierarchyIterator::make_writers(const HierarchyContext *parent_cont
       /* XXX This can lead to too many XForms being written. For example, a camera writer can
        * refuse to write an orthographic camera. By the time that this is known, the XForm has
        * already been written. */
-      transform_writer->write(*context);
+      r_jobs.push_back({transform_writer, *context});
     }
 
     if (!context->weak_export) {
-      make_writers_particle_systems(context);
-      make_writer_object_data(context);
+      make_writers_particle_systems(context, r_jobs);
+      make_writer_object_data(context, r_jobs);
     }
 
     /* Recurse into this object's children. */
-    make_writers(context);
+    make_writers(context, r_jobs);
   }
 
   /* TODO(Sybren): iterate over all unused writers and call unused_during_iteration() or something.
@@ -632,7 +660,8 @@ HierarchyContext AbstractHierarchyIterator::context_for_object_data(
   return data_context;
 }
 
-void AbstractHierarchyIterator::make_writer_object_data(const HierarchyContext *context)
+void AbstractHierarchyIterator::make_writer_object_data(const HierarchyContext *context,
+                                                        std::vector<WriteJob> &r_jobs)
 {
   if (context->object->data == nullptr) {
     return;
@@ -655,12 +684,12 @@ void AbstractHierarchyIterator::make_writer_object_data(const HierarchyContext *
   }
 
   if (data_writer.is_newly_created() || export_subset_.shapes) {
-    data_writer->write(data_context);
+    r_jobs.push_back({data_writer, data_context});
   }
 }
 
 void AbstractHierarchyIterator::make_writers_particle_systems(
-    const HierarchyContext *transform_context)
+    const HierarchyContext *transform_context, std::vector<WriteJob> &r_jobs)
 {
   Object *object = transform_context->object;
   ParticleSystem *psys = static_cast<ParticleSystem *>(object->particlesystem.first);
@@ -691,7 +720,7 @@ void AbstractHierarchyIterator::make_writers_particle_systems(
 
     /* Always write upon creation, otherwise depend on which subset is active. */
     if (writer.is_newly_created() || export_subset_.shapes) {
-      writer->write(hair_context);
+      r_jobs.push_back({writer, hair_context});
     }
   }
 }
@@ -0,0 +1,199 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+#include "IO_chunked_stream_writer.hh"
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstring>
+
+#include "BLI_fileops.h"
+
+namespace blender::io {
+
+ChunkedStreamWriter::ChunkedStreamWriter(const char *filepath,
+                                         const size_t chunk_size,
+                                         const size_t memory_budget)
+    : ChunkedStreamWriter(BLI_fopen(filepath, "wb"), chunk_size, memory_budget)
+{
+  owns_file_ = true;
+}
+
+ChunkedStreamWriter::ChunkedStreamWriter(FILE *file,
+                                         const size_t chunk_size,
+                                         const size_t memory_budget)
+    : file_(file),
+      chunk_size_(std::max<size_t>(chunk_size, 1)),
+      memory_budget_(std::max(memory_budget, chunk_size))
+{
+  if (file_ == nullptr) {
+    return;
+  }
+
+  current_chunk_.reserve(chunk_size_);
+  io_thread_ = std::thread(&ChunkedStreamWriter::write_loop, this);
+}
+
+ChunkedStreamWriter::~ChunkedStreamWriter()
+{
+  close();
+}
+
+bool ChunkedStreamWriter::is_open() const
+{
+  return file_ != nullptr;
+}
+
+void ChunkedStreamWriter::write(const void *data, size_t size)
+{
+  if (file_ == nullptr || write_error_) {
+    return;
+  }
+
+  const char *bytes = static_cast<const char *>(data);
+  while (size > 0) {
+    const size_t space = chunk_size_ - current_chunk_.size();
+    const size_t amount = std::min(space, size);
+
+    current_chunk_.insert(current_chunk_.end(), bytes, bytes + amount);
+    bytes += amount;
+    size -= amount;
+
+    if (current_chunk_.size() == chunk_size_) {
+      enqueue_current_chunk();
+    }
+  }
+}
+
+void ChunkedStreamWriter::write(const std::string &text)
+{
+  write(text.data(), text.size());
+}
+
+void ChunkedStreamWriter::write_formatted(const char *format, ...)
+{
+  char fixed_buffer[256];
+  va_list args;
+
+  va_start(args, format);
+  const int length = vsnprintf(fixed_buffer, sizeof(fixed_buffer), format, args);
+  va_end(args);
+
+  if (length < 0) {
+    return;
+  }
+
+  if (size_t(length) < sizeof(fixed_buffer)) {
+    write(fixed_buffer, size_t(length));
+    return;
+  }
+
+  /* The formatted text did not fit into the fixed buffer. */
+  std::vector<char> heap_buffer(size_t(length) + 1);
+  va_start(args, format);
+  vsnprintf(heap_buffer.data(), heap_buffer.size(), format, args);
+  va_end(args);
+
+  write(heap_buffer.data(), size_t(length));
+}
+
+void ChunkedStreamWriter::enqueue_current_chunk()
+{
+  if (current_chunk_.empty()) {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  /* Block until the I/O thread has caught up enough for this chunk to fit
+   * into the memory budget. This is what bounds the exporter's peak memory. */
+  budget_cond_.wait(lock, [&]() {
+    return queued_bytes_ + current_chunk_.size() <= memory_budget_ || write_error_;
+  });
+
+  if (write_error_) {
+    current_chunk_.clear();
+    return;
+  }
+
+  queued_bytes_ += current_chunk_.size();
+  queue_.push_back(std::move(current_chunk_));
+
+  current_chunk_ = std::vector<char>();
+  current_chunk_.reserve(chunk_size_);
+
+  queue_cond_.notify_one();
+}
+
+void ChunkedStreamWriter::write_loop()
+{
+  for (;;) {
+    std::vector<char> chunk;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      queue_cond_.wait(lock, [&]() { return !queue_.empty() || stop_; });
+
+      if (queue_.empty()) {
+        break;
+      }
+
+      chunk = std::move(queue_.front());
+      queue_.pop_front();
+    }
+
+    /* The actual I/O runs without holding the lock, so producers can keep
+     * filling the queue while this chunk goes to disk. */
+    const size_t written = fwrite(chunk.data(), 1, chunk.size(), file_);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (written != chunk.size()) {
+        write_error_ = true;
+      }
+      queued_bytes_ -= chunk.size();
+    }
+    budget_cond_.notify_all();
+  }
+}
+
+bool ChunkedStreamWriter::close()
+{
+  if (file_ == nullptr) {
+    return false;
+  }
+
+  enqueue_current_chunk();
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  queue_cond_.notify_one();
+  io_thread_.join();
+
+  if (owns_file_) {
+    if (fclose(file_) != 0) {
+      write_error_ = true;
+    }
+  }
+  else {
+    fflush(file_);
+  }
+  file_ = nullptr;
+
+  return !write_error_;
+}
+
+}  // namespace blender::io
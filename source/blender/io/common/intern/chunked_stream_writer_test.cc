@@ -0,0 +1,88 @@
+/* Apache License, Version 2.0 */
+
+#include "IO_chunked_stream_writer.hh"
+
+#include "testing/testing.h"
+
+#include <cstring>
+#include <string>
+
+namespace blender::io {
+
+/* Read everything that was streamed to the file back into a string. */
+static std::string read_back(FILE *file)
+{
+  rewind(file);
+
+  std::string result;
+  char buffer[4096];
+  size_t num_read;
+  while ((num_read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    result.append(buffer, num_read);
+  }
+  return result;
+}
+
+TEST(chunked_stream_writer, write_chunked)
+{
+  FILE *file = tmpfile();
+  ASSERT_NE(file, nullptr);
+
+  /* Tiny chunk size and budget, so that both the chunk hand-over and the
+   * budget blocking path are exercised many times. */
+  ChunkedStreamWriter writer(file, 64, 256);
+  ASSERT_TRUE(writer.is_open());
+
+  std::string expected;
+  for (int i = 0; i < 1000; i++) {
+    const std::string line = "line " + std::to_string(i) + "\n";
+    writer.write(line);
+    expected += line;
+  }
+  EXPECT_TRUE(writer.close());
+
+  EXPECT_EQ(read_back(file), expected);
+  fclose(file);
+}
+
+TEST(chunked_stream_writer, write_formatted)
+{
+  FILE *file = tmpfile();
+  ASSERT_NE(file, nullptr);
+
+  ChunkedStreamWriter writer(file, 16, 64);
+  ASSERT_TRUE(writer.is_open());
+
+  writer.write_formatted("v %.6f %.6f %.6f\n", 1.0f, 2.5f, -3.0f);
+
+  /* Longer than the fixed-size formatting buffer. */
+  const std::string long_name(512, 'x');
+  writer.write_formatted("g %s\n", long_name.c_str());
+
+  EXPECT_TRUE(writer.close());
+
+  const std::string expected = "v 1.000000 2.500000 -3.000000\ng " + long_name + "\n";
+  EXPECT_EQ(read_back(file), expected);
+  fclose(file);
+}
+
+TEST(chunked_stream_writer, write_partial_chunks)
+{
+  FILE *file = tmpfile();
+  ASSERT_NE(file, nullptr);
+
+  ChunkedStreamWriter writer(file, 8, 32);
+  ASSERT_TRUE(writer.is_open());
+
+  /* A single write larger than the chunk size has to be split up. */
+  const std::string data(100, 'a');
+  writer.write(data.data(), data.size());
+  /* A write smaller than the chunk size is flushed by close(). */
+  writer.write("b", 1);
+  EXPECT_TRUE(writer.close());
+
+  EXPECT_EQ(read_back(file), data + "b");
+  fclose(file);
+}
+
+}  // namespace blender::io
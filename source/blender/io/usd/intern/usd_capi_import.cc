@@ -46,6 +46,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_path_util.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 
 #include "DEG_depsgraph.h"
 #include "DEG_depsgraph_build.h"
@@ -236,28 +237,53 @@ static void import_startjob(void *customdata, short *stop, short *do_update, flo
   const float size = static_cast<float>(archive->readers().size());
   size_t i = 0;
 
-  /* Setup parenthood */
+  /* Read data and setup parenthood. Geometry sampling is parallelized over
+   * batches of prims: the samples of the whole batch are read by worker
+   * threads, then the results are moved into the data-blocks serially, since
+   * that modifies #Main. Batching bounds peak memory use, as sampled geometry
+   * is only held for one batch at a time. */
+  const size_t batch_size = 64;
+  const std::vector<USDPrimReader *> &readers = archive->readers();
+
+  for (size_t batch_start = 0; batch_start < readers.size(); batch_start += batch_size) {
+    const size_t batch_end = std::min(batch_start + batch_size, readers.size());
+
+    blender::threading::parallel_for(
+        blender::IndexRange(batch_start, batch_end - batch_start),
+        1,
+        [&](const blender::IndexRange range) {
+          for (const int64_t j : range) {
+            USDPrimReader *reader = readers[j];
+            if (reader && reader->supports_parallel_read()) {
+              reader->read_geometry(0.0);
+            }
+          }
+        });
+
+    for (size_t j = batch_start; j < batch_end; j++) {
+      USDPrimReader *reader = readers[j];
 
-  for (USDPrimReader *reader : archive->readers()) {
+      if (!reader) {
+        continue;
+      }
 
-    if (!reader) {
-      continue;
-    }
+      Object *ob = reader->object();
 
-    Object *ob = reader->object();
+      reader->read_object_data(data->bmain, 0.0);
 
-    reader->read_object_data(data->bmain, 0.0);
+      USDPrimReader *parent = reader->parent();
 
-    USDPrimReader *parent = reader->parent();
+      if (parent == nullptr) {
+        ob->parent = nullptr;
+      }
+      else {
+        ob->parent = parent->object();
+      }
 
-    if (parent == nullptr) {
-      ob->parent = nullptr;
-    }
-    else {
-      ob->parent = parent->object();
+      i++;
     }
 
-    *data->progress = 0.2f + 0.8f * (++i / size);
+    *data->progress = 0.2f + 0.8f * (i / size);
     *data->do_update = true;
 
     if (G.is_break) {
@@ -202,15 +202,34 @@ void USDMeshReader::create_object(Main *bmain, const double /* motionSampleTime
   object_->data = mesh;
 }
 
-void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
+bool USDMeshReader::supports_parallel_read() const
+{
+  return true;
+}
+
+void USDMeshReader::read_geometry(const double motionSampleTime)
 {
   Mesh *mesh = (Mesh *)object_->data;
 
   is_initial_load_ = true;
-  Mesh *read_mesh = this->read_mesh(
-      mesh, motionSampleTime, import_params_.mesh_read_flag, nullptr);
-
+  sampled_mesh_ = this->read_mesh(mesh, motionSampleTime, import_params_.mesh_read_flag, nullptr);
   is_initial_load_ = false;
+}
+
+void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
+{
+  Mesh *mesh = (Mesh *)object_->data;
+
+  /* Use the geometry sampled by read_geometry() when the importer ran it in a
+   * worker thread already. */
+  Mesh *read_mesh = sampled_mesh_;
+  sampled_mesh_ = nullptr;
+
+  if (read_mesh == nullptr) {
+    is_initial_load_ = true;
+    read_mesh = this->read_mesh(mesh, motionSampleTime, import_params_.mesh_read_flag, nullptr);
+    is_initial_load_ = false;
+  }
   if (read_mesh != mesh) {
     /* FIXME: after 2.80; `mesh->flag` isn't copied by #BKE_mesh_nomain_to_mesh() */
     /* read_mesh can be freed by BKE_mesh_nomain_to_mesh(), so get the flag before that happens. */
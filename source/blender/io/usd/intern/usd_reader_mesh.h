@@ -55,6 +55,9 @@ class USDMeshReader : public USDGeomReader {
    * implemented.  Note this will break if faces or positions vary. */
   bool is_initial_load_;
 
+  /* Result of read_geometry(), consumed by read_object_data(). */
+  struct Mesh *sampled_mesh_ = nullptr;
+
  public:
   USDMeshReader(const pxr::UsdPrim &prim,
                 const USDImportParams &import_params,
@@ -65,6 +68,9 @@ class USDMeshReader : public USDGeomReader {
   void create_object(Main *bmain, double motionSampleTime) override;
   void read_object_data(Main *bmain, double motionSampleTime) override;
 
+  bool supports_parallel_read() const override;
+  void read_geometry(double motionSampleTime) override;
+
   struct Mesh *read_mesh(struct Mesh *existing_mesh,
                          double motionSampleTime,
                          int read_flag,
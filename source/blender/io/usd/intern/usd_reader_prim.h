@@ -93,6 +93,19 @@ class USDPrimReader {
   virtual void create_object(Main *bmain, double motionSampleTime) = 0;
   virtual void read_object_data(Main * /* bmain */, double /* motionSampleTime */){};
 
+  /**
+   * Readers that return true from supports_parallel_read() implement
+   * read_geometry(), which samples the USD geometry ahead of
+   * read_object_data() and must not touch #Main, so that the importer can run
+   * it for many prims in parallel. The result is consumed by the subsequent
+   * read_object_data() call on the main thread.
+   */
+  virtual bool supports_parallel_read() const
+  {
+    return false;
+  }
+  virtual void read_geometry(double /* motionSampleTime */){};
+
   Object *object() const;
   void object(Object *ob);
 
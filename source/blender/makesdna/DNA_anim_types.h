@@ -774,7 +774,8 @@ typedef struct NlaStrip {
   /* Pointer to an original NLA strip. */
   struct NlaStrip *orig_strip;
 
-  void *_pad3;
+  /** Runtime. Cached raw evaluation result of the strip, see #NlaStripEvalCache. */
+  void *eval_cache;
 } NlaStrip;
 
 /* NLA Strip Blending Mode */
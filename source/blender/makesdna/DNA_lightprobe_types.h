@@ -171,6 +171,11 @@ typedef struct LightCache {
   /** Size of a visibility/reflection sample. */
   int vis_res, ref_res;
   char _pad[4][2];
+  /** Per-probe dirty bits for incremental re-bakes, indexed in cache probe order.
+   * Sized to hold MAX_GRID/MAX_PROBE bits (see eevee_private.h), only meaningful
+   * while LIGHTCACHE_TAG_PARTIAL is set. */
+  unsigned int grid_dirty[2];
+  unsigned int cube_dirty[4];
   /* In the future, we could create a bigger texture containing
    * multiple caches (for animation) and interpolate between the
    * caches overtime to another texture. */
@@ -207,6 +212,8 @@ enum {
   LIGHTCACHE_INVALID = (1 << 8),
   /** The data present in the cache is valid but unusable on this GPU. */
   LIGHTCACHE_NOT_USABLE = (1 << 9),
+  /** Per-probe dirty bits are maintained: an update can re-bake only the tagged probes. */
+  LIGHTCACHE_TAG_PARTIAL = (1 << 10),
 };
 
 /* EEVEE_LightCacheTexture->data_type */
@@ -86,7 +86,12 @@ typedef struct Mesh_Runtime {
   void *batch_cache;
 
   struct SubdivCCG *subdiv_ccg;
-  void *_pad1;
+  /**
+   * Unique stamp assigned when this mesh is stored as an evaluation result,
+   * so dependent objects can detect it changed. Zero when never stamped.
+   * See #ModifierPrefixCache in `DerivedMesh.cc`.
+   */
+  uint64_t eval_generation;
   int subdiv_ccg_tot_level;
   char _pad2[4];
 
@@ -95,6 +100,15 @@ typedef struct Mesh_Runtime {
   int64_t cd_dirty_loop;
   int64_t cd_dirty_poly;
 
+  /**
+   * Vertex range tagged by a deform-only update, so normal recalculation can be limited
+   * to the affected region. Only meaningful while `CD_MASK_NORMAL` is set in #cd_dirty_vert;
+   * a length of zero means the whole mesh is dirty.
+   * See #BKE_mesh_normals_tag_dirty_range.
+   */
+  int dirty_normal_range_start;
+  int dirty_normal_range_len;
+
   struct MLoopTri_Store looptris;
 
   /** `BVHCache` defined in 'BKE_bvhutil.c' */
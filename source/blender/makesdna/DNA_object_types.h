@@ -204,6 +204,14 @@ typedef struct Object_Runtime {
   /** Runtime evaluated curve-specific data, not stored in the file. */
   struct CurveCache *curve_cache;
 
+  /**
+   * Cached intermediate result of the modifier stack, so that parameter tweaks on the last
+   * expensive constructive modifier do not re-evaluate the whole stack. Stored on the original
+   * object since the evaluated copy is re-created on every depsgraph update.
+   * Owned and managed by `DerivedMesh.cc`.
+   */
+  struct ModifierPrefixCache *modifier_prefix_cache;
+
   unsigned short local_collections_bits;
   short _pad2[3];
 } Object_Runtime;
@@ -748,6 +748,12 @@ typedef struct RenderData {
   float simplify_particles;
   float simplify_particles_render;
   float simplify_volumes;
+  /**
+   * Screen coverage below which subdivision levels of an object are reduced in the viewport,
+   * zero disables coverage based level of detail.
+   */
+  float simplify_lod_threshold;
+  char _pad8[4];
 
   /* Freestyle line thickness options */
   int line_thickness_mode;
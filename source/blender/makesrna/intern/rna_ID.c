@@ -267,6 +267,12 @@ int rna_ID_override_library_property_operation_locname_length(PointerRNA *ptr)
   return (opop->subitem_local_name == NULL) ? 0 : strlen(opop->subitem_local_name);
 }
 
+static float rna_ID_memory_usage_get(PointerRNA *ptr)
+{
+  ID *id = (ID *)ptr->data;
+  return (float)BKE_libblock_memory_usage_estimate(id);
+}
+
 /* name functions that ignore the first two ID characters */
 void rna_ID_name_get(PointerRNA *ptr, char *value)
 {
@@ -1903,6 +1909,15 @@ static void rna_def_ID(BlenderRNA *brna)
   RNA_def_property_clear_flag(prop, PROP_EDITABLE);
   RNA_def_property_ui_text(prop, "Users", "Number of times this data-block is referenced");
 
+  prop = RNA_def_property(srna, "memory_usage", PROP_FLOAT, PROP_NONE);
+  RNA_def_property_clear_flag(prop, PROP_EDITABLE);
+  RNA_def_property_float_funcs(prop, "rna_ID_memory_usage_get", NULL, NULL);
+  RNA_def_property_ui_text(
+      prop,
+      "Memory Usage",
+      "Estimate in bytes of the main memory used by this data-block and the heavy data it owns "
+      "(geometry layers, cached image buffers, point caches), intended for statistics");
+
   prop = RNA_def_property(srna, "use_fake_user", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_boolean_sdna(prop, NULL, "flag", LIB_FAKEUSER);
   RNA_def_property_ui_text(prop, "Fake User", "Save this data-block even if it has no users");
@@ -31,6 +31,8 @@
 #include "DNA_scene_types.h"
 #include "DNA_windowmanager_types.h"
 
+#include "atomic_ops.h"
+
 #include "BLI_alloca.h"
 #include "BLI_blenlib.h"
 #include "BLI_dynstr.h"
@@ -75,27 +77,47 @@ const PointerRNA PointerRNA_NULL = {NULL};
 void RNA_init(void)
 {
   StructRNA *srna;
-  PropertyRNA *prop;
 
   BLENDER_RNA.structs_map = BLI_ghash_str_new_ex(__func__, 2048);
   BLENDER_RNA.structs_len = 0;
 
   for (srna = BLENDER_RNA.structs.first; srna; srna = srna->cont.next) {
-    if (!srna->cont.prophash) {
-      srna->cont.prophash = BLI_ghash_str_new("RNA_init gh");
-
-      for (prop = srna->cont.properties.first; prop; prop = prop->next) {
-        if (!(prop->flag_internal & PROP_INTERN_BUILTIN)) {
-          BLI_ghash_insert(srna->cont.prophash, (void *)prop->identifier, prop);
-        }
-      }
-    }
+    /* NOTE: property hashes (`cont.prophash`) are created lazily, on the first name lookup in
+     * each struct, see #rna_struct_prophash_ensure(). Creating thousands of them up-front is a
+     * measurable part of startup time, and most structs never get a name lookup at all in a
+     * typical session (background renders especially). */
     BLI_assert(srna->flag & STRUCT_PUBLIC_NAMESPACE);
     BLI_ghash_insert(BLENDER_RNA.structs_map, (void *)srna->identifier, srna);
     BLENDER_RNA.structs_len += 1;
   }
 }
 
+GHash *rna_struct_prophash_ensure(StructRNA *srna)
+{
+  GHash *prophash = srna->cont.prophash;
+
+  if (prophash != NULL) {
+    return prophash;
+  }
+
+  /* Name lookups can run from multiple threads (RNA path resolution during depsgraph evaluation
+   * e.g.), so the hash is fully built before being published, and losers of the race simply free
+   * their copy again. */
+  prophash = BLI_ghash_str_new(__func__);
+  for (PropertyRNA *prop = srna->cont.properties.first; prop; prop = prop->next) {
+    if (!(prop->flag_internal & PROP_INTERN_BUILTIN)) {
+      BLI_ghash_insert(prophash, (void *)prop->identifier, prop);
+    }
+  }
+
+  if (atomic_cas_ptr((void **)&srna->cont.prophash, NULL, prophash) != NULL) {
+    BLI_ghash_free(prophash, NULL, NULL);
+    prophash = srna->cont.prophash;
+  }
+
+  return prophash;
+}
+
 void RNA_exit(void)
 {
   StructRNA *srna;
@@ -4580,8 +4602,39 @@ static int rna_raw_access(ReportList *reports,
         return 1;
       }
 
-      /* Could also be faster with non-matching types,
-       * for now we just do slower loop. */
+      /* Non-matching raw types: both sides are still dense typed arrays,
+       * so convert element-wise in one batch instead of falling back to
+       * the much slower per-item property access below. */
+      if ((in.type != PROP_RAW_UNSET) && (out.type != PROP_RAW_UNSET)) {
+        void *outp = out.array;
+        int a, b;
+
+        for (a = 0; a < out.len; a++) {
+          RawArray item;
+
+          item.array = outp;
+          item.type = out.type;
+          item.len = arraylen;
+          item.stride = 0;
+
+          for (b = 0; b < arraylen; b++) {
+            double value;
+
+            if (set) {
+              RAW_GET(double, value, in, a * arraylen + b);
+              RAW_SET(double, item, b, value);
+            }
+            else {
+              RAW_GET(double, value, item, b);
+              RAW_SET(double, in, a * arraylen + b, value);
+            }
+          }
+
+          outp = (char *)outp + out.stride;
+        }
+
+        return 1;
+      }
     }
   }
 
@@ -18,6 +18,7 @@
  * \ingroup RNA
  */
 
+#include <float.h>
 #include <stdlib.h>
 
 #include "BLI_path_util.h"
@@ -252,6 +253,13 @@ static void rna_Depsgraph_debug_stats_gnuplot(Depsgraph *depsgraph,
   fclose(f);
 }
 
+static float rna_Depsgraph_debug_id_eval_time(Depsgraph *depsgraph, ID *id)
+{
+  float eval_time = 0.0f;
+  DEG_debug_id_eval_time_get(depsgraph, id, &eval_time);
+  return eval_time;
+}
+
 static void rna_Depsgraph_debug_tag_update(Depsgraph *depsgraph)
 {
   DEG_graph_tag_relations_update(depsgraph);
@@ -665,6 +673,18 @@ static void rna_def_depsgraph(BlenderRNA *brna)
                                   "File name where gnuplot script will save the result");
   RNA_def_parameter_flags(parm, 0, PARM_REQUIRED);
 
+  func = RNA_def_function(srna, "debug_id_eval_time", "rna_Depsgraph_debug_id_eval_time");
+  RNA_def_function_ui_description(
+      func,
+      "Time in seconds spent evaluating this data-block during the last dependency graph "
+      "evaluation, only recorded when timing statistics are enabled "
+      "(bpy.app.debug_depsgraph_time)");
+  parm = RNA_def_pointer(func, "id", "ID", "", "Data-block to query, original or evaluated");
+  RNA_def_parameter_flags(parm, PROP_NEVER_NULL, PARM_REQUIRED);
+  parm = RNA_def_float(
+      func, "eval_time", 0.0f, 0.0f, FLT_MAX, "Time", "Evaluation time in seconds", 0.0f, FLT_MAX);
+  RNA_def_function_output(func, parm);
+
   func = RNA_def_function(srna, "debug_tag_update", "rna_Depsgraph_debug_tag_update");
 
   func = RNA_def_function(srna, "debug_stats", "rna_Depsgraph_debug_stats");
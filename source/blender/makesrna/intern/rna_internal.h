@@ -559,6 +559,7 @@ bool rna_property_override_apply_default(struct Main *bmain,
 
 /* Builtin Property Callbacks */
 
+struct GHash *rna_struct_prophash_ensure(struct StructRNA *srna);
 void rna_builtin_properties_begin(struct CollectionPropertyIterator *iter, struct PointerRNA *ptr);
 void rna_builtin_properties_next(struct CollectionPropertyIterator *iter);
 PointerRNA rna_builtin_properties_get(struct CollectionPropertyIterator *iter);
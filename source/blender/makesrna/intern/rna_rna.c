@@ -435,27 +435,14 @@ int rna_builtin_properties_lookup_string(PointerRNA *ptr, const char *key, Point
   srna = ptr->type;
 
   do {
-    if (srna->cont.prophash) {
-      prop = BLI_ghash_lookup(srna->cont.prophash, (void *)key);
+    prop = BLI_ghash_lookup(rna_struct_prophash_ensure(srna), (void *)key);
 
-      if (prop) {
-        propptr.type = &RNA_Property;
-        propptr.data = prop;
+    if (prop) {
+      propptr.type = &RNA_Property;
+      propptr.data = prop;
 
-        *r_ptr = propptr;
-        return true;
-      }
-    }
-    else {
-      for (prop = srna->cont.properties.first; prop; prop = prop->next) {
-        if (!(prop->flag_internal & PROP_INTERN_BUILTIN) && STREQ(prop->identifier, key)) {
-          propptr.type = &RNA_Property;
-          propptr.data = prop;
-
-          *r_ptr = propptr;
-          return true;
-        }
-      }
+      *r_ptr = propptr;
+      return true;
     }
   } while ((srna = srna->base));
   return false;
@@ -43,9 +43,12 @@
 
 #ifdef RNA_RUNTIME
 
+#  include "MEM_guardedalloc.h"
+
 #  include "BKE_editmesh.h"
 #  include "BKE_global.h"
 #  include "BKE_image.h"
+#  include "BKE_report.h"
 #  include "BKE_scene.h"
 #  include "BKE_writeavi.h"
 
@@ -184,6 +187,80 @@ static void rna_Scene_ray_cast(Scene *scene,
   }
 }
 
+static void rna_Scene_ray_cast_multi(Scene *scene,
+                                     Depsgraph *depsgraph,
+                                     ReportList *reports,
+                                     int origins_len,
+                                     float *origins,
+                                     int directions_len,
+                                     float *directions,
+                                     float ray_dist,
+                                     int *r_results_len,
+                                     int **r_results,
+                                     int *r_locations_len,
+                                     float **r_locations,
+                                     int *r_normals_len,
+                                     float **r_normals,
+                                     int *r_indices_len,
+                                     int **r_indices)
+{
+  *r_results_len = *r_locations_len = *r_normals_len = *r_indices_len = 0;
+  *r_results = *r_indices = NULL;
+  *r_locations = *r_normals = NULL;
+
+  if ((directions_len != origins_len) || (origins_len % 3) != 0) {
+    BKE_report(reports, RPT_ERROR, "Ray arrays must hold matching multiples of 3 floats");
+    return;
+  }
+
+  const int tot_rays = origins_len / 3;
+
+  int *results = MEM_callocN(sizeof(int) * tot_rays, __func__);
+  float *locations = MEM_callocN(sizeof(float[3]) * tot_rays, __func__);
+  float *normals = MEM_callocN(sizeof(float[3]) * tot_rays, __func__);
+  int *indices = MEM_mallocN(sizeof(int) * tot_rays, __func__);
+
+  /* Unlike single ray_cast, share one snap context over all rays: the object loop then hits
+   * warm BVH trees for every ray after the first. */
+  SnapObjectContext *sctx = ED_transform_snap_object_context_create(scene, 0);
+
+  for (int i = 0; i < tot_rays; i++) {
+    float direction[3];
+    float depth = ray_dist;
+    int index = -1;
+
+    normalize_v3_v3(direction, &directions[i * 3]);
+
+    bool ret = ED_transform_snap_object_project_ray_ex(sctx,
+                                                       depsgraph,
+                                                       &(const struct SnapObjectParams){
+                                                           .snap_select = SNAP_ALL,
+                                                       },
+                                                       &origins[i * 3],
+                                                       direction,
+                                                       &depth,
+                                                       &locations[i * 3],
+                                                       &normals[i * 3],
+                                                       &index,
+                                                       NULL,
+                                                       NULL);
+
+    results[i] = (int)ret;
+    indices[i] = ret ? index : -1;
+  }
+
+  ED_transform_snap_object_context_destroy(sctx);
+
+  *r_results_len = tot_rays;
+  *r_results = results;
+  *r_locations_len = tot_rays * 3;
+  *r_locations = locations;
+  *r_normals_len = tot_rays * 3;
+  *r_normals = normals;
+  *r_indices_len = tot_rays;
+  *r_indices = indices;
+}
+
 static void rna_Scene_sequencer_editing_free(Scene *scene)
 {
   SEQ_editing_free(scene, true);
@@ -340,6 +417,82 @@ void RNA_api_scene(StructRNA *srna)
   parm = RNA_def_float_matrix(func, "matrix", 4, 4, NULL, 0.0f, 0.0f, "", "Matrix", 0.0f, 0.0f);
   RNA_def_function_output(func, parm);
 
+  /* Batched Ray Cast */
+  func = RNA_def_function(srna, "ray_cast_multi", "rna_Scene_ray_cast_multi");
+  RNA_def_function_ui_description(func,
+                                  "Cast multiple rays in one call, sharing the snap context "
+                                  "between them (much faster than repeated ray_cast calls)");
+  RNA_def_function_flag(func, FUNC_USE_REPORTS);
+  parm = RNA_def_pointer(func, "depsgraph", "Depsgraph", "", "The current dependency graph");
+  RNA_def_parameter_flags(parm, PROP_NEVER_NULL, PARM_REQUIRED);
+  parm = RNA_def_float_array(func,
+                             "origins",
+                             1,
+                             NULL,
+                             -FLT_MAX,
+                             FLT_MAX,
+                             "",
+                             "Flat array of ray origins (3 floats per ray)",
+                             -1e4,
+                             1e4);
+  RNA_def_parameter_flags(parm, PROP_NEVER_NULL | PROP_DYNAMIC, PARM_REQUIRED);
+  parm = RNA_def_float_array(func,
+                             "directions",
+                             1,
+                             NULL,
+                             -FLT_MAX,
+                             FLT_MAX,
+                             "",
+                             "Flat array of ray directions (3 floats per ray)",
+                             -1e4,
+                             1e4);
+  RNA_def_parameter_flags(parm, PROP_NEVER_NULL | PROP_DYNAMIC, PARM_REQUIRED);
+  RNA_def_float(func,
+                "distance",
+                BVH_RAYCAST_DIST_MAX,
+                0.0,
+                BVH_RAYCAST_DIST_MAX,
+                "",
+                "Maximum distance",
+                0.0,
+                BVH_RAYCAST_DIST_MAX);
+  /* return hit status, locations, normals and face indices */
+  parm = RNA_def_int_array(func, "results", 1, NULL, 0, 1, "", "1 for each ray that hit, else 0", 0, 1);
+  RNA_def_parameter_flags(parm, PROP_DYNAMIC, PARM_OUTPUT);
+  parm = RNA_def_float_array(func,
+                             "locations",
+                             1,
+                             NULL,
+                             -FLT_MAX,
+                             FLT_MAX,
+                             "",
+                             "Flat array of hit locations (3 floats per ray)",
+                             -1e4,
+                             1e4);
+  RNA_def_parameter_flags(parm, PROP_DYNAMIC, PARM_OUTPUT);
+  parm = RNA_def_float_array(func,
+                             "normals",
+                             1,
+                             NULL,
+                             -FLT_MAX,
+                             FLT_MAX,
+                             "",
+                             "Flat array of hit normals (3 floats per ray)",
+                             -1e4,
+                             1e4);
+  RNA_def_parameter_flags(parm, PROP_DYNAMIC, PARM_OUTPUT);
+  parm = RNA_def_int_array(func,
+                           "indices",
+                           1,
+                           NULL,
+                           -1,
+                           INT_MAX,
+                           "",
+                           "Face index per ray, -1 when missed or unavailable",
+                           -1,
+                           INT_MAX);
+  RNA_def_parameter_flags(parm, PROP_DYNAMIC, PARM_OUTPUT);
+
   /* Sequencer. */
   func = RNA_def_function(srna, "sequence_editor_create", "SEQ_editing_ensure");
   RNA_def_function_ui_description(func, "Ensure sequence editor is valid in this scene");
@@ -171,6 +171,7 @@ typedef struct DisplaceUserdata {
   int direction;
   bool use_global_direction;
   Tex *tex_target;
+  const TexResult *tex_values;
   float (*tex_co)[3];
   float (*vertexCos)[3];
   float local_mat[4][4];
@@ -190,7 +191,6 @@ static void displaceModifier_do_task(void *__restrict userdata,
   int defgrp_index = data->defgrp_index;
   int direction = data->direction;
   bool use_global_direction = data->use_global_direction;
-  float(*tex_co)[3] = data->tex_co;
   float(*vertexCos)[3] = data->vertexCos;
   MVert *mvert = data->mvert;
   float(*vert_clnors)[3] = data->vert_clnors;
@@ -211,10 +211,9 @@ static void displaceModifier_do_task(void *__restrict userdata,
     }
   }
 
-  if (data->tex_target) {
-    texres.nor = NULL;
-    BKE_texture_get_value_ex(
-        data->scene, data->tex_target, tex_co[iter], &texres, data->pool, false);
+  if (data->tex_values) {
+    /* Values are pre-computed in batches, see #MOD_get_texture_values. */
+    texres = data->tex_values[iter];
     delta = texres.tin - dmd->midlevel;
   }
   else {
@@ -365,6 +364,13 @@ static void displaceModifier_do(DisplaceModifierData *dmd,
   if (tex_target != NULL) {
     data.pool = BKE_image_pool_new();
     BKE_texture_fetch_images_for_pool(tex_target, data.pool);
+
+    /* Evaluate the texture for all vertices up-front in batches. */
+    TexResult *tex_values = MEM_malloc_arrayN(
+        (size_t)numVerts, sizeof(*tex_values), "displaceModifier_do tex_values");
+    MOD_get_texture_values(
+        data.scene, tex_target, (const float(*)[3])tex_co, numVerts, data.pool, tex_values);
+    data.tex_values = tex_values;
   }
   TaskParallelSettings settings;
   BLI_parallel_range_settings_defaults(&settings);
@@ -375,6 +381,10 @@ static void displaceModifier_do(DisplaceModifierData *dmd,
     BKE_image_pool_free(data.pool);
   }
 
+  if (data.tex_values) {
+    MEM_freeN((void *)data.tex_values);
+  }
+
   if (tex_co) {
     MEM_freeN(tex_co);
   }
@@ -450,7 +450,7 @@ static void normalEditModifier_do_directional(NormalEditModifierData *enmd,
 
   if (do_polynors_fix &&
       polygons_check_flip(mloop, nos, &mesh->ldata, mpoly, polynors, num_polys)) {
-    mesh->runtime.cd_dirty_vert |= CD_MASK_NORMAL;
+    BKE_mesh_normals_tag_dirty(mesh);
   }
 
   BKE_mesh_normals_loop_custom_set(mvert,
@@ -567,6 +567,8 @@ static Mesh *normalEditModifier_do(NormalEditModifierData *enmd,
                              (result->runtime.cd_dirty_vert & CD_MASK_NORMAL) ? false : true);
 
   result->runtime.cd_dirty_vert &= ~CD_MASK_NORMAL;
+  result->runtime.dirty_normal_range_start = 0;
+  result->runtime.dirty_normal_range_len = 0;
 
   clnors = CustomData_get_layer(ldata, CD_CUSTOMLOOPNORMAL);
   if (use_current_clnors) {
@@ -151,7 +151,8 @@ static int subdiv_levels_for_modifier_get(const SubsurfModifierData *smd,
   Scene *scene = DEG_get_evaluated_scene(ctx->depsgraph);
   const bool use_render_params = (ctx->flag & MOD_APPLY_RENDER);
   const int requested_levels = (use_render_params) ? smd->renderLevels : smd->levels;
-  return get_render_subsurf_level(&scene->r, requested_levels, use_render_params);
+  return get_render_subsurf_level_for_object(
+      scene, ctx->object, requested_levels, use_render_params);
 }
 
 static void subdiv_settings_init(SubdivSettings *settings,
@@ -28,6 +28,7 @@
 #include "BLI_bitmap.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.h"
 
 #include "DNA_image_types.h"
 #include "DNA_mesh_types.h"
@@ -45,6 +46,7 @@
 #include "BKE_mesh.h"
 #include "BKE_mesh_wrapper.h"
 #include "BKE_object.h"
+#include "BKE_texture.h"
 
 #include "BKE_modifier.h"
 
@@ -54,6 +56,8 @@
 #include "MOD_modifiertypes.h"
 #include "MOD_util.h"
 
+#include "RE_texture.h"
+
 #include "MEM_guardedalloc.h"
 
 #include "bmesh.h"
@@ -168,6 +172,55 @@ void MOD_get_texture_coords(MappingInfoModifierData *dmd,
   }
 }
 
+/* Block size for batched texture evaluation, keeps tasks reasonably sized
+ * while amortizing the per-call setup in #BKE_texture_get_value_span. */
+#define MOD_TEXTURE_BATCH_SIZE 512
+
+typedef struct ModTextureValuesData {
+  const Scene *scene;
+  struct Tex *texture;
+  const float (*tex_co)[3];
+  int num_verts;
+  struct ImagePool *pool;
+  struct TexResult *r_values;
+} ModTextureValuesData;
+
+static void mod_get_texture_values_task(void *__restrict userdata,
+                                        const int block,
+                                        const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ModTextureValuesData *data = userdata;
+  const int start = block * MOD_TEXTURE_BATCH_SIZE;
+  const int num = min_ii(MOD_TEXTURE_BATCH_SIZE, data->num_verts - start);
+
+  BKE_texture_get_value_span(
+      data->scene, data->texture, &data->tex_co[start], &data->r_values[start], num, data->pool, false);
+}
+
+/** \param r_values: filled with one #TexResult per coordinate in \a tex_co. */
+void MOD_get_texture_values(const struct Scene *scene,
+                            struct Tex *texture,
+                            const float (*tex_co)[3],
+                            const int num_verts,
+                            struct ImagePool *pool,
+                            struct TexResult *r_values)
+{
+  ModTextureValuesData data = {
+      .scene = scene,
+      .texture = texture,
+      .tex_co = tex_co,
+      .num_verts = num_verts,
+      .pool = pool,
+      .r_values = r_values,
+  };
+  const int num_blocks = (num_verts + MOD_TEXTURE_BATCH_SIZE - 1) / MOD_TEXTURE_BATCH_SIZE;
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (num_blocks > 1);
+  BLI_task_parallel_range(0, num_blocks, &data, mod_get_texture_values_task, &settings);
+}
+
 void MOD_previous_vcos_store(ModifierData *md, const float (*vert_coords)[3])
 {
   while ((md = md->next) && md->type == eModifierType_Armature) {
@@ -25,11 +25,15 @@
 
 #include "DEG_depsgraph_build.h"
 
+struct ImagePool;
 struct MDeformVert;
 struct Mesh;
 struct ModifierData;
 struct ModifierEvalContext;
 struct Object;
+struct Scene;
+struct Tex;
+struct TexResult;
 
 void MOD_init_texture(struct MappingInfoModifierData *dmd, const struct ModifierEvalContext *ctx);
 void MOD_get_texture_coords(struct MappingInfoModifierData *dmd,
@@ -39,6 +43,13 @@ void MOD_get_texture_coords(struct MappingInfoModifierData *dmd,
                             float (*cos)[3],
                             float (*r_texco)[3]);
 
+void MOD_get_texture_values(const struct Scene *scene,
+                            struct Tex *texture,
+                            const float (*tex_co)[3],
+                            const int num_verts,
+                            struct ImagePool *pool,
+                            struct TexResult *r_values);
+
 void MOD_previous_vcos_store(struct ModifierData *md, const float (*vert_coords)[3]);
 
 struct Mesh *MOD_deform_mesh_eval_get(struct Object *ob,
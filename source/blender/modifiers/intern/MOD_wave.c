@@ -37,6 +37,7 @@
 #include "BKE_context.h"
 #include "BKE_deform.h"
 #include "BKE_editmesh.h"
+#include "BKE_image.h"
 #include "BKE_lib_id.h"
 #include "BKE_lib_query.h"
 #include "BKE_mesh.h"
@@ -198,11 +199,21 @@ static void waveModifier_do(WaveModifierData *md,
   }
 
   Tex *tex_target = wmd->texture;
-  if (mesh != NULL && tex_target != NULL) {
+  TexResult *tex_values = NULL;
+  if (mesh != NULL && tex_target != NULL && lifefac != 0.0f) {
     tex_co = MEM_malloc_arrayN(numVerts, sizeof(*tex_co), "waveModifier_do tex_co");
     MOD_get_texture_coords((MappingInfoModifierData *)wmd, ctx, ob, mesh, vertexCos, tex_co);
 
     MOD_init_texture((MappingInfoModifierData *)wmd, ctx);
+
+    /* Evaluate the texture for all vertices up-front in batches,
+     * this threads the sampling which otherwise runs in the serial loop below. */
+    Scene *scene = DEG_get_evaluated_scene(ctx->depsgraph);
+    struct ImagePool *pool = BKE_image_pool_new();
+    BKE_texture_fetch_images_for_pool(tex_target, pool);
+    tex_values = MEM_malloc_arrayN(numVerts, sizeof(*tex_values), "waveModifier_do tex_values");
+    MOD_get_texture_values(scene, tex_target, (const float(*)[3])tex_co, numVerts, pool, tex_values);
+    BKE_image_pool_free(pool);
   }
 
   if (lifefac != 0.0f) {
@@ -272,12 +283,8 @@ static void waveModifier_do(WaveModifierData *md,
         amplit = (float)(1.0f / expf(amplit * amplit) - minfac);
 
         /* Apply texture. */
-        if (tex_co) {
-          Scene *scene = DEG_get_evaluated_scene(ctx->depsgraph);
-          TexResult texres;
-          texres.nor = NULL;
-          BKE_texture_get_value(scene, tex_target, tex_co[i], &texres, false);
-          amplit *= texres.tin;
+        if (tex_values) {
+          amplit *= tex_values[i].tin;
         }
 
         /* Apply weight & falloff. */
@@ -304,6 +311,7 @@ static void waveModifier_do(WaveModifierData *md,
   }
 
   MEM_SAFE_FREE(tex_co);
+  MEM_SAFE_FREE(tex_values);
 }
 
 static void deformVerts(ModifierData *md,
@@ -18,6 +18,7 @@
 #include "NOD_type_conversions.hh"
 
 #include "FN_multi_function_network_evaluation.hh"
+#include "FN_multi_function_network_optimization.hh"
 
 #include "BLI_color.hh"
 #include "BLI_float2.hh"
@@ -403,6 +404,15 @@ MultiFunctionByNode get_multi_function_per_node(const DerivedNodeTree &tree, Res
     }
   });
 
+  /* Optimize the sub-networks referenced by the multi-node evaluators created above. Constant
+   * folding pre-computes constant subgraphs once at build time and common-subnetwork elimination
+   * makes duplicated subgraphs share a single computed value, so every later evaluation only pays
+   * for the non-constant, unique part of the network. The functions stored in the map are owned
+   * by `scope`, so removing the now dead network nodes is safe. */
+  fn::mf_network_optimization::constant_folding(network, scope);
+  fn::mf_network_optimization::common_subnetwork_elimination(network);
+  fn::mf_network_optimization::dead_node_removal(network);
+
   return functions_by_node;
 }
 
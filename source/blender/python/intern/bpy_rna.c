@@ -5362,6 +5362,36 @@ static bool foreach_compat_buffer(RawPropertyType raw_type, int attr_signed, con
   return 0;
 }
 
+/**
+ * Map a buffer format character to the raw type its data can be copied through.
+ * Used when #foreach_compat_buffer fails, so a typed buffer of the "wrong" type
+ * still gets a batch conversion in RNA instead of the per-element sequence loop.
+ */
+static RawPropertyType foreach_raw_type_from_buffer_format(const char *format)
+{
+  const char f = format ? *format : 'B'; /* B is assumed when not set */
+
+  switch (f) {
+    case 'b':
+    case 'B':
+      return PROP_RAW_CHAR;
+    case 'h':
+    case 'H':
+      return PROP_RAW_SHORT;
+    case 'i':
+    case 'I':
+      return PROP_RAW_INT;
+    case '?':
+      return PROP_RAW_BOOLEAN;
+    case 'f':
+      return PROP_RAW_FLOAT;
+    case 'd':
+      return PROP_RAW_DOUBLE;
+    default:
+      return PROP_RAW_UNSET;
+  }
+}
+
 static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
 {
   PyObject *item = NULL;
@@ -5399,6 +5429,17 @@ static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
         ok = RNA_property_collection_raw_set(
             NULL, &self->ptr, self->prop, attr, buf.buf, raw_type, tot);
       }
+      else {
+        /* Not an exact match: if the buffer still holds a raw type we know,
+         * hand it to RNA for a typed batch conversion. */
+        const RawPropertyType buf_type = foreach_raw_type_from_buffer_format(buf.format);
+        if ((buf_type != PROP_RAW_UNSET) &&
+            (buf.len == (Py_ssize_t)RNA_raw_type_sizeof(buf_type) * tot)) {
+          ok = RNA_property_collection_raw_set(
+              NULL, &self->ptr, self->prop, attr, buf.buf, buf_type, tot);
+          buffer_is_compat = true;
+        }
+      }
 
       PyBuffer_Release(&buf);
     }
@@ -5455,6 +5496,17 @@ static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
         ok = RNA_property_collection_raw_get(
             NULL, &self->ptr, self->prop, attr, buf.buf, raw_type, tot);
       }
+      else if (!buf.readonly) {
+        /* Not an exact match: if the buffer still holds a raw type we know,
+         * have RNA fill it through a typed batch conversion. */
+        const RawPropertyType buf_type = foreach_raw_type_from_buffer_format(buf.format);
+        if ((buf_type != PROP_RAW_UNSET) &&
+            (buf.len == (Py_ssize_t)RNA_raw_type_sizeof(buf_type) * tot)) {
+          ok = RNA_property_collection_raw_get(
+              NULL, &self->ptr, self->prop, attr, buf.buf, buf_type, tot);
+          buffer_is_compat = true;
+        }
+      }
 
       PyBuffer_Release(&buf);
     }
@@ -39,6 +39,8 @@
 #include "DNA_key_types.h"
 #include "DNA_object_types.h"
 
+#include "DEG_depsgraph.h"
+
 #include "WM_api.h"
 #include "WM_types.h"
 
@@ -348,6 +350,78 @@ error:
   return ret;
 }
 
+PyDoc_STRVAR(bpy_batch_update_tag_doc,
+             ".. method:: batch_update_tag(ids, refresh=set())\n"
+             "\n"
+             "   Tag several IDs to update at once, "
+             "see :func:`bpy.types.ID.update_tag`.\n"
+             "\n"
+             "   Note that this function is quicker than individual calls to "
+             ":func:`update_tag()` when tagging many IDs.\n"
+             "\n"
+             "   :arg ids: Iterables of IDs (types can be mixed).\n"
+             "   :type ids: sequence\n"
+             "   :arg refresh: Type of updates to perform, subset of {'OBJECT', 'DATA', 'TIME'}.\n"
+             "   :type refresh: set\n");
+static PyObject *bpy_batch_update_tag(PyObject *UNUSED(self), PyObject *args, PyObject *kwds)
+{
+#if 0 /* If someone knows how to get a proper 'self' in that case... */
+  BPy_StructRNA *pyrna = (BPy_StructRNA *)self;
+  Main *bmain = pyrna->ptr.data;
+#else
+  Main *bmain = G_MAIN; /* XXX Ugly, but should work! */
+#endif
+
+  /* Matches the "refresh" enum of `ID.update_tag`. */
+  static PyC_FlagSet refresh_flag_items[] = {
+      {ID_RECALC_TRANSFORM, "OBJECT"},
+      {ID_RECALC_GEOMETRY, "DATA"},
+      {ID_RECALC_ANIMATION, "TIME"},
+      {0, NULL},
+  };
+
+  PyObject *ids = NULL;
+  PyObject *refresh_set = NULL;
+
+  static const char *_keywords[] = {"ids", "refresh", NULL};
+  static _PyArg_Parser _parser = {"O|O!:batch_update_tag", _keywords, 0};
+  if (!_PyArg_ParseTupleAndKeywordsFast(args, kwds, &_parser, &ids, &PySet_Type, &refresh_set)) {
+    return NULL;
+  }
+
+  int flag = 0;
+  if (refresh_set != NULL &&
+      PyC_FlagSet_ToBitfield(refresh_flag_items, refresh_set, &flag, "batch_update_tag") == -1) {
+    return NULL;
+  }
+
+  PyObject *ids_fast = PySequence_Fast(ids, "batch_update_tag");
+  if (ids_fast == NULL) {
+    return NULL;
+  }
+
+  PyObject **ids_array = PySequence_Fast_ITEMS(ids_fast);
+  const Py_ssize_t ids_len = PySequence_Fast_GET_SIZE(ids_fast);
+  ID **id_array = MEM_mallocN(sizeof(ID *) * (size_t)ids_len, __func__);
+
+  for (Py_ssize_t i = 0; i < ids_len; i++) {
+    if (!pyrna_id_FromPyObject(ids_array[i], &id_array[i])) {
+      PyErr_Format(
+          PyExc_TypeError, "Expected an ID type, not %.200s", Py_TYPE(ids_array[i])->tp_name);
+      MEM_freeN(id_array);
+      Py_DECREF(ids_fast);
+      return NULL;
+    }
+  }
+  Py_DECREF(ids_fast);
+
+  DEG_ids_tag_update(bmain, id_array, (int)ids_len, flag);
+
+  MEM_freeN(id_array);
+
+  Py_RETURN_NONE;
+}
+
 PyDoc_STRVAR(bpy_orphans_purge_doc,
              ".. method:: orphans_purge()\n"
              "\n"
@@ -417,6 +491,12 @@ PyMethodDef BPY_rna_id_collection_batch_remove_method_def = {
     METH_STATIC | METH_VARARGS | METH_KEYWORDS,
     bpy_batch_remove_doc,
 };
+PyMethodDef BPY_rna_id_collection_batch_update_tag_method_def = {
+    "batch_update_tag",
+    (PyCFunction)bpy_batch_update_tag,
+    METH_STATIC | METH_VARARGS | METH_KEYWORDS,
+    bpy_batch_update_tag_doc,
+};
 PyMethodDef BPY_rna_id_collection_orphans_purge_method_def = {
     "orphans_purge",
     (PyCFunction)bpy_orphans_purge,
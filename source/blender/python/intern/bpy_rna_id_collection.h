@@ -26,6 +26,7 @@ extern "C" {
 
 extern PyMethodDef BPY_rna_id_collection_user_map_method_def;
 extern PyMethodDef BPY_rna_id_collection_batch_remove_method_def;
+extern PyMethodDef BPY_rna_id_collection_batch_update_tag_method_def;
 extern PyMethodDef BPY_rna_id_collection_orphans_purge_method_def;
 
 #ifdef __cplusplus
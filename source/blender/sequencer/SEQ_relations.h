@@ -60,6 +60,12 @@ void SEQ_relations_check_uuids_unique_and_report(const struct Scene *scene);
 void SEQ_relations_session_uuid_generate(struct Sequence *sequence);
 
 void SEQ_cache_cleanup(struct Scene *scene);
+/* Aggregate memory usage and hit/miss/eviction counters of all sequencer RAM caches, for
+ * display in the UI and debugging. */
+void SEQ_cache_stats_get(size_t *r_mem_in_use,
+                         size_t *r_hit_count,
+                         size_t *r_miss_count,
+                         size_t *r_eviction_count);
 void SEQ_cache_iterate(
     struct Scene *scene,
     void *userdata,
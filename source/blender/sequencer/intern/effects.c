@@ -35,6 +35,7 @@
 #include "BLI_path_util.h"
 #include "BLI_rect.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -2176,11 +2177,15 @@ static void copy_wipe_effect(Sequence *dst, Sequence *src, const int UNUSED(flag
   dst->effectdata = MEM_dupallocN(src->effectdata);
 }
 
+/* The wipe zone is computed from absolute pixel coordinates, so the full image size is passed
+ * along with the (already offset) buffers of the rendered slice. */
 static void do_wipe_effect_byte(Sequence *seq,
                                 float facf0,
                                 float UNUSED(facf1),
                                 int x,
                                 int y,
+                                int start_line,
+                                int total_lines,
                                 unsigned char *rect1,
                                 unsigned char *rect2,
                                 unsigned char *out)
@@ -2197,8 +2202,8 @@ static void do_wipe_effect_byte(Sequence *seq,
   rt = out;
 
   xo = x;
-  yo = y;
-  for (y = 0; y < yo; y++) {
+  yo = start_line + total_lines;
+  for (y = start_line; y < yo; y++) {
     for (x = 0; x < xo; x++) {
       float check = check_zone(&wipezone, x, y, seq, facf0);
       if (check) {
@@ -2253,6 +2258,8 @@ static void do_wipe_effect_float(Sequence *seq,
                                  float UNUSED(facf1),
                                  int x,
                                  int y,
+                                 int start_line,
+                                 int total_lines,
                                  float *rect1,
                                  float *rect2,
                                  float *out)
@@ -2269,8 +2276,8 @@ static void do_wipe_effect_float(Sequence *seq,
   rt = out;
 
   xo = x;
-  yo = y;
-  for (y = 0; y < yo; y++) {
+  yo = start_line + total_lines;
+  for (y = start_line; y < yo; y++) {
     for (x = 0; x < xo; x++) {
       float check = check_zone(&wipezone, x, y, seq, facf0);
       if (check) {
@@ -2313,39 +2320,52 @@ static void do_wipe_effect_float(Sequence *seq,
   }
 }
 
-static ImBuf *do_wipe_effect(const SeqRenderData *context,
-                             Sequence *seq,
-                             float UNUSED(timeline_frame),
-                             float facf0,
-                             float facf1,
-                             ImBuf *ibuf1,
-                             ImBuf *ibuf2,
-                             ImBuf *ibuf3)
+static void do_wipe_effect(const SeqRenderData *context,
+                           Sequence *seq,
+                           float UNUSED(timeline_frame),
+                           float facf0,
+                           float facf1,
+                           ImBuf *ibuf1,
+                           ImBuf *ibuf2,
+                           ImBuf *UNUSED(ibuf3),
+                           int start_line,
+                           int total_lines,
+                           ImBuf *out)
 {
-  ImBuf *out = prepare_effect_imbufs(context, ibuf1, ibuf2, ibuf3);
-
   if (out->rect_float) {
+    float *rect1 = NULL, *rect2 = NULL, *rect_out = NULL;
+
+    slice_get_float_buffers(
+        context, ibuf1, ibuf2, NULL, out, start_line, &rect1, &rect2, NULL, &rect_out);
+
     do_wipe_effect_float(seq,
                          facf0,
                          facf1,
                          context->rectx,
                          context->recty,
-                         ibuf1->rect_float,
-                         ibuf2->rect_float,
-                         out->rect_float);
+                         start_line,
+                         total_lines,
+                         rect1,
+                         rect2,
+                         rect_out);
   }
   else {
+    unsigned char *rect1 = NULL, *rect2 = NULL, *rect_out = NULL;
+
+    slice_get_byte_buffers(
+        context, ibuf1, ibuf2, NULL, out, start_line, &rect1, &rect2, NULL, &rect_out);
+
     do_wipe_effect_byte(seq,
                         facf0,
                         facf1,
                         context->rectx,
                         context->recty,
-                        (unsigned char *)ibuf1->rect,
-                        (unsigned char *)ibuf2->rect,
-                        (unsigned char *)out->rect);
+                        start_line,
+                        total_lines,
+                        rect1,
+                        rect2,
+                        rect_out);
   }
-
-  return out;
 }
 
 /*********************** Transform *************************/
@@ -2503,6 +2523,118 @@ static void do_transform_effect(const SeqRenderData *context,
 
 /*********************** Glow *************************/
 
+/* Shared data of the parallel blur passes. Each row (or column) only reads from `map` and writes
+ * its own pixels of `temp`, so rows/columns can be processed concurrently. */
+typedef struct GlowBlurData {
+  const float *map;
+  float *temp;
+  const float *filter;
+  int width, height;
+  int halfWidth;
+} GlowBlurData;
+
+static void glow_blur_rows_fn(void *__restrict userdata,
+                              const int y,
+                              const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const GlowBlurData *blur = userdata;
+  const float *map = blur->map;
+  float *temp = blur->temp;
+  const float *filter = blur->filter;
+  const int width = blur->width;
+  const int halfWidth = blur->halfWidth;
+  float curColor[4], curColor2[4];
+  int x, i, fx, index;
+
+  /* Do the left & right strips */
+  for (x = 0; x < halfWidth; x++) {
+    fx = 0;
+    zero_v4(curColor);
+    zero_v4(curColor2);
+
+    for (i = x - halfWidth; i < x + halfWidth; i++) {
+      if ((i >= 0) && (i < width)) {
+        index = (i + y * width) * 4;
+        madd_v4_v4fl(curColor, map + index, filter[fx]);
+
+        index = (width - 1 - i + y * width) * 4;
+        madd_v4_v4fl(curColor2, map + index, filter[fx]);
+      }
+      fx++;
+    }
+    index = (x + y * width) * 4;
+    copy_v4_v4(temp + index, curColor);
+
+    index = (width - 1 - x + y * width) * 4;
+    copy_v4_v4(temp + index, curColor2);
+  }
+
+  /* Do the main body */
+  for (x = halfWidth; x < width - halfWidth; x++) {
+    fx = 0;
+    zero_v4(curColor);
+    for (i = x - halfWidth; i < x + halfWidth; i++) {
+      index = (i + y * width) * 4;
+      madd_v4_v4fl(curColor, map + index, filter[fx]);
+      fx++;
+    }
+    index = (x + y * width) * 4;
+    copy_v4_v4(temp + index, curColor);
+  }
+}
+
+static void glow_blur_cols_fn(void *__restrict userdata,
+                              const int x,
+                              const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const GlowBlurData *blur = userdata;
+  const float *map = blur->map;
+  float *temp = blur->temp;
+  const float *filter = blur->filter;
+  const int width = blur->width;
+  const int height = blur->height;
+  const int halfWidth = blur->halfWidth;
+  float curColor[4], curColor2[4];
+  int y, i, fy, index;
+
+  /* Do the top & bottom strips */
+  for (y = 0; y < halfWidth; y++) {
+    fy = 0;
+    zero_v4(curColor);
+    zero_v4(curColor2);
+    for (i = y - halfWidth; i < y + halfWidth; i++) {
+      if ((i >= 0) && (i < height)) {
+        /* Bottom */
+        index = (x + i * width) * 4;
+        madd_v4_v4fl(curColor, map + index, filter[fy]);
+
+        /* Top */
+        index = (x + (height - 1 - i) * width) * 4;
+        madd_v4_v4fl(curColor2, map + index, filter[fy]);
+      }
+      fy++;
+    }
+    index = (x + y * width) * 4;
+    copy_v4_v4(temp + index, curColor);
+
+    index = (x + (height - 1 - y) * width) * 4;
+    copy_v4_v4(temp + index, curColor2);
+  }
+
+  /* Do the main body */
+  for (y = halfWidth; y < height - halfWidth; y++) {
+    fy = 0;
+    zero_v4(curColor);
+    for (i = y - halfWidth; i < y + halfWidth; i++) {
+      index = (x + i * width) * 4;
+      madd_v4_v4fl(curColor, map + index, filter[fy]);
+      fy++;
+    }
+    index = (x + y * width) * 4;
+    copy_v4_v4(temp + index, curColor);
+  }
+}
+
 static void RVBlurBitmap2_float(float *map, int width, int height, float blur, int quality)
 {
   /* Much better than the previous blur!
@@ -2514,9 +2646,8 @@ static void RVBlurBitmap2_float(float *map, int width, int height, float blur, i
 
   float *temp = NULL, *swap;
   float *filter = NULL;
-  int x, y, i, fx, fy;
-  int index, ix, halfWidth;
-  float fval, k, curColor[4], curColor2[4], weight = 0;
+  int ix, halfWidth;
+  float fval, k, weight = 0;
 
   /* If we're not really blurring, bail out */
   if (blur <= 0) {
@@ -2561,44 +2692,19 @@ static void RVBlurBitmap2_float(float *map, int width, int height, float blur, i
     filter[ix] /= fval;
   }
 
-  /* Blur the rows */
-  for (y = 0; y < height; y++) {
-    /* Do the left & right strips */
-    for (x = 0; x < halfWidth; x++) {
-      fx = 0;
-      zero_v4(curColor);
-      zero_v4(curColor2);
-
-      for (i = x - halfWidth; i < x + halfWidth; i++) {
-        if ((i >= 0) && (i < width)) {
-          index = (i + y * width) * 4;
-          madd_v4_v4fl(curColor, map + index, filter[fx]);
-
-          index = (width - 1 - i + y * width) * 4;
-          madd_v4_v4fl(curColor2, map + index, filter[fx]);
-        }
-        fx++;
-      }
-      index = (x + y * width) * 4;
-      copy_v4_v4(temp + index, curColor);
+  GlowBlurData blur_data;
+  blur_data.filter = filter;
+  blur_data.width = width;
+  blur_data.height = height;
+  blur_data.halfWidth = halfWidth;
 
-      index = (width - 1 - x + y * width) * 4;
-      copy_v4_v4(temp + index, curColor2);
-    }
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
 
-    /* Do the main body */
-    for (x = halfWidth; x < width - halfWidth; x++) {
-      fx = 0;
-      zero_v4(curColor);
-      for (i = x - halfWidth; i < x + halfWidth; i++) {
-        index = (i + y * width) * 4;
-        madd_v4_v4fl(curColor, map + index, filter[fx]);
-        fx++;
-      }
-      index = (x + y * width) * 4;
-      copy_v4_v4(temp + index, curColor);
-    }
-  }
+  /* Blur the rows */
+  blur_data.map = map;
+  blur_data.temp = temp;
+  BLI_task_parallel_range(0, height, &blur_data, glow_blur_rows_fn, &settings);
 
   /* Swap buffers */
   swap = temp;
@@ -2606,44 +2712,9 @@ static void RVBlurBitmap2_float(float *map, int width, int height, float blur, i
   map = swap;
 
   /* Blur the columns */
-  for (x = 0; x < width; x++) {
-    /* Do the top & bottom strips */
-    for (y = 0; y < halfWidth; y++) {
-      fy = 0;
-      zero_v4(curColor);
-      zero_v4(curColor2);
-      for (i = y - halfWidth; i < y + halfWidth; i++) {
-        if ((i >= 0) && (i < height)) {
-          /* Bottom */
-          index = (x + i * width) * 4;
-          madd_v4_v4fl(curColor, map + index, filter[fy]);
-
-          /* Top */
-          index = (x + (height - 1 - i) * width) * 4;
-          madd_v4_v4fl(curColor2, map + index, filter[fy]);
-        }
-        fy++;
-      }
-      index = (x + y * width) * 4;
-      copy_v4_v4(temp + index, curColor);
-
-      index = (x + (height - 1 - y) * width) * 4;
-      copy_v4_v4(temp + index, curColor2);
-    }
-
-    /* Do the main body */
-    for (y = halfWidth; y < height - halfWidth; y++) {
-      fy = 0;
-      zero_v4(curColor);
-      for (i = y - halfWidth; i < y + halfWidth; i++) {
-        index = (x + i * width) * 4;
-        madd_v4_v4fl(curColor, map + index, filter[fy]);
-        fy++;
-      }
-      index = (x + y * width) * 4;
-      copy_v4_v4(temp + index, curColor);
-    }
-  }
+  blur_data.map = map;
+  blur_data.temp = temp;
+  BLI_task_parallel_range(0, width, &blur_data, glow_blur_cols_fn, &settings);
 
   /* Swap buffers */
   swap = temp;
@@ -4204,13 +4275,14 @@ static struct SeqEffectHandle get_sequence_effect_impl(int seq_type)
       rval.execute_slice = do_alphaunder_effect;
       break;
     case SEQ_TYPE_WIPE:
+      rval.multithreaded = true;
       rval.init = init_wipe_effect;
       rval.num_inputs = num_inputs_wipe;
       rval.free = free_wipe_effect;
       rval.copy = copy_wipe_effect;
       rval.early_out = early_out_fade;
       rval.get_default_fac = get_default_fac_fade;
-      rval.execute = do_wipe_effect;
+      rval.execute_slice = do_wipe_effect;
       break;
     case SEQ_TYPE_GLOW:
       rval.init = init_glow_effect;
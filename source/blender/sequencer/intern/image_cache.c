@@ -24,8 +24,11 @@
 #include <stddef.h>
 #include <time.h>
 
+#include "MEM_CacheLimiterC-Api.h"
 #include "MEM_guardedalloc.h"
 
+#include "atomic_ops.h"
+
 #include "DNA_scene_types.h"
 #include "DNA_sequence_types.h"
 #include "DNA_space_types.h" /* for FILE_MAX. */
@@ -172,6 +175,16 @@ typedef struct SeqCacheKey {
 } SeqCacheKey;
 
 static ThreadMutex cache_create_lock = BLI_MUTEX_INITIALIZER;
+
+/* Memory used by all sequencer RAM caches. Reported to the cache limiter so other image caches
+ * leave room for sequencer frames within the shared #UserDef.memcachelimit budget. */
+static size_t cache_mem_in_use = 0;
+
+/* Instrumentation, queryable from the UI through #SEQ_cache_stats_get(). */
+static size_t cache_stats_hit_count = 0;
+static size_t cache_stats_miss_count = 0;
+static size_t cache_stats_eviction_count = 0;
+
 static float seq_cache_timeline_frame_to_frame_index(Sequence *seq,
                                                      float timeline_frame,
                                                      int type);
@@ -810,6 +823,22 @@ static size_t seq_cache_get_mem_total(void)
   return ((size_t)U.memcachelimit) * 1024 * 1024;
 }
 
+static size_t seq_cache_item_size_get(const SeqCacheItem *item)
+{
+  size_t size = sizeof(SeqCacheItem);
+
+  if (item->ibuf) {
+    size += IMB_get_size_in_memory(item->ibuf);
+  }
+
+  return size;
+}
+
+static size_t seq_cache_external_usage_get(void)
+{
+  return cache_mem_in_use;
+}
+
 static void seq_cache_keyfree(void *val)
 {
   SeqCacheKey *key = val;
@@ -820,6 +849,8 @@ static void seq_cache_valfree(void *val)
 {
   SeqCacheItem *item = (SeqCacheItem *)val;
 
+  atomic_sub_and_fetch_z(&cache_mem_in_use, seq_cache_item_size_get(item));
+
   if (item->ibuf) {
     IMB_freeImBuf(item->ibuf);
   }
@@ -851,6 +882,8 @@ static void seq_cache_put_ex(Scene *scene, SeqCacheKey *key, ImBuf *ibuf)
   item->cache_owner = cache;
   item->ibuf = ibuf;
 
+  atomic_add_and_fetch_z(&cache_mem_in_use, seq_cache_item_size_get(item));
+
   const int stored_types_flag = get_stored_types_flag(scene, key);
 
   /* Item stored for later use. */
@@ -991,6 +1024,7 @@ static void seq_cache_recycle_linked(Scene *scene, SeqCacheKey *base)
     }
 
     BLI_ghash_remove(cache->hash, base, seq_cache_keyfree, seq_cache_valfree);
+    atomic_add_and_fetch_z(&cache_stats_eviction_count, 1);
     base = prev;
   }
 
@@ -1008,6 +1042,7 @@ static void seq_cache_recycle_linked(Scene *scene, SeqCacheKey *base)
     }
 
     BLI_ghash_remove(cache->hash, base, seq_cache_keyfree, seq_cache_valfree);
+    atomic_add_and_fetch_z(&cache_stats_eviction_count, 1);
     base = next;
   }
 }
@@ -1154,6 +1189,10 @@ static void seq_cache_create(Main *bmain, Scene *scene)
     BLI_mutex_init(&cache->iterator_mutex);
     scene->ed->cache = cache;
 
+    /* Let the cache limiter account for sequencer frames, so movie-clip and image caches don't
+     * assume they own the whole memory budget. */
+    MEM_CacheLimiter_set_external_usage_func(seq_cache_external_usage_get);
+
     if (scene->ed->disk_cache_timestamp == 0) {
       scene->ed->disk_cache_timestamp = time(NULL);
     }
@@ -1370,6 +1409,13 @@ struct ImBuf *seq_cache_get(const SeqRenderData *context,
   if (cache && seq) {
     seq_cache_populate_key(&key, context, seq, timeline_frame, type);
     ibuf = seq_cache_get_ex(cache, &key);
+
+    if (ibuf) {
+      atomic_add_and_fetch_z(&cache_stats_hit_count, 1);
+    }
+    else {
+      atomic_add_and_fetch_z(&cache_stats_miss_count, 1);
+    }
   }
   seq_cache_unlock(scene);
 
@@ -1505,3 +1551,14 @@ bool seq_cache_is_full(void)
 {
   return seq_cache_get_mem_total() < MEM_get_memory_in_use();
 }
+
+void SEQ_cache_stats_get(size_t *r_mem_in_use,
+                         size_t *r_hit_count,
+                         size_t *r_miss_count,
+                         size_t *r_eviction_count)
+{
+  *r_mem_in_use = cache_mem_in_use;
+  *r_hit_count = cache_stats_hit_count;
+  *r_miss_count = cache_stats_miss_count;
+  *r_eviction_count = cache_stats_eviction_count;
+}
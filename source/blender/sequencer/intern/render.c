@@ -37,6 +37,7 @@
 #include "BLI_linklist.h"
 #include "BLI_listbase.h"
 #include "BLI_path_util.h"
+#include "BLI_profile.h"
 #include "BLI_rect.h"
 
 #include "BKE_anim_data.h"
@@ -1749,7 +1750,9 @@ ImBuf *seq_render_strip(const SeqRenderData *context,
   }
 
   if (ibuf == NULL) {
+    BLI_PROFILE_SCOPE_BEGIN(seq->name + 2);
     ibuf = do_render_strip_uncached(context, state, seq, timeline_frame, &is_proxy_image);
+    BLI_PROFILE_SCOPE_END();
   }
 
   if (ibuf) {
@@ -36,6 +36,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_alloca.h"
 #include "BLI_blenlib.h"
 #include "BLI_utildefines.h"
 
@@ -1039,6 +1040,12 @@ void wm_draw_update(bContext *C)
   GPU_context_main_lock();
   BKE_image_free_unused_gpu_textures();
 
+  /* First decide which windows need to be redrawn: how many there are determines which of the
+   * swaps below may wait for the display, so this can't be folded into the draw loop. */
+  wmWindow **draw_windows = BLI_array_alloca(draw_windows,
+                                             (size_t)BLI_listbase_count(&wm->windows));
+  int draw_windows_len = 0;
+
   LISTBASE_FOREACH (wmWindow *, win, &wm->windows) {
 #ifdef WIN32
     GHOST_TWindowState state = GHOST_GetWindowState(win->ghostwin);
@@ -1055,18 +1062,42 @@ void wm_draw_update(bContext *C)
     CTX_wm_window_set(C, win);
 
     if (wm_draw_update_test_window(bmain, C, win)) {
-      bScreen *screen = WM_window_get_active_screen(win);
-
-      /* sets context window+screen */
-      wm_window_make_drawable(wm, win);
+      draw_windows[draw_windows_len++] = win;
+    }
+  }
 
-      /* notifiers for screen redraw */
-      ED_screen_ensure_updated(wm, win, screen);
+  for (int i = 0; i < draw_windows_len; i++) {
+    wmWindow *win = draw_windows[i];
+    bScreen *screen = WM_window_get_active_screen(win);
 
-      wm_draw_window(C, win);
-      wm_draw_update_clear_window(C, win);
+    CTX_wm_window_set(C, win);
 
-      wm_window_swap_buffers(win);
+    /* sets context window+screen */
+    wm_window_make_drawable(wm, win);
+
+    /* notifiers for screen redraw */
+    ED_screen_ensure_updated(wm, win, screen);
+
+    wm_draw_window(C, win);
+    wm_draw_update_clear_window(C, win);
+
+    /* Only the last presented swap of this pass waits for the display. Window drawing is
+     * serialized on the main thread, so when multiple windows are redrawn in the same pass
+     * (e.g. playback on one display with UI updates on another), every additional vsync wait
+     * would add a whole refresh interval, dividing the effective frame rate by the number of
+     * redrawn windows. The wait is disabled only for the duration of the earlier swaps and
+     * the window's own interval is restored right after, so a user's or driver's vsync
+     * setting is never overridden. */
+    int swap_interval = 0;
+    const bool disable_wait = (i != draw_windows_len - 1) &&
+                              wm_window_get_swap_interval(win, &swap_interval) &&
+                              (swap_interval != 0);
+    if (disable_wait) {
+      wm_window_set_swap_interval(win, 0);
+    }
+    wm_window_swap_buffers(win);
+    if (disable_wait) {
+      wm_window_set_swap_interval(win, swap_interval);
     }
   }
 
@@ -3353,6 +3353,18 @@ void wm_event_do_handlers(bContext *C)
         continue;
       }
 
+      /* In-between mouse-move events only exist to provide motion history to handlers that
+       * track continuous motion: modal operators (paint, sculpt, gestures) and active UI button
+       * states, which all live in `win->modalhandlers`. Without any modal handler the in-between
+       * positions cannot be used by anything, while high frequency tablets can queue up hundreds
+       * of them per redraw; skip them instead of running the full dispatch logic for every one.
+       * The up to date cursor position is handled by the #MOUSEMOVE event that always follows. */
+      if (event->type == INBETWEEN_MOUSEMOVE && BLI_listbase_is_empty(&win->modalhandlers)) {
+        BLI_remlink(&win->event_queue, event);
+        wm_event_free(event);
+        continue;
+      }
+
       CTX_wm_window_set(C, win);
 
       /* Clear tool-tip on mouse move. */
@@ -131,6 +131,7 @@
 #endif
 
 #include "DEG_depsgraph.h"
+#include "DEG_depsgraph_build.h"
 
 #include "WM_api.h"
 #include "WM_message.h"
@@ -588,6 +589,9 @@ static void wm_file_read_pre(bContext *C, bool use_data, bool UNUSED(use_userdef
   if (use_data) {
     BKE_callback_exec_null(CTX_data_main(C), BKE_CB_EVT_LOAD_PRE);
     BLI_timer_on_file_load();
+
+    /* A graph pre-built for the previous file must not outlive its Main. */
+    DEG_graph_warm_build_discard();
   }
 
   /* Always do this as both startup and preferences may have loaded in many font's
@@ -615,6 +619,18 @@ static void wm_file_read_post(bContext *C,
       wm_window_ghostwindows_remove_invalid(C, wm);
     }
     CTX_wm_window_set(C, wm->windows.first);
+
+    /* Start building the dependency graph of the active scene in the background, overlapping it
+     * with the Python reset and add-on initialization below which do not touch scene data. It is
+     * joined again before the load-post callbacks, which may. */
+    wmWindow *win = wm->windows.first;
+    if (win != NULL) {
+      Scene *scene = WM_window_get_active_scene(win);
+      ViewLayer *view_layer = WM_window_get_active_view_layer(win);
+      if (scene != NULL && view_layer != NULL) {
+        DEG_graph_warm_build_start(CTX_data_main(C), scene, view_layer);
+      }
+    }
   }
 
 #ifdef WITH_PYTHON
@@ -671,6 +687,11 @@ static void wm_file_read_post(bContext *C,
   }
 
   if (use_data) {
+    /* The callbacks below may modify scene data, the background relations build must be done
+     * before they run. The pre-built graph is adopted on the first depsgraph request, see
+     * #BKE_scene_ensure_depsgraph. */
+    DEG_graph_warm_build_wait();
+
     /* important to do before NULL'ing the context */
     BKE_callback_exec_null(bmain, BKE_CB_EVT_VERSION_UPDATE);
     BKE_callback_exec_null(bmain, BKE_CB_EVT_LOAD_POST);
@@ -863,7 +884,11 @@ bool WM_file_read(bContext *C, const char *filepath, ReportList *reports)
         /* Loading preferences when the user intended to load a regular file is a security
          * risk, because the excluded path list is also loaded. Further it's just confusing
          * if a user loads a file and various preferences change. */
-        .skip_flags = BLO_READ_SKIP_USERDEF,
+        .skip_flags = BLO_READ_SKIP_USERDEF |
+                      /* In background mode the file's UI is never set up, so its
+                       * window-manager, screen and workspace data-blocks would only be read to
+                       * be discarded again, skip them (keeping the current session's ones). */
+                      (G.background ? BLO_READ_SKIP_UI : 0),
     };
 
     BlendFileReadReport bf_reports = {.reports = reports,
@@ -1536,6 +1561,7 @@ static ImBuf *blend_file_thumb(const bContext *C,
                                           NULL,
                                           true,
                                           NULL,
+                                          NULL,
                                           err_out);
   }
 
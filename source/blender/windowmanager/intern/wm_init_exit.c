@@ -135,6 +135,7 @@
 #include "COM_compositor.h"
 
 #include "DEG_depsgraph.h"
+#include "DEG_depsgraph_build.h"
 #include "DEG_depsgraph_query.h"
 
 #include "DRW_engine.h"
@@ -570,6 +571,10 @@ void WM_exit_ex(bContext *C, const bool do_python)
   RE_FreeAllRender();
   RE_engines_exit();
 
+  /* A depsgraph pre-built on file load that was never adopted by a scene
+   * must not outlive the Main it was built from. */
+  DEG_graph_warm_build_discard();
+
   ED_preview_free_dbase(); /* frees a Main dbase, before BKE_blender_free! */
   ED_assetlist_storage_exit();
 
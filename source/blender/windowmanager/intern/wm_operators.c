@@ -3313,12 +3313,52 @@ static void WM_OT_redraw_timer(wmOperatorType *ot)
  * Use for testing/debugging.
  * \{ */
 
-static int memory_statistics_exec(bContext *UNUSED(C), wmOperator *UNUSED(op))
+/* Number of data-blocks listed in the per data-block breakdown. */
+#define MEMORY_STATISTICS_MAX_IDS 32
+
+static int memory_statistics_exec(bContext *C, wmOperator *UNUSED(op))
 {
   MEM_printmemlist_stats();
+
+  /* Top memory users per data-block, from the same estimate as `ID.memory_usage`. */
+  Main *bmain = CTX_data_main(C);
+  ID *top_ids[MEMORY_STATISTICS_MAX_IDS];
+  size_t top_sizes[MEMORY_STATISTICS_MAX_IDS];
+  int top_len = 0;
+
+  ID *id;
+  FOREACH_MAIN_ID_BEGIN (bmain, id) {
+    const size_t size = BKE_libblock_memory_usage_estimate(id);
+    int i = top_len;
+    if (i == MEMORY_STATISTICS_MAX_IDS) {
+      if (size <= top_sizes[i - 1]) {
+        continue;
+      }
+      i--;
+    }
+    while (i > 0 && size > top_sizes[i - 1]) {
+      top_ids[i] = top_ids[i - 1];
+      top_sizes[i] = top_sizes[i - 1];
+      i--;
+    }
+    top_ids[i] = id;
+    top_sizes[i] = size;
+    if (top_len < MEMORY_STATISTICS_MAX_IDS) {
+      top_len++;
+    }
+  }
+  FOREACH_MAIN_ID_END;
+
+  printf("\ntop data-blocks by estimated memory usage:\n");
+  for (int i = 0; i < top_len; i++) {
+    printf("%10.3f MB : %s\n", (double)top_sizes[i] / (1024.0 * 1024.0), top_ids[i]->name);
+  }
+
   return OPERATOR_FINISHED;
 }
 
+#undef MEMORY_STATISTICS_MAX_IDS
+
 static void WM_OT_memory_statistics(wmOperatorType *ot)
 {
   ot->name = "Memory Statistics";
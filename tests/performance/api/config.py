@@ -139,16 +139,21 @@ class TestConfig:
         return "Unknown"
 
     @staticmethod
-    def write_default_config(env, config_dir: pathlib.Path) -> None:
+    def write_default_config(env, config_dir: pathlib.Path, blender_executable: pathlib.Path=None) -> None:
         config_dir.mkdir(parents=True, exist_ok=True)
 
         default_config = """devices = ['CPU']\n"""
         default_config += """tests = ['*']\n"""
         default_config += """categories = ['*']\n"""
-        default_config += """builds = {\n"""
-        default_config += """    'master': '/home/user/blender-git/build/bin/blender',"""
-        default_config += """    '2.93': '/home/user/blender-2.93/blender',"""
-        default_config += """}\n"""
+        if blender_executable is not None:
+            default_config += """builds = {\n"""
+            default_config += f"""    'current': '{blender_executable}',\n"""
+            default_config += """}\n"""
+        else:
+            default_config += """builds = {\n"""
+            default_config += """    'master': '/home/user/blender-git/build/bin/blender',"""
+            default_config += """    '2.93': '/home/user/blender-2.93/blender',"""
+            default_config += """}\n"""
         default_config += """revisions = {\n"""
         default_config += """}\n"""
 
@@ -38,7 +38,7 @@ class TestEnvironment:
 
         return self.machine
 
-    def init(self, build) -> None:
+    def init(self, build, blender_executable: pathlib.Path=None) -> None:
         if not self.benchmarks_dir.exists():
             sys.stderr.write(f'Error: benchmark files directory not found at {self.benchmarks_dir}')
             sys.exit(1)
@@ -47,10 +47,12 @@ class TestEnvironment:
         print(f'Init {self.base_dir}')
         self.base_dir.mkdir(parents=True, exist_ok=True)
 
-        if len(self.get_configs_names()) == 0:
+        # When an executable is given, (re)write the default configuration to
+        # benchmark it, so automated runs always test the requested build.
+        if len(self.get_config_names()) == 0 or blender_executable is not None:
             config_dir = self.base_dir / 'default'
             print(f'Creating default configuration in {config_dir}')
-            TestConfig.write_default_config(self, config_dir)
+            TestConfig.write_default_config(self, config_dir, blender_executable)
 
         if build:
             if not self.lib_dir.exists():
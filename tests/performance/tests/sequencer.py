@@ -0,0 +1,47 @@
+# Apache License, Version 2.0
+
+import api
+import os
+
+
+def _run(args):
+    import bpy
+    import time
+
+    scene = bpy.context.scene
+    scene.render.use_compositing = False
+    scene.render.use_sequencer = True
+
+    # Render every frame through the sequencer once, with cold caches, to
+    # measure strip rendering throughput rather than cache performance.
+    start_time = time.time()
+    num_frames = 0
+    for frame in range(scene.frame_start, scene.frame_end + 1):
+        scene.frame_set(frame)
+        bpy.ops.render.render()
+        num_frames += 1
+    elapsed_time = time.time() - start_time
+
+    result = {'time': elapsed_time, 'frames_per_second': num_frames / elapsed_time}
+    return result
+
+
+class SequencerTest(api.Test):
+    def __init__(self, filepath):
+        self.filepath = filepath
+
+    def name(self):
+        return self.filepath.stem
+
+    def category(self):
+        return "sequencer"
+
+    def run(self, env, device_id):
+        args = {}
+        result, _ = env.run_in_blender(_run, args, [self.filepath])
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('sequencer')
+    return [SequencerTest(filepath) for filepath in filepaths]